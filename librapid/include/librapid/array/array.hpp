@@ -4,15 +4,28 @@
 #include "sizetype.hpp"
 #include "strideTools.hpp"
 #include "storage.hpp"
+#include "rankedShape.hpp"
+#include "bitStorage.hpp"
+#include "mappedStorage.hpp"
 #include "cudaStorage.hpp"
 #include "arrayTypeDef.hpp"
 #include "commaInitializer.hpp"
+#include "serialize.hpp"
+#include "npy.hpp"
+#include "csv.hpp"
 #include "arrayContainer.hpp"
 #include "operations.hpp"
 #include "function.hpp"
 #include "assignOps.hpp"
+#include "fill.hpp"
 #include "arrayView.hpp"
 #include "arrayViewString.hpp"
 #include "arrayFromData.hpp"
+#include "sparseArray.hpp"
+#include "sort.hpp"
+#include "scan.hpp"
+#include "fft.hpp"
+#include "indexing.hpp"
+#include "fixedMatrix.hpp"
 
 #endif // LIBRAPID_ARRAY
\ No newline at end of file
@@ -17,19 +17,70 @@ namespace librapid {
 			template<typename T>
 			struct IsArrayContainer : std::false_type {};
 
-			template<typename SizeType, size_t dims, typename StorageScalar>
-			struct IsArrayContainer<array::ArrayContainer<Shape<SizeType, dims>, StorageScalar>>
+			template<typename ShapeType, typename StorageScalar>
+			struct IsArrayContainer<array::ArrayContainer<ShapeType, StorageScalar>>
 					: std::true_type {};
 		} // namespace typetraits
 	}	  // namespace typetraits
 
+	namespace detail {
+		/// Evaluates as true if combining a \p Scalar with an arithmetic value of type \p T
+		/// promotes to a type other than \p Scalar (for example, an integer array multiplied
+		/// by a double). In-place operations with such a value must be evaluated in the
+		/// promoted type and only the result cast back to \p Scalar.
+		/// \tparam Scalar The scalar type of the array
+		/// \tparam T The type of the other operand
+		/// \return True if the operation promotes
+		template<typename Scalar, typename T>
+		constexpr bool scalarPromotes() {
+			using Type = std::decay_t<T>;
+			if constexpr (std::is_arithmetic_v<Scalar> && std::is_arithmetic_v<Type>) {
+				return !std::is_same_v<std::common_type_t<Scalar, Type>, Scalar>;
+			} else {
+				return false;
+			}
+		}
+
+		/// Return true if \p value lies within the range of \p Scalar, so converting it to
+		/// \p Scalar is well defined (converting an out-of-range floating point value to an
+		/// integer is undefined behaviour). Non-finite values are in range for floating point
+		/// types, and NaN is never in range for integers.
+		/// \tparam Scalar The type to convert to
+		/// \tparam T The type of the value
+		/// \param value The value to check
+		/// \return True if the value can be converted to \p Scalar
+		template<typename Scalar, typename T>
+		constexpr bool inRange(const T &value) {
+			using Limits = std::numeric_limits<Scalar>;
+			if constexpr (std::is_floating_point_v<Scalar>) {
+				constexpr T infinity = std::numeric_limits<T>::infinity();
+				return !(value < static_cast<T>(Limits::lowest()) ||
+						 value > static_cast<T>(Limits::max())) ||
+					   value == infinity || value == -infinity;
+			} else if constexpr (std::is_floating_point_v<T>) {
+				// The limits of an integer are -2^n (or zero) and 2^n - 1. Powers of two are
+				// exact in floating point, so compare against 2^n rather than the maximum,
+				// which would round up to it
+				constexpr T lower = static_cast<T>(Limits::lowest());
+				constexpr T upper = static_cast<T>(Limits::max() / 2 + 1) * T(2);
+				return value >= lower && value < upper;
+			} else if constexpr (std::is_signed_v<T> && !std::is_signed_v<Scalar>) {
+				return value >= 0 && static_cast<std::make_unsigned_t<T>>(value) <= Limits::max();
+			} else if constexpr (!std::is_signed_v<T> && std::is_signed_v<Scalar>) {
+				return value <= static_cast<std::make_unsigned_t<Scalar>>(Limits::max());
+			} else {
+				return value >= Limits::lowest() && value <= Limits::max();
+			}
+		}
+	} // namespace detail
+
 	namespace array {
 		template<typename ShapeType_, typename StorageType_>
 		class ArrayContainer {
 		public:
 			using StorageType = StorageType_;
 			using ShapeType	  = ShapeType_;
-			using StrideType  = Stride<size_t, 32>;
+			using StrideType  = Stride<size_t, ShapeType::MaxDimensions>;
 			using SizeType	  = typename ShapeType::SizeType;
 			using Scalar	  = typename StorageType::Scalar;
 			using Packet	  = typename typetraits::TypeInfo<Scalar>::Packet;
@@ -52,6 +103,13 @@ namespace librapid {
 			/// array container \param value The value to initialize the memory with
 			LIBRAPID_ALWAYS_INLINE ArrayContainer(const ShapeType &shape, const Scalar &value);
 
+			/// Create an array container from a shape and an existing storage object, which is
+			/// moved into the array. This allows arrays to be created from storage which cannot
+			/// be constructed from a shape alone, such as a MappedStorage object mapping a file.
+			/// \param shape The shape of the array container
+			/// \param storage The storage object, which must contain `shape.size()` elements
+			LIBRAPID_ALWAYS_INLINE ArrayContainer(const ShapeType &shape, StorageType &&storage);
+
 			/// Allows for a fixed-size array to be constructed with a fill value
 			/// \param value The value to fill the array with
 			LIBRAPID_ALWAYS_INLINE explicit ArrayContainer(const Scalar &value);
@@ -68,6 +126,24 @@ namespace librapid {
 			/// \param other The array container to move.
 			LIBRAPID_ALWAYS_INLINE ArrayContainer(ArrayContainer &&other) noexcept = default;
 
+			/// Construct an array container from one with a different shape type, such as a
+			/// RankedArray from an Array or vice versa. The data is copied. Converting to a
+			/// RankedArray throws an error if \p other has a different number of dimensions.
+			/// \tparam OtherShape The shape type of the other array container
+			/// \param other The array container to copy.
+			template<typename OtherShape,
+					 typename std::enable_if_t<!std::is_same_v<OtherShape, ShapeType_>, int> = 0>
+			LIBRAPID_ALWAYS_INLINE ArrayContainer(
+			  const ArrayContainer<OtherShape, StorageType_> &other);
+
+			/// Construct an array container from a temporary one with a different shape type. The
+			/// storage is moved rather than copied.
+			/// \tparam OtherShape The shape type of the other array container
+			/// \param other The array container to move.
+			template<typename OtherShape,
+					 typename std::enable_if_t<!std::is_same_v<OtherShape, ShapeType_>, int> = 0>
+			LIBRAPID_ALWAYS_INLINE ArrayContainer(ArrayContainer<OtherShape, StorageType_> &&other);
+
 			/// Construct an array container from a function object. This will assign the result of
 			/// the function to the array container, evaluating it accordingly.
 			/// \tparam desc The assignment descriptor
@@ -101,6 +177,39 @@ namespace librapid {
 			LIBRAPID_ALWAYS_INLINE ArrayContainer &
 			operator=(const detail::Function<desc, Functor_, Args...> &function);
 
+			/// Add a scalar, array container or function object to this array container
+			/// element-wise. The result is written directly into the existing storage, so no
+			/// memory is allocated.
+			/// \tparam T The type of the right-hand side
+			/// \param other The value to add
+			/// \return A reference to this array container
+			template<typename T>
+			LIBRAPID_ALWAYS_INLINE ArrayContainer &operator+=(const T &other);
+
+			/// Subtract a scalar, array container or function object from this array container
+			/// element-wise, in place.
+			/// \tparam T The type of the right-hand side
+			/// \param other The value to subtract
+			/// \return A reference to this array container
+			template<typename T>
+			LIBRAPID_ALWAYS_INLINE ArrayContainer &operator-=(const T &other);
+
+			/// Multiply this array container by a scalar, array container or function object
+			/// element-wise, in place.
+			/// \tparam T The type of the right-hand side
+			/// \param other The value to multiply by
+			/// \return A reference to this array container
+			template<typename T>
+			LIBRAPID_ALWAYS_INLINE ArrayContainer &operator*=(const T &other);
+
+			/// Divide this array container by a scalar, array container or function object
+			/// element-wise, in place.
+			/// \tparam T The type of the right-hand side
+			/// \param other The value to divide by
+			/// \return A reference to this array container
+			template<typename T>
+			LIBRAPID_ALWAYS_INLINE ArrayContainer &operator/=(const T &other);
+
 			/// Allow ArrayContainer objects to be initialized with a comma separated list of
 			/// values. This makes use of the CommaInitializer class
 			/// \tparam T The type of the values
@@ -124,6 +233,31 @@ namespace librapid {
 
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator[](int64_t index);
 
+			/// Return the elements of this array container where a mask is true, in row-major
+			/// order, as a new one-dimensional array.
+			/// \tparam Mask The type of the mask (an array or Function)
+			/// \param mask The mask, with the shape of this array container
+			/// \return The selected elements
+			/// \see compress
+			template<typename Mask,
+					 typename std::enable_if_t<typetraits::TypeInfo<Mask>::type !=
+												 ::librapid::detail::LibRapidType::Scalar,
+											   int> = 0>
+			LIBRAPID_NODISCARD auto operator[](const Mask &mask) const;
+
+			/// Return a strided view of part of this ArrayContainer, which references the same
+			/// memory. Each argument is an integer index or a Slice, applied to one dimension.
+			/// \tparam Indices Integer or Slice types
+			/// \param indices The index or Slice for each dimension
+			/// \return An ArrayView of the selected elements
+			/// \see ArrayView::slice
+			template<typename... Indices>
+			LIBRAPID_NODISCARD auto slice(const Indices &...indices) const;
+
+			/// \see slice
+			template<typename... Indices>
+			LIBRAPID_NODISCARD auto slice(const Indices &...indices);
+
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar get() const;
 
 			/// Return the number of dimensions of the ArrayContainer object
@@ -148,6 +282,15 @@ namespace librapid {
 			/// \return A Packet object from the array's storage at a specific index
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(size_t index) const;
 
+			/// Return a Packet object holding \p count elements from a specific index, with the
+			/// remaining lanes set to zero. The packet type must support partial loads (see
+			/// detail::CanLoadPartial).
+			/// \param index The index of the first element
+			/// \param count The number of elements to load
+			/// \return A Packet object holding the elements
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet partialPacket(size_t index,
+																		   size_t count) const;
+
 			/// Return a Scalar from the array's storage at a specific index.
 			/// \param index The index to get the scalar from
 			/// \return A Scalar from the array's storage at a specific index
@@ -158,6 +301,14 @@ namespace librapid {
 			/// \param value The value to write to the array's storage
 			LIBRAPID_ALWAYS_INLINE void writePacket(size_t index, const Packet &value);
 
+			/// Write the first \p count lanes of a Packet object to the array's storage at a
+			/// specific index
+			/// \param index The index to write the first lane to
+			/// \param value The value to write to the array's storage
+			/// \param count The number of lanes to write
+			LIBRAPID_ALWAYS_INLINE void writePartialPacket(size_t index, const Packet &value,
+														   size_t count);
+
 			/// Write a Scalar to the array's storage at a specific index
 			/// \param index The index to write the scalar to
 			/// \param value The value to write to the array's storage
@@ -168,13 +319,55 @@ namespace librapid {
 			/// \return A string representation of the array container
 			LIBRAPID_NODISCARD std::string str(const std::string &format = "{}") const;
 
+			/// Write the array to a binary file. The file contains a small header describing the
+			/// data type and shape, followed by the raw contents of the array's storage.
+			/// \param path The path of the file to write
+			/// \see load
+			void save(const std::string &path) const;
+
+			/// Read an array from a file written by `save`. An exception is thrown if the file
+			/// cannot be read, or if it contains a different data type.
+			/// \param path The path of the file to read
+			/// \return The array stored in the file
+			/// \see save
+			LIBRAPID_NODISCARD static ArrayContainer load(const std::string &path);
+
 		private:
+			/// Apply \p Functor_ element-wise to this array container and \p other, writing the
+			/// result back into this array container. Large arrays are evaluated in parallel.
+			/// \tparam Functor_ The element-wise functor to apply
+			/// \tparam T The type of the right-hand side
+			/// \param other The right-hand side of the operation
+			template<typename Functor_, typename T>
+			LIBRAPID_ALWAYS_INLINE void assignInPlace(const T &other);
+
+			// Sub-arrays and conversions use a different shape type
+			template<typename, typename>
+			friend class ArrayContainer;
+
 			ShapeType m_shape;	   // The shape type of the array
 			StorageType m_storage; // The storage container of the array
 		};
 
 		template<typename ShapeType_, typename StorageType_>
-		ArrayContainer<ShapeType_, StorageType_>::ArrayContainer() : m_shape({0}) {}
+		ArrayContainer<ShapeType_, StorageType_>::ArrayContainer() :
+				m_shape(detail::emptyShape<ShapeType_, StorageType_>()) {}
+
+		template<typename ShapeType_, typename StorageType_>
+		template<typename OtherShape,
+				 typename std::enable_if_t<!std::is_same_v<OtherShape, ShapeType_>, int>>
+		ArrayContainer<ShapeType_, StorageType_>::ArrayContainer(
+		  const ArrayContainer<OtherShape, StorageType_> &other) :
+				m_shape(other.m_shape),
+				m_storage(other.m_storage) {}
+
+		template<typename ShapeType_, typename StorageType_>
+		template<typename OtherShape,
+				 typename std::enable_if_t<!std::is_same_v<OtherShape, ShapeType_>, int>>
+		ArrayContainer<ShapeType_, StorageType_>::ArrayContainer(
+		  ArrayContainer<OtherShape, StorageType_> &&other) :
+				m_shape(other.m_shape),
+				m_storage(std::move(other.m_storage)) {}
 
 		template<typename ShapeType_, typename StorageType_>
 		template<typename T>
@@ -203,10 +396,12 @@ namespace librapid {
 				m_shape(shape),
 				m_storage(shape.size(), value) {
 			static_assert(typetraits::IsStorage<StorageType_>::value ||
+							typetraits::IsBitStorage<StorageType_>::value ||
+							typetraits::IsMappedStorage<StorageType_>::value ||
 							typetraits::IsCudaStorage<StorageType_>::value,
 						  "For a runtime-defined shape, "
 						  "the storage type must be "
-						  "either a Storage or a "
+						  "a Storage, BitStorage, MappedStorage or "
 						  "CudaStorage object");
 			static_assert(!typetraits::IsFixedStorage<StorageType_>::value,
 						  "For a compile-time-defined shape, "
@@ -214,6 +409,18 @@ namespace librapid {
 						  "a FixedStorage object");
 		}
 
+		template<typename ShapeType_, typename StorageType_>
+		ArrayContainer<ShapeType_, StorageType_>::ArrayContainer(const ShapeType &shape,
+																 StorageType &&storage) :
+				m_shape(shape),
+				m_storage(std::move(storage)) {
+			LIBRAPID_ASSERT(m_shape.size() == m_storage.size(),
+							"Shape {} requires {} elements, but the storage contains {}",
+							m_shape.str(),
+							m_shape.size(),
+							m_storage.size());
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		ArrayContainer<ShapeType_, StorageType_>::ArrayContainer(const Scalar &value) :
 				m_shape(detail::shapeFromFixedStorage(m_storage)), m_storage(value) {
@@ -234,11 +441,15 @@ namespace librapid {
 				: m_shape(function.shape()),
 				  m_storage(m_shape.size()) {
 #if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
-			if (m_storage.size() > global::multithreadThreshold && global::numThreads > 1)
-				detail::assignParallel(*this, function);
-			else
+			// Fixed-size arrays are always assigned serially, so they skip the check entirely
+			if constexpr (!typetraits::IsFixedStorage<StorageType_>::value) {
+				if (m_storage.size() > global::multithreadThreshold && global::numThreads > 1) {
+					detail::assignParallel(*this, function);
+					return;
+				}
+			}
 #endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
-				detail::assign(*this, function);
+			detail::assign(*this, function);
 		}
 
 		template<typename ShapeType_, typename StorageType_>
@@ -248,15 +459,81 @@ namespace librapid {
 			using FunctionType = detail::Function<desc, Functor_, Args...>;
 			m_storage.resize(function.shape().size(), 0);
 #if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
-			if (!std::is_same_v<typename FunctionType::Device, device::GPU> &&
-				m_storage.size() > global::multithreadThreshold && global::numThreads > 1)
-				detail::assignParallel(*this, function);
-			else
+			if constexpr (!typetraits::IsFixedStorage<StorageType_>::value &&
+						  !std::is_same_v<typename FunctionType::Device, device::GPU>) {
+				if (m_storage.size() > global::multithreadThreshold && global::numThreads > 1) {
+					detail::assignParallel(*this, function);
+					return *this;
+				}
+			}
 #endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
-				detail::assign(*this, function);
+			detail::assign(*this, function);
 			return *this;
 		}
 
+		template<typename ShapeType_, typename StorageType_>
+		template<typename T>
+		auto ArrayContainer<ShapeType_, StorageType_>::operator+=(const T &other)
+		  -> ArrayContainer & {
+			assignInPlace<detail::Plus>(other);
+			return *this;
+		}
+
+		template<typename ShapeType_, typename StorageType_>
+		template<typename T>
+		auto ArrayContainer<ShapeType_, StorageType_>::operator-=(const T &other)
+		  -> ArrayContainer & {
+			assignInPlace<detail::Minus>(other);
+			return *this;
+		}
+
+		template<typename ShapeType_, typename StorageType_>
+		template<typename T>
+		auto ArrayContainer<ShapeType_, StorageType_>::operator*=(const T &other)
+		  -> ArrayContainer & {
+			assignInPlace<detail::Multiply>(other);
+			return *this;
+		}
+
+		template<typename ShapeType_, typename StorageType_>
+		template<typename T>
+		auto ArrayContainer<ShapeType_, StorageType_>::operator/=(const T &other)
+		  -> ArrayContainer & {
+			assignInPlace<detail::Divide>(other);
+			return *this;
+		}
+
+		template<typename ShapeType_, typename StorageType_>
+		template<typename Functor_, typename T>
+		void ArrayContainer<ShapeType_, StorageType_>::assignInPlace(const T &other) {
+			if constexpr (detail::scalarPromotes<Scalar, T>()) {
+				// If the value is exactly representable as a Scalar, the result is the same as
+				// evaluating in the promoted type, so the vectorised path can still be used.
+				// Other values (e.g. adding 0.1 to a float array) are evaluated element by
+				// element in the promoted type, which is about 2x slower with AVX2 and up to
+				// 7x slower with SSE2 only. Cast the value to the array's type first to trade
+				// that precision for speed.
+				if (detail::inRange<Scalar>(other)) {
+					const auto value = static_cast<Scalar>(other);
+					if (static_cast<T>(value) == other) {
+						assignInPlace<Functor_>(value);
+						return;
+					}
+				}
+			}
+
+#if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
+			if constexpr (typetraits::IsStorage<StorageType_>::value ||
+						  typetraits::IsMappedStorage<StorageType_>::value) {
+				if (m_storage.size() > global::multithreadThreshold && global::numThreads > 1) {
+					detail::assignInPlaceParallel<Functor_>(*this, other);
+					return;
+				}
+			}
+#endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
+			detail::assignInPlace<Functor_>(*this, other);
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		auto ArrayContainer<ShapeType_, StorageType_>::operator=(const Scalar &value)
 		  -> ArrayContainer & {
@@ -293,15 +570,19 @@ namespace librapid {
 				// view.setOffset(index * stride[0]);
 				// return view;
 
-				ArrayContainer res;
+				ArrayContainer<typename detail::SubShape<ShapeType_>::Type, StorageType_> res;
 				res.m_shape	  = m_shape.subshape(1, ndim());
 				auto subSize  = res.shape().size();
 				Scalar *begin = m_storage.begin().get() + index * subSize;
 				res.m_storage = StorageType_(begin, subSize, false);
 
 				return res;
+			} else if constexpr (typetraits::IsBitStorage<StorageType_>::value) {
+				// Rows of a bit-packed array generally start part way through a word, so they
+				// cannot be referenced by another BitStorage. Return a view of the row instead
+				return ArrayView<const ArrayContainer>(*this)[index];
 			} else {
-				ArrayContainer res;
+				ArrayContainer<typename detail::SubShape<ShapeType_>::Type, StorageType_> res;
 				res.m_shape	  = m_shape.subshape(1, ndim());
 				auto subSize  = res.shape().size();
 				Scalar *begin = m_storage.begin() + index * subSize;
@@ -315,10 +596,10 @@ namespace librapid {
 		template<typename ShapeType_, typename StorageType_>
 		auto ArrayContainer<ShapeType_, StorageType_>::operator[](int64_t index) {
 			LIBRAPID_ASSERT(
-			  index >= 0 && index < static_cast<int64_t>(m_shape[0]),
+			  index >= 0 && index < static_cast<int64_t>(shape()[0]),
 			  "Index {} out of bounds in ArrayContainer::operator[] with leading dimension={}",
 			  index,
-			  m_shape[0]);
+			  shape()[0]);
 
 			if constexpr (std::is_same_v<typename typetraits::TypeInfo<ArrayContainer>::Device,
 										 device::GPU>) {
@@ -333,15 +614,19 @@ namespace librapid {
 				// view.setOffset(index * stride[0]);
 				// return view;
 
-				ArrayContainer res;
+				ArrayContainer<typename detail::SubShape<ShapeType_>::Type, StorageType_> res;
 				res.m_shape	  = m_shape.subshape(1, ndim());
 				auto subSize  = res.shape().size();
 				Scalar *begin = m_storage.begin().get() + index * subSize;
 				res.m_storage = StorageType_(begin, subSize, false);
 
 				return res;
+			} else if constexpr (typetraits::IsBitStorage<StorageType_>::value) {
+				// Rows of a bit-packed array generally start part way through a word, so they
+				// cannot be referenced by another BitStorage. Return a view of the row instead
+				return ArrayView<ArrayContainer>(*this)[index];
 			} else {
-				ArrayContainer res;
+				ArrayContainer<typename detail::SubShape<ShapeType_>::Type, StorageType_> res;
 				res.m_shape	  = m_shape.subshape(1, ndim());
 				auto subSize  = res.shape().size();
 				Scalar *begin = m_storage.begin() + index * subSize;
@@ -388,6 +673,14 @@ namespace librapid {
 			return res;
 		}
 
+		template<typename ShapeType_, typename StorageType_>
+		auto ArrayContainer<ShapeType_, StorageType_>::partialPacket(size_t index,
+																	 size_t count) const -> Packet {
+			Packet res;
+			res.loadPartial(m_storage.begin() + index, count);
+			return res;
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		auto ArrayContainer<ShapeType_, StorageType_>::scalar(size_t index) const -> Scalar {
 			return m_storage[index];
@@ -399,6 +692,13 @@ namespace librapid {
 			value.store(m_storage.begin() + index);
 		}
 
+		template<typename ShapeType_, typename StorageType_>
+		void ArrayContainer<ShapeType_, StorageType_>::writePartialPacket(size_t index,
+																		  const Packet &value,
+																		  size_t count) {
+			value.storePartial(m_storage.begin() + index, count);
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		void ArrayContainer<ShapeType_, StorageType_>::write(size_t index, const Scalar &value) {
 			m_storage[index] = value;
@@ -408,6 +708,19 @@ namespace librapid {
 		std::string ArrayContainer<ShapeType_, StorageType_>::str(const std::string &format) const {
 			return ArrayView(*this).str(format);
 		}
+
+		template<typename ShapeType_, typename StorageType_>
+		void ArrayContainer<ShapeType_, StorageType_>::save(const std::string &path) const {
+			detail::serialize::save(path, m_shape, m_storage);
+		}
+
+		template<typename ShapeType_, typename StorageType_>
+		auto ArrayContainer<ShapeType_, StorageType_>::load(const std::string &path)
+		  -> ArrayContainer {
+			ArrayContainer res;
+			detail::serialize::load(path, res.m_shape, res.m_storage);
+			return res;
+		}
 	} // namespace array
 
 	namespace detail {
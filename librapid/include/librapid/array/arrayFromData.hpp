@@ -2,6 +2,96 @@
 #define LIBRAPID_ARRAY_FROM_DATA_HPP
 
 namespace librapid {
+	namespace detail {
+		/// The number of levels of nesting of std::initializer_list or std::vector objects
+		/// \tparam T The (possibly nested) container type
+		template<typename T>
+		struct NestingDepth : std::integral_constant<size_t, 0> {};
+
+		template<typename T>
+		struct NestingDepth<std::initializer_list<T>>
+				: std::integral_constant<size_t, NestingDepth<T>::value + 1> {};
+
+		template<typename T>
+		struct NestingDepth<std::vector<T>>
+				: std::integral_constant<size_t, NestingDepth<T>::value + 1> {};
+
+		/// Set the dimensions of \p shape, starting at \p dim, from the sizes of the first
+		/// element at each level of nesting
+		/// \tparam ShapeType The shape type
+		/// \tparam Data The nested container type
+		/// \param data The nested data
+		/// \param dim The dimension corresponding to \p data
+		/// \param shape The shape to fill
+		template<typename ShapeType, typename Data>
+		void nestedShape(const Data &data, size_t dim, ShapeType &shape) {
+			shape[dim] = data.size();
+			if constexpr (NestingDepth<Data>::value > 1) {
+				if (data.size() > 0) nestedShape(*data.begin(), dim + 1, shape);
+			}
+		}
+
+		/// Copy the values of nested data to \p out in row-major order, checking that every
+		/// container at each level of nesting has the same size
+		/// \tparam ShapeType The shape type
+		/// \tparam Data The nested container type
+		/// \tparam OutputIterator The type of the output iterator
+		/// \param data The nested data
+		/// \param shape The shape of the data
+		/// \param dim The dimension corresponding to \p data
+		/// \param out The output iterator, advanced past the copied values
+		template<typename ShapeType, typename Data, typename OutputIterator>
+		void copyNested(const Data &data, const ShapeType &shape, size_t dim,
+						OutputIterator &out) {
+			if (static_cast<size_t>(shape[dim]) != data.size()) {
+				throw std::runtime_error(
+				  fmt::format("Arrays must have consistent shapes. Expected {} elements in "
+							  "dimension {}, but found {}",
+							  shape[dim],
+							  dim,
+							  data.size()));
+			}
+
+			if constexpr (NestingDepth<Data>::value == 1) {
+				out = std::copy(data.begin(), data.end(), out);
+			} else {
+				for (const auto &item : data) copyNested(item, shape, dim + 1, out);
+			}
+		}
+
+		/// Create an array from nested data. The shape is found first, so the values can be
+		/// copied straight into a single allocation, without creating an array for each row.
+		/// \tparam Scalar The scalar type of the array
+		/// \tparam Device The device the array is stored on
+		/// \tparam Data The nested container type
+		/// \param data The nested data
+		/// \return The new array
+		template<typename Scalar, typename Device, typename Data>
+		auto fromNested(const Data &data) -> Array<Scalar, Device> {
+			using ArrayType	  = Array<Scalar, Device>;
+			using ShapeType	  = typename ArrayType::ShapeType;
+			using StorageType = typename ArrayType::StorageType;
+			LIBRAPID_ASSERT(data.size() > 0, "Cannot create a zero-sized array");
+
+			auto shape = ShapeType::zeros(NestingDepth<Data>::value);
+			nestedShape(data, 0, shape);
+
+			if constexpr (typetraits::IsStorage<StorageType>::value) {
+				StorageType storage(shape.size());
+				Scalar *out = storage.begin();
+				copyNested(data, shape, 0, out);
+				return ArrayType(shape, std::move(storage));
+			} else {
+				// Gather the values in host memory, then copy them to the storage at once
+				std::vector<Scalar> values;
+				values.reserve(shape.size());
+				auto out = std::back_inserter(values);
+				copyNested(data, shape, 0, out);
+				return ArrayType(shape, StorageType::fromData(values));
+			}
+		}
+	} // namespace detail
+
 	template<typename Scalar, typename Device = device::CPU>
 	LIBRAPID_NODISCARD Array<Scalar, Device> fromData(const std::initializer_list<Scalar> &data) {
 		LIBRAPID_ASSERT(data.size() > 0, "Array must have at least one element");
@@ -14,66 +104,16 @@ namespace librapid {
 		return Array<Scalar, Device>(data);
 	}
 
-	template<typename Scalar, typename Device = device::CPU>
-	LIBRAPID_NODISCARD Array<Scalar, Device>
-	fromData(const std::initializer_list<std::initializer_list<Scalar>> &data) {
-		LIBRAPID_ASSERT(data.size() > 0, "Cannot create a zero-sized array");
-		using ShapeType = typename Array<Scalar, Device>::ShapeType;
-		auto newShape	= ShapeType({data.size(), data.begin()->size()});
-#if defined(LIBRAPID_ENABLE_ASSERT)
-		for (size_t i = 0; i < data.size(); ++i) {
-			LIBRAPID_ASSERT(data.begin()[i].size() == newShape[1],
-							"Arrays must have consistent shapes");
-		}
-#endif
-		auto res	  = Array<Scalar, Device>(newShape);
-		int64_t index = 0;
-		for (const auto &item : data) res[index++] = fromData<Scalar, Device>(item);
-		return res;
-	}
-
-	template<typename Scalar, typename Device = device::CPU>
-	LIBRAPID_NODISCARD Array<Scalar, Device>
-	fromData(const std::vector<std::vector<Scalar>> &data) {
-		LIBRAPID_ASSERT(data.size() > 0, "Cannot create a zero-sized array");
-		using ShapeType = typename Array<Scalar, Device>::ShapeType;
-		auto newShape	= ShapeType({data.size(), data.begin()->size()});
-#if defined(LIBRAPID_ENABLE_ASSERT)
-		for (size_t i = 0; i < data.size(); ++i) {
-			LIBRAPID_ASSERT(data.begin()[i].size() == newShape[1],
-							"Arrays must have consistent shapes");
-		}
-#endif
-		auto res	  = Array<Scalar, Device>(newShape);
-		int64_t index = 0;
-		for (const auto &item : data) res[index++] = fromData<Scalar, Device>(item);
-		return res;
-	}
-
 #define HIGHER_DIMENSIONAL_FROM_DATA(TYPE)                                                         \
 	template<typename Scalar, typename Device = device::CPU>                                       \
 	LIBRAPID_NODISCARD Array<Scalar, Device> fromData(const TYPE &data) {                          \
-		LIBRAPID_ASSERT(data.size() > 0, "Cannot create a zero-sized array");                      \
-		auto *tmp	  = new Array<Scalar, Device>[data.size()];                                    \
-		int64_t index = 0;                                                                         \
-		for (const auto &item : data) tmp[index++] = fromData<Scalar, Device>(item);               \
-		auto zeroShape = tmp[0].shape();                                                           \
-		for (int64_t i = 0; i < data.size(); ++i)                                                  \
-			LIBRAPID_ASSERT(tmp[i].shape() == zeroShape, "Arrays must have consistent shapes");    \
-		using ShapeType = typename Array<Scalar, Device>::ShapeType;                               \
-		auto newShape	= ShapeType::zeros(zeroShape.ndim() + 1);                                  \
-		newShape[0]		= data.size();                                                             \
-		for (size_t i = 0; i < zeroShape.ndim(); ++i) { newShape[i + 1] = zeroShape[i]; }          \
-		auto res = Array<Scalar, Device>(newShape);                                                \
-		index	 = 0;                                                                              \
-		for (int64_t i = 0; i < data.size(); ++i) res[i] = tmp[i];                                 \
-		delete[] tmp;                                                                              \
-		return res;                                                                                \
+		return detail::fromNested<Scalar, Device>(data);                                           \
 	}
 
 #define SINIT(SUB_TYPE) std::initializer_list<SUB_TYPE>
 #define SVEC(SUB_TYPE)	std::vector<SUB_TYPE>
 
+	HIGHER_DIMENSIONAL_FROM_DATA(SINIT(SINIT(Scalar)))
 	HIGHER_DIMENSIONAL_FROM_DATA(SINIT(SINIT(SINIT(Scalar))))
 	HIGHER_DIMENSIONAL_FROM_DATA(SINIT(SINIT(SINIT(SINIT(Scalar)))))
 	HIGHER_DIMENSIONAL_FROM_DATA(SINIT(SINIT(SINIT(SINIT(SINIT(Scalar))))))
@@ -81,6 +121,7 @@ namespace librapid {
 	HIGHER_DIMENSIONAL_FROM_DATA(SINIT(SINIT(SINIT(SINIT(SINIT(SINIT(SINIT(Scalar))))))))
 	HIGHER_DIMENSIONAL_FROM_DATA(SINIT(SINIT(SINIT(SINIT(SINIT(SINIT(SINIT(SINIT(Scalar)))))))))
 
+	HIGHER_DIMENSIONAL_FROM_DATA(SVEC(SVEC(Scalar)))
 	HIGHER_DIMENSIONAL_FROM_DATA(SVEC(SVEC(SVEC(Scalar))))
 	HIGHER_DIMENSIONAL_FROM_DATA(SVEC(SVEC(SVEC(SVEC(Scalar)))))
 	HIGHER_DIMENSIONAL_FROM_DATA(SVEC(SVEC(SVEC(SVEC(SVEC(Scalar))))))
@@ -89,6 +130,7 @@ namespace librapid {
 	HIGHER_DIMENSIONAL_FROM_DATA(SVEC(SVEC(SVEC(SVEC(SVEC(SVEC(SVEC(SVEC(Scalar)))))))))
 
 #undef SINIT
+#undef SVEC
 #undef HIGHER_DIMENSIONAL_FROM_DATA
 } // namespace librapid
 
@@ -17,6 +17,12 @@ namespace librapid {
 		struct TypeDefStorageEvaluator<Scalar, device::GPU> {
 			using Type = CudaStorage<Scalar>;
 		};
+
+		// Boolean arrays on the CPU are bit-packed
+		template<>
+		struct TypeDefStorageEvaluator<bool, device::CPU> {
+			using Type = BitStorage<>;
+		};
 	} // namespace detail
 
 	/// An easier to use definition than ArrayContainer. In this case, StorageType can be
@@ -25,22 +31,44 @@ namespace librapid {
 	/// \tparam StorageType The storage type of the array.
 	template<typename Scalar, typename StorageType = device::CPU>
 	using Array =
-	  array::ArrayContainer<Shape<size_t, 32>,
+	  array::ArrayContainer<Shape<size_t, LIBRAPID_MAX_ARRAY_DIMS>,
 							typename detail::TypeDefStorageEvaluator<Scalar, StorageType>::Type>;
 
+	/// An Array whose number of dimensions is fixed at compile time. Loops over the dimensions
+	/// of a RankedArray, such as the index calculations of an ArrayView, have a constant trip
+	/// count, so they unroll fully. A RankedArray converts implicitly to and from an Array with
+	/// the same scalar and storage types.
+	/// \tparam Scalar The scalar type of the array.
+	/// \tparam Rank The number of dimensions of the array.
+	/// \tparam StorageType The storage type of the array.
+	/// \see Array
+	/// \see RankedShape
+	template<typename Scalar, size_t Rank, typename StorageType = device::CPU>
+	using RankedArray =
+	  array::ArrayContainer<RankedShape<size_t, Rank>,
+							typename detail::TypeDefStorageEvaluator<Scalar, StorageType>::Type>;
+
+	/// A two-dimensional RankedArray
+	/// \tparam Scalar The scalar type of the matrix.
+	/// \tparam StorageType The storage type of the matrix.
+	/// \see RankedArray
+	template<typename Scalar, typename StorageType = device::CPU>
+	using Matrix = RankedArray<Scalar, 2, StorageType>;
+
 	/// A definition for fixed-size array objects.
 	/// \tparam Scalar The scalar type of the array.
 	/// \tparam Dimensions The dimensions of the array.
 	/// \see Array
 	template<typename Scalar, size_t... Dimensions>
-	using ArrayF = array::ArrayContainer<Shape<size_t, 32>, FixedStorage<Scalar, Dimensions...>>;
+	using ArrayF = array::ArrayContainer<Shape<size_t, LIBRAPID_MAX_ARRAY_DIMS>,
+										 FixedStorage<Scalar, Dimensions...>>;
 
 	/// A reference type for Array objects. Use this to accept Array objects as parameters since
 	/// the compiler cannot determine the templates tingle for the Array typedef. For more
 	/// granularity, you can also accept a raw ArrayContainer object. \tparam StorageType The
 	/// storage type of the array. \see Array \see ArrayF \see Function \see FunctionRef
 	template<typename StorageType>
-	using ArrayRef = array::ArrayContainer<Shape<size_t, 32>, StorageType>;
+	using ArrayRef = array::ArrayContainer<Shape<size_t, LIBRAPID_MAX_ARRAY_DIMS>, StorageType>;
 
 	/// A reference type for Array Function objects. Use this to accept Function objects as
 	/// parameters since the compiler cannot determine the templates for the typedef by default.
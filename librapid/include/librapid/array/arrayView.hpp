@@ -2,13 +2,62 @@
 #define LIBRAPID_ARRAY_ARRAY_VIEW_HPP
 
 namespace librapid {
+	/// A range of indices along one dimension of an array, equivalent to `start:stop:step` in
+	/// Python. Negative values of \p start and \p stop count back from the end of the dimension,
+	/// and either can be left as Slice::none to take everything up to the relevant end. Values
+	/// beyond the end of the dimension are clamped, so a Slice is never out of range.
+	/// \see ArrayView::slice
+	struct Slice {
+		/// Marks an unspecified start or stop
+		static constexpr int64_t none = std::numeric_limits<int64_t>::min();
+
+		/// Select every element
+		Slice() = default;
+
+		/// \param start The first index
+		/// \param stop One past the last index
+		/// \param step The distance between selected indices. Must not be zero
+		Slice(int64_t start, int64_t stop, int64_t step = 1) :
+				start(start), stop(stop), step(step) {}
+
+		int64_t start = none;
+		int64_t stop  = none;
+		int64_t step  = 1;
+	};
+
+	namespace detail {
+		/// Resolve a Slice against a dimension of \p extent elements
+		/// \param slice The Slice
+		/// \param extent The number of elements in the dimension
+		/// \param first Set to the first selected index
+		/// \return The number of selected indices
+		LIBRAPID_INLINE int64_t resolveSlice(const Slice &slice, int64_t extent, int64_t &first) {
+			if (slice.step == 0) throw std::runtime_error("Slice step cannot be zero");
+
+			// Python semantics: a negative step starts at the end and stops before index 0,
+			// which is represented by -1 here
+			const int64_t low  = slice.step > 0 ? 0 : -1;
+			const int64_t high = slice.step > 0 ? extent : extent - 1;
+			const auto bound   = [&](int64_t index, int64_t otherwise) {
+				if (index == Slice::none) return otherwise;
+				return std::clamp(index < 0 ? index + extent : index, low, high);
+			};
+
+			first			   = bound(slice.start, slice.step > 0 ? low : high);
+			const int64_t last = bound(slice.stop, slice.step > 0 ? high : low);
+			const int64_t span = slice.step > 0 ? last - first : first - last;
+			const int64_t step = slice.step > 0 ? slice.step : -slice.step;
+			return span > 0 ? (span + step - 1) / step : 0;
+		}
+	} // namespace detail
+
 	namespace typetraits {
 		template<typename T>
 		struct TypeInfo<array::ArrayView<T>> {
-			detail::LibRapidType type				 = detail::LibRapidType::ArrayView;
-			using Scalar							 = typename TypeInfo<T>::Scalar;
-			using Device							 = typename TypeInfo<T>::Device;
-			static constexpr bool allowVectorisation = false;
+			static constexpr detail::LibRapidType type = detail::LibRapidType::ArrayView;
+			using Scalar							   = typename TypeInfo<T>::Scalar;
+			using Device							   = typename TypeInfo<T>::Device;
+			static constexpr bool allowVectorisation   = false;
 		};
 	} // namespace typetraits
 
@@ -22,9 +71,17 @@ namespace librapid {
 			using Reference		 = BaseType &;
 			using ConstReference = const BaseType &;
 			using StrideType	 = typename BaseType::StrideType;
-			using ShapeType		 = typename BaseType::ShapeType;
 			using Device		 = typename typetraits::TypeInfo<BaseType>::Device;
 
+			/// Slicing can remove dimensions, so the number of dimensions of an ArrayView is only
+			/// known at runtime, even for a RankedArray. The maximum is carried over, so loops
+			/// over the dimensions of a view of a RankedArray still unroll fully.
+			using ShapeType =
+			  Shape<typename BaseType::SizeType, BaseType::ShapeType::MaxDimensions>;
+
+			/// The type returned by eval()
+			using EvalType = array::ArrayContainer<ShapeType, typename BaseType::StorageType>;
+
 			/// Default constructor should never be used
 			ArrayView() = delete;
 
@@ -50,18 +107,53 @@ namespace librapid {
 			/// \return A reference to this ArrayView.
 			ArrayView &operator=(ArrayView &&other) noexcept = default;
 
-			/// Assign a scalar value to this ArrayView. This function should only be used to
-			/// assign to a zero-dimensional "scalar" ArrayView, and will throw an error if used
-			/// incorrectly.
+			/// Assign a scalar value to every element referenced by this ArrayView. The elements
+			/// are written in the referenced array.
 			/// \param scalar The scalar value to assign
 			/// \return A reference to this
 			ArrayView &operator=(const Scalar &scalar);
 
-			/// Access a sub-array of this ArrayView.
+			/// Assign an array or function object to this ArrayView element-wise. The elements are
+			/// written in the referenced array, so this can be used to operate on a sub-block of
+			/// a larger array without copying it. \p other must have the same shape as this
+			/// ArrayView, and must not reference any of the elements being written.
+			/// \tparam Other The type of the array or function object
+			/// \param other The values to assign
+			/// \return A reference to this
+			template<typename Other,
+					 typename std::enable_if_t<typetraits::TypeInfo<Other>::type !=
+												 ::librapid::detail::LibRapidType::Scalar,
+											   int> = 0>
+			ArrayView &operator=(const Other &other);
+
+			/// Access a sub-array of this ArrayView. This is equivalent to `slice(index)`.
 			/// \param index The index of the sub-array.
 			/// \return An ArrayView from this
+			/// \see slice
 			ArrayView<ArrayType> operator[](int64_t index) const;
 
+			/// Return a view of part of this ArrayView, without copying any data. Each argument
+			/// applies to one dimension, starting from the first. An integer selects a single
+			/// index, which removes the dimension, and a Slice selects a strided range of indices.
+			/// Dimensions without an argument are kept whole. Only the shape, stride and offset
+			/// are changed, so this runs in O(ndim) time regardless of the size of the array.
+			///
+			/// Integer indices may be negative, in which case they count back from the end of
+			/// the dimension. An out-of-range index throws a std::runtime_error.
+			///
+			/// \code{.cpp}
+			/// auto a = lrc::Array<float>(lrc::Shape({100, 100}));
+			/// auto block = a.slice(lrc::Slice(10, 20), lrc::Slice(0, 100, 2)); // 10x50
+			/// auto column = a.slice(lrc::Slice(), 5);                            // 100
+			/// auto reversed = a.slice(lrc::Slice(lrc::Slice::none, lrc::Slice::none, -1));
+			/// \endcode
+			/// \tparam Indices Integer or Slice types
+			/// \param indices The index or Slice for each dimension
+			/// \return A view of the selected elements
+			/// \see Slice
+			template<typename... Indices>
+			LIBRAPID_NODISCARD ArrayView slice(const Indices &...indices) const;
+
 			/// Since even scalars are represented as an ArrayView object, it can be difficult to
 			/// operate on them directly. This allows you to extract the scalar value stored by a
 			/// zero-dimensional ArrayView object
@@ -78,11 +170,11 @@ namespace librapid {
 
 			/// Access the underlying shape of this ArrayView
 			/// \return Shape object
-			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ShapeType shape() const;
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const ShapeType &shape() const;
 
 			/// Access the stride of this ArrayView
 			/// \return Stride object
-			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE StrideType stride() const;
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const StrideType &stride() const;
 
 			/// Access the offset of this ArrayView. This is the offset, in elements, from the
 			/// referenced Array's first element.
@@ -115,7 +207,7 @@ namespace librapid {
 			/// it. Depending on your use case, this may result in more performant code, but the new
 			/// Array will not reference the original data in the ArrayView.
 			/// \return A new Array instance
-			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ArrayType eval() const;
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE EvalType eval() const;
 
 			/// Cast an ArrayView to a std::string, aligning items down the columns. A format
 			/// string can also be specified, which will be used to format the items to strings
@@ -124,6 +216,13 @@ namespace librapid {
 			LIBRAPID_NODISCARD std::string str(const std::string &format = "{}") const;
 
 		private:
+			/// Call \p func with the flat index and the offset into the referenced array of each
+			/// element of this ArrayView, in row-major order
+			/// \tparam Func The function type
+			/// \param func The function to call
+			template<typename Func>
+			void forEachOffset(Func &&func) const;
+
 			ArrayType &m_ref;
 			ShapeType m_shape;
 			StrideType m_stride;
@@ -132,31 +231,92 @@ namespace librapid {
 
 		template<typename T>
 		ArrayView<T>::ArrayView(ArrayType &array) :
-				m_ref(array), m_shape(array.shape()), m_stride(array.shape()) {}
+				m_ref(array), m_shape(array.shape()), m_stride(m_shape) {}
 
 		template<typename T>
 		ArrayView<T> &ArrayView<T>::operator=(const Scalar &scalar) {
-			LIBRAPID_ASSERT(m_shape.ndim() == 0, "Cannot assign to a non-scalar ArrayView.");
-			m_ref.storage()[m_offset] = static_cast<Scalar>(scalar);
+			auto &storage = m_ref.storage();
+			forEachOffset([&](int64_t, int64_t offset) { storage[offset] = scalar; });
+			return *this;
+		}
+
+		template<typename T>
+		template<typename Other,
+				 typename std::enable_if_t<typetraits::TypeInfo<Other>::type !=
+											 ::librapid::detail::LibRapidType::Scalar,
+										   int>>
+		ArrayView<T> &ArrayView<T>::operator=(const Other &other) {
+			if (other.shape().operator!=(m_shape)) {
+				throw std::runtime_error(fmt::format(
+				  "Cannot assign an array with shape {} to an ArrayView with shape {}",
+				  other.shape().str(),
+				  m_shape.str()));
+			}
+
+			auto &storage = m_ref.storage();
+			forEachOffset([&](int64_t index, int64_t offset) {
+				storage[offset] = static_cast<Scalar>(other.scalar(index));
+			});
 			return *this;
 		}
 
 		template<typename T>
 		auto ArrayView<T>::operator[](int64_t index) const -> ArrayView<ArrayType> {
-			LIBRAPID_ASSERT(
-			  index >= 0 && index < static_cast<int64_t>(m_shape[0]),
-			  "Index {} out of bounds in ArrayContainer::operator[] with leading dimension={}",
-			  index,
-			  m_shape[0]);
-			ArrayView<ArrayType> view(m_ref);
-			const auto stride = Stride(m_shape);
-			view.setShape(m_shape.subshape(1, ndim()));
-			if (ndim() == 1)
-				view.setStride(Stride({1}));
-			else
-				view.setStride(stride.subshape(1, ndim()));
-			view.setOffset(m_offset + index * stride[0]);
-			return view;
+			return slice(index);
+		}
+
+		template<typename T>
+		template<typename... Indices>
+		auto ArrayView<T>::slice(const Indices &...indices) const -> ArrayView {
+			static_assert(((std::is_integral_v<Indices> || std::is_same_v<Indices, Slice>)&&...),
+						  "ArrayView::slice only accepts integers and Slice objects");
+
+			const int64_t dims = ndim();
+			if (static_cast<int64_t>(sizeof...(Indices)) > dims) {
+				throw std::runtime_error(
+				  fmt::format("Cannot index {} dimensions of an ArrayView with {} dimensions",
+							  sizeof...(Indices),
+							  dims));
+			}
+
+			// Kept dimensions are moved down in place, so the result never needs more space
+			// than this ArrayView
+			ArrayView res(*this);
+			int64_t dim = 0, kept = 0;
+			const auto apply = [&](const auto &index) {
+				const auto extent = static_cast<int64_t>(m_shape[dim]);
+				const auto stride = static_cast<int64_t>(m_stride[dim]);
+
+				if constexpr (std::is_same_v<std::decay_t<decltype(index)>, Slice>) {
+					int64_t first		= 0;
+					const int64_t count = detail::resolveSlice(index, extent, first);
+					if (count > 0) res.m_offset += first * stride;
+					res.m_shape[kept]  = static_cast<size_t>(count);
+					res.m_stride[kept] = static_cast<size_t>(stride * index.step);
+					++kept;
+				} else {
+					const auto value = static_cast<int64_t>(index);
+					if (value < -extent || value >= extent) {
+						throw std::runtime_error(
+						  fmt::format("Index {} is out of range for dimension {} with {} elements",
+									  value,
+									  dim,
+									  extent));
+					}
+					res.m_offset += (value < 0 ? value + extent : value) * stride;
+				}
+				++dim;
+			};
+			(apply(indices), ...);
+
+			for (; dim < dims; ++dim, ++kept) {
+				res.m_shape[kept]  = m_shape[dim];
+				res.m_stride[kept] = m_stride[dim];
+			}
+
+			res.m_shape	 = res.m_shape.subshape(0, kept);
+			res.m_stride = res.m_stride.subshape(0, kept);
+			return res;
 		}
 
 		template<typename T>
@@ -174,12 +334,12 @@ namespace librapid {
 		}
 
 		template<typename T>
-		auto ArrayView<T>::shape() const -> ShapeType {
+		auto ArrayView<T>::shape() const -> const ShapeType & {
 			return m_shape;
 		}
 
 		template<typename T>
-		auto ArrayView<T>::stride() const -> StrideType {
+		auto ArrayView<T>::stride() const -> const StrideType & {
 			return m_stride;
 		}
 
@@ -212,41 +372,79 @@ namespace librapid {
 		auto ArrayView<T>::scalar(int64_t index) const -> auto {
 			if (ndim() == 0) return m_ref.scalar(m_offset);
 
-			ShapeType tmp	= ShapeType::zeros(ndim());
-			tmp[ndim() - 1] = index % m_shape[ndim() - 1];
-			for (int64_t i = ndim() - 2; i >= 0; --i) {
-				index /= m_shape[i + 1];
-				tmp[i] = index % m_shape[i];
+			// Convert the flat index to an offset one dimension at a time, starting from the last.
+			// What remains of the index after the inner dimensions is the index into the first
+			// one, so it needs no division. The loop is bounded by MaxDimensions, so it unrolls
+			// fully for a RankedArray
+			const int64_t dims = ndim();
+			int64_t offset	   = 0;
+			for (size_t j = 1; j < ShapeType::MaxDimensions && static_cast<int64_t>(j) < dims;
+				 ++j) {
+				const int64_t i	  = dims - static_cast<int64_t>(j);
+				const auto extent = static_cast<int64_t>(m_shape[i]);
+				offset += (index % extent) * static_cast<int64_t>(m_stride[i]);
+				index /= extent;
 			}
-			int64_t offset = 0;
-			for (int64_t i = 0; i < ndim(); ++i) { offset += tmp[i] * m_stride[i]; }
+			offset += index * static_cast<int64_t>(m_stride[0]);
 			return m_ref.scalar(m_offset + offset);
 		}
 
 		template<typename T>
-		auto ArrayView<T>::eval() const -> ArrayType {
-			ArrayType res(m_shape);
-			ShapeType coord = ShapeType::zeros(m_shape.ndim());
-			int64_t d = 0, p = 0;
-			int64_t idim = 0, adim = 0;
-			const int64_t ndim = m_shape.ndim();
-
-			do {
-				res.storage()[d++] = m_ref.scalar(p + m_offset);
-
-				for (idim = 0; idim < ndim; ++idim) {
-					adim = ndim - idim - 1;
-					if (++coord[adim] == m_shape[adim]) {
-						coord[adim] = 0;
-						p			= p - (m_shape[adim] - 1) * m_stride[adim];
-					} else {
-						p = p + m_stride[adim];
-						break;
-					}
+		auto ArrayView<T>::eval() const -> EvalType {
+			EvalType res(m_shape);
+			auto &storage = res.storage();
+			forEachOffset(
+			  [&](int64_t index, int64_t offset) { storage[index] = m_ref.scalar(offset); });
+			return res;
+		}
+
+		template<typename T>
+		template<typename Func>
+		void ArrayView<T>::forEachOffset(Func &&func) const {
+			const int64_t dims = ndim();
+			if (dims == 0) {
+				func(int64_t(0), m_offset);
+				return;
+			}
+			if (m_shape.size() == 0) return;
+
+			// Walk the last dimension directly, and the others like an odometer
+			const auto extent = static_cast<int64_t>(m_shape[dims - 1]);
+			const auto stride = static_cast<int64_t>(m_stride[dims - 1]);
+			int64_t coord[ShapeType::MaxDimensions] {0};
+			int64_t base = m_offset, index = 0;
+
+			while (true) {
+				// A separate contiguous loop lets the compiler vectorise the common case
+				if (stride == 1) {
+					for (int64_t i = 0; i < extent; ++i) func(index + i, base + i);
+				} else {
+					for (int64_t i = 0; i < extent; ++i) func(index + i, base + i * stride);
 				}
-			} while (idim < ndim);
+				index += extent;
+
+				int64_t dim = dims - 2;
+				for (size_t j = 1; j < ShapeType::MaxDimensions && dim >= 0; ++j, --dim) {
+					const auto step = static_cast<int64_t>(m_stride[dim]);
+					base += step;
+					if (++coord[dim] < static_cast<int64_t>(m_shape[dim])) break;
+					base -= coord[dim] * step;
+					coord[dim] = 0;
+				}
+				if (dim < 0) return;
+			}
+		}
 
-			return res;
+		template<typename ShapeType_, typename StorageType_>
+		template<typename... Indices>
+		auto ArrayContainer<ShapeType_, StorageType_>::slice(const Indices &...indices) const {
+			return ArrayView<const ArrayContainer>(*this).slice(indices...);
+		}
+
+		template<typename ShapeType_, typename StorageType_>
+		template<typename... Indices>
+		auto ArrayContainer<ShapeType_, StorageType_>::slice(const Indices &...indices) {
+			return ArrayView<ArrayContainer>(*this).slice(indices...);
 		}
 	} // namespace array
 } // namespace librapid
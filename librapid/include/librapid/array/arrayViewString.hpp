@@ -3,102 +3,176 @@
 
 namespace librapid {
 	namespace detail {
-		/// Count the width of a value for use in a String representation of an Array. The returned
-		/// tuple contains the length of the value before and after the central point. For floating
-		/// point values, the central point is the decimal point. For integer values, the central
-		/// point is the end of the value
-		/// \tparam T The type of the value to count the width of
-		/// \param val The value to count the width of
-		/// \param format The format string to use when converting the value to a String
-		/// \return The relevant widths of the value
-		template<typename T, typename std::enable_if_t<std::is_fundamental_v<T>, int> = 0>
-		LIBRAPID_INLINE std::pair<int64_t, int64_t> countWidth(const T &val,
-															   const std::string &format) {
-			std::string str = fmt::format(format, val);
-			auto point		= str.find('.');
-			if (point == std::string::npos) { return {str.size(), 0}; }
-			return {point, str.size() - point};
-		}
+		/// Return the indices along one dimension of an array which are printed. If the array is
+		/// being elided, only the first and last `global::printEdgeItems` indices are printed,
+		/// and the gap between them is marked by a single -1.
+		/// \param size The size of the dimension
+		/// \param elide True if the array is large enough to be elided
+		/// \return The printed indices
+		LIBRAPID_INLINE std::vector<int64_t> printedIndices(int64_t size, bool elide) {
+			const int64_t edgeItems = ::librapid::max(global::printEdgeItems, int64_t(0));
+			std::vector<int64_t> indices;
+
+			if (!elide || size <= 2 * edgeItems) {
+				indices.resize(size);
+				std::iota(indices.begin(), indices.end(), int64_t(0));
+				return indices;
+			}
 
-		template<typename T, typename std::enable_if_t<!std::is_fundamental_v<T>, int> = 0>
-		LIBRAPID_INLINE std::pair<int64_t, int64_t> countWidth(const T &val,
-															   const std::string &format) {
-			std::string str = fmt::format(format, val);
-			return {str.size(), 0};
+			indices.reserve(2 * edgeItems + 1);
+			for (int64_t i = 0; i < edgeItems; ++i) indices.push_back(i);
+			indices.push_back(-1);
+			for (int64_t i = size - edgeItems; i < size; ++i) indices.push_back(i);
+			return indices;
 		}
 
+		/// Converts an ArrayView to a string, aligning items down the columns. Each printed
+		/// element is formatted exactly once, into a single buffer, and its width is measured
+		/// from there. For floating point values, the items are aligned on the decimal point.
+		/// Arrays with more than `global::printThreshold` elements only have their edges
+		/// formatted and printed, with "..." in place of the other items.
+		/// \tparam T The type of the array referenced by the ArrayView
 		template<typename T>
-		std::vector<std::pair<int64_t, int64_t>> countColumnWidths(const array::ArrayView<T> &view,
-																   const std::string &format) {
-			if (view.ndim() == 0) {
-				// Scalar
-				return {countWidth(view.scalar(0), format)};
-			} else if (view.ndim() == 1) {
-				// Vector
-				std::vector<std::pair<int64_t, int64_t>> widths(view.shape()[0]);
-				for (int64_t i = 0; i < static_cast<int64_t>(view.shape()[0]); ++i) {
-					widths[i] = countWidth(view.scalar(i), format);
+		class ArrayFormatter {
+		public:
+			using View	 = array::ArrayView<T>;
+			using Scalar = std::decay_t<decltype(std::declval<const View &>().scalar(0))>;
+
+			/// \param view The ArrayView to format
+			/// \param format The format string used for each element
+			ArrayFormatter(const View &view, const std::string &format) :
+					m_view(view), m_format(format), m_ndim(view.ndim()) {
+				const auto shape = view.shape();
+				const bool elide =
+				  global::printThreshold >= 0 &&
+				  static_cast<int64_t>(shape.size()) > global::printThreshold;
+
+				m_indices.resize(m_ndim);
+				for (int64_t i = 0; i < m_ndim; ++i) {
+					m_indices[i] = printedIndices(static_cast<int64_t>(shape[i]), elide);
+				}
+
+				if (m_ndim > 0) {
+					m_widths.resize(m_indices.back().size(), {0, 0});
+					formatElements(0, 0);
 				}
-				return widths;
-			} else {
-				// General
-				std::vector<std::pair<int64_t, int64_t>> widths =
-				  countColumnWidths(view[0], format);
-				for (int64_t i = 1; i < static_cast<int64_t>(view.shape()[0]); ++i) {
-					auto subWidths = countColumnWidths(view[i], format);
-					for (int64_t j = 0; j < static_cast<int64_t>(widths.size()); ++j) {
-						widths[j].first	 = ::librapid::max(widths[j].first, subWidths[j].first);
-						widths[j].second = ::librapid::max(widths[j].second, subWidths[j].second);
+			}
+
+			/// \return The formatted array
+			LIBRAPID_NODISCARD std::string str() {
+				if (m_ndim == 0) return fmt::format(m_format, m_view.scalar(0));
+
+				fmt::memory_buffer out;
+				out.reserve(m_text.size() + m_ends.size() * 2);
+				size_t element = 0;
+				write(out, 0, element, 0);
+				return fmt::to_string(out);
+			}
+
+		private:
+			/// Format every printed element in dimensions \p dim and above, in row-major order
+			/// \param dim The dimension
+			/// \param flat The flat index of the first element of the sub-array being formatted
+			void formatElements(int64_t dim, int64_t flat) {
+				const int64_t extent			   = static_cast<int64_t>(m_view.shape()[dim]);
+				const std::vector<int64_t> &indices = m_indices[dim];
+
+				for (size_t pos = 0; pos < indices.size(); ++pos) {
+					if (indices[pos] < 0) continue;
+					const int64_t next = flat * extent + indices[pos];
+					if (dim + 1 < m_ndim) {
+						formatElements(dim + 1, next);
+					} else {
+						formatElement(next, pos);
 					}
 				}
-				return widths;
 			}
-		}
 
-		template<typename T>
-		std::string arrayViewToString(const array::ArrayView<T> &view, const std::string &format,
-									  const std::vector<std::pair<int64_t, int64_t>> &widths,
-									  int64_t indent) {
-			if (view.ndim() == 0) { return fmt::format(format, view.scalar(0)); }
-
-			if (view.ndim() == 1) {
-				std::string str = "[";
-				for (int64_t i = 0; i < static_cast<int64_t>(view.shape()[0]); i++) {
-					std::pair<int64_t, int64_t> width = detail::countWidth(view.scalar(i), format);
-					str += fmt::format("{:>{}}{}{:>{}}",
-									   "",
-									   widths[i].first - width.first,
-									   fmt::format(format, view.scalar(i)),
-									   "",
-									   widths[i].second - width.second);
-					if (i != view.shape()[0] - 1) { str += " "; }
+			/// Format one element, and update the width of its column
+			/// \param flat The flat index of the element
+			/// \param column The position of the element in the printed row
+			void formatElement(int64_t flat, size_t column) {
+				const size_t start = m_text.size();
+				fmt::format_to(std::back_inserter(m_text), m_format, m_view.scalar(flat));
+				const int64_t length = static_cast<int64_t>(m_text.size() - start);
+
+				// For floating point values, the central point is the decimal point. For integer
+				// values, the central point is the end of the value
+				int64_t before = length;
+				if constexpr (std::is_fundamental_v<Scalar>) {
+					const char *begin = m_text.data() + start;
+					const char *point = std::find(begin, begin + length, '.');
+					before			  = static_cast<int64_t>(point - begin);
 				}
-				str += "]";
-				return str;
+
+				m_ends.push_back(m_text.size());
+				m_before.push_back(before);
+				m_widths[column].first	= ::librapid::max(m_widths[column].first, before);
+				m_widths[column].second = ::librapid::max(m_widths[column].second, length - before);
 			}
 
-			std::string str = "[";
-			for (int64_t i = 0; i < static_cast<int64_t>(view.shape()[0]); i++) {
-				if (i > 0) str += std::string(indent + 1, ' ');
-				str += arrayViewToString(view[i], format, widths, indent + 1);
-				if (i != view.shape()[0] - 1) {
-					str += "\n";
-					if (view.ndim() > 2) { str += "\n"; }
+			/// Append the formatted sub-array in dimensions \p dim and above to \p out
+			/// \param out The buffer to write to
+			/// \param dim The dimension
+			/// \param element The index of the next formatted element
+			/// \param indent The indentation of the sub-array
+			void write(fmt::memory_buffer &out, int64_t dim, size_t &element,
+					   int64_t indent) const {
+				const auto pad = [&out](int64_t count) {
+					for (int64_t i = 0; i < count; ++i) out.push_back(' ');
+				};
+				constexpr const char *ellipsis = "...";
+
+				const std::vector<int64_t> &indices = m_indices[dim];
+				out.push_back('[');
+				for (size_t pos = 0; pos < indices.size(); ++pos) {
+					if (dim + 1 == m_ndim) {
+						if (pos > 0) out.push_back(' ');
+						if (indices[pos] < 0) {
+							out.append(ellipsis, ellipsis + 3);
+							continue;
+						}
+
+						const size_t begin	 = element == 0 ? 0 : m_ends[element - 1];
+						const int64_t length = static_cast<int64_t>(m_ends[element] - begin);
+						pad(m_widths[pos].first - m_before[element]);
+						out.append(m_text.data() + begin, m_text.data() + m_ends[element]);
+						pad(m_widths[pos].second - (length - m_before[element]));
+						++element;
+					} else {
+						if (pos > 0) {
+							out.push_back('\n');
+							if (m_ndim - dim > 2) out.push_back('\n');
+							pad(indent + 1);
+						}
+						if (indices[pos] < 0) {
+							out.append(ellipsis, ellipsis + 3);
+						} else {
+							write(out, dim + 1, element, indent + 1);
+						}
+					}
 				}
+				out.push_back(']');
 			}
-			str += "]";
-			return str;
-		}
+
+			const View &m_view;
+			const std::string &m_format;
+			int64_t m_ndim;
+
+			std::vector<std::vector<int64_t>> m_indices;
+			fmt::memory_buffer m_text;
+			std::vector<size_t> m_ends;
+			std::vector<int64_t> m_before;
+			std::vector<std::pair<int64_t, int64_t>> m_widths;
+		};
 	} // namespace detail
 
 	namespace array {
 		template<typename T>
 		auto ArrayView<T>::str(const std::string &format) const -> std::string {
-			std::vector<std::pair<int64_t, int64_t>> widths =
-			  detail::countColumnWidths(*this, format);
-			return detail::arrayViewToString(*this, format, widths, 0);
+			return detail::ArrayFormatter<T>(*this, format).str();
 		}
 	} // namespace array
 } // namespace librapid
 
-#endif // LIBRAPID_ARRAY_ARRAY_VIEW_STRING_HPP
\ No newline at end of file
+#endif // LIBRAPID_ARRAY_ARRAY_VIEW_STRING_HPP
@@ -5,6 +5,252 @@ namespace librapid::detail {
 	// All assignment operators are forward declared in "forward.hpp" so they can be used
 	// elsewhere. They are defined here.
 
+	namespace impl {
+		/// Evaluates as true if \p T can be passed to a runtime-dispatched kernel operating on
+		/// \p Scalar values (an arithmetic scalar, or an array container with contiguous host
+		/// storage of the same scalar type)
+		/// \tparam Scalar The scalar type of the kernel
+		/// \tparam T The operand type
+		/// \return True if the operand can be dispatched
+		template<typename Scalar, typename T>
+		constexpr bool isDispatchOperand() {
+			using Type = std::decay_t<T>;
+			if constexpr (typetraits::TypeInfo<Type>::type ==
+						  ::librapid::detail::LibRapidType::Scalar) {
+				return std::is_arithmetic_v<Type> && !scalarPromotes<Scalar, Type>();
+			} else if constexpr (typetraits::TypeInfo<Type>::type ==
+								 ::librapid::detail::LibRapidType::ArrayContainer) {
+				using StorageType = typename Type::StorageType;
+				return (typetraits::IsStorage<StorageType>::value ||
+						typetraits::IsFixedStorage<StorageType>::value ||
+						typetraits::IsMappedStorage<StorageType>::value) &&
+					   typetraits::IsSame<typename Type::Scalar, Scalar>;
+			} else {
+				return false;
+			}
+		}
+
+		/// Evaluates as true if a Function can be evaluated with a runtime-dispatched kernel
+		/// (see "cpuDispatch.hpp")
+		/// \tparam Scalar The scalar type of the result
+		/// \tparam Functor_ The function type
+		/// \tparam Args The argument types of the function
+		/// \return True if the function can be dispatched
+		template<typename Scalar, typename Functor_, typename... Args>
+		constexpr bool canDispatch() {
+			if constexpr (sizeof...(Args) != 2) {
+				return false;
+			} else {
+				return dispatch::IsDispatchable<Scalar>::value &&
+					   dispatch::BinaryOpOf<Functor_>::supported &&
+					   (isDispatchOperand<Scalar, Args>() && ...);
+			}
+		}
+
+		/// Return a pointer to the element at \p offset in a contiguous array, or the scalar
+		/// itself (cast to \p Scalar)
+		template<typename Scalar, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto dispatchOperand(const T &obj,
+																	   int64_t offset) {
+			if constexpr (typetraits::TypeInfo<T>::type ==
+						  ::librapid::detail::LibRapidType::Scalar) {
+				return static_cast<Scalar>(obj);
+			} else {
+				return obj.storage().begin() + offset;
+			}
+		}
+
+		/// Evaluate elements [begin, end) of a binary Function into \p dst using the kernel for
+		/// the active SIMD level
+		/// \tparam Scalar The scalar type of the result
+		/// \tparam Functor_ The function type
+		/// \tparam First The type of the first argument
+		/// \tparam Second The type of the second argument
+		/// \param dst Pointer to the first element of the destination
+		/// \param function The function to evaluate
+		/// \param begin The first element to evaluate
+		/// \param end One past the last element to evaluate
+		template<typename Scalar, typename Functor_, typename First, typename Second>
+		LIBRAPID_ALWAYS_INLINE void
+		dispatchBinary(Scalar *dst,
+					   const Function<descriptor::Trivial, Functor_, First, Second> &function,
+					   int64_t begin, int64_t end) {
+			dispatch::binary(dispatch::BinaryOpOf<Functor_>::op,
+							 dst + begin,
+							 dispatchOperand<Scalar>(std::get<0>(function.args()), begin),
+							 dispatchOperand<Scalar>(std::get<1>(function.args()), begin),
+							 end - begin);
+		}
+
+		/// Number of elements each thread processes in a parallel dispatched kernel. This is
+		/// rounded up to a multiple of 64 so threads do not share cache lines.
+		/// \param size The total number of elements
+		/// \return The number of elements per chunk
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t dispatchChunkSize(int64_t size) {
+			const int64_t perThread = (size + global::numThreads - 1) / global::numThreads;
+			return ((perThread + 63) / 64) * 64;
+		}
+
+		/// Assign the elements [begin, end) left over after the vectorised loop. If every
+		/// operand supports partial packets (see detail::HasPartialPacket), the tail is evaluated
+		/// as a single zero-padded packet so it produces the same results as the rest of the
+		/// array. Otherwise, the elements are evaluated one at a time.
+		/// \tparam Container The array container type
+		/// \tparam Function The function type
+		/// \param lhs The array container to assign to
+		/// \param function The function to assign
+		/// \param begin The first element to assign
+		/// \param end One past the last element to assign
+		template<typename Container, typename Function>
+		LIBRAPID_ALWAYS_INLINE void assignTail(Container &lhs, const Function &function,
+											   int64_t begin, int64_t end) {
+			if constexpr (HasPartialPacket<Container>::value &&
+						  HasPartialPacket<Function>::value) {
+				if (begin < end) {
+					lhs.writePartialPacket(
+					  begin, function.partialPacket(begin, end - begin), end - begin);
+				}
+			} else {
+				for (int64_t index = begin; index < end; ++index) {
+					lhs.write(index, function.scalar(index));
+				}
+			}
+		}
+
+		/// Update the elements [begin, end) left over after a vectorised in-place loop
+		/// \see assignTail
+		/// \tparam Functor_ The element-wise functor to apply (e.g. detail::Plus)
+		/// \tparam Container The array container type
+		/// \tparam Operand The type of the right-hand side (see inPlaceOperand)
+		/// \param lhs The array container to update
+		/// \param operand The right-hand side of the operation
+		/// \param begin The first element to update
+		/// \param end One past the last element to update
+		template<typename Functor_, typename Container, typename Operand>
+		LIBRAPID_ALWAYS_INLINE void assignInPlaceTail(Container &lhs, const Operand &operand,
+													  int64_t begin, int64_t end) {
+			using Scalar = typename Container::Scalar;
+			using Packet = typename typetraits::TypeInfo<Scalar>::Packet;
+
+			if constexpr (HasPartialPacket<Container>::value &&
+						  HasPartialPacket<Operand>::value) {
+				if (begin < end) {
+					const size_t count = end - begin;
+					lhs.writePartialPacket(
+					  begin,
+					  Functor_().packet(lhs.partialPacket(begin, count),
+										partialPacketExtractor<Packet>(operand, begin, count)),
+					  count);
+				}
+			} else {
+				for (int64_t index = begin; index < end; ++index) {
+					lhs.write(index,
+							  static_cast<Scalar>(
+								Functor_()(lhs.scalar(index), scalarExtractor(operand, index))));
+				}
+			}
+		}
+
+		/// Trivial assignment to an array container with contiguous host storage -- assignment
+		/// can be done with a single vectorised loop over contiguous data. This is shared by
+		/// all storage types which expose a pointer to their elements.
+		/// \tparam Container The array container type
+		/// \tparam Functor_ The function type
+		/// \tparam Args The argument types of the function
+		/// \param lhs The array container to assign to
+		/// \param function The function to assign
+		template<typename Container, typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assignContiguous(Container &lhs,
+						 const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
+			using Function = detail::Function<descriptor::Trivial, Functor_, Args...>;
+			using Scalar   = typename Container::Scalar;
+
+			constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+			constexpr bool allowVectorisation =
+			  typetraits::TypeInfo<
+				detail::Function<descriptor::Trivial, Functor_, Args...>>::allowVectorisation &&
+			  Function::argsAreSameType;
+
+			const int64_t size		 = function.shape().size();
+			const int64_t vectorSize = size - (size % packetWidth);
+
+			// Ensure the function can actually be assigned to the array container
+			static_assert(
+			  typetraits::IsSame<Scalar, typename std::decay_t<decltype(function)>::Scalar>,
+			  "Function return type must be the same as the array container's scalar type");
+			LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
+
+			if constexpr (impl::canDispatch<Scalar, Functor_, Args...>()) {
+				// Use the kernel compiled for the best instruction set the CPU supports
+				impl::dispatchBinary(lhs.storage().begin(), function, 0, size);
+			} else if constexpr (allowVectorisation) {
+				for (int64_t index = 0; index < vectorSize; index += packetWidth) {
+					lhs.writePacket(index, function.packet(index));
+				}
+
+				// Assign the remaining elements
+				assignTail(lhs, function, vectorSize, size);
+			} else {
+				// Assign the remaining elements
+				for (int64_t index = 0; index < size; ++index) {
+					lhs.write(index, function.scalar(index));
+				}
+			}
+		}
+
+		/// Trivial assignment to an array container with contiguous host storage, with
+		/// parallel execution
+		/// \see assignContiguous
+		template<typename Container, typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void assignContiguousParallel(
+		  Container &lhs,
+		  const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
+			using Scalar				  = typename Container::Scalar;
+			constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+			constexpr bool allowVectorisation = typetraits::TypeInfo<
+			  detail::Function<descriptor::Trivial, Functor_, Args...>>::allowVectorisation;
+
+			const int64_t size		 = function.shape().size();
+			const int64_t vectorSize = size - (size % packetWidth);
+
+			// Ensure the function can actually be assigned to the array container
+			static_assert(
+			  typetraits::IsSame<Scalar, typename std::decay_t<decltype(function)>::Scalar>,
+			  "Function return type must be the same as the array container's scalar type");
+			LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
+
+			if constexpr (impl::canDispatch<Scalar, Functor_, Args...>()) {
+				// Split the array into one contiguous chunk per thread and run the dispatched
+				// kernel on each of them
+				Scalar *dst				= lhs.storage().begin();
+				const int64_t chunkSize = impl::dispatchChunkSize(size);
+
+#pragma omp parallel for shared(dst, function, size, chunkSize) default(none)                      \
+  num_threads(global::numThreads)
+				for (int64_t begin = 0; begin < size; begin += chunkSize) {
+					impl::dispatchBinary(dst, function, begin, std::min(begin + chunkSize, size));
+				}
+			} else if constexpr (allowVectorisation) {
+#pragma omp parallel for shared(vectorSize, lhs, function) default(none)                           \
+  num_threads(global::numThreads)
+				for (int64_t index = 0; index < vectorSize; index += packetWidth) {
+					lhs.writePacket(index, function.packet(index));
+				}
+
+				// Assign the remaining elements
+				assignTail(lhs, function, vectorSize, size);
+			} else {
+#pragma omp parallel for shared(lhs, function, size) default(none)                                 \
+  num_threads(global::numThreads)
+				for (int64_t index = 0; index < size; ++index) {
+					lhs.write(index, function.scalar(index));
+				}
+			}
+		}
+	} // namespace impl
+
 	/// Trivial array assignment operator -- assignment can be done with a single vectorised
 	/// loop over contiguous data.
 	/// \tparam ShapeType_ The shape type of the array container
@@ -19,39 +265,21 @@ namespace librapid::detail {
 	LIBRAPID_ALWAYS_INLINE void
 	assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
 		   const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
-		using Function = detail::Function<descriptor::Trivial, Functor_, Args...>;
-		using Scalar =
-		  typename array::ArrayContainer<ShapeType_,
-										 Storage<StorageScalar, StorageAllocator>>::Scalar;
-		constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
-		constexpr bool allowVectorisation =
-		  typetraits::TypeInfo<
-			detail::Function<descriptor::Trivial, Functor_, Args...>>::allowVectorisation &&
-		  Function::argsAreSameType;
-
-		const int64_t size		 = function.shape().size();
-		const int64_t vectorSize = size - (size % packetWidth);
-
-		// Ensure the function can actually be assigned to the array container
-		static_assert(typetraits::IsSame<Scalar, typename std::decay_t<decltype(function)>::Scalar>,
-					  "Function return type must be the same as the array container's scalar type");
-		LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
-
-		if constexpr (allowVectorisation) {
-			for (int64_t index = 0; index < vectorSize; index += packetWidth) {
-				lhs.writePacket(index, function.packet(index));
-			}
+		impl::assignContiguous(lhs, function);
+	}
 
-			// Assign the remaining elements
-			for (int64_t index = vectorSize; index < size; ++index) {
-				lhs.write(index, function.scalar(index));
-			}
-		} else {
-			// Assign the remaining elements
-			for (int64_t index = 0; index < size; ++index) {
-				lhs.write(index, function.scalar(index));
-			}
-		}
+	/// Trivial assignment to a memory-mapped array
+	/// \tparam ShapeType_ The shape type of the array container
+	/// \tparam StorageScalar The scalar type of the storage object
+	/// \tparam Functor_ The function type
+	/// \tparam Args The argument types of the function
+	/// \param lhs The array container to assign to
+	/// \param function The function to assign
+	template<typename ShapeType_, typename StorageScalar, typename Functor_, typename... Args>
+	LIBRAPID_ALWAYS_INLINE void
+	assign(array::ArrayContainer<ShapeType_, MappedStorage<StorageScalar>> &lhs,
+		   const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
+		impl::assignContiguous(lhs, function);
 	}
 
 	/// Trivial assignment with fixed-size arrays
@@ -79,20 +307,19 @@ namespace librapid::detail {
 					  "Function return type must be the same as the array container's scalar type");
 		LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
 
+		// The number of elements is known at compile time, so small arrays are assigned with
+		// fully unrolled code (see unrolledFor)
 		if constexpr (allowVectorisation) {
-			for (int64_t index = 0; index < vectorSize; index += packetWidth) {
+			unrolledFor<0, vectorSize, packetWidth>([&](int64_t index) LIBRAPID_LAMBDA_INLINE {
 				lhs.writePacket(index, function.packet(index));
-			}
+			});
 
 			// Assign the remaining elements
-			for (int64_t index = vectorSize; index < elements; ++index) {
-				lhs.write(index, function.scalar(index));
-			}
+			impl::assignTail(lhs, function, vectorSize, elements);
 		} else {
-			// Assign the remaining elements
-			for (int64_t index = 0; index < elements; ++index) {
+			unrolledFor<0, elements>([&](int64_t index) LIBRAPID_LAMBDA_INLINE {
 				lhs.write(index, function.scalar(index));
-			}
+			});
 		}
 	}
 
@@ -111,78 +338,410 @@ namespace librapid::detail {
 	LIBRAPID_ALWAYS_INLINE void
 	assignParallel(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
 				   const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
-		using Scalar =
-		  typename array::ArrayContainer<ShapeType_,
-										 Storage<StorageScalar, StorageAllocator>>::Scalar;
-		constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+		impl::assignContiguousParallel(lhs, function);
+	}
 
-		constexpr bool allowVectorisation = typetraits::TypeInfo<
-		  detail::Function<descriptor::Trivial, Functor_, Args...>>::allowVectorisation;
+	/// Trivial assignment to a memory-mapped array with parallel execution
+	/// \see assign(array::ArrayContainer<ShapeType_, MappedStorage<StorageScalar>> &lhs,
+	/// const detail::Function<descriptor::Trivial, Functor_, Args...> &function)
+	template<typename ShapeType_, typename StorageScalar, typename Functor_, typename... Args>
+	LIBRAPID_ALWAYS_INLINE void
+	assignParallel(array::ArrayContainer<ShapeType_, MappedStorage<StorageScalar>> &lhs,
+				   const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
+		impl::assignContiguousParallel(lhs, function);
+	}
 
-		const int64_t size		 = function.shape().size();
-		const int64_t vectorSize = size - (size % packetWidth);
+	/// Trivial assignment with fixed-size arrays and "parallel" execution. Fixed-size arrays are
+	/// small, so starting threads would cost far more than the assignment itself. This is
+	/// always serial and is identical to assign().
+	/// \tparam ShapeType_ The shape type of the array container
+	/// \tparam StorageScalar The scalar type of the storage object
+	/// \tparam StorageSize The size of the storage object
+	/// \tparam Functor_ The function type
+	/// \tparam Args The argument types of the function
+	template<typename ShapeType_, typename StorageScalar, size_t... StorageSize, typename Functor_,
+			 typename... Args>
+	LIBRAPID_ALWAYS_INLINE void assignParallel(
+	  array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+	  const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
+		assign(lhs, function);
+	}
 
-		// Ensure the function can actually be assigned to the array container
-		static_assert(typetraits::IsSame<Scalar, typename std::decay_t<decltype(function)>::Scalar>,
-					  "Function return type must be the same as the array container's scalar type");
+	namespace impl {
+		/// Evaluates as true if \p Functor provides a `mask` method, returning the result of a
+		/// comparison between two packets as a SIMD mask (see "operations.hpp")
+		template<typename Functor, typename Packet, typename = void>
+		struct HasPacketMask : std::false_type {};
+
+		template<typename Functor, typename Packet>
+		struct HasPacketMask<Functor, Packet,
+							 std::void_t<decltype(std::declval<const Functor &>().mask(
+							   std::declval<const Packet &>(), std::declval<const Packet &>()))>>
+				: std::true_type {};
+
+		/// Convert a SIMD mask into an integer with one bit per lane (lane i is bit i)
+		/// \tparam Width The number of lanes in the mask
+		/// \tparam Mask The mask type
+		/// \param mask The mask to convert
+		/// \return The lanes of the mask
+		template<size_t Width, typename Mask>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE uint64_t maskBits(const Mask &mask) {
+			constexpr uint64_t laneMask = Width >= 64 ? ~uint64_t(0) : (uint64_t(1) << Width) - 1;
+			return static_cast<uint64_t>(mask.toInt()) & laneMask;
+		}
+
+		/// Evaluate a packet of a Function as a SIMD mask. Comparisons return the mask
+		/// directly; any other function is compared against zero.
+		template<typename Function, size_t... I>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
+		functionMask(const Function &function, std::index_sequence<I...>, size_t index) {
+			using Packet	= typename Function::Packet;
+			using ArgPacket = typename Function::ArgPacket;
+			using Functor	= typename Function::Functor;
+			if constexpr (HasPacketMask<Functor, ArgPacket>::value) {
+				return Functor().mask(
+				  packetExtractor<ArgPacket>(std::get<I>(function.args()), index)...);
+			} else {
+				return function.packet(index) != Packet(0);
+			}
+		}
+
+		/// Evaluate \p count (at most 64) consecutive elements of a Function, starting at
+		/// \p begin, as the bits of a single word. Unused bits are zero.
+		/// \tparam Function The function type
+		/// \param function The function to evaluate
+		/// \param begin The first element to evaluate
+		/// \param count The number of elements to evaluate
+		/// \return The packed elements
+		template<typename Function>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE uint64_t
+		evaluateMaskWord(const Function &function, int64_t begin, int64_t count) {
+			using Scalar				  = typename Function::Scalar;
+			constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+			constexpr bool allowVectorisation =
+			  typetraits::TypeInfo<Function>::allowVectorisation && Function::argsAreSameType;
+
+			uint64_t word  = 0;
+			int64_t offset = 0;
+
+			if constexpr (allowVectorisation && std::is_same_v<Scalar, bool>) {
+				// Boolean functions already produce 64 packed lanes at a time
+				if (count == 64) {
+					word   = function.packet(begin).bits();
+					offset = count;
+				}
+			} else if constexpr (allowVectorisation && 64 % packetWidth == 0) {
+				using ArgsTuple		   = std::decay_t<decltype(function.args())>;
+				constexpr auto indices = std::make_index_sequence<std::tuple_size_v<ArgsTuple>>();
+				for (; offset + packetWidth <= count; offset += packetWidth) {
+					word |= maskBits<packetWidth>(functionMask(function, indices, begin + offset))
+							<< offset;
+				}
+			}
+
+			for (; offset < count; ++offset) {
+				word |= static_cast<uint64_t>(static_cast<bool>(function.scalar(begin + offset)))
+						<< offset;
+			}
+			return word;
+		}
+	} // namespace impl
+
+	/// Assignment to a bit-packed boolean array. Each word of 64 elements is evaluated in
+	/// registers and written once. Comparisons write their SIMD masks directly into the bits,
+	/// and any other function is true where it is non-zero.
+	/// \tparam ShapeType_ The shape type of the array container
+	/// \tparam StorageAllocator The Allocator of the BitStorage object
+	/// \tparam Functor_ The function type
+	/// \tparam Args The argument types of the function
+	/// \param lhs The array container to assign to
+	/// \param function The function to assign
+	template<typename ShapeType_, typename StorageAllocator, typename Functor_, typename... Args>
+	LIBRAPID_ALWAYS_INLINE void
+	assign(array::ArrayContainer<ShapeType_, BitStorage<StorageAllocator>> &lhs,
+		   const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
 		LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
 
-		if constexpr (allowVectorisation) {
-#pragma omp parallel for shared(vectorSize, lhs, function) default(none)                           \
+		const int64_t size	   = function.shape().size();
+		const int64_t numWords = lhs.storage().numWords();
+		uint64_t *words		   = lhs.storage().data();
+
+		for (int64_t word = 0; word < numWords; ++word) {
+			const int64_t begin = word * 64;
+			words[word] =
+			  impl::evaluateMaskWord(function, begin, std::min<int64_t>(64, size - begin));
+		}
+	}
+
+	/// Assignment to a bit-packed boolean array with parallel execution
+	/// \see assign(array::ArrayContainer<ShapeType_, BitStorage<StorageAllocator>> &lhs,
+	/// const detail::Function<descriptor::Trivial, Functor_, Args...> &function)
+	template<typename ShapeType_, typename StorageAllocator, typename Functor_, typename... Args>
+	LIBRAPID_ALWAYS_INLINE void
+	assignParallel(array::ArrayContainer<ShapeType_, BitStorage<StorageAllocator>> &lhs,
+				   const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
+		LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
+
+		const int64_t size	   = function.shape().size();
+		const int64_t numWords = lhs.storage().numWords();
+		uint64_t *words		   = lhs.storage().data();
+
+#pragma omp parallel for shared(words, function, size, numWords) default(none)                     \
   num_threads(global::numThreads)
-			for (int64_t index = 0; index < vectorSize; index += packetWidth) {
-				lhs.writePacket(index, function.packet(index));
+		for (int64_t word = 0; word < numWords; ++word) {
+			const int64_t begin = word * 64;
+			words[word] =
+			  impl::evaluateMaskWord(function, begin, std::min<int64_t>(64, size - begin));
+		}
+	}
+
+	namespace impl {
+		template<typename T>
+		struct ArgsAreSameType : std::true_type {};
+
+		template<typename desc, typename Functor_, typename... Args>
+		struct ArgsAreSameType<Function<desc, Functor_, Args...>>
+				: std::bool_constant<Function<desc, Functor_, Args...>::argsAreSameType> {};
+
+		/// Returns true if an in-place operation on an array of \p Scalar values with a
+		/// right-hand side of type \p RHS can be evaluated with packets
+		/// \tparam Scalar The scalar type of the array being assigned to
+		/// \tparam RHS The type of the right-hand side
+		/// \return True if the operation can be vectorised
+		template<typename Scalar, typename RHS>
+		constexpr bool inPlaceAllowVectorisation() {
+			using RHSInfo = typetraits::TypeInfo<RHS>;
+			if constexpr (typetraits::TypeInfo<Scalar>::packetWidth <= 1) {
+				return false;
+			} else if constexpr (RHSInfo::type == ::librapid::detail::LibRapidType::Scalar) {
+				return !scalarPromotes<Scalar, RHS>();
+			} else {
+				return RHSInfo::allowVectorisation &&
+					   typetraits::IsSame<typename RHSInfo::Scalar, Scalar> &&
+					   ArgsAreSameType<RHS>::value;
 			}
+		}
 
-			// Assign the remaining elements
-			for (int64_t index = vectorSize; index < size; ++index) {
-				lhs.write(index, function.scalar(index));
+		/// Scalar right-hand sides are cast to the array's scalar type before use, so they can
+		/// be broadcast into a packet. Scalars which promote the operation (see
+		/// scalarPromotes) are kept as they are, so the operation is evaluated in the promoted
+		/// type. Arrays and functions are returned by reference.
+		/// \tparam Scalar The scalar type of the array being assigned to
+		/// \tparam RHS The type of the right-hand side
+		/// \param rhs The right-hand side
+		/// \return The operand to use in the in-place operation
+		template<typename Scalar, typename RHS>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE decltype(auto) inPlaceOperand(const RHS &rhs) {
+			if constexpr (typetraits::TypeInfo<RHS>::type ==
+							::librapid::detail::LibRapidType::Scalar &&
+						  !scalarPromotes<Scalar, RHS>()) {
+				return static_cast<Scalar>(rhs);
+			} else {
+				return (rhs);
 			}
-		} else {
-#pragma omp parallel for shared(vectorSize, lhs, function, size) default(none)                     \
+		}
+
+		/// In-place trivial assignment to an array container with contiguous host storage
+		/// \tparam Functor_ The element-wise functor to apply (e.g. detail::Plus)
+		/// \tparam Container The array container type
+		/// \tparam RHS The type of the right-hand side (scalar, array container or function)
+		/// \param lhs The array container to update
+		/// \param rhs The right-hand side of the operation
+		template<typename Functor_, typename Container, typename RHS>
+		LIBRAPID_ALWAYS_INLINE void assignInPlaceContiguous(Container &lhs, const RHS &rhs) {
+			using Scalar					  = typename Container::Scalar;
+			using Packet					  = typename typetraits::TypeInfo<Scalar>::Packet;
+			constexpr int64_t packetWidth	  = typetraits::TypeInfo<Scalar>::packetWidth;
+			constexpr bool allowVectorisation = impl::inPlaceAllowVectorisation<Scalar, RHS>();
+
+			if constexpr (typetraits::TypeInfo<RHS>::type !=
+						  ::librapid::detail::LibRapidType::Scalar)
+				LIBRAPID_ASSERT(lhs.shape() == rhs.shape(), "Shapes must be equal");
+
+			const auto &operand		 = impl::inPlaceOperand<Scalar>(rhs);
+			const int64_t size		 = lhs.shape().size();
+			const int64_t vectorSize = size - (size % packetWidth);
+
+			if constexpr (impl::canDispatch<Scalar, Functor_, decltype(lhs), RHS>()) {
+				// Use the kernel compiled for the best instruction set the CPU supports
+				Scalar *dst = lhs.storage().begin();
+				dispatch::binary(dispatch::BinaryOpOf<Functor_>::op,
+								 dst,
+								 dst,
+								 impl::dispatchOperand<Scalar>(rhs, 0),
+								 size);
+			} else if constexpr (allowVectorisation) {
+				for (int64_t index = 0; index < vectorSize; index += packetWidth) {
+					lhs.writePacket(index,
+									Functor_().packet(lhs.packet(index),
+													  packetExtractor<Packet>(operand, index)));
+				}
+
+				// Update the remaining elements
+				assignInPlaceTail<Functor_>(lhs, operand, vectorSize, size);
+			} else {
+				for (int64_t index = 0; index < size; ++index) {
+					lhs.write(index,
+							  static_cast<Scalar>(
+								Functor_()(lhs.scalar(index), scalarExtractor(operand, index))));
+				}
+			}
+		}
+
+		/// In-place trivial assignment to an array container with contiguous host storage, with
+		/// parallel execution
+		/// \see assignInPlaceContiguous
+		template<typename Functor_, typename Container, typename RHS>
+		LIBRAPID_ALWAYS_INLINE void assignInPlaceContiguousParallel(Container &lhs,
+																	const RHS &rhs) {
+			using Scalar					  = typename Container::Scalar;
+			using Packet					  = typename typetraits::TypeInfo<Scalar>::Packet;
+			constexpr int64_t packetWidth	  = typetraits::TypeInfo<Scalar>::packetWidth;
+			constexpr bool allowVectorisation = impl::inPlaceAllowVectorisation<Scalar, RHS>();
+
+			if constexpr (typetraits::TypeInfo<RHS>::type !=
+						  ::librapid::detail::LibRapidType::Scalar)
+				LIBRAPID_ASSERT(lhs.shape() == rhs.shape(), "Shapes must be equal");
+
+			const auto &operand		 = impl::inPlaceOperand<Scalar>(rhs);
+			const int64_t size		 = lhs.shape().size();
+			const int64_t vectorSize = size - (size % packetWidth);
+
+			if constexpr (impl::canDispatch<Scalar, Functor_, decltype(lhs), RHS>()) {
+				Scalar *dst				= lhs.storage().begin();
+				const int64_t chunkSize = impl::dispatchChunkSize(size);
+
+#pragma omp parallel for shared(dst, rhs, size, chunkSize) default(none)                           \
   num_threads(global::numThreads)
-			for (int64_t index = vectorSize; index < size; ++index) {
-				lhs.write(index, function.scalar(index));
+				for (int64_t begin = 0; begin < size; begin += chunkSize) {
+					dispatch::binary(dispatch::BinaryOpOf<Functor_>::op,
+									 dst + begin,
+									 dst + begin,
+									 impl::dispatchOperand<Scalar>(rhs, begin),
+									 std::min(begin + chunkSize, size) - begin);
+				}
+			} else if constexpr (allowVectorisation) {
+#pragma omp parallel for shared(vectorSize, lhs, operand) default(none)                            \
+  num_threads(global::numThreads)
+				for (int64_t index = 0; index < vectorSize; index += packetWidth) {
+					lhs.writePacket(index,
+									Functor_().packet(lhs.packet(index),
+													  packetExtractor<Packet>(operand, index)));
+				}
+
+				// Update the remaining elements
+				assignInPlaceTail<Functor_>(lhs, operand, vectorSize, size);
+			} else {
+#pragma omp parallel for shared(lhs, operand, size) default(none) num_threads(global::numThreads)
+				for (int64_t index = 0; index < size; ++index) {
+					lhs.write(index,
+							  static_cast<Scalar>(
+								Functor_()(lhs.scalar(index), scalarExtractor(operand, index))));
+				}
 			}
 		}
+	} // namespace impl
+
+	/// In-place trivial assignment -- each element of \p lhs is replaced by the result of
+	/// applying \p Functor_ to it and the corresponding element of \p rhs. This reads and writes
+	/// the array's existing storage in a single vectorised loop and never allocates.
+	/// \tparam Functor_ The element-wise functor to apply (e.g. detail::Plus)
+	/// \tparam ShapeType_ The shape type of the array container
+	/// \tparam StorageScalar The scalar type of the storage object
+	/// \tparam StorageAllocator The Allocator of the Storage object
+	/// \tparam RHS The type of the right-hand side (scalar, array container or function)
+	/// \param lhs The array container to update
+	/// \param rhs The right-hand side of the operation
+	template<typename Functor_, typename ShapeType_, typename StorageScalar,
+			 typename StorageAllocator, typename RHS>
+	LIBRAPID_ALWAYS_INLINE void
+	assignInPlace(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+				  const RHS &rhs) {
+		impl::assignInPlaceContiguous<Functor_>(lhs, rhs);
+	}
+
+	/// In-place trivial assignment to a memory-mapped array
+	/// \see assignInPlace
+	template<typename Functor_, typename ShapeType_, typename StorageScalar, typename RHS>
+	LIBRAPID_ALWAYS_INLINE void
+	assignInPlace(array::ArrayContainer<ShapeType_, MappedStorage<StorageScalar>> &lhs,
+				  const RHS &rhs) {
+		impl::assignInPlaceContiguous<Functor_>(lhs, rhs);
 	}
 
-	/// Trivial assignment with fixed-size arrays and parallel execution
+	/// In-place trivial assignment with fixed-size arrays
+	/// \tparam Functor_ The element-wise functor to apply (e.g. detail::Plus)
 	/// \tparam ShapeType_ The shape type of the array container
 	/// \tparam StorageScalar The scalar type of the storage object
 	/// \tparam StorageSize The size of the storage object
-	/// \tparam Functor_ The function type
-	/// \tparam Args The argument types of the function
-	template<typename ShapeType_, typename StorageScalar, size_t... StorageSize, typename Functor_,
-			 typename... Args>
-	LIBRAPID_ALWAYS_INLINE void assignParallel(
+	/// \tparam RHS The type of the right-hand side (scalar, array container or function)
+	/// \param lhs The array container to update
+	/// \param rhs The right-hand side of the operation
+	template<typename Functor_, typename ShapeType_, typename StorageScalar,
+			 size_t... StorageSize, typename RHS>
+	LIBRAPID_ALWAYS_INLINE void assignInPlace(
 	  array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
-	  const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
+	  const RHS &rhs) {
 		using Scalar =
 		  typename array::ArrayContainer<ShapeType_,
 										 FixedStorage<StorageScalar, StorageSize...>>::Scalar;
-		constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+		using Packet					  = typename typetraits::TypeInfo<Scalar>::Packet;
+		constexpr int64_t packetWidth	  = typetraits::TypeInfo<Scalar>::packetWidth;
+		constexpr int64_t elements		  = ::librapid::product<StorageSize...>();
+		constexpr int64_t vectorSize	  = elements - (elements % packetWidth);
+		constexpr bool allowVectorisation = impl::inPlaceAllowVectorisation<Scalar, RHS>();
 
-		constexpr int64_t elements	 = ::librapid::product<StorageSize...>();
-		constexpr int64_t vectorSize = elements - (elements % packetWidth);
+		if constexpr (typetraits::TypeInfo<RHS>::type != ::librapid::detail::LibRapidType::Scalar)
+			LIBRAPID_ASSERT(lhs.shape() == rhs.shape(), "Shapes must be equal");
 
-		// Ensure the function can actually be assigned to the array container
-		static_assert(typetraits::IsSame<Scalar, typename std::decay_t<decltype(function)>::Scalar>,
-					  "Function return type must be the same as the array container's scalar type");
-		LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
+		const auto &operand = impl::inPlaceOperand<Scalar>(rhs);
 
-#pragma omp parallel for shared(vectorSize, lhs, function) default(none)                           \
-  num_threads(global::numThreads)
-		for (int64_t index = 0; index < vectorSize; index += packetWidth) {
-			lhs.writePacket(index, function.packet(index));
-		}
+		const auto updateScalar = [&](int64_t index) LIBRAPID_LAMBDA_INLINE {
+			lhs.write(
+			  index,
+			  static_cast<Scalar>(Functor_()(lhs.scalar(index), scalarExtractor(operand, index))));
+		};
 
-		// Assign the remaining elements
-		for (int64_t index = vectorSize; index < elements; ++index) {
-			lhs.write(index, function.scalar(index));
+		if constexpr (allowVectorisation) {
+			unrolledFor<0, vectorSize, packetWidth>([&](int64_t index) LIBRAPID_LAMBDA_INLINE {
+				lhs.writePacket(
+				  index,
+				  Functor_().packet(lhs.packet(index), packetExtractor<Packet>(operand, index)));
+			});
+
+			// Update the remaining elements
+			impl::assignInPlaceTail<Functor_>(lhs, operand, vectorSize, elements);
+		} else {
+			unrolledFor<0, elements>(updateScalar);
 		}
 	}
 
+	/// In-place trivial assignment with parallel execution
+	/// \tparam Functor_ The element-wise functor to apply (e.g. detail::Plus)
+	/// \tparam ShapeType_ The shape type of the array container
+	/// \tparam StorageScalar The scalar type of the storage object
+	/// \tparam StorageAllocator The Allocator of the Storage object
+	/// \tparam RHS The type of the right-hand side (scalar, array container or function)
+	/// \param lhs The array container to update
+	/// \param rhs The right-hand side of the operation
+	/// \see assignInPlace
+	template<typename Functor_, typename ShapeType_, typename StorageScalar,
+			 typename StorageAllocator, typename RHS>
+	LIBRAPID_ALWAYS_INLINE void assignInPlaceParallel(
+	  array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+	  const RHS &rhs) {
+		impl::assignInPlaceContiguousParallel<Functor_>(lhs, rhs);
+	}
+
+	/// In-place trivial assignment to a memory-mapped array with parallel execution
+	/// \see assignInPlace
+	template<typename Functor_, typename ShapeType_, typename StorageScalar, typename RHS>
+	LIBRAPID_ALWAYS_INLINE void
+	assignInPlaceParallel(array::ArrayContainer<ShapeType_, MappedStorage<StorageScalar>> &lhs,
+						  const RHS &rhs) {
+		impl::assignInPlaceContiguousParallel<Functor_>(lhs, rhs);
+	}
+
 #if defined(LIBRAPID_HAS_CUDA)
 
 	/*
@@ -311,6 +870,26 @@ namespace librapid::detail {
 								 function);
 	}
 
+	/// In-place trivial assignment with CUDA execution
+	/// \tparam Functor_ The element-wise functor to apply (e.g. detail::Plus)
+	/// \tparam ShapeType_ The shape type of the array container
+	/// \tparam StorageScalar The scalar type of the storage object
+	/// \tparam RHS The type of the right-hand side (scalar, array container or function)
+	/// \param lhs The array container to update
+	/// \param rhs The right-hand side of the operation
+	template<typename Functor_, typename ShapeType_, typename StorageScalar, typename RHS>
+	LIBRAPID_ALWAYS_INLINE void
+	assignInPlace(array::ArrayContainer<ShapeType_, CudaStorage<StorageScalar>> &lhs,
+				  const RHS &rhs) {
+		// The element-wise kernels read each input element before writing the corresponding
+		// output element, so the result can be written straight back into lhs
+		using Scalar =
+		  typename array::ArrayContainer<ShapeType_, CudaStorage<StorageScalar>>::Scalar;
+		assign(lhs,
+			   makeFunction<descriptor::Trivial, Functor_>(
+				 lhs, impl::inPlaceOperand<Scalar>(rhs)));
+	}
+
 #endif // LIBRAPID_HAS_CUDA
 } // namespace librapid::detail
 
@@ -0,0 +1,489 @@
+#ifndef LIBRAPID_ARRAY_BIT_STORAGE_HPP
+#define LIBRAPID_ARRAY_BIT_STORAGE_HPP
+
+/*
+ * This file defines the BitStorage class, which stores booleans as the bits of a contiguous
+ * block of 64-bit words. This is the storage type used by Array<bool>, so large masks use one
+ * bit per element rather than one byte (or one element of the compared type).
+ */
+
+namespace librapid {
+	namespace typetraits {
+		template<typename Allocator_>
+		struct TypeInfo<BitStorage<Allocator_>> {
+			static constexpr bool isLibRapidType = true;
+			using Scalar						 = bool;
+			using Device						 = device::CPU;
+		};
+	} // namespace typetraits
+
+	namespace detail {
+		/// A reference to a single bit in a BitStorage object
+		/// \tparam Word The word type of the storage
+		template<typename Word>
+		class BitReference {
+		public:
+			LIBRAPID_ALWAYS_INLINE BitReference(Word *word, Word mask) :
+					m_word(word), m_mask(mask) {}
+
+			LIBRAPID_ALWAYS_INLINE BitReference(const BitReference &other) = default;
+
+			/// Set or clear the referenced bit
+			/// \param value The new value of the bit
+			/// \return *this
+			LIBRAPID_ALWAYS_INLINE BitReference &operator=(bool value) {
+				if (value)
+					*m_word |= m_mask;
+				else
+					*m_word &= ~m_mask;
+				return *this;
+			}
+
+			/// Copy the value of another bit into the referenced bit
+			/// \param other The bit to copy
+			/// \return *this
+			LIBRAPID_ALWAYS_INLINE BitReference &operator=(const BitReference &other) {
+				return *this = static_cast<bool>(other);
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE operator bool() const {
+				return (*m_word & m_mask) != 0;
+			}
+
+		private:
+			Word *m_word;
+			Word m_mask;
+		};
+
+		/// Points to a single bit in a BitStorage object. This is the iterator type of
+		/// BitStorage, and allows BitPacket to load and store whole words.
+		/// \tparam Word The word type of the storage (const for read-only access)
+		template<typename Word>
+		class BitPointer {
+		public:
+			static constexpr size_t wordBits = sizeof(Word) * 8;
+
+			BitPointer() = default;
+
+			LIBRAPID_ALWAYS_INLINE BitPointer(Word *words, size_t index) :
+					m_words(words), m_index(index) {}
+
+			/// \return A pointer to the word containing the referenced bit
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Word *word() const {
+				return m_words + m_index / wordBits;
+			}
+
+			/// \return The position of the referenced bit within its word
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE size_t bit() const {
+				return m_index % wordBits;
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE BitPointer operator+(size_t offset) const {
+				return BitPointer(m_words, m_index + offset);
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool
+			operator==(const BitPointer &other) const {
+				return m_words == other.m_words && m_index == other.m_index;
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool
+			operator!=(const BitPointer &other) const {
+				return !(*this == other);
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator*() const {
+				if constexpr (std::is_const_v<Word>) {
+					return ((*word() >> bit()) & 1) != 0;
+				} else {
+					return BitReference<Word>(word(), Word(1) << bit());
+				}
+			}
+
+			LIBRAPID_ALWAYS_INLINE BitPointer &operator++() {
+				++m_index;
+				return *this;
+			}
+
+		private:
+			Word *m_words  = nullptr;
+			size_t m_index = 0;
+		};
+	} // namespace detail
+
+	template<typename Allocator_ = std::allocator<uint64_t>>
+	class BitStorage {
+	public:
+		using Allocator		 = Allocator_;
+		using Word			 = typename std::allocator_traits<Allocator>::value_type;
+		using Scalar		 = bool;
+		using Pointer		 = detail::BitPointer<Word>;
+		using ConstPointer	 = detail::BitPointer<const Word>;
+		using Reference		 = detail::BitReference<Word>;
+		using ConstReference = bool;
+		using SizeType		 = size_t;
+		using Iterator		 = Pointer;
+		using ConstIterator	 = ConstPointer;
+
+		static_assert(std::is_same_v<Word, uint64_t>, "BitStorage requires 64-bit words");
+		static constexpr SizeType wordBits = 64;
+
+		/// Default constructor
+		BitStorage() = default;
+
+		/// Create a BitStorage object with \p size elements. The elements are initialized to
+		/// false.
+		/// \param size Number of elements to allocate
+		/// \param alloc Allocator to use
+		LIBRAPID_ALWAYS_INLINE explicit BitStorage(SizeType size,
+												   const Allocator &alloc = Allocator());
+
+		/// Create a BitStorage object with \p size elements, each initialized to \p value
+		/// \param size Number of elements to allocate
+		/// \param value Value to initialize each element to
+		/// \param alloc Allocator to use
+		LIBRAPID_ALWAYS_INLINE BitStorage(SizeType size, bool value,
+										  const Allocator &alloc = Allocator());
+
+		/// Create a BitStorage object from another BitStorage object
+		/// \param other BitStorage object to copy
+		LIBRAPID_ALWAYS_INLINE BitStorage(const BitStorage &other);
+
+		/// Move a BitStorage object into this object
+		/// \param other BitStorage object to move
+		LIBRAPID_ALWAYS_INLINE BitStorage(BitStorage &&other) noexcept;
+
+		/// Create a BitStorage object from an std::initializer_list. Each value is converted to
+		/// bool
+		/// \tparam V Type of the elements in the initializer list
+		/// \param list Initializer list to copy
+		/// \param alloc Allocator to use
+		template<typename V>
+		LIBRAPID_ALWAYS_INLINE BitStorage(const std::initializer_list<V> &list,
+										  const Allocator &alloc = Allocator());
+
+		/// Create a BitStorage object from a std::vector. Each value is converted to bool
+		/// \tparam V Type of the elements in the vector
+		/// \param vec Vector to copy
+		/// \param alloc Allocator to use
+		template<typename V>
+		LIBRAPID_ALWAYS_INLINE explicit BitStorage(const std::vector<V> &vec,
+												   const Allocator &alloc = Allocator());
+
+		template<typename V>
+		static BitStorage fromData(const std::initializer_list<V> &list);
+
+		template<typename V>
+		static BitStorage fromData(const std::vector<V> &vec);
+
+		/// Assignment operator for a BitStorage object
+		/// \param other BitStorage object to copy
+		/// \return *this
+		LIBRAPID_ALWAYS_INLINE BitStorage &operator=(const BitStorage &other);
+
+		/// Move assignment operator for a BitStorage object
+		/// \param other BitStorage object to move
+		/// \return *this
+		LIBRAPID_ALWAYS_INLINE BitStorage &operator=(BitStorage &&other) noexcept;
+
+		/// Free a BitStorage object
+		~BitStorage();
+
+		/// Resize a BitStorage object to \p size elements. Existing elements are preserved and
+		/// new elements are false.
+		/// \param newSize New size of the BitStorage object
+		LIBRAPID_ALWAYS_INLINE void resize(SizeType newSize);
+
+		/// Resize a BitStorage object to \p size elements. Existing elements are not preserved
+		/// \param newSize New size of the BitStorage object
+		LIBRAPID_ALWAYS_INLINE void resize(SizeType newSize, int);
+
+		/// Return the number of elements in the BitStorage object
+		/// \return Number of elements
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE SizeType size() const noexcept;
+
+		/// Return the number of words used to store the elements
+		/// \return Number of words
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE SizeType numWords() const noexcept;
+
+		/// Access the underlying words. Bit i of word w holds element w * 64 + i. Bits past the
+		/// last element are always zero.
+		/// \return Pointer to the first word
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Word *data() noexcept;
+
+		/// Access the underlying words (const)
+		/// \return Pointer to the first word
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const Word *data() const noexcept;
+
+		/// Const access to the element at index \p index
+		/// \param index Index of the element to access
+		/// \return The value of the element
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstReference operator[](SizeType index) const;
+
+		/// Access to the element at index \p index
+		/// \param index Index of the element to access
+		/// \return A reference to the bit holding the element
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Reference operator[](SizeType index);
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Iterator begin() noexcept;
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Iterator end() noexcept;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstIterator begin() const noexcept;
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstIterator end() const noexcept;
+
+		/// Count the number of elements which are true
+		/// \return The number of true elements
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t count() const noexcept;
+
+		/// Return true if any element is true
+		/// \return True if any element is true
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool any() const noexcept;
+
+		/// Return true if every element is true (this is true for an empty storage object)
+		/// \return True if every element is true
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool all() const noexcept;
+
+	private:
+		/// Return the number of words needed to store \p size elements
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static SizeType wordsFor(SizeType size) {
+			return (size + wordBits - 1) / wordBits;
+		}
+
+		/// Copy the elements from \p begin to \p end into this BitStorage object
+		/// \tparam P Iterator type
+		/// \param begin Beginning of data to copy
+		/// \param end End of data to copy
+		template<typename P>
+		LIBRAPID_ALWAYS_INLINE void initData(P begin, P end);
+
+		/// Reallocate the BitStorage object to hold \p newSize elements, without initializing
+		/// the new words
+		/// \param newSize New size of the BitStorage object
+		LIBRAPID_ALWAYS_INLINE void reallocate(SizeType newSize);
+
+		/// Zero the unused bits of the final word
+		LIBRAPID_ALWAYS_INLINE void clearPadding();
+
+		Allocator m_allocator;
+		Word *m_words	= nullptr;
+		SizeType m_size = 0;
+	};
+
+	// Trait implementations
+	namespace typetraits {
+		template<typename T>
+		struct IsBitStorage : std::false_type {};
+
+		template<typename Allocator>
+		struct IsBitStorage<BitStorage<Allocator>> : std::true_type {};
+	} // namespace typetraits
+
+	template<typename A>
+	BitStorage<A>::BitStorage(SizeType size, const Allocator &alloc) : m_allocator(alloc) {
+		reallocate(size);
+		std::fill(m_words, m_words + numWords(), Word(0));
+	}
+
+	template<typename A>
+	BitStorage<A>::BitStorage(SizeType size, bool value, const Allocator &alloc) :
+			m_allocator(alloc) {
+		reallocate(size);
+		std::fill(m_words, m_words + numWords(), value ? ~Word(0) : Word(0));
+		clearPadding();
+	}
+
+	template<typename A>
+	BitStorage<A>::BitStorage(const BitStorage &other) :
+			m_allocator(
+			  std::allocator_traits<A>::select_on_container_copy_construction(other.m_allocator)) {
+		reallocate(other.size());
+		std::copy(other.m_words, other.m_words + numWords(), m_words);
+	}
+
+	template<typename A>
+	BitStorage<A>::BitStorage(BitStorage &&other) noexcept :
+			m_allocator(std::move(other.m_allocator)), m_words(other.m_words),
+			m_size(other.m_size) {
+		other.m_words = nullptr;
+		other.m_size  = 0;
+	}
+
+	template<typename A>
+	template<typename V>
+	BitStorage<A>::BitStorage(const std::initializer_list<V> &list, const Allocator &alloc) :
+			m_allocator(alloc) {
+		initData(list.begin(), list.end());
+	}
+
+	template<typename A>
+	template<typename V>
+	BitStorage<A>::BitStorage(const std::vector<V> &vec, const Allocator &alloc) :
+			m_allocator(alloc) {
+		initData(vec.begin(), vec.end());
+	}
+
+	template<typename A>
+	template<typename V>
+	auto BitStorage<A>::fromData(const std::initializer_list<V> &list) -> BitStorage {
+		BitStorage ret;
+		ret.initData(list.begin(), list.end());
+		return ret;
+	}
+
+	template<typename A>
+	template<typename V>
+	auto BitStorage<A>::fromData(const std::vector<V> &vec) -> BitStorage {
+		BitStorage ret;
+		ret.initData(vec.begin(), vec.end());
+		return ret;
+	}
+
+	template<typename A>
+	auto BitStorage<A>::operator=(const BitStorage &other) -> BitStorage & {
+		if (this != &other) {
+			reallocate(other.size());
+			std::copy(other.m_words, other.m_words + numWords(), m_words);
+		}
+		return *this;
+	}
+
+	template<typename A>
+	auto BitStorage<A>::operator=(BitStorage &&other) noexcept -> BitStorage & {
+		if (this != &other) {
+			std::swap(m_allocator, other.m_allocator);
+			std::swap(m_words, other.m_words);
+			std::swap(m_size, other.m_size);
+		}
+		return *this;
+	}
+
+	template<typename A>
+	BitStorage<A>::~BitStorage() {
+		if (m_words) std::allocator_traits<A>::deallocate(m_allocator, m_words, numWords());
+		m_words = nullptr;
+		m_size	= 0;
+	}
+
+	template<typename A>
+	template<typename P>
+	void BitStorage<A>::initData(P begin, P end) {
+		reallocate(static_cast<SizeType>(std::distance(begin, end)));
+		std::fill(m_words, m_words + numWords(), Word(0));
+		SizeType index = 0;
+		for (P it = begin; it != end; ++it, ++index) {
+			if (static_cast<bool>(*it)) m_words[index / wordBits] |= Word(1) << (index % wordBits);
+		}
+	}
+
+	template<typename A>
+	void BitStorage<A>::reallocate(SizeType newSize) {
+		if (wordsFor(newSize) != numWords()) {
+			if (m_words) std::allocator_traits<A>::deallocate(m_allocator, m_words, numWords());
+			m_words = wordsFor(newSize) > 0
+						? std::allocator_traits<A>::allocate(m_allocator, wordsFor(newSize))
+						: nullptr;
+		}
+		m_size = newSize;
+	}
+
+	template<typename A>
+	void BitStorage<A>::clearPadding() {
+		const SizeType used = m_size % wordBits;
+		if (used != 0) m_words[numWords() - 1] &= (Word(1) << used) - 1;
+	}
+
+	template<typename A>
+	void BitStorage<A>::resize(SizeType newSize) {
+		if (newSize == size()) return;
+		BitStorage tmp(newSize, m_allocator);
+		const SizeType common = std::min(numWords(), tmp.numWords());
+		std::copy(m_words, m_words + common, tmp.m_words);
+		if (newSize < size()) tmp.clearPadding();
+		*this = std::move(tmp);
+	}
+
+	template<typename A>
+	void BitStorage<A>::resize(SizeType newSize, int) {
+		reallocate(newSize);
+		if (numWords() > 0) m_words[numWords() - 1] = 0;
+	}
+
+	template<typename A>
+	auto BitStorage<A>::size() const noexcept -> SizeType {
+		return m_size;
+	}
+
+	template<typename A>
+	auto BitStorage<A>::numWords() const noexcept -> SizeType {
+		return wordsFor(m_size);
+	}
+
+	template<typename A>
+	auto BitStorage<A>::data() noexcept -> Word * {
+		return m_words;
+	}
+
+	template<typename A>
+	auto BitStorage<A>::data() const noexcept -> const Word * {
+		return m_words;
+	}
+
+	template<typename A>
+	auto BitStorage<A>::operator[](SizeType index) const -> ConstReference {
+		LIBRAPID_ASSERT(index < size(), "Index {} out of bounds for size {}", index, size());
+		return (m_words[index / wordBits] >> (index % wordBits)) & 1;
+	}
+
+	template<typename A>
+	auto BitStorage<A>::operator[](SizeType index) -> Reference {
+		LIBRAPID_ASSERT(index < size(), "Index {} out of bounds for size {}", index, size());
+		return Reference(m_words + index / wordBits, Word(1) << (index % wordBits));
+	}
+
+	template<typename A>
+	auto BitStorage<A>::begin() noexcept -> Iterator {
+		return Iterator(m_words, 0);
+	}
+
+	template<typename A>
+	auto BitStorage<A>::end() noexcept -> Iterator {
+		return Iterator(m_words, m_size);
+	}
+
+	template<typename A>
+	auto BitStorage<A>::begin() const noexcept -> ConstIterator {
+		return ConstIterator(m_words, 0);
+	}
+
+	template<typename A>
+	auto BitStorage<A>::end() const noexcept -> ConstIterator {
+		return ConstIterator(m_words, m_size);
+	}
+
+	template<typename A>
+	int64_t BitStorage<A>::count() const noexcept {
+		int64_t res = 0;
+		for (SizeType i = 0; i < numWords(); ++i) res += detail::popCount(m_words[i]);
+		return res;
+	}
+
+	template<typename A>
+	bool BitStorage<A>::any() const noexcept {
+		for (SizeType i = 0; i < numWords(); ++i) {
+			if (m_words[i] != 0) return true;
+		}
+		return false;
+	}
+
+	template<typename A>
+	bool BitStorage<A>::all() const noexcept {
+		const SizeType fullWords = m_size / wordBits;
+		for (SizeType i = 0; i < fullWords; ++i) {
+			if (m_words[i] != ~Word(0)) return false;
+		}
+		const SizeType used = m_size % wordBits;
+		return used == 0 || m_words[fullWords] == (Word(1) << used) - 1;
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_BIT_STORAGE_HPP
@@ -0,0 +1,633 @@
+#ifndef LIBRAPID_ARRAY_CSV_HPP
+#define LIBRAPID_ARRAY_CSV_HPP
+
+/*
+ * Loading numeric delimited text (CSV, TSV, whitespace-separated columns) into arrays.
+ *
+ * Text is read in large chunks, each ending on a line boundary. Every chunk is split into one
+ * part per thread. The rows in each part are counted in parallel, and the parts are then parsed
+ * in parallel, with each thread writing its values straight into the destination array at the
+ * row given by the counts of the parts before it. No per-row containers are ever created.
+ *
+ * By default, files are read twice: once to count the rows, so the array is allocated once at
+ * its final size, and once to parse them. Single-pass loading grows the storage geometrically
+ * instead, which avoids the second read at the cost of some reallocation.
+ */
+
+namespace librapid {
+	/// Options controlling how delimited text is parsed
+	struct CsvOptions {
+		/// The character separating columns. If this is a space, columns are separated by any
+		/// run of spaces and tabs.
+		char delimiter = ',';
+
+		/// Text from this character to the end of a line is ignored, and lines containing only
+		/// a comment are skipped. Set to '\0' to disable comments.
+		char comment = '#';
+
+		/// The number of lines (such as column headings) to skip at the start of the text
+		size_t skipRows = 0;
+
+		/// If true, the rows are counted before they are parsed, so the array is allocated
+		/// exactly once. Otherwise, the text is read only once and the array grows as rows are
+		/// parsed.
+		bool twoPass = true;
+
+		/// The number of bytes read from a file at once
+		size_t chunkSize = size_t(1) << 24;
+	};
+} // namespace librapid
+
+namespace librapid::detail::csv {
+	/// Chunks are only split between threads if each part is at least this many bytes
+	constexpr size_t minPartBytes = size_t(1) << 16;
+
+	/// Parse a floating point value using only exact arithmetic. A decimal with few enough
+	/// significant digits and a small enough exponent is a mantissa and a power of ten which are
+	/// both exactly representable, so a single (correctly rounded) multiplication or division
+	/// gives the correctly rounded result. This covers most numbers found in text files.
+	/// \tparam Float The floating point type
+	/// \param begin The start of the text
+	/// \param end The end of the text
+	/// \param out The parsed value
+	/// \return True if the text was parsed, false if it needs the general parser
+	template<typename Float>
+	LIBRAPID_NODISCARD bool parseFloatFast(const char *begin, const char *end, Float &out) {
+		constexpr int maxExponent	   = std::numeric_limits<Float>::digits > 24 ? 22 : 10;
+		constexpr uint64_t maxMantissa = uint64_t(1) << std::numeric_limits<Float>::digits;
+		constexpr Float powers[]	   = {1e0,	1e1,  1e2,	1e3,  1e4,	1e5,  1e6,	1e7,
+										  1e8,	1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+										  1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+		// Intermediate results held with extra precision would be rounded twice
+		if constexpr (FLT_EVAL_METHOD != 0) return false;
+
+		const char *ptr		  = begin;
+		const bool isNegative = ptr != end && *ptr == '-';
+		if (ptr != end && (*ptr == '-' || *ptr == '+')) ++ptr;
+
+		uint64_t mantissa = 0;
+		int digits		  = 0;
+		int exponent	  = 0;
+		for (; ptr != end && static_cast<unsigned>(*ptr - '0') < 10; ++ptr, ++digits) {
+			mantissa = mantissa * 10 + static_cast<unsigned>(*ptr - '0');
+		}
+		if (ptr != end && *ptr == '.') {
+			const char *fraction = ++ptr;
+			for (; ptr != end && static_cast<unsigned>(*ptr - '0') < 10; ++ptr, ++digits) {
+				mantissa = mantissa * 10 + static_cast<unsigned>(*ptr - '0');
+			}
+			exponent -= static_cast<int>(ptr - fraction);
+		}
+		if (digits == 0 || digits > 19) return false;
+
+		if (ptr != end && (*ptr == 'e' || *ptr == 'E')) {
+			++ptr;
+			const bool isNegativeExponent = ptr != end && *ptr == '-';
+			if (ptr != end && (*ptr == '-' || *ptr == '+')) ++ptr;
+			if (ptr == end) return false;
+
+			int value = 0;
+			for (; ptr != end && static_cast<unsigned>(*ptr - '0') < 10; ++ptr) {
+				if (value > 10000) return false;
+				value = value * 10 + (*ptr - '0');
+			}
+			exponent += isNegativeExponent ? -value : value;
+		}
+
+		if (ptr != end || mantissa > maxMantissa) return false;
+		if (mantissa != 0 && (exponent < -maxExponent || exponent > maxExponent)) return false;
+
+		Float value = static_cast<Float>(mantissa);
+		if (mantissa != 0) {
+			value = exponent < 0 ? value / powers[-exponent] : value * powers[exponent];
+		}
+		out = isNegative ? -value : value;
+		return true;
+	}
+
+	/// Parse a floating point value of any form, including "inf" and "nan"
+	/// \tparam Float The floating point type
+	/// \param begin The start of the text
+	/// \param end The end of the text
+	/// \param out The parsed value
+	/// \return True if the whole of the text is a valid value
+	template<typename Float>
+	LIBRAPID_NODISCARD bool parseFloat(const char *begin, const char *end, Float &out) {
+		if (parseFloatFast(begin, end, out)) return true;
+
+		// Unlike strtod, from_chars does not accept a leading '+'
+		if (begin != end && *begin == '+') {
+			if (++begin != end && *begin == '-') return false;
+		}
+
+#if defined(__cpp_lib_to_chars)
+		const auto [ptr, error] = std::from_chars(begin, end, out);
+		return error == std::errc() && ptr == end;
+#else
+		// strtod requires a null-terminated string
+		const std::string text(begin, end);
+		char *ptr = nullptr;
+		if constexpr (std::is_same_v<Float, float>) {
+			out = std::strtof(text.c_str(), &ptr);
+		} else {
+			out = std::strtod(text.c_str(), &ptr);
+		}
+		return !text.empty() && ptr == text.c_str() + text.size();
+#endif
+	}
+
+	/// Parse a value of any supported scalar type
+	/// \tparam Scalar The type of the value
+	/// \param begin The start of the text
+	/// \param end The end of the text
+	/// \param out The parsed value
+	/// \return True if the whole of the text is a valid value
+	template<typename Scalar>
+	LIBRAPID_NODISCARD bool parseValue(const char *begin, const char *end, Scalar &out) {
+		if constexpr (std::is_integral_v<Scalar>) {
+			if (begin != end && *begin == '+') {
+				if (++begin != end && *begin == '-') return false;
+			}
+			const auto [ptr, error] = std::from_chars(begin, end, out);
+			return error == std::errc() && ptr == end;
+		} else if constexpr (std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>) {
+			return parseFloat(begin, end, out);
+		} else {
+			float value;
+			if (!parseFloat(begin, end, value)) return false;
+			out = Scalar(value);
+			return true;
+		}
+	}
+
+	/// The characters which separate values, blank space and comments
+	struct Syntax {
+		explicit Syntax(const CsvOptions &options) :
+				delimiter(options.delimiter), comment(options.comment),
+				whitespace(options.delimiter == ' ') {}
+
+		/// \return True for space which may surround a value
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isBlank(char c) const {
+			return (c == ' ' || c == '\t' || c == '\r') && (whitespace || c != delimiter);
+		}
+
+		/// \return True if \p c starts a comment
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isComment(char c) const {
+			return comment != '\0' && c == comment;
+		}
+
+		/// \return True if \p c cannot be part of a value
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool endsValue(char c) const {
+			return (whitespace ? isBlank(c) : c == delimiter) || isComment(c);
+		}
+
+		/// \return The first non-blank character in [\p begin, \p end)
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const char *skipBlanks(const char *begin,
+																		 const char *end) const {
+			while (begin != end && isBlank(*begin)) ++begin;
+			return begin;
+		}
+
+		/// \return The end of the line starting at \p begin (the newline, or \p end)
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static const char *lineEnd(const char *begin,
+																			 const char *end) {
+			const void *newline = std::memchr(begin, '\n', static_cast<size_t>(end - begin));
+			return newline == nullptr ? end : static_cast<const char *>(newline);
+		}
+
+		/// \return True if a line whose first non-blank character is at \p begin contains data
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isData(const char *begin,
+															  const char *end) const {
+			return begin != end && !isComment(*begin);
+		}
+
+		/// Count the values in a line of data
+		/// \param begin The first non-blank character of the line
+		/// \param end The end of the line
+		/// \return The number of values
+		LIBRAPID_NODISCARD size_t countValues(const char *begin, const char *end) const {
+			size_t count = 1;
+			while (true) {
+				while (begin != end && !endsValue(*begin)) ++begin;
+				if (whitespace) begin = skipBlanks(begin, end);
+				if (begin == end || isComment(*begin)) return count;
+				if (!whitespace) ++begin;
+				++count;
+			}
+		}
+
+		char delimiter;
+		char comment;
+		bool whitespace;
+	};
+
+	/// A range of complete lines, processed by one thread
+	struct Part {
+		const char *begin;
+		const char *end;
+		size_t rows		= 0; // Lines containing data
+		size_t lines	= 0; // All lines, including blank lines and comments
+		size_t firstRow = 0; // The index of the first row of data in the whole text
+
+		const char *errorPos = nullptr;
+		std::string error;
+	};
+
+	/// Count the lines and rows of data in a part
+	/// \param part The part
+	/// \param syntax The syntax of the text
+	LIBRAPID_INLINE void countRows(Part &part, const Syntax &syntax) {
+		for (const char *ptr = part.begin; ptr != part.end;) {
+			const char *end = Syntax::lineEnd(ptr, part.end);
+			part.rows += syntax.isData(syntax.skipBlanks(ptr, end), end);
+			++part.lines;
+			ptr = end == part.end ? end : end + 1;
+		}
+	}
+
+	/// Parse one row of data
+	/// \tparam Scalar The type of the values
+	/// \param ptr The first non-blank character of the line
+	/// \param end The end of the line
+	/// \param out The row of the array to write to
+	/// \param cols The number of columns
+	/// \param syntax The syntax of the text
+	/// \param part The part containing the row, which records any error
+	/// \return True on success
+	template<typename Scalar>
+	LIBRAPID_NODISCARD bool parseRow(const char *ptr, const char *end, Scalar *out, size_t cols,
+									 const Syntax &syntax, Part &part) {
+		for (size_t col = 0; col < cols; ++col) {
+			ptr				  = syntax.skipBlanks(ptr, end);
+			const char *value = ptr;
+			while (ptr != end && !syntax.endsValue(*ptr)) ++ptr;
+			const char *valueEnd = ptr;
+			while (valueEnd != value && syntax.isBlank(valueEnd[-1])) --valueEnd;
+
+			if (!parseValue(value, valueEnd, out[col])) {
+				part.errorPos = value;
+				part.error	  = value == valueEnd
+								  ? fmt::format("Missing value in column {}", col + 1)
+								  : fmt::format("Invalid value '{}' in column {}",
+											  std::string(value, valueEnd),
+											  col + 1);
+				return false;
+			}
+
+			if (col + 1 == cols) break;
+			if (syntax.whitespace) ptr = syntax.skipBlanks(ptr, end);
+			if (ptr == end || syntax.isComment(*ptr)) {
+				part.errorPos = ptr;
+				part.error	  = fmt::format("Expected {} columns but found {}", cols, col + 1);
+				return false;
+			}
+			if (!syntax.whitespace) ++ptr;
+		}
+
+		ptr = syntax.skipBlanks(ptr, end);
+		if (ptr != end && !syntax.isComment(*ptr)) {
+			part.errorPos = ptr;
+			part.error	  = fmt::format("Expected {} columns but found more", cols);
+			return false;
+		}
+		return true;
+	}
+
+	/// Parse the rows of data in a part. Parsing stops at the first error, which is recorded in
+	/// the part.
+	/// \tparam Scalar The type of the values
+	/// \param part The part
+	/// \param data The first row of the array
+	/// \param cols The number of columns
+	/// \param syntax The syntax of the text
+	template<typename Scalar>
+	void parseRows(Part &part, Scalar *data, size_t cols, const Syntax &syntax) {
+		Scalar *out = data + part.firstRow * cols;
+		for (const char *ptr = part.begin; ptr != part.end;) {
+			const char *end	  = Syntax::lineEnd(ptr, part.end);
+			const char *first = syntax.skipBlanks(ptr, end);
+			if (syntax.isData(first, end)) {
+				if (!parseRow(first, end, out, cols, syntax, part)) return;
+				out += cols;
+			}
+			ptr = end == part.end ? end : end + 1;
+		}
+	}
+
+	/// Call a function on every part, in parallel if there is more than one
+	/// \tparam Function The type of the function
+	/// \param parts The parts
+	/// \param function The function, which must not throw
+	template<typename Function>
+	void forEachPart(std::vector<Part> &parts, const Function &function) {
+		const int64_t numParts = static_cast<int64_t>(parts.size());
+		Part *data			   = parts.data();
+		if (numParts == 1) {
+			function(data[0]);
+			return;
+		}
+
+#pragma omp parallel for shared(numParts, data, function) default(none)                            \
+  num_threads(global::numThreads)
+		for (int64_t i = 0; i < numParts; ++i) { function(data[i]); }
+	}
+
+	/// Counts and parses the rows of a text, one chunk of complete lines at a time
+	/// \tparam Scalar The type of the values
+	template<typename Scalar>
+	class Reader {
+	public:
+		static_assert(!std::is_same_v<Scalar, bool>, "Boolean arrays cannot be read from text");
+
+		/// \param options The options controlling how the text is parsed
+		/// \param source A description of the text, used in error messages
+		Reader(const CsvOptions &options, std::string source) :
+				m_syntax(options), m_skip(options.skipRows), m_source(std::move(source)) {}
+
+		/// Process a chunk of complete lines (the last line of the text need not end with a
+		/// newline). The rows in the chunk are counted, and then \p reserve is called with the
+		/// total number of rows and columns found so far. If it returns a pointer to the
+		/// array's data (with room for that many rows), the chunk is parsed into it.
+		/// \tparam Reserve The type of the reserve function
+		/// \param begin The start of the chunk
+		/// \param end The end of the chunk
+		/// \param reserve A function returning the array to parse into, or nullptr
+		template<typename Reserve>
+		void process(const char *begin, const char *end, Reserve &&reserve) {
+			for (; m_skip > 0 && begin != end; --m_skip, ++m_lines) {
+				begin = Syntax::lineEnd(begin, end);
+				if (begin != end) ++begin;
+			}
+			if (begin == end) return;
+
+			if (m_cols == 0) findColumns(begin, end);
+
+			std::vector<Part> parts = split(begin, end);
+			forEachPart(parts, [this](Part &part) { countRows(part, m_syntax); });
+
+			size_t rows = m_rows;
+			for (Part &part : parts) {
+				part.firstRow = rows;
+				rows += part.rows;
+			}
+
+			// A chunk holding only comments and blank lines has no rows, and the number of
+			// columns is not known yet, so there is nothing to reserve
+			Scalar *data = m_cols == 0 ? nullptr : reserve(rows, m_cols);
+			if (data != nullptr) {
+				const size_t cols = m_cols;
+				forEachPart(parts,
+							[this, data, cols](Part &part) {
+								parseRows(part, data, cols, m_syntax);
+							});
+
+				for (const Part &part : parts) {
+					if (part.errorPos != nullptr) throwError(begin, part);
+				}
+			}
+
+			for (const Part &part : parts) m_lines += part.lines;
+			m_rows = rows;
+		}
+
+		/// \return The number of rows of data processed
+		LIBRAPID_NODISCARD size_t rows() const { return m_rows; }
+
+		/// \return The number of columns, or zero if no data has been found
+		LIBRAPID_NODISCARD size_t cols() const { return m_cols; }
+
+		/// \return The description of the text
+		LIBRAPID_NODISCARD const std::string &source() const { return m_source; }
+
+	private:
+		/// Set the number of columns from the first line of data in a chunk, if there is one
+		void findColumns(const char *begin, const char *end) {
+			for (const char *ptr = begin; ptr != end;) {
+				const char *lineEnd = Syntax::lineEnd(ptr, end);
+				const char *first	= m_syntax.skipBlanks(ptr, lineEnd);
+				if (m_syntax.isData(first, lineEnd)) {
+					m_cols = m_syntax.countValues(first, lineEnd);
+					return;
+				}
+				ptr = lineEnd == end ? end : lineEnd + 1;
+			}
+		}
+
+		/// Split a chunk into one part per thread, on line boundaries
+		LIBRAPID_NODISCARD std::vector<Part> split(const char *begin, const char *end) const {
+			const size_t bytes	  = static_cast<size_t>(end - begin);
+			const size_t maxParts = static_cast<size_t>(std::max<int64_t>(global::numThreads, 1));
+			const size_t numParts = std::clamp<size_t>(bytes / minPartBytes, 1, maxParts);
+
+			std::vector<Part> parts(numParts);
+			const char *partBegin = begin;
+			for (size_t i = 0; i < numParts; ++i) {
+				const char *partEnd = end;
+				if (i + 1 < numParts) {
+					const char *target = std::max(partBegin, begin + bytes * (i + 1) / numParts);
+					partEnd			   = Syntax::lineEnd(target, end);
+					if (partEnd != end) ++partEnd;
+				}
+				parts[i].begin = partBegin;
+				parts[i].end   = partEnd;
+				partBegin	   = partEnd;
+			}
+			return parts;
+		}
+
+		/// Throw an exception describing the error in a part, with its line number
+		[[noreturn]] void throwError(const char *chunkBegin, const Part &part) const {
+			const size_t line =
+			  m_lines + static_cast<size_t>(std::count(chunkBegin, part.errorPos, '\n')) + 1;
+			throw std::runtime_error(
+			  fmt::format("Failed to parse {} (line {}): {}", m_source, line, part.error));
+		}
+
+		Syntax m_syntax;
+		size_t m_skip;
+		std::string m_source;
+		size_t m_lines = 0;
+		size_t m_rows  = 0;
+		size_t m_cols  = 0;
+	};
+
+	/// Call a function on each chunk of complete lines in a file
+	/// \tparam Function The type of the function
+	/// \param path The path of the file
+	/// \param chunkSize The number of bytes to read at once
+	/// \param function The function, called with the start and end of each chunk
+	template<typename Function>
+	void forEachChunk(const std::string &path, size_t chunkSize, Function &&function) {
+		serialize::File file(path, "rb");
+		std::vector<char> buffer(std::max<size_t>(chunkSize, 1));
+		size_t filled = 0;
+
+		while (true) {
+			// A line longer than a chunk
+			if (filled == buffer.size()) buffer.resize(buffer.size() * 2);
+
+			const size_t bytes = file.readSome(buffer.data() + filled, buffer.size() - filled);
+			filled += bytes;
+			if (bytes == 0) {
+				if (filled > 0) function(buffer.data(), buffer.data() + filled);
+				return;
+			}
+
+			size_t complete = filled;
+			while (complete > 0 && buffer[complete - 1] != '\n') --complete;
+			if (complete == 0) continue;
+
+			function(buffer.data(), buffer.data() + complete);
+			std::memmove(buffer.data(), buffer.data() + complete, filled - complete);
+			filled -= complete;
+		}
+	}
+
+	/// Throw if no data was found
+	template<typename Scalar>
+	void checkNotEmpty(const Reader<Scalar> &reader) {
+		if (reader.rows() == 0) {
+			throw std::runtime_error(fmt::format("{} does not contain any data", reader.source()));
+		}
+	}
+
+	/// Parse text into an existing block of memory
+	/// \tparam Scalar The type of the values
+	/// \tparam ForEachChunk The type of the function providing the text
+	/// \param options The options controlling how the text is parsed
+	/// \param source A description of the text, used in error messages
+	/// \param forEachChunk A function calling its argument on each chunk of the text
+	/// \param data The memory to parse into
+	/// \param rows The expected number of rows
+	/// \param cols The expected number of columns
+	template<typename Scalar, typename ForEachChunk>
+	void readInto(const CsvOptions &options, const std::string &source,
+				  ForEachChunk &&forEachChunk, Scalar *data, size_t rows, size_t cols) {
+		const auto throwShape = [&]() {
+			throw std::runtime_error(
+			  fmt::format("{} does not contain a {}x{} array", source, rows, cols));
+		};
+
+		Reader<Scalar> reader(options, source);
+		forEachChunk([&](const char *begin, const char *end) {
+			reader.process(begin, end, [&](size_t newRows, size_t newCols) {
+				if (newRows > rows || newCols != cols) throwShape();
+				return data;
+			});
+		});
+		if (reader.rows() != rows) throwShape();
+	}
+
+	/// Parse text into a new two-dimensional array
+	/// \tparam Scalar The type of the values
+	/// \tparam ForEachChunk The type of the function providing the text
+	/// \param options The options controlling how the text is parsed
+	/// \param source A description of the text, used in error messages
+	/// \param forEachChunk A function calling its argument on each chunk of the text
+	/// \return The parsed array
+	template<typename Scalar, typename ForEachChunk>
+	auto read(const CsvOptions &options, const std::string &source, ForEachChunk &&forEachChunk)
+	  -> Array<Scalar> {
+		using ArrayType	  = Array<Scalar>;
+		using ShapeType	  = typename ArrayType::ShapeType;
+		using StorageType = typename ArrayType::StorageType;
+
+		Reader<Scalar> reader(options, source);
+
+		if (options.twoPass) {
+			forEachChunk([&reader](const char *begin, const char *end) {
+				reader.process(begin, end, [](size_t, size_t) -> Scalar * { return nullptr; });
+			});
+			checkNotEmpty(reader);
+
+			ArrayType res(ShapeType({reader.rows(), reader.cols()}));
+			readInto(options,
+					 source,
+					 forEachChunk,
+					 res.storage().begin(),
+					 reader.rows(),
+					 reader.cols());
+			return res;
+		}
+
+		// Grow the storage geometrically, so each element is copied a constant number of times
+		StorageType storage;
+		forEachChunk([&](const char *begin, const char *end) {
+			reader.process(begin, end, [&storage](size_t rows, size_t cols) {
+				if (rows * cols > storage.size()) {
+					storage.resize(std::max(rows * cols, storage.size() * 2));
+				}
+				return storage.begin();
+			});
+		});
+		checkNotEmpty(reader);
+
+		storage.resize(reader.rows() * reader.cols());
+		return ArrayType(ShapeType({reader.rows(), reader.cols()}), std::move(storage));
+	}
+} // namespace librapid::detail::csv
+
+namespace librapid {
+	/// Load a file of numeric delimited text (such as CSV) into a two-dimensional array, with
+	/// one row per line of data. The file is read in chunks and parsed on multiple threads.
+	/// \tparam Scalar The scalar type of the array
+	/// \param path The path of the file
+	/// \param options The options controlling how the text is parsed
+	/// \return The parsed array
+	/// \throws std::runtime_error if the file cannot be read, contains an invalid value, or has
+	/// rows with different numbers of columns
+	template<typename Scalar>
+	auto loadCsv(const std::string &path, const CsvOptions &options = {}) -> Array<Scalar> {
+		const std::string source = fmt::format("'{}'", path);
+		return detail::csv::read<Scalar>(options, source, [&](auto &&function) {
+			detail::csv::forEachChunk(path, options.chunkSize, function);
+		});
+	}
+
+	/// Load a file of numeric delimited text into an existing two-dimensional array, which
+	/// must already have the shape of the data. Values are parsed straight into the array's
+	/// storage, so no memory is allocated for the data.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param path The path of the file
+	/// \param dst The array to parse into
+	/// \param options The options controlling how the text is parsed. \p twoPass is ignored.
+	template<typename ShapeType, typename StorageType>
+	void loadCsv(const std::string &path, array::ArrayContainer<ShapeType, StorageType> &dst,
+				 const CsvOptions &options = {}) {
+		static_assert(typetraits::IsStorage<StorageType>::value ||
+						typetraits::IsFixedStorage<StorageType>::value ||
+						typetraits::IsMappedStorage<StorageType>::value,
+					  "Text can only be loaded into arrays stored in host memory");
+
+		const std::string source = fmt::format("'{}'", path);
+		if (dst.shape().ndim() != 2) {
+			throw std::runtime_error(
+			  fmt::format("{} can only be loaded into a two-dimensional array", source));
+		}
+
+		detail::csv::readInto(
+		  options,
+		  source,
+		  [&](auto &&function) { detail::csv::forEachChunk(path, options.chunkSize, function); },
+		  dst.storage().begin(),
+		  static_cast<size_t>(dst.shape()[0]),
+		  static_cast<size_t>(dst.shape()[1]));
+	}
+
+	/// Parse numeric delimited text held in memory into a two-dimensional array
+	/// \tparam Scalar The scalar type of the array
+	/// \param text The text
+	/// \param options The options controlling how the text is parsed. \p chunkSize is ignored.
+	/// \return The parsed array
+	/// \see loadCsv
+	template<typename Scalar>
+	auto parseCsv(std::string_view text, const CsvOptions &options = {}) -> Array<Scalar> {
+		return detail::csv::read<Scalar>(options, "text", [text](auto &&function) {
+			function(text.data(), text.data() + text.size());
+		});
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_CSV_HPP
@@ -0,0 +1,1145 @@
+#ifndef LIBRAPID_ARRAY_FFT_HPP
+#define LIBRAPID_ARRAY_FFT_HPP
+
+/*
+ * Fast Fourier transforms of real and complex arrays, along one axis or along several axes.
+ *
+ * Transforms are computed by precomputed plans, which are cached by length. A plan factorises
+ * its length into radix-4, 2, 3 and 5 stages (and small prime stages for other factors), and
+ * runs them with the Stockham autosort algorithm, which ping-pongs between two buffers instead
+ * of reordering the output. Lengths with a prime factor larger than `maxRadix` are computed
+ * with Bluestein's algorithm, as a convolution of power-of-two length.
+ *
+ * A Stockham stage combines rows of the data, and every element of a row is transformed in the
+ * same way. Lines along an axis other than the last are interleaved, so they are transformed
+ * together, with each row holding one element of many lines. Rows are processed with
+ * ComplexPacket, so the butterflies are vectorised whenever a row holds at least one packet:
+ * every stage of a transform along a leading axis, and every stage but the first few of a
+ * transform along the last axis.
+ *
+ * Many lines are transformed in parallel, in blocks of columns that stay in cache for every
+ * stage. When there are too few blocks to keep every thread busy, each stage of each block is
+ * split between the threads instead.
+ *
+ * Real transforms of even length pack the even and odd elements into the real and imaginary
+ * components of a complex transform of half the length, and separate the result afterwards.
+ */
+
+namespace librapid {
+	namespace fft {
+		/// How the results of a transform are scaled. The names match NumPy's `norm` argument.
+		enum class Norm {
+			Backward, // Forward transforms are unscaled, inverse transforms are scaled by 1/n
+			Ortho,	  // Both directions are scaled by 1/sqrt(n)
+			Forward	  // Forward transforms are scaled by 1/n, inverse transforms are unscaled
+		};
+	} // namespace fft
+
+	namespace detail::fft {
+		/// The largest prime factor computed with a mixed-radix stage. Lengths with larger prime
+		/// factors use Bluestein's algorithm, since a radix-p stage costs O(p) per element.
+		constexpr int64_t maxRadix = 64;
+
+		/// The number of plans kept in the cache of each scalar type
+		constexpr size_t maxCachedPlans = 64;
+
+		/// The number of complex values transformed by one task. Lines along a leading axis are
+		/// split into blocks of columns of about this size, which stay in cache between stages.
+		constexpr int64_t blockSize = 16384;
+
+		/// The smallest number of columns in a block, so each row is still vectorised
+		constexpr int64_t minBlockColumns = 16;
+
+		/// The real type of a (possibly complex) scalar type
+		template<typename Scalar>
+		struct RealType {
+			using Type = Scalar;
+		};
+
+		template<typename T>
+		struct RealType<Complex<T>> {
+			using Type = T;
+		};
+
+		/// The complex type with the same precision as a (possibly complex) scalar type
+		template<typename Scalar>
+		using ComplexType = Complex<typename RealType<Scalar>::Type>;
+
+		/// Transforms work directly on contiguous host memory, with float or double precision
+		template<typename StorageType>
+		constexpr void assertTransformable() {
+			using Real = typename RealType<typename StorageType::Scalar>::Type;
+			static_assert(typetraits::IsStorage<StorageType>::value ||
+							typetraits::IsFixedStorage<StorageType>::value ||
+							typetraits::IsMappedStorage<StorageType>::value,
+						  "FFTs require a Storage, FixedStorage or MappedStorage object");
+			static_assert(std::is_same_v<Real, float> || std::is_same_v<Real, double>,
+						  "FFTs require float, double, Complex<float> or Complex<double> values");
+		}
+
+		/// \return exp(-2 pi i k / n), computed in double precision
+		template<typename T>
+		LIBRAPID_NODISCARD Complex<T> twiddle(int64_t k, int64_t n) {
+			const double angle = -TWOPI * static_cast<double>(k % n) / static_cast<double>(n);
+			return Complex<T>(std::cos(angle), std::sin(angle));
+		}
+
+		/// Split a length into the radices of the stages of a plan: fours first, then a two,
+		/// then odd primes in increasing order
+		/// \param size The length of the transform
+		/// \return The radices, whose product is \p size
+		LIBRAPID_INLINE std::vector<int64_t> factorise(int64_t size) {
+			std::vector<int64_t> radices;
+			while (size % 4 == 0) {
+				radices.push_back(4);
+				size /= 4;
+			}
+			if (size % 2 == 0) {
+				radices.push_back(2);
+				size /= 2;
+			}
+			for (int64_t factor = 3; factor * factor <= size; factor += 2) {
+				while (size % factor == 0) {
+					radices.push_back(factor);
+					size /= factor;
+				}
+			}
+			if (size > 1) radices.push_back(size);
+			return radices;
+		}
+
+		/// One stage of a Stockham transform. The stage splits each sub-transform of length
+		/// `radix * count` into `radix` interleaved sub-transforms of length `count`. A row of the
+		/// stage holds `stride` elements of every line, one from each sub-transform.
+		struct Stage {
+			int64_t radix;	  // The radix of the butterflies
+			int64_t count;	  // The number of butterflies in each sub-transform
+			int64_t stride;	  // The product of the radices of the previous stages
+			int64_t twiddles; // The offset of the stage's twiddle factors
+			int64_t roots;	  // The offset of the roots of unity of a generic radix
+		};
+
+		/// The columns of a block of interleaved lines. A block holds one row of `inner` values
+		/// for each element of a line, and each column is a line. Only the columns in
+		/// [begin, end) are transformed.
+		struct Columns {
+			int64_t inner; // The number of columns
+			int64_t begin; // The first column to transform
+			int64_t end;   // One past the last column to transform
+		};
+
+		template<typename V, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE V loadLane(const Complex<T> *ptr) {
+			if constexpr (std::is_same_v<V, Complex<T>>) {
+				return *ptr;
+			} else {
+				V res;
+				res.load(ptr);
+				return res;
+			}
+		}
+
+		template<typename V, typename T>
+		LIBRAPID_ALWAYS_INLINE void storeLane(const V &value, Complex<T> *ptr) {
+			if constexpr (std::is_same_v<V, Complex<T>>) {
+				*ptr = value;
+			} else {
+				value.store(ptr);
+			}
+		}
+
+		/// Multiply by a real constant, without promoting it to a complex value
+		template<typename V, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE V scaleLane(const V &value, T factor) {
+			return V(value.real() * factor, value.imag() * factor);
+		}
+
+		/// Multiply by -i for a forward transform, or by i for an inverse transform
+		template<bool Inverse, typename V>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE V rotate(const V &value) {
+			if constexpr (Inverse) {
+				return V(-value.imag(), value.real());
+			} else {
+				return V(value.imag(), -value.real());
+			}
+		}
+
+		/// Compute one butterfly of a stage for a complex value or a packet of complex values.
+		/// The inputs are loaded from \p in, transformed, multiplied by the twiddle factors and
+		/// stored to \p out.
+		/// \tparam Radix The radix, or 0 for a generic radix
+		/// \tparam Inverse True for an inverse transform
+		/// \tparam V Complex<T> or a ComplexPacket
+		/// \param radix The radix (used when Radix is 0)
+		/// \param in The first input
+		/// \param inStride The distance between inputs
+		/// \param out The first output
+		/// \param outStride The distance between outputs
+		/// \param twiddles The radix - 1 twiddle factors of the butterfly
+		/// \param twiddle False if every twiddle factor is one
+		/// \param roots The roots of unity of a generic radix
+		/// \param scratch Space for 2 * radix values (used when Radix is 0)
+		template<int Radix, bool Inverse, typename V, typename T>
+		LIBRAPID_ALWAYS_INLINE void butterfly(int64_t radix, const Complex<T> *in,
+											  int64_t inStride, Complex<T> *out,
+											  int64_t outStride, const Complex<T> *twiddles,
+											  bool twiddle, const Complex<T> *roots,
+											  V *scratch) {
+			constexpr T sin60	= T(0.866025403784438646763723170752936183);
+			constexpr T cos72	= T(0.309016994374947424102293417182819059);
+			constexpr T cos144	= T(-0.809016994374947424102293417182819059);
+			constexpr T sin72	= T(0.951056516295153572116439333379382143);
+			constexpr T sin144	= T(0.587785252292473129168705954639072769);
+			const int64_t count = Radix == 0 ? radix : Radix;
+
+			V fixed[Radix == 0 ? 1 : Radix];
+			V *a = Radix == 0 ? scratch : fixed;
+			for (int64_t j = 0; j < count; ++j) a[j] = loadLane<V>(in + j * inStride);
+
+			if constexpr (Radix == 2) {
+				const V t = a[0];
+				a[0]	  = t + a[1];
+				a[1]	  = t - a[1];
+			} else if constexpr (Radix == 3) {
+				const V sum	 = a[1] + a[2];
+				const V diff = rotate<Inverse>(scaleLane(a[1] - a[2], sin60));
+				const V mid	 = a[0] - scaleLane(sum, T(0.5));
+				a[0]		 = a[0] + sum;
+				a[1]		 = mid + diff;
+				a[2]		 = mid - diff;
+			} else if constexpr (Radix == 4) {
+				const V t0 = a[0] + a[2];
+				const V t1 = a[0] - a[2];
+				const V t2 = a[1] + a[3];
+				const V t3 = rotate<Inverse>(a[1] - a[3]);
+				a[0]	   = t0 + t2;
+				a[1]	   = t1 + t3;
+				a[2]	   = t0 - t2;
+				a[3]	   = t1 - t3;
+			} else if constexpr (Radix == 5) {
+				const V t1 = a[1] + a[4];
+				const V t2 = a[2] + a[3];
+				const V t3 = a[1] - a[4];
+				const V t4 = a[2] - a[3];
+				const V m1 = a[0] + scaleLane(t1, cos72) + scaleLane(t2, cos144);
+				const V m2 = a[0] + scaleLane(t1, cos144) + scaleLane(t2, cos72);
+				const V n1 = rotate<Inverse>(scaleLane(t3, sin72) + scaleLane(t4, sin144));
+				const V n2 = rotate<Inverse>(scaleLane(t3, sin144) - scaleLane(t4, sin72));
+				a[0]	   = a[0] + t1 + t2;
+				a[1]	   = m1 + n1;
+				a[2]	   = m2 + n2;
+				a[3]	   = m2 - n2;
+				a[4]	   = m1 - n1;
+			} else {
+				// A direct DFT of the inputs, using the stage's roots of unity
+				V *result = scratch + count;
+				for (int64_t k = 0; k < count; ++k) {
+					V sum = a[0];
+					for (int64_t j = 1; j < count; ++j) {
+						const V root = V(roots[(j * k) % count]);
+						sum			 = sum + (Inverse ? conjMultiply(a[j], root) : a[j] * root);
+					}
+					result[k] = sum;
+				}
+				for (int64_t k = 0; k < count; ++k) a[k] = result[k];
+			}
+
+			storeLane(a[0], out);
+			for (int64_t k = 1; k < count; ++k) {
+				if (twiddle) {
+					const V factor = V(twiddles[k - 1]);
+					storeLane(Inverse ? conjMultiply(a[k], factor) : a[k] * factor,
+							  out + k * outStride);
+				} else {
+					storeLane(a[k], out + k * outStride);
+				}
+			}
+		}
+
+		/// Compute the butterflies of one row of a stage, for the row elements in [begin, end).
+		/// Whole packets of elements are processed together, and the rest one at a time.
+		template<int Radix, bool Inverse, typename T, typename Packet>
+		LIBRAPID_ALWAYS_INLINE void
+		butterflies(int64_t radix, const Complex<T> *in, int64_t inStride, Complex<T> *out,
+					int64_t outStride, const Complex<T> *twiddles, bool twiddle,
+					const Complex<T> *roots, int64_t begin, int64_t end,
+					Complex<T> *scalarScratch, Packet *packetScratch) {
+			int64_t q = begin;
+			if constexpr (complexHasPacket<T>) {
+				constexpr int64_t width = typetraits::TypeInfo<Complex<T>>::packetWidth;
+				for (; q + width <= end; q += width) {
+					butterfly<Radix, Inverse, Packet>(radix,
+													  in + q,
+													  inStride,
+													  out + q,
+													  outStride,
+													  twiddles,
+													  twiddle,
+													  roots,
+													  packetScratch);
+				}
+			}
+
+			for (; q < end; ++q) {
+				butterfly<Radix, Inverse, Complex<T>>(
+				  radix, in + q, inStride, out + q, outStride, twiddles, twiddle, roots,
+				  scalarScratch);
+			}
+		}
+
+		/// Compute the butterflies of a stage with indices in [pBegin, pEnd), for the rows of
+		/// each butterfly in [tBegin, tEnd)
+		/// \tparam Radix The radix, or 0 for a generic radix
+		/// \tparam Inverse True for an inverse transform
+		/// \tparam T The type of the components
+		/// \param stage The stage
+		/// \param twiddles The twiddle factors of the plan
+		/// \param roots The roots of unity of the plan
+		/// \param src The input of the stage
+		/// \param dst The output of the stage
+		/// \param columns The columns to transform
+		template<int Radix, bool Inverse, typename T>
+		void pass(const Stage &stage, const Complex<T> *twiddles, const Complex<T> *roots,
+				  const Complex<T> *src, Complex<T> *dst, const Columns &columns, int64_t pBegin,
+				  int64_t pEnd, int64_t tBegin, int64_t tEnd) {
+			using Packet		  = typename typetraits::TypeInfo<Complex<T>>::Packet;
+			const int64_t radix	  = stage.radix;
+			const int64_t inner	  = columns.inner;
+			const int64_t stride  = stage.stride * inner;
+			const int64_t spacing = stage.count * stride;
+			const bool whole	  = columns.begin == 0 && columns.end == inner;
+
+			std::vector<Complex<T>> scalarScratch(Radix == 0 ? 2 * radix : 0);
+			std::vector<Packet> packetScratch(Radix == 0 && complexHasPacket<T> ? 2 * radix : 0);
+
+			for (int64_t p = pBegin; p < pEnd; ++p) {
+				const Complex<T> *in = src + p * stride;
+				Complex<T> *out		 = dst + p * radix * stride;
+				const auto row		 = [&](int64_t begin, int64_t end) {
+					  butterflies<Radix, Inverse>(radix,
+												  in,
+												  spacing,
+												  out,
+												  stride,
+												  twiddles + stage.twiddles + p * (radix - 1),
+												  p != 0,
+												  roots + stage.roots,
+												  begin,
+												  end,
+												  scalarScratch.data(),
+												  packetScratch.data());
+				};
+
+				// With every column, the rows of one butterfly are contiguous
+				if (whole) {
+					row(tBegin * inner, tEnd * inner);
+				} else {
+					for (int64_t t = tBegin; t < tEnd; ++t) {
+						row(t * inner + columns.begin, t * inner + columns.end);
+					}
+				}
+			}
+		}
+
+		/// Copy the columns of a block of \p rows rows
+		template<typename T>
+		void copyColumns(const Complex<T> *src, Complex<T> *dst, int64_t rows,
+						 const Columns &columns) {
+			for (int64_t row = 0; row < rows; ++row) {
+				const int64_t start = row * columns.inner;
+				std::copy(src + start + columns.begin, src + start + columns.end,
+						  dst + start + columns.begin);
+			}
+		}
+
+		/// Call \p f for every index in [0, count), on multiple threads if \p parallel is true
+		template<typename F>
+		void parallelFor(int64_t count, bool parallel, const F &f) {
+			if (!parallel || count < 2) {
+				for (int64_t i = 0; i < count; ++i) f(i);
+				return;
+			}
+
+#pragma omp parallel for shared(count, f) default(none) num_threads(global::numThreads)
+			for (int64_t i = 0; i < count; ++i) { f(i); }
+		}
+
+		/// A precomputed plan for transforms of one length. Plans are immutable, so one plan can
+		/// be used by many threads at once.
+		/// \tparam T The type of the components (float or double)
+		template<typename T>
+		class Plan {
+		public:
+			/// Create a plan, computing its stages and twiddle factors
+			/// \param size The length of the transform
+			explicit Plan(int64_t size);
+
+			/// \return The length of the transform
+			LIBRAPID_NODISCARD int64_t size() const { return m_size; }
+
+			/// Transform the columns of a block of interleaved lines. The transform is unscaled in
+			/// both directions. \p src and \p dst may be the same.
+			/// \param src The input block
+			/// \param dst The output block
+			/// \param work A block of the same size, used between stages
+			/// \param columns The columns to transform
+			/// \param inverse True for an inverse transform
+			/// \param parallel True to split each stage between the threads
+			void execute(const Complex<T> *src, Complex<T> *dst, Complex<T> *work,
+						 const Columns &columns, bool inverse, bool parallel) const;
+
+		private:
+			template<int Radix, bool Inverse>
+			void runStage(const Stage &stage, const Complex<T> *src, Complex<T> *dst,
+						  const Columns &columns, bool parallel) const;
+
+			template<bool Inverse>
+			void dispatchStage(const Stage &stage, const Complex<T> *src, Complex<T> *dst,
+							   const Columns &columns, bool parallel) const;
+
+			/// Transform each column with Bluestein's algorithm, as a convolution with a chirp
+			void bluestein(const Complex<T> *src, Complex<T> *dst, const Columns &columns,
+						   bool inverse, bool parallel) const;
+
+			int64_t m_size;
+			std::vector<Stage> m_stages;
+			std::vector<Complex<T>> m_twiddles;
+			std::vector<Complex<T>> m_roots;
+
+			// Bluestein's algorithm
+			std::shared_ptr<const Plan<T>> m_convolution; // Plan of the convolution length
+			std::vector<Complex<T>> m_chirp;			  // exp(-pi i k^2 / n)
+			std::vector<Complex<T>> m_filter; // Transform of the conjugate chirp, scaled by 1/m
+		};
+
+		/// Return the plan for transforms of length \p size. Recently used plans are cached, so
+		/// repeated transforms of the same length reuse their twiddle factors.
+		/// \tparam T The type of the components (float or double)
+		/// \param size The length of the transform
+		/// \return The plan
+		template<typename T>
+		std::shared_ptr<const Plan<T>> getPlan(int64_t size) {
+			struct Entry {
+				std::shared_ptr<const Plan<T>> plan;
+				uint64_t lastUse;
+			};
+
+			static std::mutex mutex;
+			static std::map<int64_t, Entry> cache;
+			static uint64_t clock = 0;
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				auto it = cache.find(size);
+				if (it != cache.end()) {
+					it->second.lastUse = ++clock;
+					return it->second.plan;
+				}
+			}
+
+			// Bluestein plans get the plan of their convolution, so the lock is not held here
+			auto plan = std::make_shared<const Plan<T>>(size);
+
+			std::lock_guard<std::mutex> lock(mutex);
+			auto it = cache.find(size);
+			if (it != cache.end()) {
+				// Another thread created the same plan first
+				it->second.lastUse = ++clock;
+				return it->second.plan;
+			}
+
+			if (cache.size() >= maxCachedPlans) {
+				auto oldest = cache.begin();
+				for (auto entry = cache.begin(); entry != cache.end(); ++entry) {
+					if (entry->second.lastUse < oldest->second.lastUse) oldest = entry;
+				}
+				cache.erase(oldest);
+			}
+			cache.emplace(size, Entry {plan, ++clock});
+			return plan;
+		}
+
+		template<typename T>
+		Plan<T>::Plan(int64_t size) : m_size(size) {
+			LIBRAPID_ASSERT(size > 0, "FFT length must be positive");
+			const std::vector<int64_t> radices = factorise(size);
+
+			if (!radices.empty() && radices.back() > maxRadix) {
+				// The smallest power of two which holds a linear convolution of two sequences of
+				// length `size`
+				int64_t length = 1;
+				while (length < 2 * size - 1) length *= 2;
+				m_convolution = getPlan<T>(length);
+
+				// k^2 is reduced modulo 2n incrementally, so large lengths do not overflow and
+				// the angle stays accurate
+				m_chirp.resize(size);
+				int64_t square = 0;
+				for (int64_t k = 0; k < size; ++k) {
+					const double angle =
+					  -PI * static_cast<double>(square) / static_cast<double>(size);
+					m_chirp[k] = Complex<T>(std::cos(angle), std::sin(angle));
+					square	   = (square + 2 * k + 1) % (2 * size);
+				}
+
+				m_filter.assign(length, Complex<T>());
+				m_filter[0] = conj(m_chirp[0]);
+				for (int64_t k = 1; k < size; ++k) {
+					m_filter[k] = m_filter[length - k] = conj(m_chirp[k]);
+				}
+
+				std::vector<Complex<T>> work(length);
+				m_convolution->execute(
+				  m_filter.data(), m_filter.data(), work.data(), {1, 0, 1}, false, false);
+				for (auto &value : m_filter) value *= T(1) / static_cast<T>(length);
+				return;
+			}
+
+			int64_t stride = 1;
+			int64_t span   = size;
+			for (int64_t radix : radices) {
+				const Stage stage {radix,
+								   span / radix,
+								   stride,
+								   static_cast<int64_t>(m_twiddles.size()),
+								   static_cast<int64_t>(m_roots.size())};
+
+				for (int64_t p = 0; p < stage.count; ++p) {
+					for (int64_t k = 1; k < radix; ++k) {
+						m_twiddles.push_back(twiddle<T>(p * k, span));
+					}
+				}
+				if (radix > 5) {
+					for (int64_t j = 0; j < radix; ++j) m_roots.push_back(twiddle<T>(j, radix));
+				}
+
+				m_stages.push_back(stage);
+				stride *= radix;
+				span /= radix;
+			}
+		}
+
+		template<typename T>
+		void Plan<T>::execute(const Complex<T> *src, Complex<T> *dst, Complex<T> *work,
+							  const Columns &columns, bool inverse, bool parallel) const {
+			if (m_convolution) return bluestein(src, dst, columns, inverse, parallel);
+			if (m_stages.empty()) {
+				if (src != dst) copyColumns(src, dst, m_size, columns);
+				return;
+			}
+
+			// The stages alternate between dst and work, starting with whichever makes the last
+			// stage write to dst. In place, the first stage cannot write to dst, so the result
+			// may have to be copied back.
+			Complex<T> *buffers[2] = {dst, work};
+			int64_t target		   = (src == dst || m_stages.size() % 2 == 0) ? 1 : 0;
+			const Complex<T> *in   = src;
+			for (const Stage &stage : m_stages) {
+				Complex<T> *out = buffers[target];
+				if (inverse) {
+					dispatchStage<true>(stage, in, out, columns, parallel);
+				} else {
+					dispatchStage<false>(stage, in, out, columns, parallel);
+				}
+				in = out;
+				target ^= 1;
+			}
+
+			if (in != dst) copyColumns(in, dst, m_size, columns);
+		}
+
+		template<typename T>
+		template<bool Inverse>
+		void Plan<T>::dispatchStage(const Stage &stage, const Complex<T> *src, Complex<T> *dst,
+									const Columns &columns, bool parallel) const {
+			switch (stage.radix) {
+				case 2: return runStage<2, Inverse>(stage, src, dst, columns, parallel);
+				case 3: return runStage<3, Inverse>(stage, src, dst, columns, parallel);
+				case 4: return runStage<4, Inverse>(stage, src, dst, columns, parallel);
+				case 5: return runStage<5, Inverse>(stage, src, dst, columns, parallel);
+				default: return runStage<0, Inverse>(stage, src, dst, columns, parallel);
+			}
+		}
+
+		template<typename T>
+		template<int Radix, bool Inverse>
+		void Plan<T>::runStage(const Stage &stage, const Complex<T> *src, Complex<T> *dst,
+							   const Columns &columns, bool parallel) const {
+			const Complex<T> *twiddles = m_twiddles.data();
+			const Complex<T> *roots	   = m_roots.data();
+			if (!parallel) {
+				return pass<Radix, Inverse>(
+				  stage, twiddles, roots, src, dst, columns, 0, stage.count, 0, stage.stride);
+			}
+
+			// Split whichever of the butterflies or their rows is longer between the threads.
+			// The first stage has many butterflies of one row, and the last has one butterfly of
+			// many rows.
+			const int64_t parts = global::numThreads;
+			const int64_t count = stage.count;
+			const int64_t rows	= stage.stride;
+#pragma omp parallel for shared(parts, count, rows, stage, twiddles, roots, src, dst, columns)    \
+  default(none) num_threads(global::numThreads)
+			for (int64_t part = 0; part < parts; ++part) {
+				if (count >= rows) {
+					pass<Radix, Inverse>(stage,
+										 twiddles,
+										 roots,
+										 src,
+										 dst,
+										 columns,
+										 count * part / parts,
+										 count * (part + 1) / parts,
+										 0,
+										 rows);
+				} else {
+					pass<Radix, Inverse>(stage,
+										 twiddles,
+										 roots,
+										 src,
+										 dst,
+										 columns,
+										 0,
+										 count,
+										 rows * part / parts,
+										 rows * (part + 1) / parts);
+				}
+			}
+		}
+
+		template<typename T>
+		void Plan<T>::bluestein(const Complex<T> *src, Complex<T> *dst, const Columns &columns,
+								bool inverse, bool parallel) const {
+			// X[j] = c[j] * sum_k (x[k] * c[k]) * conj(c[j - k]), where c[k] = exp(-pi i k^2 / n).
+			// An inverse transform uses the conjugate chirp. The filter is symmetric, so the
+			// transform of its conjugate is the conjugate of its transform.
+			const int64_t length = m_convolution->size();
+			const int64_t inner	 = columns.inner;
+			const Columns line {1, 0, 1};
+			std::vector<Complex<T>> buffer(length);
+			std::vector<Complex<T>> work(length);
+
+			for (int64_t column = columns.begin; column < columns.end; ++column) {
+				for (int64_t k = 0; k < m_size; ++k) {
+					const Complex<T> &value = src[k * inner + column];
+					buffer[k] = inverse ? conjMultiply(value, m_chirp[k]) : value * m_chirp[k];
+				}
+				std::fill(buffer.begin() + m_size, buffer.end(), Complex<T>());
+
+				m_convolution->execute(buffer.data(), buffer.data(), work.data(), line, false,
+									   parallel);
+				for (int64_t k = 0; k < length; ++k) {
+					buffer[k] =
+					  inverse ? conjMultiply(buffer[k], m_filter[k]) : buffer[k] * m_filter[k];
+				}
+				m_convolution->execute(buffer.data(), buffer.data(), work.data(), line, true,
+									   parallel);
+
+				for (int64_t k = 0; k < m_size; ++k) {
+					dst[k * inner + column] =
+					  inverse ? conjMultiply(buffer[k], m_chirp[k]) : buffer[k] * m_chirp[k];
+				}
+			}
+		}
+
+		/// \return The factor by which a transform of length \p size is scaled
+		template<typename T>
+		LIBRAPID_NODISCARD T normScale(::librapid::fft::Norm norm, int64_t size, bool inverse) {
+			using ::librapid::fft::Norm;
+			if (size == 0) return T(1);
+			switch (norm) {
+				case Norm::Ortho:
+					return T(1) / static_cast<T>(std::sqrt(static_cast<double>(size)));
+				case Norm::Forward: return inverse ? T(1) : T(1) / static_cast<T>(size);
+				default: return inverse ? T(1) / static_cast<T>(size) : T(1);
+			}
+		}
+
+		/// Multiply \p size values by \p factor, on multiple threads for large arrays
+		template<typename T, typename Scalar>
+		void scaleValues(Scalar *data, int64_t size, T factor) {
+			if (factor == T(1)) return;
+			const int64_t blocks = (size + blockSize - 1) / blockSize;
+			parallelFor(blocks,
+						size > global::multithreadThreshold && global::numThreads > 1,
+						[data, size, factor](int64_t block) {
+							const int64_t end = ::librapid::min((block + 1) * blockSize, size);
+							for (int64_t i = block * blockSize; i < end; ++i) data[i] *= factor;
+						});
+		}
+
+		/// Transform every line of an array along one axis, without scaling. Lines along a
+		/// leading axis are transformed together, in blocks of columns. \p src and \p dst may
+		/// be the same.
+		/// \tparam T The type of the components
+		/// \param src The values
+		/// \param dst The result
+		/// \param lines The lines of the array along the axis
+		/// \param inverse True for an inverse transform
+		template<typename T>
+		void transformLines(const Complex<T> *src, Complex<T> *dst, const sort::Lines &lines,
+							bool inverse) {
+			if (lines.count == 0 || lines.extent == 0) return;
+			const auto plan		  = getPlan<T>(lines.extent);
+			const int64_t inner	  = lines.inner;
+			const int64_t outer	  = lines.count / inner;
+			const int64_t block	  = lines.extent * inner;
+			const int64_t columns = ::librapid::min(
+			  inner, ::librapid::max(blockSize / lines.extent, minBlockColumns));
+			const int64_t columnBlocks = (inner + columns - 1) / columns;
+			const int64_t tasks		   = outer * columnBlocks;
+			const bool large =
+			  lines.count * lines.extent > global::multithreadThreshold && global::numThreads > 1;
+
+			std::vector<Complex<T>> work(lines.count * lines.extent);
+			const auto process = [&](int64_t task, bool parallelStages) {
+				const int64_t offset = (task / columnBlocks) * block;
+				const int64_t begin	 = (task % columnBlocks) * columns;
+				plan->execute(src + offset,
+							  dst + offset,
+							  work.data() + offset,
+							  {inner, begin, ::librapid::min(begin + columns, inner)},
+							  inverse,
+							  parallelStages);
+			};
+
+			// Transform many blocks on separate threads, or a few large blocks on every thread
+			if (large && tasks >= global::numThreads) {
+#pragma omp parallel for shared(tasks, process) default(none) num_threads(global::numThreads)
+				for (int64_t task = 0; task < tasks; ++task) { process(task, false); }
+			} else {
+				for (int64_t task = 0; task < tasks; ++task) process(task, large);
+			}
+		}
+
+		/// Transform an array in place along each of several axes, then scale it
+		/// \tparam T The type of the components
+		/// \tparam ShapeType The shape type of the array
+		/// \param data The values
+		/// \param shape The shape of the array
+		/// \param axes The axes to transform along
+		/// \param inverse True for inverse transforms
+		/// \param norm The normalisation
+		/// \throws std::runtime_error if an axis is out of range
+		template<typename T, typename ShapeType>
+		void transformAxes(Complex<T> *data, const ShapeType &shape,
+						   const std::vector<int64_t> &axes, bool inverse,
+						   ::librapid::fft::Norm norm) {
+			T factor = T(1);
+			for (int64_t axis : axes) {
+				const sort::Lines lines = sort::lines(shape, axis);
+				transformLines(data, data, lines, inverse);
+				factor *= normScale<T>(norm, lines.extent, inverse);
+			}
+			scaleValues(data, static_cast<int64_t>(shape.size()), factor);
+		}
+
+		/// \return \p axes, or every axis of \p shape if \p axes is empty
+		template<typename ShapeType>
+		std::vector<int64_t> axesOrAll(const ShapeType &shape, const std::vector<int64_t> &axes) {
+			if (!axes.empty()) return axes;
+			std::vector<int64_t> result(static_cast<size_t>(shape.ndim()));
+			std::iota(result.begin(), result.end(), int64_t(0));
+			return result;
+		}
+
+		/// Return \p axes, or every axis of \p shape if \p axes is empty, for a real transform.
+		/// The last of these is transformed with a real FFT, so there must be at least one.
+		/// \throws std::runtime_error if there are no axes (a zero-dimensional array)
+		template<typename ShapeType>
+		std::vector<int64_t> realAxes(const ShapeType &shape, const std::vector<int64_t> &axes) {
+			std::vector<int64_t> result = axesOrAll(shape, axes);
+			if (result.empty()) {
+				throw std::runtime_error("Cannot compute a real FFT of a zero-dimensional array");
+			}
+			return result;
+		}
+
+		/// Copy an array into a new complex array, converting real values to complex values
+		template<typename ShapeType, typename StorageType>
+		auto toComplex(const array::ArrayContainer<ShapeType, StorageType> &array)
+		  -> array::ArrayContainer<ShapeType, Storage<ComplexType<typename StorageType::Scalar>>> {
+			using Result =
+			  array::ArrayContainer<ShapeType, Storage<ComplexType<typename StorageType::Scalar>>>;
+			Result result(array.shape());
+			const auto *src	   = array.storage().begin();
+			auto *dst		   = result.storage().begin();
+			const int64_t size = static_cast<int64_t>(array.shape().size());
+			for (int64_t i = 0; i < size; ++i) {
+				dst[i] = ComplexType<typename StorageType::Scalar>(src[i]);
+			}
+			return result;
+		}
+
+		/// Transform the real lines of an array along one axis, keeping the n / 2 + 1
+		/// non-negative frequencies of each line. The result is unscaled.
+		/// \tparam T The type of the values
+		/// \param src The values
+		/// \param dst The result, whose lines have n / 2 + 1 elements
+		/// \param lines The lines of the input along the axis
+		template<typename T>
+		void realTransformLines(const T *src, Complex<T> *dst, const sort::Lines &lines) {
+			if (lines.count == 0 || lines.extent == 0) return;
+			const int64_t n		= lines.extent;
+			const int64_t inner = lines.inner;
+			const int64_t outer = lines.count / inner;
+			const int64_t half	= n / 2;
+			const bool large	= lines.count * n > global::multithreadThreshold &&
+								   global::numThreads > 1;
+
+			if (n % 2 == 1) {
+				std::vector<Complex<T>> full(lines.count * n);
+				for (int64_t i = 0; i < lines.count * n; ++i) full[i] = Complex<T>(src[i]);
+				transformLines(full.data(), full.data(), lines, false);
+				parallelFor(outer, large, [&](int64_t o) {
+					const Complex<T> *start = full.data() + o * n * inner;
+					std::copy(start, start + (half + 1) * inner, dst + o * (half + 1) * inner);
+				});
+				return;
+			}
+
+			// z[k] = x[2k] + i x[2k + 1] is transformed with half the length
+			std::vector<Complex<T>> packed(outer * half * inner);
+			parallelFor(outer * half, large, [&](int64_t row) {
+				const T *even	= src + ((row / half) * n + 2 * (row % half)) * inner;
+				const T *odd	= even + inner;
+				Complex<T> *out = packed.data() + row * inner;
+				for (int64_t c = 0; c < inner; ++c) out[c] = Complex<T>(even[c], odd[c]);
+			});
+			transformLines(packed.data(), packed.data(), {outer * inner, half, inner}, false);
+
+			// X[k] = E[k] + exp(-2 pi i k / n) O[k], where E and O are the transforms of the even
+			// and odd elements: E[k] = (Z[k] + conj(Z[h - k])) / 2 and
+			// O[k] = (Z[k] - conj(Z[h - k])) / 2i
+			std::vector<Complex<T>> factors(half + 1);
+			for (int64_t k = 0; k <= half; ++k) factors[k] = twiddle<T>(k, n);
+
+			parallelFor(outer * (half + 1), large, [&](int64_t row) {
+				const int64_t o		   = row / (half + 1);
+				const int64_t k		   = row % (half + 1);
+				const Complex<T> *zk   = packed.data() + (o * half + k % half) * inner;
+				const Complex<T> *zr   = packed.data() + (o * half + (half - k) % half) * inner;
+				const Complex<T> scale = Complex<T>(T(0), T(-0.5));
+				Complex<T> *out		   = dst + row * inner;
+				for (int64_t c = 0; c < inner; ++c) {
+					const Complex<T> a	  = zk[c];
+					const Complex<T> b	  = conj(zr[c]);
+					const Complex<T> even = (a + b) * T(0.5);
+					const Complex<T> odd  = (a - b) * scale;
+					out[c]				  = even + odd * factors[k];
+				}
+			});
+		}
+
+		/// Inverse transform the lines of an array along one axis, from their n / 2 + 1
+		/// non-negative frequencies to n real values. Missing frequencies are zero, and extra
+		/// frequencies are ignored. The imaginary components of the zero frequency (and, for
+		/// even n, the Nyquist frequency) are ignored.
+		/// \tparam T The type of the values
+		/// \param src The frequencies
+		/// \param dst The result, whose lines have n elements
+		/// \param lines The lines of the input along the axis
+		/// \param n The length of the output lines
+		/// \param factor The factor by which the result is scaled
+		template<typename T>
+		void inverseRealTransformLines(const Complex<T> *src, T *dst, const sort::Lines &lines,
+									   int64_t n, T factor) {
+			if (lines.count == 0) return;
+			const int64_t m		= lines.extent;
+			const int64_t inner = lines.inner;
+			const int64_t outer = lines.count / inner;
+			const int64_t half	= n / 2;
+			const bool large	= outer * inner * n > global::multithreadThreshold &&
+								   global::numThreads > 1;
+
+			const auto input = [&](int64_t o, int64_t k, int64_t c) {
+				if (k >= m) return Complex<T>();
+				const Complex<T> &value = src[(o * m + k) * inner + c];
+				return (k == 0 || 2 * k == n) ? Complex<T>(value.real(), T(0)) : value;
+			};
+
+			if (n % 2 == 1) {
+				std::vector<Complex<T>> full(outer * n * inner);
+				parallelFor(outer * n, large, [&](int64_t row) {
+					const int64_t o = row / n;
+					const int64_t k = row % n;
+					for (int64_t c = 0; c < inner; ++c) {
+						full[row * inner + c] =
+						  k <= half ? input(o, k, c) : conj(input(o, n - k, c));
+					}
+				});
+				transformLines(full.data(), full.data(), {outer * inner, n, inner}, true);
+				for (int64_t i = 0; i < outer * n * inner; ++i) dst[i] = full[i].real() * factor;
+				return;
+			}
+
+			// Z[k] = E[k] + i O[k] is the transform of z[k] = x[2k] + i x[2k + 1], where
+			// 2 E[k] = X[k] + conj(X[h - k]) and
+			// 2 O[k] = (X[k] - conj(X[h - k])) exp(2 pi i k / n).
+			// Z is computed doubled, which is accounted for by transforming half the length.
+			std::vector<Complex<T>> factors(half);
+			for (int64_t k = 0; k < half; ++k) factors[k] = twiddle<T>(k, n);
+
+			std::vector<Complex<T>> packed(outer * half * inner);
+			parallelFor(outer * half, large, [&](int64_t row) {
+				const int64_t o = row / half;
+				const int64_t k = row % half;
+				for (int64_t c = 0; c < inner; ++c) {
+					const Complex<T> a	  = input(o, k, c);
+					const Complex<T> b	  = conj(input(o, half - k, c));
+					const Complex<T> odd  = conjMultiply(a - b, factors[k]);
+					packed[row * inner + c] = (a + b) + Complex<T>(-odd.imag(), odd.real());
+				}
+			});
+			transformLines(packed.data(), packed.data(), {outer * inner, half, inner}, true);
+
+			parallelFor(outer * half, large, [&](int64_t row) {
+				const Complex<T> *z = packed.data() + row * inner;
+				T *even				= dst + ((row / half) * n + 2 * (row % half)) * inner;
+				T *odd				= even + inner;
+				for (int64_t c = 0; c < inner; ++c) {
+					even[c] = z[c].real() * factor;
+					odd[c]	= z[c].imag() * factor;
+				}
+			});
+		}
+
+		/// Return \p shape with the extent of \p axis replaced
+		template<typename ShapeType>
+		ShapeType resizeAxis(ShapeType shape, int64_t axis, int64_t extent) {
+			const int64_t ndim = static_cast<int64_t>(shape.ndim());
+			shape[axis < 0 ? axis + ndim : axis] = extent;
+			return shape;
+		}
+	} // namespace detail::fft
+
+	namespace fft {
+		/// Return the discrete Fourier transform of an array along one axis. Real arrays are
+		/// transformed as complex arrays with zero imaginary components. Lengths with small
+		/// prime factors are fastest, but any length is supported.
+		/// \tparam ShapeType The shape type of the array
+		/// \tparam StorageType The storage type of the array
+		/// \param array The array
+		/// \param axis The axis to transform along. Negative values count back from the last axis.
+		/// \param norm The normalisation
+		/// \return A complex array with the shape of \p array
+		/// \throws std::runtime_error if the axis is out of range
+		template<typename ShapeType, typename StorageType>
+		auto fft(const array::ArrayContainer<ShapeType, StorageType> &array, int64_t axis = -1,
+				 Norm norm = Norm::Backward) {
+			detail::fft::assertTransformable<StorageType>();
+			auto result = detail::fft::toComplex(array);
+			detail::fft::transformAxes(
+			  result.storage().begin(), result.shape(), {axis}, false, norm);
+			return result;
+		}
+
+		/// Return the inverse discrete Fourier transform of an array along one axis
+		/// \tparam ShapeType The shape type of the array
+		/// \tparam StorageType The storage type of the array
+		/// \param array The array
+		/// \param axis The axis to transform along. Negative values count back from the last axis.
+		/// \param norm The normalisation
+		/// \return A complex array with the shape of \p array
+		/// \throws std::runtime_error if the axis is out of range
+		template<typename ShapeType, typename StorageType>
+		auto ifft(const array::ArrayContainer<ShapeType, StorageType> &array, int64_t axis = -1,
+				  Norm norm = Norm::Backward) {
+			detail::fft::assertTransformable<StorageType>();
+			auto result = detail::fft::toComplex(array);
+			detail::fft::transformAxes(
+			  result.storage().begin(), result.shape(), {axis}, true, norm);
+			return result;
+		}
+
+		/// Return the discrete Fourier transform of an array along several axes
+		/// \tparam ShapeType The shape type of the array
+		/// \tparam StorageType The storage type of the array
+		/// \param array The array
+		/// \param axes The axes to transform along, or every axis if empty
+		/// \param norm The normalisation
+		/// \return A complex array with the shape of \p array
+		/// \throws std::runtime_error if an axis is out of range
+		template<typename ShapeType, typename StorageType>
+		auto fftn(const array::ArrayContainer<ShapeType, StorageType> &array,
+				  const std::vector<int64_t> &axes = {}, Norm norm = Norm::Backward) {
+			detail::fft::assertTransformable<StorageType>();
+			auto result = detail::fft::toComplex(array);
+			detail::fft::transformAxes(result.storage().begin(),
+									   result.shape(),
+									   detail::fft::axesOrAll(array.shape(), axes),
+									   false,
+									   norm);
+			return result;
+		}
+
+		/// Return the inverse discrete Fourier transform of an array along several axes
+		/// \tparam ShapeType The shape type of the array
+		/// \tparam StorageType The storage type of the array
+		/// \param array The array
+		/// \param axes The axes to transform along, or every axis if empty
+		/// \param norm The normalisation
+		/// \return A complex array with the shape of \p array
+		/// \throws std::runtime_error if an axis is out of range
+		template<typename ShapeType, typename StorageType>
+		auto ifftn(const array::ArrayContainer<ShapeType, StorageType> &array,
+				   const std::vector<int64_t> &axes = {}, Norm norm = Norm::Backward) {
+			detail::fft::assertTransformable<StorageType>();
+			auto result = detail::fft::toComplex(array);
+			detail::fft::transformAxes(result.storage().begin(),
+									   result.shape(),
+									   detail::fft::axesOrAll(array.shape(), axes),
+									   true,
+									   norm);
+			return result;
+		}
+
+		/// Return the two-dimensional discrete Fourier transform of an array, along its last two
+		/// axes
+		/// \throws std::runtime_error if the array has fewer than two dimensions
+		template<typename ShapeType, typename StorageType>
+		auto fft2(const array::ArrayContainer<ShapeType, StorageType> &array,
+				  Norm norm = Norm::Backward) {
+			return fftn(array, {-2, -1}, norm);
+		}
+
+		/// Return the two-dimensional inverse discrete Fourier transform of an array, along its
+		/// last two axes
+		/// \throws std::runtime_error if the array has fewer than two dimensions
+		template<typename ShapeType, typename StorageType>
+		auto ifft2(const array::ArrayContainer<ShapeType, StorageType> &array,
+				   Norm norm = Norm::Backward) {
+			return ifftn(array, {-2, -1}, norm);
+		}
+
+		/// Return the discrete Fourier transform of a real array along one axis. The transform
+		/// of real values is conjugate-symmetric, so only the n / 2 + 1 non-negative frequencies
+		/// are returned. Even lengths are computed with a complex transform of half the length.
+		/// \tparam ShapeType The shape type of the array
+		/// \tparam StorageType The storage type of the array
+		/// \param array The real array
+		/// \param axis The axis to transform along. Negative values count back from the last axis.
+		/// \param norm The normalisation
+		/// \return A complex array with the shape of \p array, except that the extent of \p axis
+		/// is n / 2 + 1
+		/// \throws std::runtime_error if the axis is out of range or has length 0
+		template<typename ShapeType, typename StorageType>
+		auto rfft(const array::ArrayContainer<ShapeType, StorageType> &array, int64_t axis = -1,
+				  Norm norm = Norm::Backward)
+		  -> array::ArrayContainer<ShapeType, Storage<Complex<typename StorageType::Scalar>>> {
+			using Real = typename StorageType::Scalar;
+			static_assert(!typetraits::IsComplex<Real>::value, "rfft requires a real array");
+			detail::fft::assertTransformable<StorageType>();
+
+			const detail::sort::Lines lines = detail::sort::lines(array.shape(), axis);
+			if (lines.extent == 0) {
+				throw std::runtime_error(
+				  fmt::format("Cannot compute a real FFT along axis {} of length 0", axis));
+			}
+
+			array::ArrayContainer<ShapeType, Storage<Complex<Real>>> result(
+			  detail::fft::resizeAxis(array.shape(), axis, lines.extent / 2 + 1));
+			detail::fft::realTransformLines(array.storage().begin(), result.storage().begin(),
+											lines);
+			detail::fft::scaleValues(result.storage().begin(),
+									 static_cast<int64_t>(result.shape().size()),
+									 detail::fft::normScale<Real>(norm, lines.extent, false));
+			return result;
+		}
+
+		/// Return the inverse of rfft: the real array whose non-negative frequencies along one
+		/// axis are given. The imaginary components of the zero frequency, and of the Nyquist
+		/// frequency of even lengths, are ignored.
+		/// \tparam ShapeType The shape type of the array
+		/// \tparam StorageType The storage type of the array
+		/// \param array The complex array of non-negative frequencies
+		/// \param n The length of the output along \p axis. Frequencies are cropped or padded
+		/// with zeros to n / 2 + 1. The default of -1 gives 2 * (m - 1), where m is the extent of
+		/// \p axis.
+		/// \param axis The axis to transform along. Negative values count back from the last axis.
+		/// \param norm The normalisation
+		/// \return A real array with the shape of \p array, except that the extent of \p axis is
+		/// \p n
+		/// \throws std::runtime_error if the axis is out of range or the output length is not
+		/// positive
+		template<typename ShapeType, typename StorageType>
+		auto irfft(const array::ArrayContainer<ShapeType, StorageType> &array, int64_t n = -1,
+				   int64_t axis = -1, Norm norm = Norm::Backward)
+		  -> array::ArrayContainer<ShapeType,
+								   Storage<typename detail::fft::RealType<
+									 typename StorageType::Scalar>::Type>> {
+			using Real = typename detail::fft::RealType<typename StorageType::Scalar>::Type;
+			static_assert(typetraits::IsComplex<typename StorageType::Scalar>::value,
+						  "irfft requires a complex array");
+			detail::fft::assertTransformable<StorageType>();
+
+			const detail::sort::Lines lines = detail::sort::lines(array.shape(), axis);
+			if (n < 0) n = 2 * (lines.extent - 1);
+			if (n < 1) {
+				throw std::runtime_error(
+				  fmt::format("Invalid output length {} for an inverse real FFT", n));
+			}
+
+			array::ArrayContainer<ShapeType, Storage<Real>> result(
+			  detail::fft::resizeAxis(array.shape(), axis, n));
+			detail::fft::inverseRealTransformLines(array.storage().begin(),
+												   result.storage().begin(),
+												   lines,
+												   n,
+												   detail::fft::normScale<Real>(norm, n, true));
+			return result;
+		}
+
+		/// Return the discrete Fourier transform of a real array along several axes. The last
+		/// axis is transformed with rfft, so its extent becomes n / 2 + 1, and the other axes
+		/// are transformed with fft.
+		/// \tparam ShapeType The shape type of the array
+		/// \tparam StorageType The storage type of the array
+		/// \param array The real array
+		/// \param axes The axes to transform along, or every axis if empty
+		/// \param norm The normalisation
+		/// \return A complex array
+		/// \throws std::runtime_error if there are no axes, an axis is out of range or the last
+		/// axis has length 0
+		template<typename ShapeType, typename StorageType>
+		auto rfftn(const array::ArrayContainer<ShapeType, StorageType> &array,
+				   const std::vector<int64_t> &axes = {}, Norm norm = Norm::Backward) {
+			std::vector<int64_t> all = detail::fft::realAxes(array.shape(), axes);
+			const int64_t last		 = all.back();
+			all.pop_back();
+
+			auto result = rfft(array, last, norm);
+			detail::fft::transformAxes(result.storage().begin(), result.shape(), all, false, norm);
+			return result;
+		}
+
+		/// Return the inverse of rfftn. Every axis but the last is inverse transformed with
+		/// ifft, and the last axis with irfft.
+		/// \tparam ShapeType The shape type of the array
+		/// \tparam StorageType The storage type of the array
+		/// \param array The complex array
+		/// \param axes The axes to transform along, or every axis if empty
+		/// \param n The length of the output along the last axis, as for irfft
+		/// \param norm The normalisation
+		/// \return A real array
+		/// \throws std::runtime_error if there are no axes, an axis is out of range or the output
+		/// length is not positive
+		template<typename ShapeType, typename StorageType>
+		auto irfftn(const array::ArrayContainer<ShapeType, StorageType> &array,
+					const std::vector<int64_t> &axes = {}, int64_t n = -1,
+					Norm norm = Norm::Backward) {
+			static_assert(typetraits::IsComplex<typename StorageType::Scalar>::value,
+						  "irfftn requires a complex array");
+			std::vector<int64_t> all = detail::fft::realAxes(array.shape(), axes);
+			const int64_t last		 = all.back();
+			all.pop_back();
+
+			auto spectrum = detail::fft::toComplex(array);
+			detail::fft::transformAxes(
+			  spectrum.storage().begin(), spectrum.shape(), all, true, norm);
+			return irfft(spectrum, n, last, norm);
+		}
+	} // namespace fft
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_FFT_HPP
@@ -0,0 +1,101 @@
+#ifndef LIBRAPID_ARRAY_FILL_HPP
+#define LIBRAPID_ARRAY_FILL_HPP
+
+namespace librapid {
+	namespace detail {
+		/// Number of elements generated per task when filling an array with random values. This
+		/// does not depend on the number of threads, and neither does the value generated for
+		/// any element, so the output is the same for any value of `global::numThreads`.
+		constexpr int64_t randomFillChunkSize = 4096;
+
+		/// Call \p generate for contiguous chunks of an array, in parallel if the array is
+		/// large enough
+		/// \tparam Scalar The scalar type of the array
+		/// \tparam Generate The type of the generator function
+		/// \param dst Pointer to the first element of the array
+		/// \param size The number of elements in the array
+		/// \param generate Callable taking (index, pointer, count)
+		template<typename Scalar, typename Generate>
+		void randomFill(Scalar *dst, int64_t size, const Generate &generate) {
+			if (size > global::multithreadThreshold && global::numThreads > 1) {
+				const int64_t chunkSize = randomFillChunkSize;
+
+#pragma omp parallel for shared(dst, size, generate, chunkSize) default(none)                      \
+  num_threads(global::numThreads)
+				for (int64_t begin = 0; begin < size; begin += chunkSize) {
+					generate(begin, dst + begin, std::min(chunkSize, size - begin));
+				}
+			} else {
+				generate(0, dst, size);
+			}
+		}
+
+		/// Random fills write directly to contiguous host memory
+		template<typename StorageType>
+		constexpr void assertRandomFillable() {
+			static_assert(typetraits::IsStorage<StorageType>::value ||
+							typetraits::IsFixedStorage<StorageType>::value ||
+							typetraits::IsMappedStorage<StorageType>::value,
+						  "Random fills require a Storage, FixedStorage or MappedStorage object");
+		}
+	} // namespace detail
+
+	/// Fill an array with uniformly distributed random values in the range [lower, upper) for
+	/// floating point types, or [lower, upper] for integer types.
+	///
+	/// Element `i` of the array receives variate `offset + i` of the generator selected by
+	/// \p seed, so a large array can be generated in independent shards by filling each shard
+	/// with the same seed and the offset of its first element. If no seed is given, a seed is
+	/// derived from `global::randomSeed` and every call produces different values.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param dst The array to fill
+	/// \param lower The lower bound of the distribution
+	/// \param upper The upper bound of the distribution
+	/// \param seed The seed, or -1 to use the global seed
+	/// \param offset The index of the variate used for the first element
+	template<typename ShapeType, typename StorageType>
+	void fillRandom(array::ArrayContainer<ShapeType, StorageType> &dst,
+					const typename StorageType::Scalar &lower = 0,
+					const typename StorageType::Scalar &upper = 1, uint64_t seed = -1,
+					uint64_t offset = 0) {
+		using Scalar = typename StorageType::Scalar;
+		detail::assertRandomFillable<StorageType>();
+
+		const Philox generator = detail::randomGenerator(seed);
+		detail::randomFill(
+		  dst.storage().begin(),
+		  static_cast<int64_t>(dst.storage().size()),
+		  [&generator, &lower, &upper, offset](int64_t index, Scalar *ptr, int64_t count) {
+			  detail::generateUniform(generator, offset + index, ptr, count, lower, upper);
+		  });
+	}
+
+	/// Fill an array with normally distributed random values
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param dst The array to fill
+	/// \param mean The mean of the distribution
+	/// \param stddev The standard deviation of the distribution
+	/// \param seed The seed, or -1 to use the global seed
+	/// \param offset The index of the variate used for the first element
+	/// \see fillRandom
+	template<typename ShapeType, typename StorageType>
+	void fillRandomGaussian(array::ArrayContainer<ShapeType, StorageType> &dst,
+							const typename StorageType::Scalar &mean   = 0,
+							const typename StorageType::Scalar &stddev = 1, uint64_t seed = -1,
+							uint64_t offset = 0) {
+		using Scalar = typename StorageType::Scalar;
+		detail::assertRandomFillable<StorageType>();
+
+		const Philox generator = detail::randomGenerator(seed);
+		detail::randomFill(
+		  dst.storage().begin(),
+		  static_cast<int64_t>(dst.storage().size()),
+		  [&generator, &mean, &stddev, offset](int64_t index, Scalar *ptr, int64_t count) {
+			  detail::generateNormal(generator, offset + index, ptr, count, mean, stddev);
+		  });
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_FILL_HPP
@@ -0,0 +1,273 @@
+#ifndef LIBRAPID_ARRAY_FIXED_MATRIX_HPP
+#define LIBRAPID_ARRAY_FIXED_MATRIX_HPP
+
+/*
+ * Matrix products, determinants and inverses of small fixed-size matrices (ArrayF objects with
+ * at most 8 rows and columns).
+ *
+ * Every loop has a trip count known at compile time and is expanded with unrolledFor, so each
+ * element is addressed with a constant index. The exception is the loop over the rows of a
+ * matrix product, which is kept as a loop so that its body stays small enough to vectorise well.
+ * The working copy of a matrix is a local array, which the compiler keeps in registers, and
+ * nothing is allocated. The lambdas passed to unrolledFor are marked LIBRAPID_LAMBDA_INLINE, so
+ * the unrolled steps are inlined even in large translation units. All of these functions run on
+ * the calling thread.
+ *
+ * Determinants and inverses of 2x2 and 3x3 matrices use closed-form expressions. Larger
+ * matrices use Gaussian elimination with partial pivoting. Rows are exchanged with branchless
+ * selects instead of by index, so the pivot search does not stop the rows being kept in
+ * registers.
+ */
+
+namespace librapid {
+	namespace detail::fixed {
+		/// The largest number of rows or columns of a matrix handled by these functions
+		constexpr size_t maxMatrixSize = 8;
+
+		/// Exchange rows \p first and \p second of a matrix if \p swap is true, without a branch
+		/// \tparam Begin The first column to exchange. The columns before it are not changed.
+		/// \tparam Scalar The scalar type of the matrix
+		/// \tparam Rows The number of rows of the matrix
+		/// \tparam Cols The number of columns of the matrix
+		/// \param matrix The matrix
+		/// \param first The index of the first row
+		/// \param second The index of the second row
+		/// \param swap True if the rows should be exchanged
+		template<int64_t Begin, typename Scalar, size_t Rows, size_t Cols>
+		LIBRAPID_ALWAYS_INLINE void selectSwapRows(Scalar (&matrix)[Rows][Cols], int64_t first,
+												   int64_t second, bool swap) {
+			unrolledFor<Begin, static_cast<int64_t>(Cols)>([&](auto j) LIBRAPID_LAMBDA_INLINE {
+				const Scalar a	 = matrix[first][j];
+				const Scalar b	 = matrix[second][j];
+				matrix[first][j]  = swap ? b : a;
+				matrix[second][j] = swap ? a : b;
+			});
+		}
+
+		/// Move the row with the largest value in column \p K, out of rows K onwards, to row
+		/// \p K
+		/// \tparam K The column to pivot on
+		/// \tparam Scalar The scalar type of the matrix
+		/// \tparam Rows The number of rows of the matrix
+		/// \tparam Cols The number of columns of the matrix
+		/// \param matrix The matrix
+		/// \return True if an odd number of rows were exchanged
+		template<int64_t K, typename Scalar, size_t Rows, size_t Cols>
+		LIBRAPID_ALWAYS_INLINE bool pivot(Scalar (&matrix)[Rows][Cols]) {
+			bool odd = false;
+			unrolledFor<K + 1, static_cast<int64_t>(Rows)>([&](auto i) LIBRAPID_LAMBDA_INLINE {
+				const bool swap = ::librapid::abs(matrix[i][K]) > ::librapid::abs(matrix[K][K]);
+				selectSwapRows<K>(matrix, K, i, swap);
+				odd ^= swap;
+			});
+			return odd;
+		}
+
+		/// Copy the elements of a fixed-size matrix into a local array
+		/// \tparam N The number of rows and columns of the matrix
+		/// \tparam Cols The number of columns of the local array
+		/// \tparam Scalar The scalar type of the matrix
+		/// \param matrix The matrix to copy
+		/// \param dst The local array
+		template<size_t N, size_t Cols, typename Scalar>
+		LIBRAPID_ALWAYS_INLINE void load(const ArrayF<Scalar, N, N> &matrix,
+										 Scalar (&dst)[N][Cols]) {
+			const Scalar *src = matrix.storage().begin();
+			unrolledFor<0, N>([&](auto i) LIBRAPID_LAMBDA_INLINE {
+				unrolledFor<0, N>([&](auto j) LIBRAPID_LAMBDA_INLINE {
+					dst[i][j] = src[i * N + j];
+				});
+			});
+		}
+
+		/// Check that a matrix can be used with determinant or inverse
+		template<typename Scalar, size_t N>
+		constexpr void checkSquareMatrix() {
+			static_assert(N >= 1 && N <= maxMatrixSize,
+						  "Fixed-size matrices must have between 1 and 8 rows and columns");
+			static_assert(!std::is_integral_v<Scalar>,
+						  "The determinant and inverse require a floating point scalar type");
+		}
+
+		/// Throw an error for a singular matrix
+		[[noreturn]] inline void throwSingular() {
+			throw std::runtime_error("Cannot invert a singular matrix");
+		}
+	} // namespace detail::fixed
+
+	/// Multiply two fixed-size matrices. The product is computed one row at a time, as a sum of
+	/// rows of \p rhs scaled by one element of \p lhs, so the inner loops are contiguous and
+	/// vectorise. The work for each row is unrolled and no dimension may exceed 8.
+	/// \tparam Scalar The scalar type of the matrices
+	/// \tparam M The number of rows of \p lhs
+	/// \tparam K The number of columns of \p lhs and rows of \p rhs
+	/// \tparam N The number of columns of \p rhs
+	/// \param lhs The left-hand matrix
+	/// \param rhs The right-hand matrix
+	/// \return The M x N product
+	template<typename Scalar, size_t M, size_t K, size_t N>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ArrayF<Scalar, M, N>
+	matmul(const ArrayF<Scalar, M, K> &lhs, const ArrayF<Scalar, K, N> &rhs) {
+		static_assert(M <= detail::fixed::maxMatrixSize && K <= detail::fixed::maxMatrixSize &&
+						N <= detail::fixed::maxMatrixSize,
+					  "Fixed-size matrices may have at most 8 rows and columns");
+
+		const Scalar *a = lhs.storage().begin();
+		const Scalar *b = rhs.storage().begin();
+
+		ArrayF<Scalar, M, N> result;
+		Scalar *r = result.storage().begin();
+
+		// Only the work for one row is unrolled. Unrolling the rows as well gives the compiler
+		// an M x K x N block of scalar operations, which it vectorises poorly once the matrices
+		// are larger than 4x4. Each row is built in a local array, which could otherwise alias an
+		// input as far as the compiler knows, so it is kept in registers and written out once.
+		for (size_t i = 0; i < M; ++i) {
+			Scalar row[N];
+			detail::unrolledFor<0, N>([&](auto j) LIBRAPID_LAMBDA_INLINE {
+				row[j] = a[i * K] * b[j];
+			});
+			detail::unrolledFor<1, K>([&](auto k) LIBRAPID_LAMBDA_INLINE {
+				const Scalar scale = a[i * K + k];
+				detail::unrolledFor<0, N>([&](auto j) LIBRAPID_LAMBDA_INLINE {
+					row[j] += scale * b[k * N + j];
+				});
+			});
+			detail::unrolledFor<0, N>([&](auto j) LIBRAPID_LAMBDA_INLINE {
+				r[i * N + j] = row[j];
+			});
+		}
+		return result;
+	}
+
+	/// Return the determinant of a fixed-size square matrix with at most 8 rows
+	/// \tparam Scalar The scalar type of the matrix, which must be a floating point type
+	/// \tparam N The number of rows and columns of the matrix
+	/// \param matrix The matrix
+	/// \return The determinant
+	template<typename Scalar, size_t N>
+	LIBRAPID_NODISCARD Scalar determinant(const ArrayF<Scalar, N, N> &matrix) {
+		detail::fixed::checkSquareMatrix<Scalar, N>();
+		const Scalar *m = matrix.storage().begin();
+
+		if constexpr (N == 1) {
+			return m[0];
+		} else if constexpr (N == 2) {
+			return m[0] * m[3] - m[1] * m[2];
+		} else if constexpr (N == 3) {
+			return m[0] * (m[4] * m[8] - m[5] * m[7]) - m[1] * (m[3] * m[8] - m[5] * m[6]) +
+				   m[2] * (m[3] * m[7] - m[4] * m[6]);
+		} else {
+			constexpr auto n = static_cast<int64_t>(N);
+			Scalar a[N][N];
+			detail::fixed::load(matrix, a);
+
+			// Reduce the matrix to upper triangular form. A zero pivot makes the determinant
+			// zero, and its row is then left as it is, so no division by zero occurs.
+			Scalar result = 1;
+			detail::unrolledFor<0, n>([&](auto k) LIBRAPID_LAMBDA_INLINE {
+				if (detail::fixed::pivot<k>(a)) result = -result;
+				const Scalar pivot = a[k][k];
+				const Scalar scale = pivot != Scalar(0) ? Scalar(1) / pivot : Scalar(0);
+				result *= pivot;
+
+				detail::unrolledFor<k + 1, n>([&](auto i) LIBRAPID_LAMBDA_INLINE {
+					const Scalar factor = a[i][k] * scale;
+					detail::unrolledFor<k + 1, n>([&](auto j) LIBRAPID_LAMBDA_INLINE {
+						a[i][j] -= factor * a[k][j];
+					});
+				});
+			});
+
+			return result;
+		}
+	}
+
+	/// Return the inverse of a fixed-size square matrix with at most 8 rows
+	/// \tparam Scalar The scalar type of the matrix, which must be a floating point type
+	/// \tparam N The number of rows and columns of the matrix
+	/// \param matrix The matrix
+	/// \return The inverse
+	/// \throws std::runtime_error if the matrix is singular
+	template<typename Scalar, size_t N>
+	LIBRAPID_NODISCARD ArrayF<Scalar, N, N>
+	inverse(const ArrayF<Scalar, N, N> &matrix) {
+		detail::fixed::checkSquareMatrix<Scalar, N>();
+		ArrayF<Scalar, N, N> result;
+		Scalar *r = result.storage().begin();
+
+		if constexpr (N <= 3) {
+			const Scalar det = determinant(matrix);
+			if (det == Scalar(0)) detail::fixed::throwSingular();
+			const Scalar scale = Scalar(1) / det;
+
+			// Copy the matrix first, since the result could alias it as far as the compiler
+			// knows
+			Scalar m[N * N];
+			detail::unrolledFor<0, N * N>([&](auto i) LIBRAPID_LAMBDA_INLINE {
+				m[i] = matrix.storage()[i];
+			});
+
+			if constexpr (N == 1) {
+				r[0] = scale;
+			} else if constexpr (N == 2) {
+				r[0] = m[3] * scale;
+				r[1] = -m[1] * scale;
+				r[2] = -m[2] * scale;
+				r[3] = m[0] * scale;
+			} else {
+				// The transpose of the matrix of cofactors, divided by the determinant
+				r[0] = (m[4] * m[8] - m[5] * m[7]) * scale;
+				r[1] = (m[2] * m[7] - m[1] * m[8]) * scale;
+				r[2] = (m[1] * m[5] - m[2] * m[4]) * scale;
+				r[3] = (m[5] * m[6] - m[3] * m[8]) * scale;
+				r[4] = (m[0] * m[8] - m[2] * m[6]) * scale;
+				r[5] = (m[2] * m[3] - m[0] * m[5]) * scale;
+				r[6] = (m[3] * m[7] - m[4] * m[6]) * scale;
+				r[7] = (m[1] * m[6] - m[0] * m[7]) * scale;
+				r[8] = (m[0] * m[4] - m[1] * m[3]) * scale;
+			}
+		} else {
+			// Gauss-Jordan elimination on the matrix augmented with the identity. When the left
+			// half has been reduced to the identity, the right half is the inverse.
+			constexpr auto n = static_cast<int64_t>(N);
+			Scalar a[N][2 * N];
+			detail::fixed::load(matrix, a);
+			detail::unrolledFor<0, n>([&](auto i) LIBRAPID_LAMBDA_INLINE {
+				detail::unrolledFor<n, 2 * n>([&](auto j) LIBRAPID_LAMBDA_INLINE {
+					a[i][j] = Scalar(i + n == j);
+				});
+			});
+
+			bool singular = false;
+			detail::unrolledFor<0, n>([&](auto k) LIBRAPID_LAMBDA_INLINE {
+				detail::fixed::pivot<k>(a);
+				const Scalar pivot = a[k][k];
+				singular |= pivot == Scalar(0);
+				const Scalar scale = pivot != Scalar(0) ? Scalar(1) / pivot : Scalar(0);
+				detail::unrolledFor<k + 1, 2 * n>([&](auto j) LIBRAPID_LAMBDA_INLINE {
+					a[k][j] *= scale;
+				});
+
+				detail::unrolledFor<0, n>([&](auto i) LIBRAPID_LAMBDA_INLINE {
+					if constexpr (i != k) {
+						const Scalar factor = a[i][k];
+						detail::unrolledFor<k + 1, 2 * n>(
+						  [&](auto j) LIBRAPID_LAMBDA_INLINE { a[i][j] -= factor * a[k][j]; });
+					}
+				});
+			});
+			if (singular) detail::fixed::throwSingular();
+
+			detail::unrolledFor<0, n>([&](auto i) LIBRAPID_LAMBDA_INLINE {
+				detail::unrolledFor<0, n>([&](auto j) LIBRAPID_LAMBDA_INLINE {
+					r[i * n + j] = a[i][n + j];
+				});
+			});
+		}
+
+		return result;
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_FIXED_MATRIX_HPP
@@ -35,6 +35,29 @@ namespace librapid {
 			}
 		}
 
+		/// The scalar type shared by the array arguments (arrays, views and functions) of a
+		/// Function. Scalar arguments are broadcast into packets, so they are ignored. Type is
+		/// void if there are no array arguments, and std::false_type if the array arguments have
+		/// different scalar types.
+		/// \tparam Args The argument types of the Function
+		template<typename... Args>
+		struct ArrayArgScalar {
+			using Type = void;
+		};
+
+		template<typename First, typename... Rest>
+		struct ArrayArgScalar<First, Rest...> {
+			using FirstType = std::conditional_t<
+			  TypeInfo<std::decay_t<First>>::type == detail::LibRapidType::Scalar, void,
+			  typename TypeInfo<std::decay_t<First>>::Scalar>;
+			using RestType = typename ArrayArgScalar<Rest...>::Type;
+
+			using Type = std::conditional_t<
+			  std::is_void_v<FirstType>, RestType,
+			  std::conditional_t<std::is_void_v<RestType> || std::is_same_v<FirstType, RestType>,
+								 FirstType, std::false_type>>;
+		};
+
 		template<typename desc, typename Functor_, typename... Args>
 		struct TypeInfo<::librapid::detail::Function<desc, Functor_, Args...>> {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::ArrayFunction;
@@ -43,7 +66,10 @@ namespace librapid {
 			using Device =
 			  decltype(commonDevice<Args...>()); // typename DeviceCheckAndExtract<Args...>::Device;
 
-			static constexpr bool allowVectorisation = checkAllowVectorisation<Args...>();
+			// Every array argument is loaded with the same packet type
+			static constexpr bool allowVectorisation =
+			  checkAllowVectorisation<Args...>() &&
+			  !std::is_same_v<typename ArrayArgScalar<Args...>::Type, std::false_type>;
 
 			static constexpr bool supportsArithmetic = TypeInfo<Scalar>::supportsArithmetic;
 			static constexpr bool supportsLogical	 = TypeInfo<Scalar>::supportsLogical;
@@ -87,16 +113,66 @@ namespace librapid {
 			return obj;
 		}
 
+		/// True if \p Packet can load and store fewer values than it has lanes, setting the
+		/// remaining lanes to zero (see Float16Packet::loadPartial)
+		template<typename Packet, typename = void>
+		struct CanLoadPartial : std::false_type {};
+
+		template<typename Packet>
+		struct CanLoadPartial<Packet,
+							  std::void_t<decltype(std::declval<Packet &>().loadPartial(
+								std::declval<const typename Packet::EntryType *>(), size_t()))>>
+				: std::true_type {};
+
+		/// True if \p T can be evaluated as a partial packet, with partialPacketExtractor.
+		/// Scalars are broadcast, array containers with contiguous host storage load the values
+		/// that exist, and functions need every argument to support partial packets.
+		/// \tparam T The type of the object
+		template<typename T>
+		struct HasPartialPacket
+				: std::bool_constant<typetraits::TypeInfo<T>::type ==
+									 ::librapid::detail::LibRapidType::Scalar> {};
+
+		template<typename ShapeType, typename StorageType>
+		struct HasPartialPacket<array::ArrayContainer<ShapeType, StorageType>>
+				: std::bool_constant<(typetraits::IsStorage<StorageType>::value ||
+									  typetraits::IsFixedStorage<StorageType>::value ||
+									  typetraits::IsMappedStorage<StorageType>::value) &&
+									 CanLoadPartial<typename typetraits::TypeInfo<
+									   typename StorageType::Scalar>::Packet>::value> {};
+
+		template<typename desc, typename Functor_, typename... Args>
+		struct HasPartialPacket<Function<desc, Functor_, Args...>>
+				: std::bool_constant<(HasPartialPacket<std::decay_t<Args>>::value && ...)> {};
+
+		template<
+		  typename Packet, typename T,
+		  typename std::enable_if_t<
+			typetraits::TypeInfo<T>::type != ::librapid::detail::LibRapidType::Scalar, int> = 0>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+		partialPacketExtractor(const T &obj, size_t index, size_t count) {
+			return obj.partialPacket(index, count);
+		}
+
+		template<
+		  typename Packet, typename T,
+		  typename std::enable_if_t<
+			typetraits::TypeInfo<T>::type == ::librapid::detail::LibRapidType::Scalar, int> = 0>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet partialPacketExtractor(const T &obj,
+																				size_t, size_t) {
+			return Packet(obj);
+		}
+
 		template<typename First, typename... Rest>
 		constexpr auto scalarTypesAreSame() {
+			using Scalar = typename typetraits::TypeInfo<std::decay_t<First>>::Scalar;
 			if constexpr (sizeof...(Rest) == 0) {
-				using Scalar = typename typetraits::TypeInfo<std::decay_t<First>>::Scalar;
 				return Scalar {};
 			} else {
 				using RestType = decltype(scalarTypesAreSame<Rest...>());
 				if constexpr (std::is_same_v<RestType, std::false_type>) {
 					return std::false_type {};
-				} else if constexpr (std::is_same_v<First, RestType>) {
+				} else if constexpr (std::is_same_v<Scalar, RestType>) {
 					return RestType{};
 				} else {
 					return std::false_type {};
@@ -119,6 +195,15 @@ namespace librapid {
 			using Device	 = typename typetraits::TypeInfo<Type>::Device;
 			using Packet	 = typename typetraits::TypeInfo<Scalar>::Packet;
 			using Descriptor = desc;
+
+			/// The scalar type shared by the array arguments (see typetraits::ArrayArgScalar)
+			using ArrayArgScalar = typename typetraits::ArrayArgScalar<Args...>::Type;
+
+			/// The packet type of the arguments. This differs from Packet when the functor
+			/// changes the scalar type, such as the magnitude of a complex number.
+			using ArgPacket = typename typetraits::TypeInfo<std::conditional_t<
+			  std::is_void_v<ArrayArgScalar> || std::is_same_v<ArrayArgScalar, std::false_type>,
+			  Scalar, ArrayArgScalar>>::Packet;
 			static constexpr bool argsAreSameType =
 			  !std::is_same_v<decltype(scalarTypesAreSame<Args...>()), std::false_type>;
 
@@ -164,6 +249,15 @@ namespace librapid {
 			/// \return The result of the function (vectorized).
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(size_t index) const;
 
+			/// Evaluates the function for \p count elements from the given index, returning a
+			/// Packet whose remaining lanes are computed from zeros. Only valid if
+			/// HasPartialPacket is true for the function.
+			/// \param index The index of the first element.
+			/// \param count The number of elements to evaluate (less than the packet width).
+			/// \return The result of the function (vectorized).
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet partialPacket(size_t index,
+																		   size_t count) const;
+
 			/// Evaluates the function at the given index, returning a Scalar result.
 			/// \param index The index to evaluate at.
 			/// \return The result of the function (scalar).
@@ -184,6 +278,15 @@ namespace librapid {
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packetImpl(std::index_sequence<I...>,
 																		size_t index) const;
 
+			/// Implementation detail -- evaluates the function as a partial packet
+			/// \tparam I The index sequence.
+			/// \param index The index of the first element.
+			/// \param count The number of elements to evaluate.
+			/// \return The result of the function (vectorized).
+			template<size_t... I>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+			partialPacketImpl(std::index_sequence<I...>, size_t index, size_t count) const;
+
 			/// Implementation detail -- evaluates the function at the given index,
 			/// returning a Scalar result.
 			/// \tparam I The index sequence.
@@ -230,7 +333,22 @@ namespace librapid {
 		auto Function<desc, Functor, Args...>::packetImpl(std::index_sequence<I...>,
 														  size_t index) const -> Packet {
 			// return m_functor.packet((std::get<I>(m_args).packet(index))...);
-			return m_functor.packet(packetExtractor<Packet>(std::get<I>(m_args), index)...);
+			return m_functor.packet(packetExtractor<ArgPacket>(std::get<I>(m_args), index)...);
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		auto Function<desc, Functor, Args...>::partialPacket(size_t index, size_t count) const
+		  -> Packet {
+			return partialPacketImpl(std::make_index_sequence<sizeof...(Args)>(), index, count);
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		template<size_t... I>
+		auto Function<desc, Functor, Args...>::partialPacketImpl(std::index_sequence<I...>,
+																 size_t index, size_t count) const
+		  -> Packet {
+			return m_functor.packet(
+			  partialPacketExtractor<ArgPacket>(std::get<I>(m_args), index, count)...);
 		}
 
 		template<typename desc, typename Functor, typename... Args>
@@ -0,0 +1,390 @@
+#ifndef LIBRAPID_ARRAY_INDEXING_HPP
+#define LIBRAPID_ARRAY_INDEXING_HPP
+
+/*
+ * Indexing arrays with integer arrays and boolean masks. All indices refer to the elements of
+ * the flattened array, in row-major order, and negative indices count back from the end.
+ *
+ * `take` is lazy: it returns a Function whose argument is a Gather object, so it can be used in
+ * larger expressions and is only evaluated when assigned to an array. Each packet of the result
+ * is gathered from a fixed-width loop over the indices, which compilers turn into gather
+ * instructions where the target has them.
+ *
+ * `put` scatters values into an array. On multiple threads, the indices are first split between
+ * the threads and sorted into buckets by the range of the destination they land in, keeping
+ * their order. Each thread then owns a contiguous range of the destination and applies, in
+ * order, the writes in its buckets, so repeated indices always keep the last value, as they do
+ * on one thread. Each index is visited a fixed number of times, whatever the number of threads.
+ *
+ * `compress` (and `operator[]` with a mask) counts the selected elements of each chunk, turns
+ * the counts into output offsets with an exclusive prefix sum, then copies every chunk to its
+ * offset in parallel. Within a chunk, elements are compacted without branches into a small
+ * buffer, which is then copied to the result.
+ */
+
+namespace librapid {
+	namespace detail {
+		template<typename Source, typename Indices>
+		class Gather;
+	} // namespace detail
+
+	namespace typetraits {
+		template<typename Source, typename Indices>
+		struct TypeInfo<::librapid::detail::Gather<Source, Indices>> {
+			static constexpr detail::LibRapidType type = detail::LibRapidType::ArrayFunction;
+			using Scalar							   = typename std::decay_t<Source>::Scalar;
+			using Device							   = device::CPU;
+			static constexpr bool allowVectorisation   = TypeInfo<Scalar>::packetWidth > 1;
+
+			static constexpr bool supportsArithmetic = TypeInfo<Scalar>::supportsArithmetic;
+			static constexpr bool supportsLogical	 = TypeInfo<Scalar>::supportsLogical;
+			static constexpr bool supportsBinary	 = TypeInfo<Scalar>::supportsBinary;
+		};
+	} // namespace typetraits
+
+	namespace detail {
+		namespace indexing {
+			/// Number of elements in each chunk of a parallel mask compaction
+			constexpr int64_t chunkSize = 16384;
+
+			/// Number of elements compacted into a buffer on the stack at a time
+			constexpr int64_t blockSize = 256;
+
+			/// Indexing works directly on contiguous host memory
+			template<typename StorageType>
+			constexpr void assertIndexable() {
+				static_assert(typetraits::IsStorage<StorageType>::value ||
+								typetraits::IsFixedStorage<StorageType>::value ||
+								typetraits::IsMappedStorage<StorageType>::value,
+							  "Indexing requires a Storage, FixedStorage or MappedStorage object");
+			}
+
+			/// Check that every index is in range for an array of \p size elements
+			/// \tparam Index The type of the indices
+			/// \param indices The indices
+			/// \param count The number of indices
+			/// \param size The number of elements in the indexed array
+			/// \throws std::runtime_error if an index is out of range
+			template<typename Index>
+			void checkIndices(const Index *indices, int64_t count, int64_t size) {
+				static_assert(std::is_integral_v<Index>, "Indices must be integers");
+				if (count == 0) return;
+
+				int64_t low = static_cast<int64_t>(indices[0]), high = low;
+				for (int64_t i = 1; i < count; ++i) {
+					const int64_t index = static_cast<int64_t>(indices[i]);
+					low					= index < low ? index : low;
+					high				= index > high ? index : high;
+				}
+
+				if (low < -size || high >= size) {
+					throw std::runtime_error(
+					  fmt::format("Index {} is out of range for an array with {} elements",
+								  low < -size ? low : high,
+								  size));
+				}
+			}
+
+			/// \return \p index, with negative values counting back from \p size
+			template<typename Index>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t wrap(Index index, int64_t size) {
+				const int64_t value = static_cast<int64_t>(index);
+				return value < 0 ? value + size : value;
+			}
+		} // namespace indexing
+
+		/// The argument of a `take` Function: the elements of an array at a set of indices. It
+		/// has the shape of the indices.
+		/// \tparam Source The type of the indexed array (a reference for lvalues)
+		/// \tparam Indices The type of the index array (a reference for lvalues)
+		template<typename Source, typename Indices>
+		class Gather {
+		public:
+			using SourceType  = std::decay_t<Source>;
+			using IndicesType = std::decay_t<Indices>;
+			using Scalar	  = typename SourceType::Scalar;
+			using Packet	  = typename typetraits::TypeInfo<Scalar>::Packet;
+			using Index		  = typename IndicesType::Scalar;
+
+			/// Gather the elements of \p source at \p indices. The indices must already have
+			/// been checked.
+			/// \param source The indexed array
+			/// \param indices The indices
+			Gather(Source &&source, Indices &&indices) :
+					m_source(std::forward<Source>(source)),
+					m_indices(std::forward<Indices>(indices)),
+					m_size(static_cast<int64_t>(m_source.shape().size())) {}
+
+			/// \return The shape of the index array
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto shape() const {
+				return m_indices.shape();
+			}
+
+			/// \param index The position in the index array
+			/// \return The element at the index stored at \p index
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar scalar(size_t index) const {
+				return m_source.storage().begin()[indexing::wrap(
+				  m_indices.storage().begin()[index], m_size)];
+			}
+
+			/// \param index The position in the index array of the first lane
+			/// \return The elements at the indices stored from \p index
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(size_t index) const {
+				constexpr int64_t width = typetraits::TypeInfo<Scalar>::packetWidth;
+				const Scalar *data		= m_source.storage().begin();
+				const Index *indices	= m_indices.storage().begin() + index;
+
+				Scalar lanes[width];
+				for (int64_t i = 0; i < width; ++i) {
+					lanes[i] = data[indexing::wrap(indices[i], m_size)];
+				}
+
+				Packet result;
+				result.load(lanes);
+				return result;
+			}
+
+		private:
+			Source m_source;
+			Indices m_indices;
+			int64_t m_size; // The number of elements in the indexed array
+		};
+
+		/// Passes the gathered elements through unchanged
+		struct Take {
+			template<typename T>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const T &val) const {
+				return val;
+			}
+
+			template<typename Packet>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto packet(const Packet &val) const {
+				return val;
+			}
+		};
+	} // namespace detail
+
+	namespace typetraits {
+		template<>
+		struct TypeInfo<::librapid::detail::Take> {
+			static constexpr const char *name = "take";
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+	} // namespace typetraits
+
+	/// Return the elements of an array at a set of indices into the flattened array, with the
+	/// shape of the indices. The result is a Function, so it is only evaluated (in parallel for
+	/// large results) when it is assigned to an array, and `take(a, indices) * 2` does not
+	/// create an intermediate array.
+	///
+	/// The Function refers to lvalue arguments, which must outlive it.
+	/// \tparam Source The array type
+	/// \tparam Indices The index array type, which must have integer elements
+	/// \param source The array
+	/// \param indices The indices. Negative values count back from the end of the array.
+	/// \return A Function evaluating to the selected elements
+	/// \throws std::runtime_error if an index is out of range
+	template<typename Source, typename Indices>
+	LIBRAPID_NODISCARD auto take(Source &&source, Indices &&indices) {
+		using SourceType  = std::decay_t<Source>;
+		using IndicesType = std::decay_t<Indices>;
+		detail::indexing::assertIndexable<typename SourceType::StorageType>();
+		detail::indexing::assertIndexable<typename IndicesType::StorageType>();
+
+		detail::indexing::checkIndices(indices.storage().begin(),
+									   static_cast<int64_t>(indices.shape().size()),
+									   static_cast<int64_t>(source.shape().size()));
+
+		using GatherType = detail::Gather<Source, Indices>;
+		return detail::makeFunction<detail::descriptor::Trivial, detail::Take>(
+		  GatherType(std::forward<Source>(source), std::forward<Indices>(indices)));
+	}
+
+	/// Write values into an array at a set of indices into the flattened array. If an index
+	/// appears more than once, the last value written to it is kept. Large scatters run on
+	/// multiple threads, each owning a range of the array.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \tparam Indices The index array type, which must have integer elements
+	/// \tparam Values The type of the values: a scalar, or an array or Function with one
+	/// element for each index
+	/// \param array The array to write to
+	/// \param indices The indices. Negative values count back from the end of the array.
+	/// \param values The values
+	/// \throws std::runtime_error if an index is out of range or the number of values does not
+	/// match the number of indices
+	template<typename ShapeType, typename StorageType, typename Indices, typename Values>
+	void put(array::ArrayContainer<ShapeType, StorageType> &array, const Indices &indices,
+			 const Values &values) {
+		using Scalar = typename StorageType::Scalar;
+		detail::indexing::assertIndexable<StorageType>();
+		detail::indexing::assertIndexable<typename Indices::StorageType>();
+
+		const int64_t size	= static_cast<int64_t>(array.shape().size());
+		const int64_t count = static_cast<int64_t>(indices.shape().size());
+		const auto *index	= indices.storage().begin();
+		detail::indexing::checkIndices(index, count, size);
+
+		if constexpr (typetraits::TypeInfo<Values>::type != detail::LibRapidType::Scalar) {
+			if (static_cast<int64_t>(values.shape().size()) != count) {
+				throw std::runtime_error(fmt::format(
+				  "Cannot put {} values at {} indices", values.shape().size(), count));
+			}
+		}
+
+		Scalar *data	 = array.storage().begin();
+		const auto write = [&](int64_t i) {
+			data[detail::indexing::wrap(index[i], size)] =
+			  static_cast<Scalar>(detail::scalarExtractor(values, i));
+		};
+
+		if (count <= global::multithreadThreshold || global::numThreads < 2) {
+			for (int64_t i = 0; i < count; ++i) write(i);
+			return;
+		}
+
+		// Each thread takes a slice of the indices and sorts its writes into buckets, one for
+		// each range of the array. The counts and cursors of a slice are stored together, at
+		// `slice * parts + range`, and the buckets are laid out by range, then by slice, so the
+		// writes to a range are kept in the order of the indices.
+		const int64_t parts = global::numThreads;
+		const auto rangeOf	= [index, size, parts](int64_t i) {
+			return detail::indexing::wrap(index[i], size) * parts / size;
+		};
+		const auto slice = [count, parts](int64_t s) { return count * s / parts; };
+		std::vector<int64_t> cursors(parts * parts, 0);
+		std::vector<int64_t> order(count);
+
+#pragma omp parallel for shared(parts, cursors, rangeOf, slice) default(none)                      \
+  num_threads(global::numThreads)
+		for (int64_t s = 0; s < parts; ++s) {
+			int64_t *counts = cursors.data() + s * parts;
+			for (int64_t i = slice(s); i < slice(s + 1); ++i) ++counts[rangeOf(i)];
+		}
+
+		// Turn the counts into the position of each bucket, keeping the start of each range
+		std::vector<int64_t> starts(parts + 1);
+		int64_t total = 0;
+		for (int64_t range = 0; range < parts; ++range) {
+			starts[range] = total;
+			for (int64_t s = 0; s < parts; ++s) {
+				const int64_t bucketCount  = cursors[s * parts + range];
+				cursors[s * parts + range] = total;
+				total += bucketCount;
+			}
+		}
+		starts[parts] = total;
+
+#pragma omp parallel for shared(parts, cursors, order, rangeOf, slice) default(none)               \
+  num_threads(global::numThreads)
+		for (int64_t s = 0; s < parts; ++s) {
+			int64_t *cursor = cursors.data() + s * parts;
+			for (int64_t i = slice(s); i < slice(s + 1); ++i) order[cursor[rangeOf(i)]++] = i;
+		}
+
+		// Each thread applies, in order, the writes that land in its range
+#pragma omp parallel for shared(parts, starts, order, write) default(none)                         \
+  num_threads(global::numThreads)
+		for (int64_t range = 0; range < parts; ++range) {
+			for (int64_t k = starts[range]; k < starts[range + 1]; ++k) write(order[k]);
+		}
+	}
+
+	/// Return the elements of an array where a mask is true, in row-major order. Large arrays
+	/// are compacted on multiple threads.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \tparam Mask The type of the mask: an array or Function with the shape of the array.
+	/// Nonzero elements select the corresponding elements of the array.
+	/// \param array The array
+	/// \param mask The mask
+	/// \return A one-dimensional array of the selected elements
+	/// \throws std::runtime_error if the mask does not have the shape of the array
+	template<typename ShapeType, typename StorageType, typename Mask>
+	auto compress(const array::ArrayContainer<ShapeType, StorageType> &array, const Mask &mask)
+	  -> array::ArrayContainer<typename detail::FlatShape<ShapeType>::Type,
+							   Storage<typename StorageType::Scalar>> {
+		using Scalar	= typename StorageType::Scalar;
+		using FlatShape = typename detail::FlatShape<ShapeType>::Type;
+		using Result	= array::ArrayContainer<FlatShape, Storage<Scalar>>;
+		detail::indexing::assertIndexable<StorageType>();
+		using detail::indexing::blockSize;
+		using detail::indexing::chunkSize;
+
+		if (!(mask.shape() == array.shape())) {
+			throw std::runtime_error(
+			  fmt::format("Cannot index an array of shape {} with a mask of shape {}",
+						  array.shape().str(),
+						  mask.shape().str()));
+		}
+
+		const int64_t size	 = static_cast<int64_t>(array.shape().size());
+		const int64_t chunks = (size + chunkSize - 1) / chunkSize;
+		const bool parallel	 = size > global::multithreadThreshold && global::numThreads > 1;
+		const auto selected	 = [&mask](int64_t i) {
+			return static_cast<bool>(detail::scalarExtractor(mask, i));
+		};
+
+		// Count the selected elements of each chunk, then turn the counts into offsets
+		std::vector<int64_t> offsets(chunks);
+		const auto countChunk = [&](int64_t chunk) {
+			const int64_t last = ::librapid::min((chunk + 1) * chunkSize, size);
+			int64_t count	   = 0;
+			for (int64_t i = chunk * chunkSize; i < last; ++i) count += selected(i);
+			offsets[chunk] = count;
+		};
+
+		if (parallel) {
+#pragma omp parallel for shared(chunks, countChunk) default(none) num_threads(global::numThreads)
+			for (int64_t chunk = 0; chunk < chunks; ++chunk) { countChunk(chunk); }
+		} else {
+			for (int64_t chunk = 0; chunk < chunks; ++chunk) countChunk(chunk);
+		}
+
+		const int64_t total =
+		  detail::scan::scanRun<detail::scan::Sum>(offsets.data(), offsets.data(), chunks, true);
+		Result result(FlatShape({static_cast<size_t>(total)}));
+
+		// Compact each chunk without branches, one block at a time, through a buffer on the
+		// stack, so no thread writes past the end of its own part of the result
+		const Scalar *src	   = array.storage().begin();
+		Scalar *dst			   = result.storage().begin();
+		const auto writeChunk = [&](int64_t chunk) {
+			const int64_t last = ::librapid::min((chunk + 1) * chunkSize, size);
+			Scalar *out		   = dst + offsets[chunk];
+			Scalar buffer[blockSize];
+			for (int64_t begin = chunk * chunkSize; begin < last; begin += blockSize) {
+				const int64_t end = ::librapid::min(begin + blockSize, last);
+				int64_t count	  = 0;
+				for (int64_t i = begin; i < end; ++i) {
+					buffer[count] = src[i];
+					count += selected(i);
+				}
+				std::copy(buffer, buffer + count, out);
+				out += count;
+			}
+		};
+
+		if (parallel) {
+#pragma omp parallel for shared(chunks, writeChunk) default(none) num_threads(global::numThreads)
+			for (int64_t chunk = 0; chunk < chunks; ++chunk) { writeChunk(chunk); }
+		} else {
+			for (int64_t chunk = 0; chunk < chunks; ++chunk) writeChunk(chunk);
+		}
+
+		return result;
+	}
+
+	namespace array {
+		template<typename ShapeType_, typename StorageType_>
+		template<typename Mask,
+				 typename std::enable_if_t<typetraits::TypeInfo<Mask>::type !=
+											 ::librapid::detail::LibRapidType::Scalar,
+										   int>>
+		auto ArrayContainer<ShapeType_, StorageType_>::operator[](const Mask &mask) const {
+			return ::librapid::compress(*this, mask);
+		}
+	} // namespace array
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_INDEXING_HPP
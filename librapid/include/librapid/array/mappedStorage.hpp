@@ -0,0 +1,673 @@
+#ifndef LIBRAPID_ARRAY_MAPPED_STORAGE_HPP
+#define LIBRAPID_ARRAY_MAPPED_STORAGE_HPP
+
+/*
+ * This file defines the MappedStorage class, which stores the elements of an array in a
+ * memory-mapped region. The region can be backed by a file, so arrays larger than physical
+ * memory can be processed with the same expression templates as any other array, with the
+ * operating system paging data in and out on demand.
+ */
+
+namespace librapid {
+	namespace typetraits {
+		template<typename Scalar_>
+		struct TypeInfo<MappedStorage<Scalar_>> {
+			static constexpr bool isLibRapidType = true;
+			using Scalar						 = Scalar_;
+			using Device						 = device::CPU;
+		};
+
+		template<typename T>
+		struct IsMappedStorage : std::false_type {};
+
+		template<typename Scalar>
+		struct IsMappedStorage<MappedStorage<Scalar>> : std::true_type {};
+	} // namespace typetraits
+
+	/// How a file is mapped into memory
+	enum class MapMode {
+		ReadOnly,	// Elements can be read but not written. Writing to the array is an error
+		ReadWrite,	// Writes are visible to other processes and are written back to the file
+		CopyOnWrite // Writes are private to this mapping and never reach the file
+	};
+
+	/// Hints describing how a mapped array will be accessed. The operating system may use these
+	/// to read ahead or to release memory early, but they never change the array's contents.
+	enum class MapAdvice {
+		Normal,		// No special treatment
+		Sequential, // Elements will be accessed in order, so read ahead aggressively
+		Random,		// Elements will be accessed in a random order, so do not read ahead
+		WillNeed,	// The elements will be accessed soon, so start reading them now
+		DontNeed	// The elements will not be accessed soon, so their pages can be released
+	};
+
+	namespace detail {
+		/// An owning handle to a region of mapped memory, which is either anonymous or backed
+		/// by a file. This contains all of the platform-specific code used by MappedStorage.
+		class MappedRegion {
+		public:
+			MappedRegion() = default;
+			MappedRegion(const MappedRegion &)			  = delete;
+			MappedRegion &operator=(const MappedRegion &) = delete;
+
+			LIBRAPID_INLINE MappedRegion(MappedRegion &&other) noexcept { swap(other); }
+
+			LIBRAPID_INLINE MappedRegion &operator=(MappedRegion &&other) noexcept {
+				MappedRegion(std::move(other)).swap(*this);
+				return *this;
+			}
+
+			LIBRAPID_INLINE ~MappedRegion() { unmap(); }
+
+			/// Map \p bytes bytes of zero-initialised memory which is not backed by a file
+			/// \param bytes The number of bytes to map
+			/// \return The mapped region
+			LIBRAPID_NODISCARD static LIBRAPID_INLINE MappedRegion anonymous(size_t bytes);
+
+			/// Map \p bytes bytes of a file, starting \p offset bytes into it. The offset does not
+			/// need to be a multiple of the page size.
+			/// \param path The path of the file
+			/// \param mode How the file is mapped
+			/// \param offset The offset of the first mapped byte in the file
+			/// \param bytes The number of bytes to map
+			/// \param create If true, the file is created if necessary and resized to
+			/// `offset + bytes` bytes, keeping the first \p offset bytes and setting the mapped
+			/// bytes to zero. Otherwise the file must already contain the mapped bytes
+			/// \return The mapped region
+			LIBRAPID_NODISCARD static LIBRAPID_INLINE MappedRegion
+			file(const std::string &path, MapMode mode, size_t offset, size_t bytes, bool create);
+
+			/// Return the size of a file in bytes
+			/// \param path The path of the file
+			/// \return The size of the file
+			LIBRAPID_NODISCARD static LIBRAPID_INLINE size_t fileSize(const std::string &path);
+
+			/// \return A pointer to the first requested byte of the region
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE void *data() const {
+				return m_base == nullptr ? nullptr : static_cast<char *>(m_base) + m_skip;
+			}
+
+			/// \return True if the region is backed by a file
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isFileBacked() const {
+				return m_fileBacked;
+			}
+
+			/// Pass an access pattern hint to the operating system
+			/// \param advice The hint
+			LIBRAPID_INLINE void advise(MapAdvice advice) const;
+
+			/// Write modified pages back to the file and wait for the writes to complete. This
+			/// does nothing for anonymous and copy-on-write regions
+			LIBRAPID_INLINE void flush() const;
+
+		private:
+			LIBRAPID_INLINE void swap(MappedRegion &other) noexcept {
+				std::swap(m_base, other.m_base);
+				std::swap(m_length, other.m_length);
+				std::swap(m_skip, other.m_skip);
+				std::swap(m_fileBacked, other.m_fileBacked);
+				std::swap(m_shared, other.m_shared);
+#if defined(LIBRAPID_WINDOWS)
+				std::swap(m_file, other.m_file);
+				std::swap(m_mapping, other.m_mapping);
+#endif
+			}
+
+			LIBRAPID_INLINE void unmap() noexcept;
+
+			void *m_base		= nullptr; // Start of the mapping (aligned to the page size)
+			size_t m_length		= 0;	   // Length of the mapping in bytes
+			size_t m_skip		= 0;	   // Bytes between m_base and the first requested byte
+			bool m_fileBacked	= false;   // True if the region maps a file
+			bool m_shared		= false;   // True if writes are written back to the file
+#if defined(LIBRAPID_WINDOWS)
+			HANDLE m_file		= INVALID_HANDLE_VALUE;
+			HANDLE m_mapping	= nullptr;
+#endif
+		};
+	} // namespace detail
+
+	/// Contiguous storage for an array whose elements live in a memory-mapped region. A
+	/// MappedStorage object can be used as the StorageType of an ArrayContainer, in which case
+	/// expressions are evaluated directly into (and read directly from) the mapped memory.
+	///
+	/// Anonymous mappings behave like a Storage object. File-backed mappings have a fixed size
+	/// and cannot be resized, and writing to a read-only mapping is an error.
+	/// \tparam Scalar_ The scalar type of the elements
+	template<typename Scalar_>
+	class MappedStorage {
+	public:
+		using Scalar			   = Scalar_;
+		using Pointer			   = Scalar *;
+		using ConstPointer		   = const Scalar *;
+		using Reference			   = Scalar &;
+		using ConstReference	   = const Scalar &;
+		using SizeType			   = size_t;
+		using DifferenceType	   = ptrdiff_t;
+		using Iterator			   = Pointer;
+		using ConstIterator		   = ConstPointer;
+		using ReverseIterator	   = std::reverse_iterator<Iterator>;
+		using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+		static_assert(std::is_trivially_copyable_v<Scalar>,
+					  "Only trivially copyable types can be stored in mapped memory");
+
+		/// Default constructor
+		MappedStorage() = default;
+
+		/// Create an anonymous mapping containing \p size zero-initialised elements
+		/// \param size Number of elements to allocate
+		LIBRAPID_INLINE explicit MappedStorage(SizeType size);
+
+		/// Create an anonymous mapping containing \p size elements, each initialised to \p value
+		/// \param size Number of elements to allocate
+		/// \param value Value to initialise each element to
+		LIBRAPID_INLINE MappedStorage(SizeType size, ConstReference value);
+
+		/// Map \p size elements of an existing file, starting \p offset bytes into the file
+		/// \param path The path of the file
+		/// \param mode How the file is mapped
+		/// \param size The number of elements to map
+		/// \param offset The offset of the first element in the file. This must be a multiple
+		/// of the alignment of \p Scalar
+		LIBRAPID_INLINE MappedStorage(const std::string &path, MapMode mode, SizeType size,
+									  size_t offset = 0);
+
+		/// Create a MappedStorage object referring to existing data. If \p independent is true,
+		/// the data is copied into an anonymous mapping. Otherwise the object is a view of the
+		/// data, which must outlive it.
+		/// \param begin Pointer to the first element
+		/// \param end Pointer past the last element
+		/// \param independent If true, copy the data
+		LIBRAPID_INLINE MappedStorage(Scalar *begin, Scalar *end, bool independent);
+
+		/// Copy another MappedStorage object into a new anonymous mapping
+		/// \param other MappedStorage object to copy
+		LIBRAPID_INLINE MappedStorage(const MappedStorage &other);
+
+		/// Move a MappedStorage object into this object
+		/// \param other MappedStorage object to move
+		LIBRAPID_INLINE MappedStorage(MappedStorage &&other) noexcept;
+
+		/// Copy the elements of another MappedStorage object into this one. An anonymous
+		/// mapping is resized to fit, while a file-backed mapping or view must already have
+		/// the same size, and the elements are written through to the underlying memory
+		/// \param other MappedStorage object to copy
+		/// \return *this
+		LIBRAPID_INLINE MappedStorage &operator=(const MappedStorage &other);
+
+		/// Move a MappedStorage object into this one
+		/// \param other MappedStorage object to move
+		/// \return *this
+		LIBRAPID_INLINE MappedStorage &operator=(MappedStorage &&other) noexcept;
+
+		/// Resize a file (creating it if necessary) to contain \p size zero elements after its
+		/// first \p offset bytes, which are kept, and map the elements for reading and writing
+		/// \param path The path of the file
+		/// \param size The number of elements in the file
+		/// \param offset The offset of the first element in the file
+		/// \return The mapped storage
+		LIBRAPID_NODISCARD static LIBRAPID_INLINE MappedStorage create(const std::string &path,
+																	   SizeType size,
+																	   size_t offset = 0);
+
+		/// Resize an anonymous mapping to \p newSize elements, retaining existing data.
+		/// File-backed mappings cannot be resized.
+		/// \param newSize New size of the MappedStorage object
+		LIBRAPID_INLINE void resize(SizeType newSize);
+
+		/// Resize an anonymous mapping to \p newSize elements. The contents of the storage are
+		/// unspecified afterwards.
+		/// \param newSize New size of the MappedStorage object
+		LIBRAPID_INLINE void resize(SizeType newSize, int);
+
+		/// Pass an access pattern hint for the mapped elements to the operating system
+		/// \param advice The expected access pattern
+		LIBRAPID_INLINE void advise(MapAdvice advice) const;
+
+		/// Write modified elements of a read-write file mapping back to the file, and wait for
+		/// the writes to complete. This does nothing for other mappings.
+		LIBRAPID_INLINE void flush() const;
+
+		/// \return True if the elements are backed by a file
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isFileBacked() const noexcept;
+
+		/// \return The mode the elements were mapped with
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE MapMode mode() const noexcept;
+
+		/// Return the number of elements in the MappedStorage object
+		/// \return Number of elements
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE SizeType size() const noexcept;
+
+		/// Const access to the element at index \p index
+		/// \param index Index of the element to access
+		/// \return Const reference to the element at index \p index
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstReference operator[](SizeType index) const;
+
+		/// Access to the element at index \p index
+		/// \param index Index of the element to access
+		/// \return Reference to the element at index \p index
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Reference operator[](SizeType index);
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Iterator begin() noexcept;
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Iterator end() noexcept;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstIterator begin() const noexcept;
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstIterator end() const noexcept;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstIterator cbegin() const noexcept;
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstIterator cend() const noexcept;
+
+	private:
+		/// Map \p size elements of anonymous memory, replacing the current mapping
+		/// \param size The number of elements
+		LIBRAPID_INLINE void mapAnonymous(SizeType size);
+
+		detail::MappedRegion m_region;
+		Pointer m_begin	   = nullptr;
+		SizeType m_size	   = 0;
+		MapMode m_mode	   = MapMode::ReadWrite;
+		bool m_independent = true; // If false, this object is a view of memory it does not own
+	};
+
+	namespace detail {
+		/// Throw an exception describing the last operating system error
+		/// \param action Description of the operation that failed
+		/// \param path The path of the file involved
+		[[noreturn]] LIBRAPID_INLINE void throwMapError(const char *action,
+														const std::string &path) {
+#if defined(LIBRAPID_WINDOWS)
+			const auto error = static_cast<int>(GetLastError());
+			throw std::runtime_error(
+			  fmt::format("Failed to {} '{}' (error code {})", action, path, error));
+#else
+			throw std::runtime_error(
+			  fmt::format("Failed to {} '{}': {}", action, path, std::strerror(errno)));
+#endif
+		}
+
+#if defined(LIBRAPID_WINDOWS)
+		LIBRAPID_INLINE size_t MappedRegion::fileSize(const std::string &path) {
+			WIN32_FILE_ATTRIBUTE_DATA info;
+			if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &info))
+				throwMapError("read the size of", path);
+			return (static_cast<size_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+		}
+
+		LIBRAPID_INLINE MappedRegion MappedRegion::anonymous(size_t bytes) {
+			MappedRegion region;
+			if (bytes == 0) return region;
+			region.m_base = VirtualAlloc(nullptr, bytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+			if (region.m_base == nullptr) throw std::bad_alloc();
+			region.m_length = bytes;
+			return region;
+		}
+
+		LIBRAPID_INLINE MappedRegion MappedRegion::file(const std::string &path, MapMode mode,
+														size_t offset, size_t bytes,
+														bool create) {
+			const bool readWrite = mode == MapMode::ReadWrite;
+			MappedRegion region;
+			region.m_fileBacked = true;
+			region.m_shared		= readWrite;
+			region.m_file		= CreateFileA(path.c_str(),
+										  GENERIC_READ | (readWrite ? GENERIC_WRITE : 0),
+										  FILE_SHARE_READ | FILE_SHARE_WRITE,
+										  nullptr,
+										  create ? OPEN_ALWAYS : OPEN_EXISTING,
+										  FILE_ATTRIBUTE_NORMAL,
+										  nullptr);
+			if (region.m_file == INVALID_HANDLE_VALUE) throwMapError("open", path);
+
+			// Truncate the file to the offset, so the mapping extends it with zeros
+			if (create) {
+				LARGE_INTEGER end;
+				end.QuadPart = static_cast<LONGLONG>(offset);
+				if (!SetFilePointerEx(region.m_file, end, nullptr, FILE_BEGIN) ||
+					!SetEndOfFile(region.m_file))
+					throwMapError("resize", path);
+			}
+			if (bytes == 0) return region;
+
+			SYSTEM_INFO info;
+			GetSystemInfo(&info);
+			const size_t granularity = info.dwAllocationGranularity;
+			const size_t start		 = offset - offset % granularity;
+			const uint64_t end		 = static_cast<uint64_t>(offset) + bytes;
+
+			// Creating a mapping larger than the file extends the file
+			const DWORD protect = mode == MapMode::ReadOnly		 ? PAGE_READONLY
+								  : mode == MapMode::CopyOnWrite ? PAGE_WRITECOPY
+																 : PAGE_READWRITE;
+			region.m_mapping	= CreateFileMappingA(region.m_file,
+												 nullptr,
+												 protect,
+												 static_cast<DWORD>(end >> 32),
+												 static_cast<DWORD>(end & 0xFFFFFFFF),
+												 nullptr);
+			if (region.m_mapping == nullptr) throwMapError("map", path);
+
+			const DWORD access = mode == MapMode::ReadOnly		? FILE_MAP_READ
+								 : mode == MapMode::CopyOnWrite ? FILE_MAP_COPY
+																: FILE_MAP_WRITE;
+			region.m_skip	   = offset - start;
+			region.m_length	   = region.m_skip + bytes;
+			region.m_base	   = MapViewOfFile(region.m_mapping,
+										   access,
+										   static_cast<DWORD>(static_cast<uint64_t>(start) >> 32),
+										   static_cast<DWORD>(start & 0xFFFFFFFF),
+										   region.m_length);
+			if (region.m_base == nullptr) throwMapError("map", path);
+			return region;
+		}
+
+		LIBRAPID_INLINE void MappedRegion::advise(MapAdvice) const {
+			// Windows has no equivalent of madvise for mapped files, so hints are ignored
+		}
+
+		LIBRAPID_INLINE void MappedRegion::flush() const {
+			if (m_base == nullptr || !m_shared) return;
+			if (!FlushViewOfFile(m_base, m_length) || !FlushFileBuffers(m_file))
+				throwMapError("flush", "mapped file");
+		}
+
+		LIBRAPID_INLINE void MappedRegion::unmap() noexcept {
+			if (m_base != nullptr) {
+				if (m_fileBacked)
+					UnmapViewOfFile(m_base);
+				else
+					VirtualFree(m_base, 0, MEM_RELEASE);
+			}
+			if (m_mapping != nullptr) CloseHandle(m_mapping);
+			if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+			m_base	  = nullptr;
+			m_mapping = nullptr;
+			m_file	  = INVALID_HANDLE_VALUE;
+		}
+#else
+		LIBRAPID_INLINE size_t MappedRegion::fileSize(const std::string &path) {
+			struct stat info {};
+			if (stat(path.c_str(), &info) != 0) throwMapError("read the size of", path);
+			return static_cast<size_t>(info.st_size);
+		}
+
+		LIBRAPID_INLINE MappedRegion MappedRegion::anonymous(size_t bytes) {
+			MappedRegion region;
+			if (bytes == 0) return region;
+			void *base =
+			  mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (base == MAP_FAILED) throw std::bad_alloc();
+			region.m_base	= base;
+			region.m_length = bytes;
+			return region;
+		}
+
+		LIBRAPID_INLINE MappedRegion MappedRegion::file(const std::string &path, MapMode mode,
+														size_t offset, size_t bytes,
+														bool create) {
+			const bool readWrite = mode == MapMode::ReadWrite;
+			const int flags		 = readWrite ? (O_RDWR | (create ? O_CREAT : 0)) : O_RDONLY;
+			const int fd		 = open(path.c_str(), flags, 0644);
+			if (fd < 0) throwMapError("open", path);
+
+			// The mapping keeps the file open, so the descriptor can be closed straight away
+			struct FileCloser {
+				int fd;
+				~FileCloser() { close(fd); }
+			} closer {fd};
+
+			// Truncating to the offset first discards any old data, so the elements are zero
+			if (create && (ftruncate(fd, static_cast<off_t>(offset)) != 0 ||
+						   ftruncate(fd, static_cast<off_t>(offset + bytes)) != 0))
+				throwMapError("resize", path);
+
+			MappedRegion region;
+			region.m_fileBacked = true;
+			region.m_shared		= readWrite;
+			if (bytes == 0) return region;
+
+			const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+			const size_t start	= offset - offset % pageSize;
+			const int prot = mode == MapMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+
+			region.m_skip	= offset - start;
+			region.m_length = region.m_skip + bytes;
+			void *base		= mmap(nullptr,
+							   region.m_length,
+							   prot,
+							   readWrite ? MAP_SHARED : MAP_PRIVATE,
+							   fd,
+							   static_cast<off_t>(start));
+			if (base == MAP_FAILED) throwMapError("map", path);
+			region.m_base = base;
+			return region;
+		}
+
+		LIBRAPID_INLINE void MappedRegion::advise(MapAdvice advice) const {
+			if (m_base == nullptr) return;
+
+			// posix_madvise never discards data, even for POSIX_MADV_DONTNEED, so every hint is
+			// safe for private and anonymous mappings. Failures are ignored, since these are
+			// only hints.
+			int value = POSIX_MADV_NORMAL;
+			switch (advice) {
+				case MapAdvice::Normal: value = POSIX_MADV_NORMAL; break;
+				case MapAdvice::Sequential: value = POSIX_MADV_SEQUENTIAL; break;
+				case MapAdvice::Random: value = POSIX_MADV_RANDOM; break;
+				case MapAdvice::WillNeed: value = POSIX_MADV_WILLNEED; break;
+				case MapAdvice::DontNeed: value = POSIX_MADV_DONTNEED; break;
+			}
+			(void)posix_madvise(m_base, m_length, value);
+		}
+
+		LIBRAPID_INLINE void MappedRegion::flush() const {
+			if (m_base == nullptr || !m_shared) return;
+			if (msync(m_base, m_length, MS_SYNC) != 0) throwMapError("flush", "mapped file");
+		}
+
+		LIBRAPID_INLINE void MappedRegion::unmap() noexcept {
+			if (m_base != nullptr) munmap(m_base, m_length);
+			m_base = nullptr;
+		}
+#endif // LIBRAPID_WINDOWS
+	}	   // namespace detail
+
+	template<typename T>
+	MappedStorage<T>::MappedStorage(SizeType size) {
+		mapAnonymous(size);
+	}
+
+	template<typename T>
+	MappedStorage<T>::MappedStorage(SizeType size, ConstReference value) {
+		mapAnonymous(size);
+		std::fill(m_begin, m_begin + m_size, value);
+	}
+
+	template<typename T>
+	MappedStorage<T>::MappedStorage(const std::string &path, MapMode mode, SizeType size,
+									size_t offset) :
+			m_mode(mode) {
+		if (offset % alignof(Scalar) != 0) {
+			throw std::runtime_error(
+			  fmt::format("Cannot map '{}' at offset {}, which is not a multiple of {}",
+						  path,
+						  offset,
+						  alignof(Scalar)));
+		}
+
+		const size_t bytes	  = size * sizeof(Scalar);
+		const size_t fileSize = detail::MappedRegion::fileSize(path);
+		if (offset > fileSize || fileSize - offset < bytes) {
+			throw std::runtime_error(
+			  fmt::format("Cannot map {} bytes at offset {} of '{}', which contains {} bytes",
+						  bytes,
+						  offset,
+						  path,
+						  fileSize));
+		}
+
+		m_region = detail::MappedRegion::file(path, mode, offset, bytes, false);
+		m_begin	 = static_cast<Pointer>(m_region.data());
+		m_size	 = size;
+	}
+
+	template<typename T>
+	MappedStorage<T>::MappedStorage(Scalar *begin, Scalar *end, bool independent) :
+			m_independent(independent) {
+		if (independent) {
+			mapAnonymous(static_cast<SizeType>(end - begin));
+			std::copy(begin, end, m_begin);
+		} else {
+			m_begin = begin;
+			m_size	= static_cast<SizeType>(end - begin);
+		}
+	}
+
+	template<typename T>
+	MappedStorage<T>::MappedStorage(const MappedStorage &other) {
+		mapAnonymous(other.size());
+		std::copy(other.begin(), other.end(), m_begin);
+	}
+
+	template<typename T>
+	MappedStorage<T>::MappedStorage(MappedStorage &&other) noexcept :
+			m_region(std::move(other.m_region)), m_begin(std::exchange(other.m_begin, nullptr)),
+			m_size(std::exchange(other.m_size, 0)), m_mode(other.m_mode),
+			m_independent(other.m_independent) {}
+
+	template<typename T>
+	auto MappedStorage<T>::operator=(const MappedStorage &other) -> MappedStorage & {
+		if (this != &other) {
+			if (m_size != other.size()) {
+				LIBRAPID_ASSERT(m_independent && !isFileBacked(),
+								"Cannot resize a file-backed or dependent mapping");
+				mapAnonymous(other.size());
+			}
+			std::copy(other.begin(), other.end(), m_begin);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	auto MappedStorage<T>::operator=(MappedStorage &&other) noexcept -> MappedStorage & {
+		if (this != &other) {
+			m_region	  = std::move(other.m_region);
+			m_begin		  = std::exchange(other.m_begin, nullptr);
+			m_size		  = std::exchange(other.m_size, 0);
+			m_mode		  = other.m_mode;
+			m_independent = other.m_independent;
+		}
+		return *this;
+	}
+
+	template<typename T>
+	auto MappedStorage<T>::create(const std::string &path, SizeType size, size_t offset)
+	  -> MappedStorage {
+		MappedStorage res;
+		res.m_region =
+		  detail::MappedRegion::file(path, MapMode::ReadWrite, offset, size * sizeof(Scalar), true);
+		res.m_begin = static_cast<Pointer>(res.m_region.data());
+		res.m_size	= size;
+		return res;
+	}
+
+	template<typename T>
+	void MappedStorage<T>::mapAnonymous(SizeType size) {
+		m_region	  = detail::MappedRegion::anonymous(size * sizeof(Scalar));
+		m_begin		  = static_cast<Pointer>(m_region.data());
+		m_size		  = size;
+		m_mode		  = MapMode::ReadWrite;
+		m_independent = true;
+	}
+
+	template<typename T>
+	void MappedStorage<T>::resize(SizeType newSize) {
+		if (newSize == m_size) return;
+		LIBRAPID_ASSERT(m_independent && !isFileBacked(),
+						"Cannot resize a file-backed or dependent mapping");
+
+		// Keep the old region mapped until its elements have been copied
+		detail::MappedRegion old = std::move(m_region);
+		Pointer oldBegin		 = m_begin;
+		const SizeType oldSize	 = m_size;
+		mapAnonymous(newSize);
+		std::copy(oldBegin, oldBegin + std::min(oldSize, newSize), m_begin);
+	}
+
+	template<typename T>
+	void MappedStorage<T>::resize(SizeType newSize, int) {
+		if (newSize == m_size) return;
+		LIBRAPID_ASSERT(m_independent && !isFileBacked(),
+						"Cannot resize a file-backed or dependent mapping");
+		mapAnonymous(newSize);
+	}
+
+	template<typename T>
+	void MappedStorage<T>::advise(MapAdvice advice) const {
+		m_region.advise(advice);
+	}
+
+	template<typename T>
+	void MappedStorage<T>::flush() const {
+		m_region.flush();
+	}
+
+	template<typename T>
+	auto MappedStorage<T>::isFileBacked() const noexcept -> bool {
+		return m_region.isFileBacked();
+	}
+
+	template<typename T>
+	auto MappedStorage<T>::mode() const noexcept -> MapMode {
+		return m_mode;
+	}
+
+	template<typename T>
+	auto MappedStorage<T>::size() const noexcept -> SizeType {
+		return m_size;
+	}
+
+	template<typename T>
+	auto MappedStorage<T>::operator[](SizeType index) const -> ConstReference {
+		LIBRAPID_ASSERT(index < size(), "Index {} out of bounds for size {}", index, size());
+		return m_begin[index];
+	}
+
+	template<typename T>
+	auto MappedStorage<T>::operator[](SizeType index) -> Reference {
+		LIBRAPID_ASSERT(index < size(), "Index {} out of bounds for size {}", index, size());
+		return m_begin[index];
+	}
+
+	template<typename T>
+	auto MappedStorage<T>::begin() noexcept -> Iterator {
+		return m_begin;
+	}
+
+	template<typename T>
+	auto MappedStorage<T>::end() noexcept -> Iterator {
+		return m_begin + m_size;
+	}
+
+	template<typename T>
+	auto MappedStorage<T>::begin() const noexcept -> ConstIterator {
+		return m_begin;
+	}
+
+	template<typename T>
+	auto MappedStorage<T>::end() const noexcept -> ConstIterator {
+		return m_begin + m_size;
+	}
+
+	template<typename T>
+	auto MappedStorage<T>::cbegin() const noexcept -> ConstIterator {
+		return m_begin;
+	}
+
+	template<typename T>
+	auto MappedStorage<T>::cend() const noexcept -> ConstIterator {
+		return m_begin + m_size;
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_MAPPED_STORAGE_HPP
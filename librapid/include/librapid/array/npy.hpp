@@ -0,0 +1,978 @@
+#ifndef LIBRAPID_ARRAY_NPY_HPP
+#define LIBRAPID_ARRAY_NPY_HPP
+
+/*
+ * Reading and writing NumPy's .npy and .npz formats, so arrays can be exchanged with Python
+ * without a custom parser.
+ *
+ * A .npy file is a short preamble, a Python dictionary literal describing the data type, the
+ * memory order and the shape, and then the raw elements. Elements are read straight into the
+ * destination array's storage, or can be memory-mapped with mapNpy. Files in Fortran order are
+ * reordered on load, since LibRapid arrays are always stored in C (row-major) order.
+ *
+ * A .npz file is a ZIP archive containing one .npy file per array, as written by `np.savez`.
+ * Entries are stored uncompressed, so they can also be read and mapped in place. Archives
+ * written by `np.savez_compressed` cannot be read, since that would require a deflate
+ * implementation.
+ */
+
+namespace librapid::detail::npy {
+	using serialize::DType;
+	using serialize::File;
+
+	/// Magic string at the start of every .npy file
+	constexpr char magic[6] = {'\x93', 'N', 'U', 'M', 'P', 'Y'};
+
+	/// The length of a .npy header (including the preamble) is a multiple of this, so the data
+	/// is aligned
+	constexpr size_t headerAlignment = 64;
+
+	/// Return the NumPy type code of a DType, without its byte order character
+	/// \param dtype The DType
+	/// \return The type code, or nullptr if the type has no NumPy equivalent
+	LIBRAPID_NODISCARD LIBRAPID_INLINE const char *typeCode(DType dtype) {
+		switch (dtype) {
+			case DType::Bool:
+			case DType::PackedBool: return "b1";
+			case DType::Int8: return "i1";
+			case DType::UInt8: return "u1";
+			case DType::Int16: return "i2";
+			case DType::UInt16: return "u2";
+			case DType::Int32: return "i4";
+			case DType::UInt32: return "u4";
+			case DType::Int64: return "i8";
+			case DType::UInt64: return "u8";
+			case DType::Float16: return "f2";
+			case DType::Float32: return "f4";
+			case DType::Float64: return "f8";
+			case DType::Complex64: return "c8";
+			case DType::Complex128: return "c16";
+			default: return nullptr;
+		}
+	}
+
+	/// Return the size in bytes of one element of a DType, as stored in a .npy file
+	/// \param dtype The DType
+	/// \return The size of one element
+	LIBRAPID_NODISCARD LIBRAPID_INLINE size_t elementSize(DType dtype) {
+		const char *code = typeCode(dtype);
+		return code == nullptr ? 0 : static_cast<size_t>(std::atoi(code + 1));
+	}
+
+	/// Return the DType stored in a .npy file for arrays with a given storage type. Boolean
+	/// arrays are stored with one byte per element, even when they are bit-packed in memory.
+	/// \tparam StorageType The storage type
+	/// \return The DType of the elements in the file
+	template<typename StorageType>
+	constexpr DType dtypeOf() {
+		if constexpr (typetraits::IsBitStorage<StorageType>::value) {
+			return DType::Bool;
+		} else {
+			return serialize::dtypeOf<typename StorageType::Scalar>();
+		}
+	}
+
+	/// The parts of a .npy header used to read the data
+	struct Header {
+		DType dtype;				 // Data type of the elements
+		bool swap;					 // True if the elements are in the opposite byte order
+		bool fortranOrder;			 // True if the elements are in Fortran (column-major) order
+		std::vector<uint64_t> shape; // Dimensions of the array
+		uint64_t dataOffset;		 // Offset of the first element in the file
+	};
+
+	/// Build a .npy header (including the preamble) for a C-order array of native-endian data
+	/// \param dtype The data type of the elements
+	/// \param shape The dimensions of the array
+	/// \return The bytes of the header
+	LIBRAPID_NODISCARD LIBRAPID_INLINE std::string
+	headerString(DType dtype, const std::vector<uint64_t> &shape) {
+		const char *code = typeCode(dtype);
+		LIBRAPID_ASSERT(code != nullptr, "Data type cannot be stored in a .npy file");
+		const char order = elementSize(dtype) == 1			 ? '|'
+						   : serialize::hostIsLittleEndian() ? '<'
+															 : '>';
+
+		std::string dims;
+		for (const auto dim : shape) dims += fmt::format("{}, ", dim);
+		if (shape.size() > 1) dims.resize(dims.size() - 2);
+		if (shape.size() == 1) dims.pop_back();
+
+		std::string dict = fmt::format(
+		  "{{'descr': '{}{}', 'fortran_order': False, 'shape': ({}), }}", order, code, dims);
+
+		// Version 1.0 stores the header length in two bytes, so long headers need version 2.0
+		size_t preamble = 10;
+		if (dict.size() + headerAlignment + 1 > 0xFFFF) preamble = 12;
+		const size_t total =
+		  (preamble + dict.size() + 1 + headerAlignment - 1) / headerAlignment * headerAlignment;
+		dict.append(total - preamble - dict.size() - 1, ' ');
+		dict += '\n';
+
+		std::string res(magic, sizeof(magic));
+		res += static_cast<char>(preamble == 10 ? 1 : 2);
+		res += '\0';
+		const size_t length = dict.size();
+		for (size_t i = 0; i < preamble - 8; ++i) res += static_cast<char>(length >> (i * 8));
+		return res + dict;
+	}
+
+	/// Convert a NumPy type description (such as '<f8') into a DType
+	/// \param descr The type description
+	/// \param path The path of the file, for error messages
+	/// \param header The header to store the DType and byte order in
+	LIBRAPID_INLINE void parseDescr(const std::string &descr, const std::string &path,
+									Header &header) {
+		constexpr DType types[] = {DType::Bool,
+								   DType::Int8,
+								   DType::UInt8,
+								   DType::Int16,
+								   DType::UInt16,
+								   DType::Int32,
+								   DType::UInt32,
+								   DType::Int64,
+								   DType::UInt64,
+								   DType::Float16,
+								   DType::Float32,
+								   DType::Float64,
+								   DType::Complex64,
+								   DType::Complex128};
+
+		const char order		= descr.empty() ? '\0' : descr[0];
+		const bool hasOrder		= order == '<' || order == '>' || order == '|' || order == '=';
+		const std::string code	= hasOrder ? descr.substr(1) : descr;
+		const bool littleEndian = serialize::hostIsLittleEndian();
+
+		for (const auto dtype : types) {
+			if (code == typeCode(dtype)) {
+				header.dtype = dtype;
+				header.swap	 = elementSize(dtype) > 1 &&
+							  ((order == '<' && !littleEndian) || (order == '>' && littleEndian));
+				return;
+			}
+		}
+
+		throw std::runtime_error(fmt::format(
+		  "'{}' contains elements of NumPy type '{}', which is not supported", path, descr));
+	}
+
+	/// Parse the dictionary in a .npy header
+	/// \param text The dictionary literal
+	/// \param path The path of the file, for error messages
+	/// \param header The header to store the results in
+	LIBRAPID_INLINE void parseDict(const std::string &text, const std::string &path,
+								   Header &header) {
+		const auto fail = [&path](const char *message) {
+			throw std::runtime_error(
+			  fmt::format("'{}' has an invalid .npy header: {}", path, message));
+		};
+
+		// Return the position of the value for a key
+		const auto find = [&](const char *key) {
+			size_t pos = text.find(fmt::format("'{}'", key));
+			if (pos == std::string::npos) pos = text.find(fmt::format("\"{}\"", key));
+			if (pos == std::string::npos) fail("missing key");
+			pos = text.find(':', pos);
+			if (pos == std::string::npos) fail("missing value");
+			pos = text.find_first_not_of(" \t", pos + 1);
+			if (pos == std::string::npos) fail("missing value");
+			return pos;
+		};
+
+		size_t pos = find("descr");
+		if (text[pos] != '\'' && text[pos] != '"') {
+			fail("structured data types are not supported");
+		}
+		const size_t end = text.find(text[pos], pos + 1);
+		if (end == std::string::npos) fail("unterminated string");
+		parseDescr(text.substr(pos + 1, end - pos - 1), path, header);
+
+		pos = find("fortran_order");
+		if (text.compare(pos, 4, "True") == 0) {
+			header.fortranOrder = true;
+		} else if (text.compare(pos, 5, "False") == 0) {
+			header.fortranOrder = false;
+		} else {
+			fail("invalid value for 'fortran_order'");
+		}
+
+		pos = find("shape");
+		if (text[pos] != '(') fail("invalid value for 'shape'");
+		header.shape.clear();
+		for (++pos; pos < text.size() && text[pos] != ')';) {
+			if (text[pos] == ' ' || text[pos] == ',') {
+				++pos;
+			} else if (std::isdigit(static_cast<unsigned char>(text[pos]))) {
+				size_t digits = 0;
+				header.shape.push_back(std::stoull(text.substr(pos), &digits));
+				pos += digits;
+			} else {
+				fail("invalid value for 'shape'");
+			}
+		}
+		if (pos >= text.size()) fail("unterminated shape");
+	}
+
+	/// Read the header of a .npy file
+	/// \param file The file to read from
+	/// \param start The offset of the .npy data in the file (non-zero inside a .npz archive)
+	/// \return The header
+	LIBRAPID_NODISCARD LIBRAPID_INLINE Header readHeader(File &file, uint64_t start) {
+		file.seek(start);
+		uint8_t preamble[8];
+		file.read(preamble, sizeof(preamble));
+		if (!std::equal(magic, magic + sizeof(magic), reinterpret_cast<char *>(preamble))) {
+			throw std::runtime_error(fmt::format("'{}' is not a .npy file", file.path()));
+		}
+
+		const uint8_t major = preamble[6];
+		if (major < 1 || major > 3) {
+			throw std::runtime_error(
+			  fmt::format("'{}' has .npy format version {}, which is not supported",
+						  file.path(),
+						  major));
+		}
+
+		const size_t length =
+		  major == 1 ? file.readLittleEndian<uint16_t>() : file.readLittleEndian<uint32_t>();
+		std::string text(length, '\0');
+		file.read(text.data(), length);
+
+		Header header;
+		parseDict(text, file.path(), header);
+		header.dataOffset = start + (major == 1 ? 10 : 12) + length;
+		return header;
+	}
+
+	/// Copy an array stored in Fortran order into C order
+	/// \tparam T The element type
+	/// \param src The elements in Fortran order
+	/// \param dst The destination for the elements in C order
+	/// \param shape The dimensions of the array
+	template<typename T>
+	void fortranToC(const T *src, T *dst, const std::vector<uint64_t> &shape) {
+		const size_t ndim = shape.size();
+		uint64_t size	  = 1;
+		std::vector<uint64_t> stride(ndim);
+		for (size_t i = 0; i < ndim; ++i) {
+			stride[i] = size;
+			size *= shape[i];
+		}
+
+		// Walk the array in C order, keeping track of the corresponding Fortran index
+		std::vector<uint64_t> index(ndim, 0);
+		uint64_t source = 0;
+		for (uint64_t i = 0; i < size; ++i) {
+			dst[i] = src[source];
+			for (size_t dim = ndim; dim-- > 0;) {
+				source += stride[dim];
+				if (++index[dim] < shape[dim]) break;
+				source -= stride[dim] * shape[dim];
+				index[dim] = 0;
+			}
+		}
+	}
+
+	/// Read the elements described by \p header into the storage of an array with the same
+	/// shape
+	/// \tparam StorageType The storage type of the array
+	/// \param file The file to read from
+	/// \param header The header of the .npy data
+	/// \param storage The storage to read into
+	template<typename StorageType>
+	void readData(File &file, const Header &header, StorageType &storage) {
+		const size_t size = storage.size();
+		const bool permute = header.fortranOrder && header.shape.size() > 1;
+		file.seek(header.dataOffset);
+
+		if constexpr (typetraits::IsBitStorage<StorageType>::value) {
+			std::vector<uint8_t> bytes(size);
+			file.read(bytes.data(), size);
+			if (permute) {
+				std::vector<uint8_t> ordered(size);
+				fortranToC(bytes.data(), ordered.data(), header.shape);
+				bytes.swap(ordered);
+			}
+
+			using Word	 = typename StorageType::Word;
+			Word *words	 = storage.data();
+			for (size_t word = 0; word < storage.numWords(); ++word) {
+				const size_t begin = word * StorageType::wordBits;
+				const size_t end   = std::min(begin + StorageType::wordBits, size);
+				Word bits		   = 0;
+				for (size_t i = begin; i < end; ++i) bits |= Word(bytes[i] != 0) << (i - begin);
+				words[word] = bits;
+			}
+		} else {
+			using Bytes	 = serialize::StorageBytes<StorageType>;
+			using Scalar = typename StorageType::Scalar;
+
+			auto *dst = static_cast<Scalar *>(Bytes::data(storage));
+			if (permute) {
+				std::vector<Scalar> elements(size);
+				file.read(elements.data(), size * sizeof(Scalar));
+				fortranToC(elements.data(), dst, header.shape);
+			} else {
+				file.read(dst, size * sizeof(Scalar));
+			}
+
+			if (header.swap) {
+				serialize::swapBytes(reinterpret_cast<uint8_t *>(dst),
+									 size * sizeof(Scalar) / Bytes::swapSize,
+									 Bytes::swapSize);
+			}
+		}
+	}
+
+	/// Pass the elements of an array, as stored in a .npy file, to \p write in blocks
+	/// \tparam StorageType The storage type of the array
+	/// \tparam Write The type of the callback
+	/// \param storage The storage of the array
+	/// \param write Callable taking (pointer, bytes)
+	template<typename StorageType, typename Write>
+	void writeData(const StorageType &storage, Write &&write) {
+		if constexpr (typetraits::IsBitStorage<StorageType>::value) {
+			// Unpack one bit per byte, a block at a time
+			constexpr size_t block = size_t(1) << 16;
+			std::vector<uint8_t> bytes(std::min(block, storage.size()));
+			for (size_t begin = 0; begin < storage.size(); begin += block) {
+				const size_t count = std::min(block, storage.size() - begin);
+				for (size_t i = 0; i < count; ++i) bytes[i] = storage[begin + i] ? 1 : 0;
+				write(bytes.data(), count);
+			}
+		} else {
+			using Bytes = serialize::StorageBytes<StorageType>;
+			const auto *data = static_cast<const uint8_t *>(Bytes::data(storage));
+			const size_t bytes = Bytes::bytes(storage);
+			for (size_t begin = 0; begin < bytes; begin += serialize::blockSize) {
+				write(data + begin, std::min(serialize::blockSize, bytes - begin));
+			}
+		}
+	}
+
+	/// Return the dimensions of an array as stored in a .npy header
+	/// \tparam ShapeType The shape type
+	/// \tparam StorageType The storage type
+	/// \param array The array
+	/// \return The dimensions
+	template<typename ShapeType, typename StorageType>
+	std::vector<uint64_t> shapeOf(const array::ArrayContainer<ShapeType, StorageType> &array) {
+		const ShapeType shape = serialize::serializedShape(array.shape(), array.storage());
+		std::vector<uint64_t> res(shape.ndim());
+		for (size_t i = 0; i < shape.ndim(); ++i) res[i] = static_cast<uint64_t>(shape[i]);
+		return res;
+	}
+
+	/// Read .npy data starting at \p start in \p file into an array. If the array already has
+	/// the shape stored in the file, the elements are read straight into its existing storage.
+	/// Otherwise, arrays with resizable storage are reallocated, and an exception is thrown for
+	/// any other array.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param file The file to read from
+	/// \param start The offset of the .npy data in the file
+	/// \param dst The array to read into
+	template<typename ShapeType, typename StorageType>
+	void load(File &file, uint64_t start, array::ArrayContainer<ShapeType, StorageType> &dst) {
+		using ArrayType = array::ArrayContainer<ShapeType, StorageType>;
+
+		const Header header = readHeader(file, start);
+		if (header.dtype != dtypeOf<StorageType>()) {
+			throw std::runtime_error(fmt::format("'{}' contains {} data, but {} was expected",
+												 file.path(),
+												 serialize::dtypeName(header.dtype),
+												 serialize::dtypeName(dtypeOf<StorageType>())));
+		}
+		if (header.shape.size() > ShapeType::MaxDimensions) {
+			throw std::runtime_error(
+			  fmt::format("'{}' has {} dimensions, but at most {} are supported",
+						  file.path(),
+						  header.shape.size(),
+						  ShapeType::MaxDimensions));
+		}
+
+		const ShapeType shape(header.shape);
+		if (serialize::serializedShape(dst.shape(), dst.storage()) != shape) {
+			if constexpr (typetraits::IsStorage<StorageType>::value ||
+						  typetraits::IsBitStorage<StorageType>::value) {
+				dst = ArrayType(shape);
+			} else {
+				throw std::runtime_error(
+				  fmt::format("'{}' has shape {}, but the destination array has shape {}",
+							  file.path(),
+							  shape.str(),
+							  dst.shape().str()));
+			}
+		}
+
+		readData(file, header, dst.storage());
+	}
+
+	/// Write an array as .npy data, passing the bytes to \p write
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \tparam Write The type of the callback
+	/// \param array The array to write
+	/// \param write Callable taking (pointer, bytes)
+	template<typename ShapeType, typename StorageType, typename Write>
+	void save(const array::ArrayContainer<ShapeType, StorageType> &array, Write &&write) {
+		static_assert(serialize::dtypeOf<typename StorageType::Scalar>() != DType::Invalid &&
+						serialize::dtypeOf<typename StorageType::Scalar>() != DType::BFloat16,
+					  "This scalar type has no NumPy equivalent");
+
+		const std::string header = headerString(dtypeOf<StorageType>(), shapeOf(array));
+		write(header.data(), header.size());
+		writeData(array.storage(), write);
+	}
+
+	/// Map .npy data starting at \p start in a file into memory
+	/// \tparam Scalar The scalar type of the array
+	/// \param path The path of the file
+	/// \param start The offset of the .npy data in the file
+	/// \param mode How the file is mapped
+	/// \return An array referring to the mapped data
+	template<typename Scalar>
+	auto map(const std::string &path, uint64_t start, MapMode mode)
+	  -> Array<Scalar, MappedStorage<Scalar>> {
+		using ArrayType = Array<Scalar, MappedStorage<Scalar>>;
+		using ShapeType = typename ArrayType::ShapeType;
+
+		Header header;
+		{
+			File file(path, "rb");
+			header = readHeader(file, start);
+		}
+
+		constexpr DType dtype = serialize::dtypeOf<Scalar>();
+		if (header.dtype != dtype) {
+			throw std::runtime_error(fmt::format("'{}' contains {} data, but {} was expected",
+												 path,
+												 serialize::dtypeName(header.dtype),
+												 serialize::dtypeName(dtype)));
+		}
+		if (header.swap || (header.fortranOrder && header.shape.size() > 1)) {
+			throw std::runtime_error(
+			  fmt::format("'{}' is not stored in native byte order and C order, so it must be "
+						  "loaded rather than mapped",
+						  path));
+		}
+		if (header.shape.size() > ShapeType::MaxDimensions) {
+			throw std::runtime_error(
+			  fmt::format("'{}' has {} dimensions, but at most {} are supported",
+						  path,
+						  header.shape.size(),
+						  ShapeType::MaxDimensions));
+		}
+
+		const ShapeType shape(header.shape);
+		return ArrayType(shape, MappedStorage<Scalar>(path, mode, shape.size(), header.dataOffset));
+	}
+
+	/// Lookup tables for CRC-32 (as used by ZIP archives), processing eight bytes at a time
+	struct Crc32Table {
+		uint32_t values[8][256];
+
+		constexpr Crc32Table() : values() {
+			for (uint32_t i = 0; i < 256; ++i) {
+				uint32_t crc = i;
+				for (int bit = 0; bit < 8; ++bit) {
+					crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+				}
+				values[0][i] = crc;
+			}
+			for (uint32_t i = 0; i < 256; ++i) {
+				for (int table = 1; table < 8; ++table) {
+					const uint32_t prev = values[table - 1][i];
+					values[table][i]	= (prev >> 8) ^ values[0][prev & 0xFF];
+				}
+			}
+		}
+	};
+
+	inline constexpr Crc32Table crc32Table {};
+
+	/// Update a CRC-32 checksum with \p bytes bytes of data
+	/// \param crc The checksum of the preceding data (0 initially)
+	/// \param data Pointer to the data
+	/// \param bytes The number of bytes
+	/// \return The updated checksum
+	LIBRAPID_NODISCARD LIBRAPID_INLINE uint32_t crc32(uint32_t crc, const void *data,
+													  size_t bytes) {
+		const auto &table = crc32Table.values;
+		const auto *ptr	  = static_cast<const uint8_t *>(data);
+		crc				  = ~crc;
+
+		for (; bytes >= 8; bytes -= 8, ptr += 8) {
+			const uint32_t lo = crc ^ (uint32_t(ptr[0]) | uint32_t(ptr[1]) << 8 |
+									   uint32_t(ptr[2]) << 16 | uint32_t(ptr[3]) << 24);
+			crc = table[7][lo & 0xFF] ^ table[6][(lo >> 8) & 0xFF] ^ table[5][(lo >> 16) & 0xFF] ^
+				  table[4][lo >> 24] ^ table[3][ptr[4]] ^ table[2][ptr[5]] ^ table[1][ptr[6]] ^
+				  table[0][ptr[7]];
+		}
+		for (; bytes > 0; --bytes, ++ptr) crc = (crc >> 8) ^ table[0][(crc ^ *ptr) & 0xFF];
+		return ~crc;
+	}
+
+	/// Read a little-endian integer from a byte buffer
+	template<typename T>
+	LIBRAPID_NODISCARD T readLittleEndian(const uint8_t *data) {
+		uint64_t value = 0;
+		for (size_t i = 0; i < sizeof(T); ++i) value |= static_cast<uint64_t>(data[i]) << (i * 8);
+		return static_cast<T>(value);
+	}
+
+	// ZIP record signatures and limits
+	constexpr uint32_t localHeaderSignature		= 0x04034b50;
+	constexpr uint32_t centralHeaderSignature	= 0x02014b50;
+	constexpr uint32_t endOfCentralSignature	= 0x06054b50;
+	constexpr uint32_t zip64EndOfCentralSignature = 0x06064b50;
+	constexpr uint32_t zip64LocatorSignature	= 0x07064b50;
+	constexpr uint32_t zip32Limit				= 0xFFFFFFFF;
+	constexpr uint16_t zip64ExtraId				= 0x0001;
+	constexpr uint16_t paddingExtraId			= 0xD935; // As written by Android's zipalign
+	constexpr uint16_t dosDate					= (1 << 5) | 1; // 1980-01-01
+	constexpr uint16_t utf8Flag					= 1 << 11;
+} // namespace librapid::detail::npy
+
+namespace librapid {
+	/// Write an array to a NumPy .npy file. The elements are written in C order with the
+	/// host's byte order, straight from the array's storage.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param path The path of the file
+	/// \param array The array to write
+	template<typename ShapeType, typename StorageType>
+	void saveNpy(const std::string &path,
+				 const array::ArrayContainer<ShapeType, StorageType> &array) {
+		detail::serialize::File file(path, "wb");
+		detail::npy::save(array,
+						  [&file](const void *data, size_t bytes) { file.write(data, bytes); });
+	}
+
+	/// Read a NumPy .npy file into an existing array. If the array already has the shape of the
+	/// stored array, the elements are read directly into its storage without any intermediate
+	/// copy, so this can fill pre-allocated or memory-mapped arrays. Otherwise, arrays with
+	/// resizable storage are reallocated to fit.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param path The path of the file
+	/// \param dst The array to read into
+	template<typename ShapeType, typename StorageType>
+	void loadNpy(const std::string &path, array::ArrayContainer<ShapeType, StorageType> &dst) {
+		detail::serialize::File file(path, "rb");
+		detail::npy::load(file, 0, dst);
+	}
+
+	/// Read a NumPy .npy file into a new array. Files in either C or Fortran order, and in
+	/// either byte order, can be read. An exception is thrown if the file contains elements of
+	/// a different type to \p Scalar.
+	/// \tparam Scalar The scalar type of the array
+	/// \param path The path of the file
+	/// \return The array stored in the file
+	template<typename Scalar>
+	auto loadNpy(const std::string &path) -> Array<Scalar> {
+		Array<Scalar> res;
+		loadNpy(path, res);
+		return res;
+	}
+
+	/// Map a NumPy .npy file into memory without reading it. The file must be in C order and
+	/// use the host's byte order.
+	/// \tparam Scalar The scalar type of the array
+	/// \param path The path of the file
+	/// \param mode How the file is mapped
+	/// \return An array referring to the mapped data
+	template<typename Scalar>
+	auto mapNpy(const std::string &path, MapMode mode = MapMode::ReadOnly)
+	  -> Array<Scalar, MappedStorage<Scalar>> {
+		return detail::npy::map<Scalar>(path, 0, mode);
+	}
+
+	/// Writes a NumPy .npz archive, containing one .npy file per array. The archive can be
+	/// read with `np.load` in Python, or with NpzReader.
+	class NpzWriter {
+	public:
+		/// Create (or overwrite) an archive
+		/// \param path The path of the archive
+		explicit NpzWriter(const std::string &path) : m_file(path, "wb") {}
+
+		NpzWriter(const NpzWriter &)			= delete;
+		NpzWriter &operator=(const NpzWriter &) = delete;
+
+		/// The archive is closed automatically if `close` has not been called. Errors are
+		/// ignored, so call `close` explicitly to detect them.
+		~NpzWriter() {
+			try {
+				close();
+			} catch (...) {}
+		}
+
+		/// Add an array to the archive
+		/// \tparam ShapeType The shape type of the array
+		/// \tparam StorageType The storage type of the array
+		/// \param name The name of the array (the entry is named `name + ".npy"`)
+		/// \param array The array to add
+		template<typename ShapeType, typename StorageType>
+		void add(const std::string &name,
+				 const array::ArrayContainer<ShapeType, StorageType> &array);
+
+		/// Write the central directory and close the archive. No more arrays can be added.
+		void close();
+
+	private:
+		struct Entry {
+			std::string name;
+			uint32_t crc;
+			uint64_t size;
+			uint64_t offset;
+		};
+
+		detail::serialize::File m_file;
+		std::vector<Entry> m_entries;
+		uint64_t m_offset = 0;
+		bool m_closed	  = false;
+	};
+
+	/// Reads the arrays in a NumPy .npz archive
+	class NpzReader {
+	public:
+		/// Open an archive and read its directory
+		/// \param path The path of the archive
+		explicit NpzReader(const std::string &path);
+
+		NpzReader(const NpzReader &)			= delete;
+		NpzReader &operator=(const NpzReader &) = delete;
+
+		/// \return The names of the arrays in the archive
+		LIBRAPID_NODISCARD std::vector<std::string> names() const;
+
+		/// \param name The name of an array
+		/// \return True if the archive contains an array called \p name
+		LIBRAPID_NODISCARD bool contains(const std::string &name) const;
+
+		/// Read an array from the archive into an existing array
+		/// \tparam ShapeType The shape type of the array
+		/// \tparam StorageType The storage type of the array
+		/// \param name The name of the array in the archive
+		/// \param dst The array to read into
+		/// \see loadNpy
+		template<typename ShapeType, typename StorageType>
+		void load(const std::string &name, array::ArrayContainer<ShapeType, StorageType> &dst);
+
+		/// Read an array from the archive
+		/// \tparam Scalar The scalar type of the array
+		/// \param name The name of the array in the archive
+		/// \return The array
+		template<typename Scalar>
+		LIBRAPID_NODISCARD auto load(const std::string &name) -> Array<Scalar>;
+
+		/// Map an array in the archive into memory without reading it
+		/// \tparam Scalar The scalar type of the array
+		/// \param name The name of the array in the archive
+		/// \param mode How the file is mapped
+		/// \return An array referring to the mapped data
+		/// \see mapNpy
+		template<typename Scalar>
+		LIBRAPID_NODISCARD auto map(const std::string &name, MapMode mode = MapMode::ReadOnly)
+		  -> Array<Scalar, MappedStorage<Scalar>>;
+
+	private:
+		struct Entry {
+			std::string name;
+			uint16_t method;
+			uint64_t offset;
+		};
+
+		/// Return the offset of the .npy data of an entry
+		/// \param name The name of the array
+		/// \return The offset of the first byte of the .npy data in the archive
+		uint64_t dataOffset(const std::string &name);
+
+		detail::serialize::File m_file;
+		std::vector<Entry> m_entries;
+	};
+
+	template<typename ShapeType, typename StorageType>
+	void NpzWriter::add(const std::string &name,
+						const array::ArrayContainer<ShapeType, StorageType> &array) {
+		namespace npy = detail::npy;
+		LIBRAPID_ASSERT(!m_closed, "Cannot add an array to a closed archive");
+
+		const std::string fileName = name + ".npy";
+		const uint64_t size =
+		  npy::headerString(npy::dtypeOf<StorageType>(), npy::shapeOf(array)).size() +
+		  array.storage().size() * npy::elementSize(npy::dtypeOf<StorageType>());
+		const bool zip64 = size >= npy::zip32Limit;
+
+		// The local header's extra field is padded so the .npy data starts at a multiple of 64
+		// bytes. The .npy header is itself padded to a multiple of 64 bytes, so the elements are
+		// aligned too, and the entry can be memory-mapped (see NpzReader::map)
+		const uint64_t headerEnd = m_offset + 30 + fileName.size() + (zip64 ? 20 : 0);
+		const uint64_t overhang	 = headerEnd % npy::headerAlignment;
+		uint64_t padding		 = overhang == 0 ? 0 : npy::headerAlignment - overhang;
+		if (padding != 0 && padding < 4) padding += npy::headerAlignment;
+		const uint16_t extraSize = static_cast<uint16_t>((zip64 ? 20 : 0) + padding);
+
+		Entry entry {name, 0, size, m_offset};
+		m_file.writeLittleEndian<uint32_t>(npy::localHeaderSignature);
+		m_file.writeLittleEndian<uint16_t>(zip64 ? 45 : 20);
+		m_file.writeLittleEndian<uint16_t>(npy::utf8Flag);
+		m_file.writeLittleEndian<uint16_t>(0); // Stored without compression
+		m_file.writeLittleEndian<uint16_t>(0);
+		m_file.writeLittleEndian<uint16_t>(npy::dosDate);
+		m_file.writeLittleEndian<uint32_t>(0); // CRC-32, written once the data is known
+		m_file.writeLittleEndian<uint32_t>(zip64 ? npy::zip32Limit : static_cast<uint32_t>(size));
+		m_file.writeLittleEndian<uint32_t>(zip64 ? npy::zip32Limit : static_cast<uint32_t>(size));
+		m_file.writeLittleEndian<uint16_t>(static_cast<uint16_t>(fileName.size()));
+		m_file.writeLittleEndian<uint16_t>(extraSize);
+		m_file.write(fileName.data(), fileName.size());
+		if (zip64) {
+			m_file.writeLittleEndian<uint16_t>(npy::zip64ExtraId);
+			m_file.writeLittleEndian<uint16_t>(16);
+			m_file.writeLittleEndian<uint64_t>(size);
+			m_file.writeLittleEndian<uint64_t>(size);
+		}
+		if (padding != 0) {
+			const char zeros[2 * npy::headerAlignment] = {};
+			m_file.writeLittleEndian<uint16_t>(npy::paddingExtraId);
+			m_file.writeLittleEndian<uint16_t>(static_cast<uint16_t>(padding - 4));
+			m_file.write(zeros, padding - 4);
+		}
+
+		// Compute the checksum of each block as it is written, while it is still in cache
+		uint32_t crc = 0;
+		npy::save(array, [this, &crc](const void *data, size_t bytes) {
+			crc = npy::crc32(crc, data, bytes);
+			m_file.write(data, bytes);
+		});
+
+		m_file.seek(m_offset + 14);
+		m_file.writeLittleEndian<uint32_t>(crc);
+		m_offset  = m_file.seekEnd();
+		entry.crc = crc;
+		m_entries.push_back(std::move(entry));
+	}
+
+	LIBRAPID_INLINE void NpzWriter::close() {
+		namespace npy = detail::npy;
+		if (m_closed) return;
+		m_closed = true;
+
+		const uint64_t directoryOffset = m_offset;
+		for (const auto &entry : m_entries) {
+			const std::string fileName = entry.name + ".npy";
+			const bool largeSize	   = entry.size >= npy::zip32Limit;
+			const bool largeOffset	   = entry.offset >= npy::zip32Limit;
+			const uint16_t extraSize   = (largeSize ? 16 : 0) + (largeOffset ? 8 : 0);
+			const bool zip64		   = extraSize != 0;
+
+			m_file.writeLittleEndian<uint32_t>(npy::centralHeaderSignature);
+			m_file.writeLittleEndian<uint16_t>(45);
+			m_file.writeLittleEndian<uint16_t>(zip64 ? 45 : 20);
+			m_file.writeLittleEndian<uint16_t>(npy::utf8Flag);
+			m_file.writeLittleEndian<uint16_t>(0);
+			m_file.writeLittleEndian<uint16_t>(0);
+			m_file.writeLittleEndian<uint16_t>(npy::dosDate);
+			m_file.writeLittleEndian<uint32_t>(entry.crc);
+			const auto size = largeSize ? npy::zip32Limit : static_cast<uint32_t>(entry.size);
+			m_file.writeLittleEndian<uint32_t>(size);
+			m_file.writeLittleEndian<uint32_t>(size);
+			m_file.writeLittleEndian<uint16_t>(static_cast<uint16_t>(fileName.size()));
+			m_file.writeLittleEndian<uint16_t>(zip64 ? extraSize + 4 : 0);
+			m_file.writeLittleEndian<uint16_t>(0); // Comment length
+			m_file.writeLittleEndian<uint16_t>(0); // Disk number
+			m_file.writeLittleEndian<uint16_t>(0); // Internal attributes
+			m_file.writeLittleEndian<uint32_t>(0); // External attributes
+			m_file.writeLittleEndian<uint32_t>(largeOffset ? npy::zip32Limit
+														   : static_cast<uint32_t>(entry.offset));
+			m_file.write(fileName.data(), fileName.size());
+			if (zip64) {
+				m_file.writeLittleEndian<uint16_t>(npy::zip64ExtraId);
+				m_file.writeLittleEndian<uint16_t>(extraSize);
+				if (largeSize) {
+					m_file.writeLittleEndian<uint64_t>(entry.size);
+					m_file.writeLittleEndian<uint64_t>(entry.size);
+				}
+				if (largeOffset) m_file.writeLittleEndian<uint64_t>(entry.offset);
+			}
+			m_offset += 46 + fileName.size() + (zip64 ? extraSize + 4 : 0);
+		}
+
+		const uint64_t directorySize = m_offset - directoryOffset;
+		const uint64_t count		 = m_entries.size();
+		if (count >= 0xFFFF || directoryOffset >= npy::zip32Limit ||
+			directorySize >= npy::zip32Limit) {
+			m_file.writeLittleEndian<uint32_t>(npy::zip64EndOfCentralSignature);
+			m_file.writeLittleEndian<uint64_t>(44);
+			m_file.writeLittleEndian<uint16_t>(45);
+			m_file.writeLittleEndian<uint16_t>(45);
+			m_file.writeLittleEndian<uint32_t>(0);
+			m_file.writeLittleEndian<uint32_t>(0);
+			m_file.writeLittleEndian<uint64_t>(count);
+			m_file.writeLittleEndian<uint64_t>(count);
+			m_file.writeLittleEndian<uint64_t>(directorySize);
+			m_file.writeLittleEndian<uint64_t>(directoryOffset);
+
+			m_file.writeLittleEndian<uint32_t>(npy::zip64LocatorSignature);
+			m_file.writeLittleEndian<uint32_t>(0);
+			m_file.writeLittleEndian<uint64_t>(m_offset);
+			m_file.writeLittleEndian<uint32_t>(1);
+		}
+
+		m_file.writeLittleEndian<uint32_t>(npy::endOfCentralSignature);
+		m_file.writeLittleEndian<uint16_t>(0);
+		m_file.writeLittleEndian<uint16_t>(0);
+		const auto shortCount = static_cast<uint16_t>(std::min<uint64_t>(count, 0xFFFF));
+		m_file.writeLittleEndian<uint16_t>(shortCount);
+		m_file.writeLittleEndian<uint16_t>(shortCount);
+		m_file.writeLittleEndian<uint32_t>(
+		  static_cast<uint32_t>(std::min<uint64_t>(directorySize, npy::zip32Limit)));
+		m_file.writeLittleEndian<uint32_t>(
+		  static_cast<uint32_t>(std::min<uint64_t>(directoryOffset, npy::zip32Limit)));
+		m_file.writeLittleEndian<uint16_t>(0);
+	}
+
+	LIBRAPID_INLINE NpzReader::NpzReader(const std::string &path) : m_file(path, "rb") {
+		namespace npy = detail::npy;
+		const auto fail = [&path]() {
+			throw std::runtime_error(fmt::format("'{}' is not a valid .npz archive", path));
+		};
+
+		// The end of central directory record is within the last 64 KiB (plus its own size)
+		const uint64_t fileSize = m_file.seekEnd();
+		const uint64_t tailSize = std::min<uint64_t>(fileSize, 0xFFFF + 22);
+		std::vector<uint8_t> tail(tailSize);
+		m_file.seek(fileSize - tailSize);
+		m_file.read(tail.data(), tailSize);
+
+		int64_t end = static_cast<int64_t>(tailSize) - 22;
+		while (end >= 0 &&
+			   npy::readLittleEndian<uint32_t>(&tail[end]) != npy::endOfCentralSignature) {
+			--end;
+		}
+		if (end < 0) fail();
+
+		uint64_t count			 = npy::readLittleEndian<uint16_t>(&tail[end + 10]);
+		uint64_t directorySize	 = npy::readLittleEndian<uint32_t>(&tail[end + 12]);
+		uint64_t directoryOffset = npy::readLittleEndian<uint32_t>(&tail[end + 16]);
+
+		// Large archives store these values in a ZIP64 record, found through a locator
+		if (end >= 20 &&
+			npy::readLittleEndian<uint32_t>(&tail[end - 20]) == npy::zip64LocatorSignature) {
+			uint8_t record[56];
+			m_file.seek(npy::readLittleEndian<uint64_t>(&tail[end - 12]));
+			m_file.read(record, sizeof(record));
+			if (npy::readLittleEndian<uint32_t>(record) != npy::zip64EndOfCentralSignature) fail();
+			count			= npy::readLittleEndian<uint64_t>(record + 32);
+			directorySize	= npy::readLittleEndian<uint64_t>(record + 40);
+			directoryOffset = npy::readLittleEndian<uint64_t>(record + 48);
+		}
+
+		if (directoryOffset + directorySize > fileSize) fail();
+		std::vector<uint8_t> directory(directorySize);
+		m_file.seek(directoryOffset);
+		m_file.read(directory.data(), directorySize);
+
+		size_t pos = 0;
+		for (uint64_t i = 0; i < count; ++i) {
+			if (pos + 46 > directory.size() ||
+				npy::readLittleEndian<uint32_t>(&directory[pos]) != npy::centralHeaderSignature)
+				fail();
+
+			const uint8_t *record	= &directory[pos];
+			const auto nameSize		= npy::readLittleEndian<uint16_t>(record + 28);
+			const auto extraSize	= npy::readLittleEndian<uint16_t>(record + 30);
+			const auto commentSize	= npy::readLittleEndian<uint16_t>(record + 32);
+			if (pos + 46 + nameSize + extraSize + commentSize > directory.size()) fail();
+
+			Entry entry;
+			entry.method = npy::readLittleEndian<uint16_t>(record + 10);
+			entry.offset = npy::readLittleEndian<uint32_t>(record + 42);
+			entry.name.assign(reinterpret_cast<const char *>(record + 46), nameSize);
+
+			// Replace any saturated fields with their ZIP64 values, which are stored in order
+			const uint8_t *extra	= record + 46 + nameSize;
+			const uint8_t *extraEnd = extra + extraSize;
+			while (extra + 4 <= extraEnd) {
+				const auto id	= npy::readLittleEndian<uint16_t>(extra);
+				const auto size = npy::readLittleEndian<uint16_t>(extra + 2);
+				if (id == npy::zip64ExtraId) {
+					const uint8_t *field = extra + 4;
+					if (npy::readLittleEndian<uint32_t>(record + 24) == npy::zip32Limit) field += 8;
+					if (npy::readLittleEndian<uint32_t>(record + 20) == npy::zip32Limit) field += 8;
+					if (entry.offset == npy::zip32Limit && field + 8 <= extra + 4 + size)
+						entry.offset = npy::readLittleEndian<uint64_t>(field);
+				}
+				extra += 4 + size;
+			}
+
+			constexpr char suffix[] = ".npy";
+			if (entry.name.size() >= 4 &&
+				entry.name.compare(entry.name.size() - 4, 4, suffix) == 0) {
+				entry.name.resize(entry.name.size() - 4);
+			}
+			m_entries.push_back(std::move(entry));
+			pos += 46 + nameSize + extraSize + commentSize;
+		}
+	}
+
+	LIBRAPID_INLINE std::vector<std::string> NpzReader::names() const {
+		std::vector<std::string> res;
+		for (const auto &entry : m_entries) res.push_back(entry.name);
+		return res;
+	}
+
+	LIBRAPID_INLINE bool NpzReader::contains(const std::string &name) const {
+		return std::any_of(m_entries.begin(), m_entries.end(), [&name](const Entry &entry) {
+			return entry.name == name;
+		});
+	}
+
+	LIBRAPID_INLINE uint64_t NpzReader::dataOffset(const std::string &name) {
+		const auto it = std::find_if(m_entries.begin(),
+									 m_entries.end(),
+									 [&name](const Entry &entry) { return entry.name == name; });
+		if (it == m_entries.end()) {
+			throw std::runtime_error(
+			  fmt::format("'{}' does not contain an array named '{}'", m_file.path(), name));
+		}
+		if (it->method != 0) {
+			throw std::runtime_error(
+			  fmt::format("'{}' in '{}' is compressed, which is not supported. Save the archive "
+						  "with np.savez rather than np.savez_compressed",
+						  name,
+						  m_file.path()));
+		}
+
+		uint8_t header[30];
+		m_file.seek(it->offset);
+		m_file.read(header, sizeof(header));
+		if (detail::npy::readLittleEndian<uint32_t>(header) != detail::npy::localHeaderSignature) {
+			throw std::runtime_error(
+			  fmt::format("'{}' is not a valid .npz archive", m_file.path()));
+		}
+		return it->offset + sizeof(header) + detail::npy::readLittleEndian<uint16_t>(header + 26) +
+			   detail::npy::readLittleEndian<uint16_t>(header + 28);
+	}
+
+	template<typename ShapeType, typename StorageType>
+	void NpzReader::load(const std::string &name,
+						 array::ArrayContainer<ShapeType, StorageType> &dst) {
+		detail::npy::load(m_file, dataOffset(name), dst);
+	}
+
+	template<typename Scalar>
+	auto NpzReader::load(const std::string &name) -> Array<Scalar> {
+		Array<Scalar> res;
+		load(name, res);
+		return res;
+	}
+
+	template<typename Scalar>
+	auto NpzReader::map(const std::string &name, MapMode mode)
+	  -> Array<Scalar, MappedStorage<Scalar>> {
+		return detail::npy::map<Scalar>(m_file.path(), dataOffset(name), mode);
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_NPY_HPP
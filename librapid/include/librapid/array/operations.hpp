@@ -31,6 +31,40 @@
 			Packet res(1);                                                                         \
 			res.setZero(!mask);                                                                    \
 			return res;                                                                            \
+		}                                                                                          \
+                                                                                                   \
+		template<typename Packet>                                                                  \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto mask(const Packet &lhs,                     \
+															const Packet &rhs) const {             \
+			return lhs OP_ rhs;                                                                    \
+		}                                                                                          \
+	}
+
+#define LIBRAPID_BINARY_BITWISE_FUNCTOR(NAME_, OP_)                                                \
+	struct NAME_ {                                                                                 \
+		template<typename T, typename V>                                                           \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const T &lhs,                    \
+																  const V &rhs) const {            \
+			return (typename std::common_type_t<T, V>)(lhs OP_ rhs);                               \
+		}                                                                                          \
+                                                                                                   \
+		template<typename Packet>                                                                  \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto packet(const Packet &lhs,                   \
+															  const Packet &rhs) const {           \
+			return lhs OP_ rhs;                                                                    \
+		}                                                                                          \
+	}
+
+#define LIBRAPID_UNARY_FUNCTOR(NAME_, FUNC_)                                                       \
+	struct NAME_ {                                                                                 \
+		template<typename T>                                                                       \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const T &val) const {            \
+			return ::librapid::FUNC_(val);                                                         \
+		}                                                                                          \
+                                                                                                   \
+		template<typename Packet>                                                                  \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto packet(const Packet &val) const {           \
+			return FUNC_(val);                                                                     \
 		}                                                                                          \
 	}
 
@@ -55,6 +89,21 @@
 		return getKernelNameImpl(args);                                                            \
 	}
 
+#define LIBRAPID_UNARY_KERNEL_GETTER                                                               \
+	template<typename... Args>                                                                     \
+	static constexpr const char *getKernelName(std::tuple<Args...> args) {                         \
+		static_assert(sizeof...(Args) == 1, "Invalid number of arguments for unary operation");    \
+		return kernelName;                                                                         \
+	}
+
+#define LIBRAPID_UNARY_SHAPE_EXTRACTOR                                                             \
+	template<typename... Args>                                                                     \
+	LIBRAPID_NODISCARD static LIBRAPID_ALWAYS_INLINE auto getShape(                                \
+	  const std::tuple<Args...> &args) {                                                           \
+		static_assert(sizeof...(Args) == 1, "Invalid number of arguments for unary operation");    \
+		return std::get<0>(args).shape();                                                          \
+	}
+
 #define LIBRAPID_BINARY_SHAPE_EXTRACTOR                                                            \
 	template<typename First, typename Second>                                                      \
 	LIBRAPID_NODISCARD static LIBRAPID_ALWAYS_INLINE auto getShapeImpl(                            \
@@ -104,7 +153,44 @@ namespace librapid {
 		LIBRAPID_BINARY_COMPARISON_FUNCTOR(GreaterThanEqual, >=);	 // a >= b
 		LIBRAPID_BINARY_COMPARISON_FUNCTOR(ElementWiseEqual, ==);	 // a == b
 		LIBRAPID_BINARY_COMPARISON_FUNCTOR(ElementWiseNotEqual, !=); // a != b
-	}																 // namespace detail
+
+		LIBRAPID_BINARY_BITWISE_FUNCTOR(BitwiseAnd, &); // a & b
+		LIBRAPID_BINARY_BITWISE_FUNCTOR(BitwiseOr, |);	// a | b
+		LIBRAPID_BINARY_BITWISE_FUNCTOR(BitwiseXor, ^); // a ^ b
+
+		/// Logical negation of a boolean array (!a)
+		struct LogicalNot {
+			template<typename T>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool operator()(const T &val) const {
+				return !val;
+			}
+
+			template<typename Packet>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto packet(const Packet &val) const {
+				return !val;
+			}
+		};
+
+		LIBRAPID_UNARY_FUNCTOR(Abs, abs);	// |a|
+		LIBRAPID_UNARY_FUNCTOR(Arg, arg);	// arg(a)
+		LIBRAPID_UNARY_FUNCTOR(Exp, exp);	// exp(a)
+		LIBRAPID_UNARY_FUNCTOR(Conj, conj); // conj(a)
+
+		/// Multiplication by a complex conjugate (a * conj(b)), without negating b first
+		struct ConjMultiply {
+			template<typename T, typename V>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const T &lhs,
+																	  const V &rhs) const {
+				return ::librapid::conjMultiply(lhs, rhs);
+			}
+
+			template<typename Packet>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto packet(const Packet &lhs,
+																  const Packet &rhs) const {
+				return conjMultiply(lhs, rhs);
+			}
+		};
+	} // namespace detail
 
 	namespace typetraits {
 		/// Merge together two Descriptor types. Two trivial operations will result in
@@ -301,6 +387,105 @@ namespace librapid {
 			LIBRAPID_BINARY_KERNEL_GETTER
 			LIBRAPID_BINARY_SHAPE_EXTRACTOR
 		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::BitwiseAnd> {
+			static constexpr const char *name				 = "bitwise and";
+			static constexpr const char *filename			 = "logical";
+			static constexpr const char *kernelName			 = "bitwiseAndArrays";
+			static constexpr const char *kernelNameScalarRhs = "bitwiseAndArraysScalarRhs";
+			static constexpr const char *kernelNameScalarLhs = "bitwiseAndArraysScalarLhs";
+			LIBRAPID_BINARY_KERNEL_GETTER
+			LIBRAPID_BINARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::BitwiseOr> {
+			static constexpr const char *name				 = "bitwise or";
+			static constexpr const char *filename			 = "logical";
+			static constexpr const char *kernelName			 = "bitwiseOrArrays";
+			static constexpr const char *kernelNameScalarRhs = "bitwiseOrArraysScalarRhs";
+			static constexpr const char *kernelNameScalarLhs = "bitwiseOrArraysScalarLhs";
+			LIBRAPID_BINARY_KERNEL_GETTER
+			LIBRAPID_BINARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::BitwiseXor> {
+			static constexpr const char *name				 = "bitwise xor";
+			static constexpr const char *filename			 = "logical";
+			static constexpr const char *kernelName			 = "bitwiseXorArrays";
+			static constexpr const char *kernelNameScalarRhs = "bitwiseXorArraysScalarRhs";
+			static constexpr const char *kernelNameScalarLhs = "bitwiseXorArraysScalarLhs";
+			LIBRAPID_BINARY_KERNEL_GETTER
+			LIBRAPID_BINARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::LogicalNot> {
+			static constexpr const char *name		= "logical not";
+			static constexpr const char *filename	= "logical";
+			static constexpr const char *kernelName = "logicalNotArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Abs> {
+			static constexpr const char *name		= "absolute value";
+			static constexpr const char *filename	= "complex";
+			static constexpr const char *kernelName = "absArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Arg> {
+			static constexpr const char *name		= "argument";
+			static constexpr const char *filename	= "complex";
+			static constexpr const char *kernelName = "argArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Exp> {
+			static constexpr const char *name		= "exponential";
+			static constexpr const char *filename	= "complex";
+			static constexpr const char *kernelName = "expArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Conj> {
+			static constexpr const char *name		= "conjugate";
+			static constexpr const char *filename	= "complex";
+			static constexpr const char *kernelName = "conjArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::ConjMultiply> {
+			static constexpr const char *name				 = "conjugate multiply";
+			static constexpr const char *filename			 = "complex";
+			static constexpr const char *kernelName			 = "conjMultiplyArrays";
+			static constexpr const char *kernelNameScalarRhs = "conjMultiplyArraysScalarRhs";
+			static constexpr const char *kernelNameScalarLhs = "conjMultiplyArraysScalarLhs";
+			LIBRAPID_BINARY_KERNEL_GETTER
+			LIBRAPID_BINARY_SHAPE_EXTRACTOR
+		};
+
+		/// Evaluates as true if \p T is an array, view or function with complex elements
+		/// \tparam T Input type
+		template<typename T, typename = void>
+		struct IsComplexArray : std::false_type {};
+
+		template<typename T>
+		struct IsComplexArray<
+		  T, std::enable_if_t<TypeInfo<T>::type != ::librapid::detail::LibRapidType::Scalar>>
+				: IsComplex<typename TypeInfo<T>::Scalar> {};
 	} // namespace typetraits
 
 	namespace array {
@@ -694,7 +879,289 @@ namespace librapid {
 										detail::ElementWiseNotEqual>(std::forward<LHS>(lhs),
 																	 std::forward<RHS>(rhs));
 		}
+
+		/// \brief Element-wise bitwise AND, computing a & b for all a, b in input arrays
+		///
+		/// For boolean arrays this is a logical operation, evaluated 64 elements at a time on
+		/// the packed bits. They must both be the same size and of the same data type.
+		///
+		/// \tparam LHS Type of the LHS element
+		/// \tparam RHS Type of the RHS element
+		/// \param lhs The first array
+		/// \param rhs The second array
+		/// \return The element-wise AND of the two arrays
+		template<class LHS, class RHS,
+				 typename std::enable_if_t<(typetraits::TypeInfo<std::decay_t<LHS>>::type !=
+											::librapid::detail::LibRapidType::Scalar) &&
+											 (typetraits::TypeInfo<std::decay_t<RHS>>::type !=
+											  ::librapid::detail::LibRapidType::Scalar),
+										   int> = 0>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator&(LHS &&lhs, RHS &&rhs)
+		  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<LHS, RHS>,
+													  detail::BitwiseAnd, LHS, RHS> {
+			LIBRAPID_ASSERT(lhs.shape().operator==(rhs.shape()), "Shapes must be equal");
+			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::BitwiseAnd>(
+			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+		}
+
+		template<class LHS, class RHS,
+				 typename std::enable_if_t<(typetraits::TypeInfo<std::decay_t<LHS>>::type ==
+											::librapid::detail::LibRapidType::Scalar) ^
+											 (typetraits::TypeInfo<std::decay_t<RHS>>::type ==
+											  ::librapid::detail::LibRapidType::Scalar),
+										   int> = 0>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator&(LHS &&lhs, RHS &&rhs)
+		  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<LHS, RHS>,
+													  detail::BitwiseAnd, LHS, RHS> {
+			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::BitwiseAnd>(
+			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+		}
+
+		/// \brief Element-wise bitwise OR, computing a | b for all a, b in input arrays
+		///
+		/// For boolean arrays this is a logical operation, evaluated 64 elements at a time on
+		/// the packed bits. They must both be the same size and of the same data type.
+		///
+		/// \tparam LHS Type of the LHS element
+		/// \tparam RHS Type of the RHS element
+		/// \param lhs The first array
+		/// \param rhs The second array
+		/// \return The element-wise OR of the two arrays
+		template<class LHS, class RHS,
+				 typename std::enable_if_t<(typetraits::TypeInfo<std::decay_t<LHS>>::type !=
+											::librapid::detail::LibRapidType::Scalar) &&
+											 (typetraits::TypeInfo<std::decay_t<RHS>>::type !=
+											  ::librapid::detail::LibRapidType::Scalar),
+										   int> = 0>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator|(LHS &&lhs, RHS &&rhs)
+		  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<LHS, RHS>,
+													  detail::BitwiseOr, LHS, RHS> {
+			LIBRAPID_ASSERT(lhs.shape().operator==(rhs.shape()), "Shapes must be equal");
+			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::BitwiseOr>(
+			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+		}
+
+		template<class LHS, class RHS,
+				 typename std::enable_if_t<(typetraits::TypeInfo<std::decay_t<LHS>>::type ==
+											::librapid::detail::LibRapidType::Scalar) ^
+											 (typetraits::TypeInfo<std::decay_t<RHS>>::type ==
+											  ::librapid::detail::LibRapidType::Scalar),
+										   int> = 0>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator|(LHS &&lhs, RHS &&rhs)
+		  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<LHS, RHS>,
+													  detail::BitwiseOr, LHS, RHS> {
+			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::BitwiseOr>(
+			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+		}
+
+		/// \brief Element-wise bitwise XOR, computing a ^ b for all a, b in input arrays
+		///
+		/// For boolean arrays this is a logical operation, evaluated 64 elements at a time on
+		/// the packed bits. They must both be the same size and of the same data type.
+		///
+		/// \tparam LHS Type of the LHS element
+		/// \tparam RHS Type of the RHS element
+		/// \param lhs The first array
+		/// \param rhs The second array
+		/// \return The element-wise XOR of the two arrays
+		template<class LHS, class RHS,
+				 typename std::enable_if_t<(typetraits::TypeInfo<std::decay_t<LHS>>::type !=
+											::librapid::detail::LibRapidType::Scalar) &&
+											 (typetraits::TypeInfo<std::decay_t<RHS>>::type !=
+											  ::librapid::detail::LibRapidType::Scalar),
+										   int> = 0>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator^(LHS &&lhs, RHS &&rhs)
+		  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<LHS, RHS>,
+													  detail::BitwiseXor, LHS, RHS> {
+			LIBRAPID_ASSERT(lhs.shape().operator==(rhs.shape()), "Shapes must be equal");
+			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::BitwiseXor>(
+			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+		}
+
+		template<class LHS, class RHS,
+				 typename std::enable_if_t<(typetraits::TypeInfo<std::decay_t<LHS>>::type ==
+											::librapid::detail::LibRapidType::Scalar) ^
+											 (typetraits::TypeInfo<std::decay_t<RHS>>::type ==
+											  ::librapid::detail::LibRapidType::Scalar),
+										   int> = 0>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator^(LHS &&lhs, RHS &&rhs)
+		  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<LHS, RHS>,
+													  detail::BitwiseXor, LHS, RHS> {
+			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::BitwiseXor>(
+			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+		}
+
+		/// \brief Element-wise logical negation of a boolean array
+		///
+		/// The negation is evaluated 64 elements at a time on the packed bits.
+		///
+		/// \tparam Val Type of the input
+		/// \param val The array to negate
+		/// \return The element-wise negation of the array
+		template<class Val,
+				 typename std::enable_if_t<(typetraits::TypeInfo<std::decay_t<Val>>::type !=
+											::librapid::detail::LibRapidType::Scalar) &&
+											 std::is_same_v<typename typetraits::TypeInfo<
+															  std::decay_t<Val>>::Scalar,
+															bool>,
+										   int> = 0>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator!(Val &&val)
+		  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<Val>,
+													  detail::LogicalNot, Val> {
+			return detail::makeFunction<typetraits::DescriptorType_t<Val>, detail::LogicalNot>(
+			  std::forward<Val>(val));
+		}
 	} // namespace array
+
+	/// Count the number of true elements in a boolean array. This is a population count over
+	/// the array's packed bits.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam Allocator The allocator of the array's storage
+	/// \param mask The array to count
+	/// \return The number of true elements
+	template<typename ShapeType, typename Allocator>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t
+	count(const array::ArrayContainer<ShapeType, BitStorage<Allocator>> &mask) {
+		return mask.storage().count();
+	}
+
+	/// Count the number of elements for which a function (such as a comparison) is true. The
+	/// function is evaluated into a bit-packed boolean array first.
+	/// \tparam desc The descriptor of the function
+	/// \tparam Functor The functor type of the function
+	/// \tparam Args The argument types of the function
+	/// \param function The function to evaluate
+	/// \return The number of true elements
+	template<typename desc, typename Functor, typename... Args>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t
+	count(const detail::Function<desc, Functor, Args...> &function) {
+		return count(Array<bool>(function));
+	}
+
+	/// Return true if any element of a boolean array is true
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam Allocator The allocator of the array's storage
+	/// \param mask The array to check
+	/// \return True if any element is true
+	template<typename ShapeType, typename Allocator>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool
+	any(const array::ArrayContainer<ShapeType, BitStorage<Allocator>> &mask) {
+		return mask.storage().any();
+	}
+
+	/// Return true if a function (such as a comparison) is true for any element
+	/// \see any(const array::ArrayContainer<ShapeType, BitStorage<Allocator>> &)
+	template<typename desc, typename Functor, typename... Args>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool
+	any(const detail::Function<desc, Functor, Args...> &function) {
+		return any(Array<bool>(function));
+	}
+
+	/// Return true if every element of a boolean array is true
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam Allocator The allocator of the array's storage
+	/// \param mask The array to check
+	/// \return True if every element is true
+	template<typename ShapeType, typename Allocator>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool
+	all(const array::ArrayContainer<ShapeType, BitStorage<Allocator>> &mask) {
+		return mask.storage().all();
+	}
+
+	/// Return true if a function (such as a comparison) is true for every element
+	/// \see all(const array::ArrayContainer<ShapeType, BitStorage<Allocator>> &)
+	template<typename desc, typename Functor, typename... Args>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool
+	all(const detail::Function<desc, Functor, Args...> &function) {
+		return all(Array<bool>(function));
+	}
+
+	/// \brief Element-wise magnitude of a complex array
+	///
+	/// The result is a real array. Like hypot, the larger component of each element is
+	/// factored out of the square root, so large and small magnitudes are computed accurately.
+	///
+	/// \tparam Val Type of the input
+	/// \param val The complex array
+	/// \return The magnitude of each element
+	template<class Val, typename std::enable_if_t<
+						  typetraits::IsComplexArray<std::decay_t<Val>>::value, int> = 0>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto abs(Val &&val)
+	  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<Val>,
+												  detail::Abs, Val> {
+		return detail::makeFunction<typetraits::DescriptorType_t<Val>, detail::Abs>(
+		  std::forward<Val>(val));
+	}
+
+	/// \brief Element-wise phase angle of a complex array
+	///
+	/// The result is a real array of angles in the range [-pi, pi].
+	///
+	/// \tparam Val Type of the input
+	/// \param val The complex array
+	/// \return The phase angle of each element
+	template<class Val, typename std::enable_if_t<
+						  typetraits::IsComplexArray<std::decay_t<Val>>::value, int> = 0>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto arg(Val &&val)
+	  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<Val>,
+												  detail::Arg, Val> {
+		return detail::makeFunction<typetraits::DescriptorType_t<Val>, detail::Arg>(
+		  std::forward<Val>(val));
+	}
+
+	/// \brief Element-wise exponential of a complex array
+	///
+	/// Each element is computed as exp(real) * (cos(imag) + i * sin(imag)).
+	///
+	/// \tparam Val Type of the input
+	/// \param val The complex array
+	/// \return The exponential of each element
+	template<class Val, typename std::enable_if_t<
+						  typetraits::IsComplexArray<std::decay_t<Val>>::value, int> = 0>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto exp(Val &&val)
+	  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<Val>,
+												  detail::Exp, Val> {
+		return detail::makeFunction<typetraits::DescriptorType_t<Val>, detail::Exp>(
+		  std::forward<Val>(val));
+	}
+
+	/// \brief Element-wise complex conjugate of an array
+	///
+	/// The imaginary component of each element is negated.
+	///
+	/// \tparam Val Type of the input
+	/// \param val The complex array
+	/// \return The conjugate of each element
+	template<class Val, typename std::enable_if_t<
+						  typetraits::IsComplexArray<std::decay_t<Val>>::value, int> = 0>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto conj(Val &&val)
+	  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<Val>,
+												  detail::Conj, Val> {
+		return detail::makeFunction<typetraits::DescriptorType_t<Val>, detail::Conj>(
+		  std::forward<Val>(val));
+	}
+
+	/// \brief Element-wise multiplication by the conjugate of a complex array
+	///
+	/// Computes `lhs * conj(rhs)` in a single pass, without negating the imaginary components
+	/// of \p rhs first. This is the kernel of cross-correlations and cross-power spectra.
+	///
+	/// \tparam LHS Type of the LHS element
+	/// \tparam RHS Type of the RHS element
+	/// \param lhs The complex array to multiply
+	/// \param rhs The complex array whose conjugate is used
+	/// \return The element-wise product of \p lhs and the conjugate of \p rhs
+	template<class LHS, class RHS,
+			 typename std::enable_if_t<typetraits::IsComplexArray<std::decay_t<LHS>>::value &&
+										 typetraits::IsComplexArray<std::decay_t<RHS>>::value,
+									   int> = 0>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto conjMultiply(LHS &&lhs, RHS &&rhs)
+	  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<LHS, RHS>,
+												  detail::ConjMultiply, LHS, RHS> {
+		LIBRAPID_ASSERT(lhs.shape().operator==(rhs.shape()), "Shapes must be equal");
+		return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::ConjMultiply>(
+		  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+	}
 } // namespace librapid
 
 #endif // LIBRAPID_ARRAY_OPERATIONS_HPP
\ No newline at end of file
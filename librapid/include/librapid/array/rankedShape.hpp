@@ -0,0 +1,312 @@
+#ifndef LIBRAPID_ARRAY_RANKED_SHAPE_HPP
+#define LIBRAPID_ARRAY_RANKED_SHAPE_HPP
+
+/*
+ * This file defines the RankedShape class, a Shape whose number of dimensions is a template
+ * parameter, along with the traits used to move between ranked and runtime-ranked arrays.
+ */
+
+namespace librapid {
+	/// A RankedShape stores the dimensions of an array whose number of dimensions is known at
+	/// compile time. It provides the same interface as Shape, but ndim() is a constant, so every
+	/// loop over the dimensions has a fixed trip count and can be unrolled. A RankedShape can be
+	/// converted to and from a Shape; converting from a Shape with a different number of
+	/// dimensions throws a std::runtime_error.
+	/// \tparam T The type of each dimension
+	/// \tparam Rank The number of dimensions
+	/// \see Shape
+	/// \see RankedArray
+	template<typename T = size_t, size_t Rank = 2>
+	class RankedShape {
+		static_assert(Rank > 0, "Zero-dimensional arrays use Shape");
+
+	public:
+		using SizeType						  = T;
+		static constexpr size_t MaxDimensions = Rank;
+
+		/// Create a RankedShape with every dimension set to zero
+		RankedShape() = default;
+
+		/// Create a RankedShape from a list of exactly \p Rank values
+		/// \tparam V Scalar type of the values
+		/// \param vals The dimensions for the object
+		template<typename V, typename typetraits::EnableIf<typetraits::CanCast<V, T>::value> = 0>
+		RankedShape(const std::initializer_list<V> &vals);
+
+		/// Create a RankedShape from a vector of exactly \p Rank values
+		/// \tparam V Scalar type of the values
+		/// \param vals The dimensions for the object
+		template<typename V, typename typetraits::EnableIf<typetraits::CanCast<V, T>::value> = 0>
+		explicit RankedShape(const std::vector<V> &vals);
+
+		/// Create a RankedShape from a Shape with \p Rank dimensions
+		/// \tparam V Scalar type of the Shape
+		/// \tparam N Maximum number of dimensions of the Shape
+		/// \param shape The Shape to convert
+		template<typename V, size_t N>
+		RankedShape(const Shape<V, N> &shape);
+
+		/// Convert this RankedShape to a Shape
+		/// \tparam V Scalar type of the Shape
+		/// \tparam N Maximum number of dimensions of the Shape
+		/// \return A Shape with the same dimensions
+		template<typename V, size_t N>
+		operator Shape<V, N>() const;
+
+		/// Return a RankedShape with every dimension set to zero
+		/// \param dims Number of dimensions, which must be \p Rank
+		/// \return New RankedShape object
+		static RankedShape zeros(size_t dims = Rank);
+
+		/// Return a RankedShape with every dimension set to one
+		/// \param dims Number of dimensions, which must be \p Rank
+		/// \return New RankedShape object
+		static RankedShape ones(size_t dims = Rank);
+
+		/// Access an element of the RankedShape object
+		/// \tparam Index Typename of the index
+		/// \param index Index to access
+		/// \return The value at the index
+		template<typename Index>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const T &operator[](Index index) const;
+
+		/// Access an element of the RankedShape object
+		/// \tparam Index Typename of the index
+		/// \param index Index to access
+		/// \return A reference to the value at the index
+		template<typename Index>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE T &operator[](Index index);
+
+		/// Compare two RankedShape objects, returning true if and only if they are identical
+		/// \param other RankedShape object to compare
+		/// \return True if the objects are identical
+		LIBRAPID_ALWAYS_INLINE bool operator==(const RankedShape &other) const;
+
+		/// Compare a RankedShape with a Shape, returning true if and only if they have the same
+		/// dimensions
+		/// \param other Shape object to compare
+		/// \return True if the objects are identical
+		template<typename V, size_t N>
+		LIBRAPID_ALWAYS_INLINE bool operator==(const Shape<V, N> &other) const;
+
+		/// Compare two RankedShape objects, returning true if and only if they are not identical
+		/// \param other RankedShape object to compare
+		/// \return True if the objects are not identical
+		LIBRAPID_ALWAYS_INLINE bool operator!=(const RankedShape &other) const;
+
+		/// Compare a RankedShape with a Shape, returning true if and only if they do not have the
+		/// same dimensions
+		/// \param other Shape object to compare
+		/// \return True if the objects are not identical
+		template<typename V, size_t N>
+		LIBRAPID_ALWAYS_INLINE bool operator!=(const Shape<V, N> &other) const;
+
+		/// Return the number of dimensions of the RankedShape object, which is always \p Rank
+		/// \return Number of dimensions
+		LIBRAPID_NODISCARD static constexpr T ndim() { return static_cast<T>(Rank); }
+
+		/// Return a subshape of the RankedShape object. The number of dimensions of the result
+		/// depends on the arguments, so it is a Shape.
+		/// \param start Starting index
+		/// \param end Ending index
+		/// \return Subshape
+		LIBRAPID_NODISCARD Shape<T, Rank> subshape(size_t start, size_t end) const;
+
+		/// Return the number of elements the RankedShape object represents
+		/// \return Number of elements
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE T size() const;
+
+		/// Convert a RankedShape object into a string representation
+		/// \return A string representation of the RankedShape object
+		LIBRAPID_NODISCARD std::string str(const std::string &format = "{}") const;
+
+	private:
+		/// Throw an error if a shape with \p dims dimensions cannot be stored
+		/// \param dims The number of dimensions
+		static void checkRank(size_t dims);
+
+		std::array<T, Rank> m_data {};
+	};
+
+	template<typename T, size_t Rank>
+	void RankedShape<T, Rank>::checkRank(size_t dims) {
+		if (dims != Rank) {
+			throw std::runtime_error(fmt::format(
+			  "Cannot create a shape with {} dimensions for an array of rank {}", dims, Rank));
+		}
+	}
+
+	template<typename T, size_t Rank>
+	template<typename V, typename typetraits::EnableIf<typetraits::CanCast<V, T>::value>>
+	RankedShape<T, Rank>::RankedShape(const std::initializer_list<V> &vals) {
+		checkRank(vals.size());
+		for (size_t i = 0; i < Rank; ++i) m_data[i] = static_cast<T>(*(vals.begin() + i));
+	}
+
+	template<typename T, size_t Rank>
+	template<typename V, typename typetraits::EnableIf<typetraits::CanCast<V, T>::value>>
+	RankedShape<T, Rank>::RankedShape(const std::vector<V> &vals) {
+		checkRank(vals.size());
+		for (size_t i = 0; i < Rank; ++i) m_data[i] = static_cast<T>(vals[i]);
+	}
+
+	template<typename T, size_t Rank>
+	template<typename V, size_t N>
+	RankedShape<T, Rank>::RankedShape(const Shape<V, N> &shape) {
+		checkRank(shape.ndim());
+		for (size_t i = 0; i < Rank; ++i) m_data[i] = static_cast<T>(shape[i]);
+	}
+
+	template<typename T, size_t Rank>
+	template<typename V, size_t N>
+	RankedShape<T, Rank>::operator Shape<V, N>() const {
+		static_assert(Rank <= N, "The Shape cannot store this many dimensions");
+		auto res = Shape<V, N>::zeros(Rank);
+		for (size_t i = 0; i < Rank; ++i) res[i] = static_cast<V>(m_data[i]);
+		return Shape<V, N>(res);
+	}
+
+	template<typename T, size_t Rank>
+	auto RankedShape<T, Rank>::zeros(size_t dims) -> RankedShape {
+		checkRank(dims);
+		return RankedShape();
+	}
+
+	template<typename T, size_t Rank>
+	auto RankedShape<T, Rank>::ones(size_t dims) -> RankedShape {
+		checkRank(dims);
+		RankedShape res;
+		res.m_data.fill(1);
+		return res;
+	}
+
+	template<typename T, size_t Rank>
+	template<typename Index>
+	auto RankedShape<T, Rank>::operator[](Index index) const -> const T & {
+		LIBRAPID_ASSERT(index >= 0 && static_cast<size_t>(index) < Rank, "Index out of bounds");
+		return m_data[index];
+	}
+
+	template<typename T, size_t Rank>
+	template<typename Index>
+	auto RankedShape<T, Rank>::operator[](Index index) -> T & {
+		LIBRAPID_ASSERT(index >= 0 && static_cast<size_t>(index) < Rank, "Index out of bounds");
+		return m_data[index];
+	}
+
+	template<typename T, size_t Rank>
+	bool RankedShape<T, Rank>::operator==(const RankedShape &other) const {
+		return m_data == other.m_data;
+	}
+
+	template<typename T, size_t Rank>
+	template<typename V, size_t N>
+	bool RankedShape<T, Rank>::operator==(const Shape<V, N> &other) const {
+		if (static_cast<size_t>(other.ndim()) != Rank) return false;
+		for (size_t i = 0; i < Rank; ++i) {
+			if (m_data[i] != static_cast<T>(other[i])) return false;
+		}
+		return true;
+	}
+
+	template<typename T, size_t Rank>
+	bool RankedShape<T, Rank>::operator!=(const RankedShape &other) const {
+		return !(*this == other);
+	}
+
+	template<typename T, size_t Rank>
+	template<typename V, size_t N>
+	bool RankedShape<T, Rank>::operator!=(const Shape<V, N> &other) const {
+		return !(*this == other);
+	}
+
+	template<typename T, size_t Rank>
+	auto RankedShape<T, Rank>::subshape(size_t start, size_t end) const -> Shape<T, Rank> {
+		return static_cast<Shape<T, Rank>>(*this).subshape(start, end);
+	}
+
+	template<typename T, size_t Rank>
+	auto RankedShape<T, Rank>::size() const -> T {
+		T res = 1;
+		for (size_t i = 0; i < Rank; ++i) res *= m_data[i];
+		return res;
+	}
+
+	template<typename T, size_t Rank>
+	std::string RankedShape<T, Rank>::str(const std::string &format) const {
+		return static_cast<Shape<T, Rank>>(*this).str(format);
+	}
+
+	namespace typetraits {
+		template<typename T, size_t Rank>
+		struct IsSizeType<RankedShape<T, Rank>> {
+			using value = std::true_type;
+		};
+
+		/// Evaluates as true if the input type is a RankedShape
+		/// \tparam T Input type
+		template<typename T>
+		struct IsRankedShape : std::false_type {};
+
+		template<typename T, size_t Rank>
+		struct IsRankedShape<RankedShape<T, Rank>> : std::true_type {};
+	} // namespace typetraits
+
+	namespace detail {
+		/// The shape type of a sub-array of an array with shape type \p ShapeType, which has
+		/// one dimension fewer. The elements of a one-dimensional ranked array are
+		/// zero-dimensional, so they use a Shape like the elements of any other array.
+		/// \tparam ShapeType The shape type of the array
+		template<typename ShapeType>
+		struct SubShape {
+			using Type = ShapeType;
+		};
+
+		template<typename T, size_t Rank>
+		struct SubShape<RankedShape<T, Rank>> {
+			using Type = RankedShape<T, Rank - 1>;
+		};
+
+		template<typename T>
+		struct SubShape<RankedShape<T, 1>> {
+			using Type = Shape<T, LIBRAPID_MAX_ARRAY_DIMS>;
+		};
+
+		/// The shape type of a one-dimensional array holding the elements of an array with
+		/// shape type \p ShapeType (e.g. the result of boolean indexing). Ranked arrays give a
+		/// ranked vector; a Shape can hold any number of dimensions, so it is unchanged.
+		/// \tparam ShapeType The shape type of the array
+		template<typename ShapeType>
+		struct FlatShape {
+			using Type = ShapeType;
+		};
+
+		template<typename T, size_t Rank>
+		struct FlatShape<RankedShape<T, Rank>> {
+			using Type = RankedShape<T, 1>;
+		};
+
+		/// Return the shape of a default-constructed array: the dimensions of a FixedStorage, a
+		/// single empty dimension, or every dimension empty for a RankedShape
+		/// \tparam ShapeType The shape type of the array
+		/// \tparam StorageType The storage type of the array
+		/// \return The shape
+		template<typename ShapeType, typename StorageType>
+		LIBRAPID_INLINE ShapeType emptyShape() {
+			if constexpr (typetraits::IsFixedStorage<StorageType>::value) {
+				return StorageType::template defaultShape<ShapeType>();
+			} else if constexpr (typetraits::IsRankedShape<ShapeType>::value) {
+				return ShapeType();
+			} else {
+				return ShapeType({0});
+			}
+		}
+	} // namespace detail
+} // namespace librapid
+
+// Support FMT printing
+#ifdef FMT_API
+LIBRAPID_SIMPLE_IO_IMPL(typename T COMMA size_t Rank, librapid::RankedShape<T COMMA Rank>)
+#endif // FMT_API
+
+#endif // LIBRAPID_ARRAY_RANKED_SHAPE_HPP
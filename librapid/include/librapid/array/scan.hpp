@@ -0,0 +1,462 @@
+#ifndef LIBRAPID_ARRAY_SCAN_HPP
+#define LIBRAPID_ARRAY_SCAN_HPP
+
+/*
+ * Prefix scans (cumulative sums, products and maxima) of arrays, either over the flattened
+ * array or along one axis.
+ *
+ * A contiguous line is scanned in chunks of a fixed size. Each chunk is scanned on its own,
+ * starting from the identity, and the combined totals of the chunks before it are then applied
+ * to every element. When the line is long enough, the chunks are scanned in parallel, the
+ * totals are combined on one thread, and the totals are applied in parallel. Very long lines
+ * are processed a fixed number of chunks at a time, so the totals are kept on the stack and a
+ * scan never allocates. Since the chunks do not depend on the number of threads, floating point
+ * results are the same for any value of `global::numThreads`.
+ *
+ * Within a chunk, types with a SIMD packet are scanned one packet at a time. Each packet is
+ * scanned in registers with log2(width) shifted combines, so the serial dependency between
+ * elements is only one operation per packet.
+ *
+ * Scans along any axis except the last combine whole rows of the array, element by element,
+ * so they are vectorised across the contiguous dimension instead.
+ */
+
+namespace librapid {
+	/// Pass as the axis of a scan to scan the elements of the flattened array, in row-major
+	/// order
+	constexpr int64_t allAxes = std::numeric_limits<int64_t>::min();
+
+	namespace detail::scan {
+		/// Number of elements in each independently scanned chunk of a line
+		constexpr int64_t chunkSize = 16384;
+
+		/// Maximum number of chunks of a line scanned in one parallel pass
+		constexpr int64_t maxParallelChunks = 256;
+
+		/// Number of elements of a row processed by one task in a scan along a leading axis
+		constexpr int64_t rowBlockSize = 4096;
+
+		/// True if \p Packet is a SIMD vector that can shift its lanes, shifting in values
+		/// from another vector
+		template<typename Packet, typename = void>
+		struct CanShift : std::false_type {};
+
+		template<typename Packet>
+		struct CanShift<Packet, std::void_t<decltype(std::declval<const Packet &>().shifted(
+								  -1, std::declval<const Packet &>()))>> : std::true_type {};
+
+		/// Addition
+		struct Sum {
+			template<typename T>
+			static constexpr T identity() {
+				return T(0);
+			}
+
+			template<typename T>
+			LIBRAPID_ALWAYS_INLINE static T apply(const T &a, const T &b) {
+				return a + b;
+			}
+		};
+
+		/// Multiplication
+		struct Product {
+			template<typename T>
+			static constexpr T identity() {
+				return T(1);
+			}
+
+			template<typename T>
+			LIBRAPID_ALWAYS_INLINE static T apply(const T &a, const T &b) {
+				return a * b;
+			}
+		};
+
+		/// The maximum of two values. NaN values propagate, so every element after a NaN is NaN.
+		struct Max {
+			template<typename T>
+			static constexpr T identity() {
+				if constexpr (std::numeric_limits<T>::has_infinity) {
+					return -std::numeric_limits<T>::infinity();
+				} else {
+					return std::numeric_limits<T>::lowest();
+				}
+			}
+
+			template<typename T>
+			LIBRAPID_ALWAYS_INLINE static T apply(const T &a, const T &b) {
+				if constexpr (CanShift<T>::value) {
+					return Vc::iif(a > b || a != a, a, b);
+				} else {
+					return (a > b || a != a) ? a : b;
+				}
+			}
+		};
+
+		/// Scan contiguous values, starting from the identity of the operation. When the type
+		/// has a SIMD packet, values are processed one packet at a time: each packet is scanned
+		/// in registers with log2(width) shifted combines, then combined with the running total.
+		/// \p src and \p dst may be the same.
+		/// \tparam Op The operation
+		/// \tparam Scalar The type of the values
+		/// \param src The values
+		/// \param dst The result
+		/// \param size The number of values
+		/// \param exclusive True to exclude each value from its own result
+		/// \return The combination of every value
+		template<typename Op, typename Scalar>
+		Scalar scanRun(const Scalar *src, Scalar *dst, int64_t size, bool exclusive) {
+			using Packet		  = typename typetraits::TypeInfo<Scalar>::Packet;
+			const Scalar identity = Op::template identity<Scalar>();
+
+			Scalar carry = identity;
+			int64_t i	 = 0;
+
+			if constexpr (CanShift<Packet>::value) {
+				constexpr int64_t width = typetraits::TypeInfo<Scalar>::packetWidth;
+				const Packet identities(identity);
+				Packet carries(identity);
+
+				for (; i + width <= size; i += width) {
+					// Hillis-Steele scan of the packet: each step combines every lane with the
+					// lane `step` places before it
+					Packet lanes;
+					lanes.load(src + i, Vc::Unaligned);
+					for (int64_t step = 1; step < width; step *= 2) {
+						const Packet shifted = lanes.shifted(-static_cast<int>(step), identities);
+						lanes				 = Op::apply(shifted, lanes);
+					}
+
+					const Packet result =
+					  Op::apply(carries, exclusive ? lanes.shifted(-1, identities) : lanes);
+					result.store(dst + i, Vc::Unaligned);
+					carries = Op::apply(carries, Packet(lanes[width - 1]));
+				}
+				carry = carries[0];
+			}
+
+			for (; i < size; ++i) {
+				const Scalar value = src[i];
+				if (exclusive) dst[i] = carry;
+				carry = Op::apply(carry, value);
+				if (!exclusive) dst[i] = carry;
+			}
+			return carry;
+		}
+
+		/// Scan a contiguous line in chunks, on multiple threads if \p parallel is true.
+		/// \p src and \p dst may be the same.
+		/// \tparam Op The operation
+		/// \tparam Scalar The type of the values
+		/// \param src The values
+		/// \param dst The result
+		/// \param size The number of values
+		/// \param exclusive True to exclude each value from its own result
+		/// \param parallel True to scan the chunks on multiple threads
+		template<typename Op, typename Scalar>
+		void scanLine(const Scalar *src, Scalar *dst, int64_t size, bool exclusive,
+					  bool parallel) {
+			const int64_t chunks = (size + chunkSize - 1) / chunkSize;
+
+			// Scan one chunk from the identity, returning its total
+			const auto scanChunk = [src, dst, size, exclusive](int64_t chunk) {
+				const int64_t begin = chunk * chunkSize;
+				const int64_t count = ::librapid::min(chunkSize, size - begin);
+				return scanRun<Op>(src + begin, dst + begin, count, exclusive);
+			};
+
+			// Apply the combined totals of the previous chunks to one chunk
+			const auto applyOffset = [dst, size](int64_t chunk, const Scalar &offset) {
+				Scalar *begin		= dst + chunk * chunkSize;
+				const int64_t count = ::librapid::min(chunkSize, size - chunk * chunkSize);
+				for (int64_t i = 0; i < count; ++i) begin[i] = Op::apply(offset, begin[i]);
+			};
+
+			if (!parallel || chunks < 2) {
+				Scalar offset = Op::template identity<Scalar>();
+				for (int64_t chunk = 0; chunk < chunks; ++chunk) {
+					const Scalar total = scanChunk(chunk);
+					if (chunk > 0) {
+						applyOffset(chunk, offset);
+						offset = Op::apply(offset, total);
+					} else {
+						offset = total;
+					}
+				}
+				return;
+			}
+
+			// The chunks are scanned in groups of at most `maxParallelChunks`, so the totals fit
+			// in a buffer on the stack. The offset of each group carries on from the last one.
+			Scalar totals[maxParallelChunks];
+			Scalar offset = Op::template identity<Scalar>();
+			for (int64_t first = 0; first < chunks; first += maxParallelChunks) {
+				const int64_t last = ::librapid::min(chunks, first + maxParallelChunks);
+
+#pragma omp parallel for shared(first, last, totals, scanChunk) default(none)                      \
+  num_threads(global::numThreads)
+				for (int64_t chunk = first; chunk < last; ++chunk) {
+					totals[chunk - first] = scanChunk(chunk);
+				}
+
+				// Replace each total with the combined totals of the chunks before it
+				for (int64_t chunk = first; chunk < last; ++chunk) {
+					const Scalar total = totals[chunk - first];
+					if (chunk > 0) {
+						totals[chunk - first] = offset;
+						offset				  = Op::apply(offset, total);
+					} else {
+						offset = total;
+					}
+				}
+
+#pragma omp parallel for shared(first, last, totals, applyOffset) default(none)                    \
+  num_threads(global::numThreads)
+				for (int64_t chunk = ::librapid::max(first, int64_t(1)); chunk < last; ++chunk) {
+					applyOffset(chunk, totals[chunk - first]);
+				}
+			}
+		}
+
+		/// Scan along a leading axis, combining whole rows of `inner` contiguous elements, so the
+		/// work is vectorised across the rows. Each task scans a block of at most
+		/// `rowBlockSize` columns of one outer index. An exclusive scan is computed as an
+		/// inclusive scan, then moved down by one row, so it also works in place. \p src and
+		/// \p dst may be the same.
+		/// \tparam Op The operation
+		/// \tparam Scalar The type of the values
+		/// \param src The values
+		/// \param dst The result
+		/// \param lines The lines of the array along the axis
+		/// \param exclusive True to exclude each value from its own result
+		template<typename Op, typename Scalar>
+		void scanRows(const Scalar *src, Scalar *dst, const sort::Lines &lines, bool exclusive) {
+			const int64_t outer		 = lines.count / lines.inner;
+			const int64_t blocksEach = (lines.inner + rowBlockSize - 1) / rowBlockSize;
+			const int64_t tasks		 = outer * blocksEach;
+
+			const auto process = [&](int64_t task) {
+				const int64_t first = (task % blocksEach) * rowBlockSize;
+				const int64_t count = ::librapid::min(rowBlockSize, lines.inner - first);
+				const int64_t base	= (task / blocksEach) * lines.extent * lines.inner + first;
+				const auto row		= [&](int64_t k) { return dst + base + k * lines.inner; };
+
+				std::copy(src + base, src + base + count, row(0));
+				for (int64_t k = 1; k < lines.extent; ++k) {
+					const Scalar *in   = src + base + k * lines.inner;
+					const Scalar *prev = row(k - 1);
+					Scalar *out		   = row(k);
+					for (int64_t i = 0; i < count; ++i) out[i] = Op::apply(prev[i], in[i]);
+				}
+
+				if (exclusive) {
+					for (int64_t k = lines.extent - 1; k > 0; --k) {
+						std::copy(row(k - 1), row(k - 1) + count, row(k));
+					}
+					std::fill(row(0), row(0) + count, Op::template identity<Scalar>());
+				}
+			};
+
+			if (lines.count * lines.extent > global::multithreadThreshold &&
+				global::numThreads > 1 && tasks > 1) {
+#pragma omp parallel for shared(tasks, process) default(none) num_threads(global::numThreads)
+				for (int64_t task = 0; task < tasks; ++task) { process(task); }
+			} else {
+				for (int64_t task = 0; task < tasks; ++task) process(task);
+			}
+		}
+
+		/// Scan an array over its flattened elements or along one axis
+		/// \tparam Op The operation
+		/// \tparam Scalar The type of the values
+		/// \tparam ShapeType The shape type of the array
+		/// \param src The values
+		/// \param dst The result
+		/// \param shape The shape of the array
+		/// \param axis The axis, or `allAxes`
+		/// \param exclusive True to exclude each value from its own result
+		template<typename Op, typename Scalar, typename ShapeType>
+		void scan(const Scalar *src, Scalar *dst, const ShapeType &shape, int64_t axis,
+				  bool exclusive) {
+			const int64_t size = static_cast<int64_t>(shape.size());
+			const bool large   = size > global::multithreadThreshold && global::numThreads > 1;
+			if (axis == allAxes) return scanLine<Op>(src, dst, size, exclusive, large);
+
+			const sort::Lines lines = sort::lines(shape, axis);
+			if (size == 0) return;
+			if (lines.inner > 1) return scanRows<Op>(src, dst, lines, exclusive);
+
+			// Scan many lines on separate threads, or a few long lines on every thread
+			if (!large || lines.count < global::numThreads) {
+				for (int64_t line = 0; line < lines.count; ++line) {
+					const int64_t start = line * lines.extent;
+					scanLine<Op>(src + start, dst + start, lines.extent, exclusive, large);
+				}
+				return;
+			}
+
+#pragma omp parallel for shared(lines, src, dst, exclusive) default(none)                          \
+  num_threads(global::numThreads)
+			for (int64_t line = 0; line < lines.count; ++line) {
+				const int64_t start = line * lines.extent;
+				scanLine<Op>(src + start, dst + start, lines.extent, exclusive, false);
+			}
+		}
+
+		/// Scans work directly on contiguous host memory
+		template<typename StorageType>
+		constexpr void assertScannable() {
+			static_assert(typetraits::IsStorage<StorageType>::value ||
+							typetraits::IsFixedStorage<StorageType>::value ||
+							typetraits::IsMappedStorage<StorageType>::value,
+						  "Scans require a Storage, FixedStorage or MappedStorage object");
+		}
+
+		/// Scan an array into an existing array, checking that the result has the right shape
+		template<typename Op, typename SrcShape, typename SrcStorage, typename DstShape,
+				 typename DstStorage>
+		void scanInto(const array::ArrayContainer<SrcShape, SrcStorage> &src,
+					  array::ArrayContainer<DstShape, DstStorage> &dst, int64_t axis,
+					  bool exclusive) {
+			static_assert(std::is_same_v<typename SrcStorage::Scalar, typename DstStorage::Scalar>,
+						  "The result of a scan must have the same scalar type as the input");
+			assertScannable<SrcStorage>();
+			assertScannable<DstStorage>();
+
+			const bool flat = axis == allAxes;
+			if ((flat && dst.shape().size() != src.shape().size()) ||
+				(!flat && dst.shape() != src.shape())) {
+				throw std::runtime_error(fmt::format(
+				  "Cannot scan an array of shape {} into an array of shape {}",
+				  src.shape().str(),
+				  dst.shape().str()));
+			}
+
+			scan<Op>(src.storage().begin(), dst.storage().begin(), src.shape(), axis, exclusive);
+		}
+
+		/// The shape type of the result of a scan. A scan along an axis keeps the shape of the
+		/// array, and a scan of the flattened array has one dimension. For a ranked array with
+		/// more than one dimension, which of these applies is only known at runtime, so the
+		/// result uses a Shape.
+		/// \tparam ShapeType The shape type of the array
+		template<typename ShapeType>
+		struct ResultShape {
+			using Type = ShapeType;
+		};
+
+		template<typename T, size_t Rank>
+		struct ResultShape<RankedShape<T, Rank>> {
+			using Type = std::conditional_t<Rank == 1,
+											typename FlatShape<RankedShape<T, Rank>>::Type,
+											Shape<T, LIBRAPID_MAX_ARRAY_DIMS>>;
+		};
+
+		/// Scan an array into a new array
+		template<typename Op, typename ShapeType, typename StorageType>
+		auto scanNew(const array::ArrayContainer<ShapeType, StorageType> &src, int64_t axis,
+					 bool exclusive)
+		  -> array::ArrayContainer<typename ResultShape<ShapeType>::Type,
+								   Storage<typename StorageType::Scalar>> {
+			using DstShape = typename ResultShape<ShapeType>::Type;
+			using Result   = array::ArrayContainer<DstShape, Storage<typename StorageType::Scalar>>;
+			Result dst(axis == allAxes ? DstShape({src.shape().size()}) : DstShape(src.shape()));
+			scanInto<Op>(src, dst, axis, exclusive);
+			return dst;
+		}
+	} // namespace detail::scan
+
+	/// Return the cumulative sum of the elements of an array, over the flattened array or
+	/// along one axis. Long scans run on multiple threads.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param array The array
+	/// \param axis The axis to scan along, or `allAxes` to scan the flattened array
+	/// \param exclusive True to exclude each element from its own result, so the first result
+	/// is the identity
+	/// \return The result, with the shape of \p array, or one dimension for `allAxes`
+	/// \throws std::runtime_error if the axis is out of range
+	template<typename ShapeType, typename StorageType>
+	auto cumsum(const array::ArrayContainer<ShapeType, StorageType> &array, int64_t axis = allAxes,
+			  bool exclusive = false) {
+		return detail::scan::scanNew<detail::scan::Sum>(array, axis, exclusive);
+	}
+
+	/// Compute the cumulative sum of the elements of an array into an existing array,
+	/// without allocating a new result. \p dst may be \p array, to scan in place.
+	/// \param array The array
+	/// \param dst The result, with the shape of \p array, or the same number of elements for
+	/// `allAxes`
+	/// \param axis The axis to scan along, or `allAxes` to scan the flattened array
+	/// \param exclusive True to exclude each element from its own result
+	/// \throws std::runtime_error if the axis is out of range or \p dst has the wrong shape
+	template<typename SrcShape, typename SrcStorage, typename DstShape, typename DstStorage>
+	void cumsum(const array::ArrayContainer<SrcShape, SrcStorage> &array,
+			  array::ArrayContainer<DstShape, DstStorage> &dst, int64_t axis = allAxes,
+			  bool exclusive = false) {
+		detail::scan::scanInto<detail::scan::Sum>(array, dst, axis, exclusive);
+	}
+
+	/// Return the cumulative product of the elements of an array, over the flattened array or
+	/// along one axis. Long scans run on multiple threads.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param array The array
+	/// \param axis The axis to scan along, or `allAxes` to scan the flattened array
+	/// \param exclusive True to exclude each element from its own result, so the first result
+	/// is the identity
+	/// \return The result, with the shape of \p array, or one dimension for `allAxes`
+	/// \throws std::runtime_error if the axis is out of range
+	template<typename ShapeType, typename StorageType>
+	auto cumprod(const array::ArrayContainer<ShapeType, StorageType> &array, int64_t axis = allAxes,
+			  bool exclusive = false) {
+		return detail::scan::scanNew<detail::scan::Product>(array, axis, exclusive);
+	}
+
+	/// Compute the cumulative product of the elements of an array into an existing array,
+	/// without allocating a new result. \p dst may be \p array, to scan in place.
+	/// \param array The array
+	/// \param dst The result, with the shape of \p array, or the same number of elements for
+	/// `allAxes`
+	/// \param axis The axis to scan along, or `allAxes` to scan the flattened array
+	/// \param exclusive True to exclude each element from its own result
+	/// \throws std::runtime_error if the axis is out of range or \p dst has the wrong shape
+	template<typename SrcShape, typename SrcStorage, typename DstShape, typename DstStorage>
+	void cumprod(const array::ArrayContainer<SrcShape, SrcStorage> &array,
+			  array::ArrayContainer<DstShape, DstStorage> &dst, int64_t axis = allAxes,
+			  bool exclusive = false) {
+		detail::scan::scanInto<detail::scan::Product>(array, dst, axis, exclusive);
+	}
+
+	/// Return the cumulative maximum of the elements of an array, over the flattened array or
+	/// along one axis. Long scans run on multiple threads.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param array The array
+	/// \param axis The axis to scan along, or `allAxes` to scan the flattened array
+	/// \param exclusive True to exclude each element from its own result, so the first result
+	/// is the identity
+	/// \return The result, with the shape of \p array, or one dimension for `allAxes`
+	/// \throws std::runtime_error if the axis is out of range
+	template<typename ShapeType, typename StorageType>
+	auto cummax(const array::ArrayContainer<ShapeType, StorageType> &array, int64_t axis = allAxes,
+			  bool exclusive = false) {
+		return detail::scan::scanNew<detail::scan::Max>(array, axis, exclusive);
+	}
+
+	/// Compute the cumulative maximum of the elements of an array into an existing array,
+	/// without allocating a new result. \p dst may be \p array, to scan in place.
+	/// \param array The array
+	/// \param dst The result, with the shape of \p array, or the same number of elements for
+	/// `allAxes`
+	/// \param axis The axis to scan along, or `allAxes` to scan the flattened array
+	/// \param exclusive True to exclude each element from its own result
+	/// \throws std::runtime_error if the axis is out of range or \p dst has the wrong shape
+	template<typename SrcShape, typename SrcStorage, typename DstShape, typename DstStorage>
+	void cummax(const array::ArrayContainer<SrcShape, SrcStorage> &array,
+			  array::ArrayContainer<DstShape, DstStorage> &dst, int64_t axis = allAxes,
+			  bool exclusive = false) {
+		detail::scan::scanInto<detail::scan::Max>(array, dst, axis, exclusive);
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_SCAN_HPP
@@ -0,0 +1,592 @@
+#ifndef LIBRAPID_ARRAY_SERIALIZE_HPP
+#define LIBRAPID_ARRAY_SERIALIZE_HPP
+
+/*
+ * Binary serialization of arrays. A file consists of a small header followed by the raw bytes
+ * of the array's storage, so saving and loading are limited by disk bandwidth rather than by
+ * formatting. All header fields are little-endian:
+ *
+ *   Offset  Size     Field
+ *   0       4        Magic number "LRPD"
+ *   4       2        Format version
+ *   6       1        Byte order of the data (0 = little-endian, 1 = big-endian)
+ *   7       1        Data type (see DType)
+ *   8       4        Size of one element of the data in bytes
+ *   12      4        Number of dimensions, N
+ *   16      8 * N    Dimensions
+ *   16+8N   8        Size of the data in bytes
+ *   24+8N   ...      Zero padding, up to the next multiple of 64 bytes
+ *   D       ...      Data
+ *
+ * Boolean arrays are stored bit-packed, as 64-bit words. The data starts at a multiple of 64
+ * bytes, so files can be memory-mapped (see mapArray) with the data aligned for SIMD loads.
+ *
+ * Version 1 files have no padding, so their data starts at offset 24+8N. They can still be
+ * loaded and mapped.
+ */
+
+namespace librapid::detail::serialize {
+	/// The file format version written by `save`. Files with a newer version cannot be read.
+	/// Version 2 added the padding before the data.
+	constexpr uint16_t version = 2;
+
+	/// Magic number at the start of every file
+	constexpr char magic[4] = {'L', 'R', 'P', 'D'};
+
+	/// Size of the blocks in which data is read and written
+	constexpr size_t blockSize = size_t(1) << 24;
+
+	/// The data in a file starts at a multiple of this many bytes
+	constexpr size_t dataAlignment = 64;
+
+	/// Return the offset of the data in a file storing an array with \p ndim dimensions
+	/// \param ndim The number of dimensions
+	/// \return The offset of the first byte of data
+	LIBRAPID_NODISCARD constexpr size_t dataOffset(size_t ndim) {
+		const size_t headerSize = 24 + 8 * ndim;
+		return (headerSize + dataAlignment - 1) / dataAlignment * dataAlignment;
+	}
+
+	/// Data types which can be serialized
+	enum class DType : uint8_t {
+		Invalid	   = 0,
+		Bool	   = 1,
+		Int8	   = 2,
+		UInt8	   = 3,
+		Int16	   = 4,
+		UInt16	   = 5,
+		Int32	   = 6,
+		UInt32	   = 7,
+		Int64	   = 8,
+		UInt64	   = 9,
+		Float16	   = 10,
+		BFloat16   = 11,
+		Float32	   = 12,
+		Float64	   = 13,
+		Complex64  = 14,
+		Complex128 = 15,
+		PackedBool = 16
+	};
+
+	/// Return the DType of a scalar type, or DType::Invalid if it cannot be serialized
+	/// \tparam T The scalar type
+	/// \return The DType of \p T
+	template<typename T>
+	constexpr DType dtypeOf() {
+		if constexpr (std::is_same_v<T, bool>) {
+			return DType::Bool;
+		} else if constexpr (std::is_integral_v<T>) {
+			constexpr bool isSigned = std::is_signed_v<T>;
+			switch (sizeof(T)) {
+				case 1: return isSigned ? DType::Int8 : DType::UInt8;
+				case 2: return isSigned ? DType::Int16 : DType::UInt16;
+				case 4: return isSigned ? DType::Int32 : DType::UInt32;
+				case 8: return isSigned ? DType::Int64 : DType::UInt64;
+				default: return DType::Invalid;
+			}
+		} else if constexpr (std::is_same_v<T, half>) {
+			return DType::Float16;
+		} else if constexpr (std::is_same_v<T, bfloat16>) {
+			return DType::BFloat16;
+		} else if constexpr (std::is_same_v<T, float>) {
+			return DType::Float32;
+		} else if constexpr (std::is_same_v<T, double>) {
+			return DType::Float64;
+		} else if constexpr (std::is_same_v<T, Complex<float>>) {
+			return DType::Complex64;
+		} else if constexpr (std::is_same_v<T, Complex<double>>) {
+			return DType::Complex128;
+		} else {
+			return DType::Invalid;
+		}
+	}
+
+	/// \return True if the host stores integers in little-endian byte order
+	LIBRAPID_NODISCARD LIBRAPID_INLINE bool hostIsLittleEndian() {
+		const uint16_t value = 1;
+		return *reinterpret_cast<const uint8_t *>(&value) == 1;
+	}
+
+	/// Reverse the byte order of \p count values, each \p size bytes long
+	/// \param data Pointer to the values
+	/// \param count Number of values
+	/// \param size Size of each value in bytes
+	LIBRAPID_INLINE void swapBytes(uint8_t *data, size_t count, size_t size) {
+		for (size_t i = 0; i < count; ++i) { std::reverse(data + i * size, data + (i + 1) * size); }
+	}
+
+	/// An owning handle to a C file, closed on destruction. Data is read and written in large
+	/// blocks, so the stream is unbuffered to avoid an extra copy.
+	class File {
+	public:
+		File(const std::string &path, const char *mode) : m_path(path) {
+			m_file = std::fopen(path.c_str(), mode);
+			if (m_file == nullptr) {
+				throw std::runtime_error(fmt::format("Failed to open '{}'", path));
+			}
+			std::setvbuf(m_file, nullptr, _IONBF, 0);
+		}
+
+		File(const File &)			  = delete;
+		File &operator=(const File &) = delete;
+
+		~File() { std::fclose(m_file); }
+
+		void write(const void *data, size_t bytes) {
+			const auto *ptr = static_cast<const uint8_t *>(data);
+			while (bytes > 0) {
+				const size_t n = std::min(bytes, blockSize);
+				if (std::fwrite(ptr, 1, n, m_file) != n) {
+					throw std::runtime_error(fmt::format("Failed to write to '{}'", m_path));
+				}
+				ptr += n;
+				bytes -= n;
+			}
+		}
+
+		void read(void *data, size_t bytes) {
+			auto *ptr = static_cast<uint8_t *>(data);
+			while (bytes > 0) {
+				const size_t n = std::min(bytes, blockSize);
+				if (std::fread(ptr, 1, n, m_file) != n) {
+					throw std::runtime_error(fmt::format("Unexpected end of file in '{}'", m_path));
+				}
+				ptr += n;
+				bytes -= n;
+			}
+		}
+
+		/// Read up to \p bytes bytes
+		/// \param data The buffer to read into
+		/// \param bytes The size of the buffer
+		/// \return The number of bytes read, which is less than \p bytes only at the end of the
+		/// file
+		LIBRAPID_NODISCARD size_t readSome(void *data, size_t bytes) {
+			const size_t n = std::fread(data, 1, bytes, m_file);
+			if (n < bytes && std::ferror(m_file)) {
+				throw std::runtime_error(fmt::format("Failed to read from '{}'", m_path));
+			}
+			return n;
+		}
+
+		/// Move to \p offset bytes from the start of the file
+		/// \param offset The new position in the file
+		void seek(uint64_t offset) {
+#if defined(LIBRAPID_WINDOWS)
+			const int result = _fseeki64(m_file, static_cast<int64_t>(offset), SEEK_SET);
+#else
+			const int result = fseeko(m_file, static_cast<off_t>(offset), SEEK_SET);
+#endif
+			if (result != 0) {
+				throw std::runtime_error(fmt::format("Failed to seek in '{}'", m_path));
+			}
+		}
+
+		/// Move to the end of the file
+		/// \return The size of the file in bytes
+		uint64_t seekEnd() {
+#if defined(LIBRAPID_WINDOWS)
+			const bool failed = _fseeki64(m_file, 0, SEEK_END) != 0;
+			const auto offset = _ftelli64(m_file);
+#else
+			const bool failed = fseeko(m_file, 0, SEEK_END) != 0;
+			const auto offset = ftello(m_file);
+#endif
+			if (failed || offset < 0) {
+				throw std::runtime_error(fmt::format("Failed to seek in '{}'", m_path));
+			}
+			return static_cast<uint64_t>(offset);
+		}
+
+		/// \return The path of the file
+		LIBRAPID_NODISCARD const std::string &path() const { return m_path; }
+
+		template<typename T>
+		void writeLittleEndian(T value) {
+			uint8_t bytes[sizeof(T)];
+			for (size_t i = 0; i < sizeof(T); ++i) {
+				bytes[i] = static_cast<uint8_t>(static_cast<uint64_t>(value) >> (i * 8));
+			}
+			write(bytes, sizeof(T));
+		}
+
+		template<typename T>
+		LIBRAPID_NODISCARD T readLittleEndian() {
+			uint8_t bytes[sizeof(T)];
+			read(bytes, sizeof(T));
+			uint64_t value = 0;
+			for (size_t i = 0; i < sizeof(T); ++i) {
+				value |= static_cast<uint64_t>(bytes[i]) << (i * 8);
+			}
+			return static_cast<T>(value);
+		}
+
+	private:
+		std::string m_path;
+		std::FILE *m_file;
+	};
+
+	/// Describes the raw memory of a storage object
+	/// \tparam StorageType The storage type
+	template<typename StorageType>
+	struct StorageBytes {
+		using Scalar = typename StorageType::Scalar;
+
+		static_assert(typetraits::IsStorage<StorageType>::value ||
+						typetraits::IsFixedStorage<StorageType>::value ||
+						typetraits::IsMappedStorage<StorageType>::value,
+					  "Only arrays stored in host memory can be serialized");
+		static_assert(dtypeOf<Scalar>() != DType::Invalid,
+					  "This scalar type cannot be serialized");
+
+		static constexpr DType dtype		= dtypeOf<Scalar>();
+		static constexpr size_t elementSize = sizeof(Scalar);
+
+		/// Size of the values whose byte order must be reversed on a byte order mismatch
+		static constexpr size_t swapSize =
+		  dtype == DType::Complex64 || dtype == DType::Complex128 ? elementSize / 2 : elementSize;
+
+		/// Number of elementSize-byte units needed to store \p elements values
+		static constexpr uint64_t units(uint64_t elements) { return elements; }
+
+		static size_t bytes(const StorageType &storage) { return storage.size() * sizeof(Scalar); }
+		static const void *data(const StorageType &storage) { return storage.begin(); }
+		static void *data(StorageType &storage) { return storage.begin(); }
+		static void finish(StorageType &) {}
+	};
+
+	template<typename Allocator_>
+	struct StorageBytes<BitStorage<Allocator_>> {
+		using StorageType = BitStorage<Allocator_>;
+		using Word		  = typename StorageType::Word;
+
+		static constexpr DType dtype		= DType::PackedBool;
+		static constexpr size_t elementSize = sizeof(Word);
+		static constexpr size_t swapSize	= sizeof(Word);
+
+		/// Number of words needed to store \p elements bits
+		static constexpr uint64_t units(uint64_t elements) {
+			return elements / StorageType::wordBits + (elements % StorageType::wordBits != 0);
+		}
+
+		static size_t bytes(const StorageType &storage) {
+			return storage.numWords() * sizeof(Word);
+		}
+		static const void *data(const StorageType &storage) { return storage.data(); }
+		static void *data(StorageType &storage) { return storage.data(); }
+
+		/// Clear any bits past the end of the array so corrupt files cannot break the invariant
+		/// that padding bits are zero
+		static void finish(StorageType &storage) {
+			const size_t used = storage.size() % StorageType::wordBits;
+			if (used != 0) storage.data()[storage.numWords() - 1] &= (Word(1) << used) - 1;
+		}
+	};
+
+	/// Return the name of a DType, for error messages
+	LIBRAPID_NODISCARD LIBRAPID_INLINE const char *dtypeName(DType dtype) {
+		constexpr const char *names[] = {"invalid",	  "bool",		"int8",		 "uint8",
+										 "int16",	  "uint16",		"int32",	 "uint32",
+										 "int64",	  "uint64",		"float16",	 "bfloat16",
+										 "float32",	  "float64",	"complex64", "complex128",
+										 "packed bool"};
+		const auto index = static_cast<size_t>(dtype);
+		return index < sizeof(names) / sizeof(names[0]) ? names[index] : "unknown";
+	}
+
+	/// Return the shape to store for an array. Fixed-size arrays take their shape from their
+	/// storage type
+	template<typename ShapeType, typename StorageType>
+	LIBRAPID_NODISCARD ShapeType serializedShape(const ShapeType &shape,
+												 const StorageType &storage) {
+		if constexpr (typetraits::IsFixedStorage<StorageType>::value) {
+			return ShapeType(detail::shapeFromFixedStorage(storage));
+		} else {
+			return shape;
+		}
+	}
+
+	/// The contents of a file header
+	struct Header {
+		bool littleEndian;			// Byte order of the data
+		DType dtype;				// Data type of the elements
+		uint32_t elementSize;		// Size of one element in bytes
+		std::vector<uint64_t> dims; // Dimensions of the array
+		uint64_t bytes;				// Size of the data in bytes
+		uint64_t offset;			// Offset of the first byte of data in the file
+	};
+
+	/// Write a header to a file, followed by the padding before the data
+	/// \param file The file to write to
+	/// \param header The header to write
+	LIBRAPID_INLINE void writeHeader(File &file, const Header &header) {
+		file.write(magic, sizeof(magic));
+		file.writeLittleEndian<uint16_t>(version);
+		file.writeLittleEndian<uint8_t>(header.littleEndian ? 0 : 1);
+		file.writeLittleEndian<uint8_t>(static_cast<uint8_t>(header.dtype));
+		file.writeLittleEndian<uint32_t>(header.elementSize);
+		file.writeLittleEndian<uint32_t>(static_cast<uint32_t>(header.dims.size()));
+		for (const auto dim : header.dims) file.writeLittleEndian<uint64_t>(dim);
+		file.writeLittleEndian<uint64_t>(header.bytes);
+
+		const char padding[dataAlignment] = {};
+		const size_t ndim				  = header.dims.size();
+		file.write(padding, dataOffset(ndim) - (24 + 8 * ndim));
+	}
+
+	/// Read and validate a header from a file, leaving the file positioned at the start of the
+	/// data
+	/// \param file The file to read from
+	/// \param path The path of the file, for error messages
+	/// \param maxDimensions The maximum number of dimensions the caller can store
+	/// \return The header
+	LIBRAPID_NODISCARD LIBRAPID_INLINE Header readHeader(File &file, const std::string &path,
+														 size_t maxDimensions) {
+		char fileMagic[sizeof(magic)];
+		file.read(fileMagic, sizeof(fileMagic));
+		if (!std::equal(fileMagic, fileMagic + sizeof(magic), magic)) {
+			throw std::runtime_error(fmt::format("'{}' is not a LibRapid array file", path));
+		}
+
+		const auto fileVersion = file.readLittleEndian<uint16_t>();
+		if (fileVersion > version) {
+			throw std::runtime_error(
+			  fmt::format("'{}' has format version {}, but only versions up to {} are supported",
+						  path,
+						  fileVersion,
+						  version));
+		}
+
+		Header header;
+		header.littleEndian = file.readLittleEndian<uint8_t>() == 0;
+		header.dtype		= static_cast<DType>(file.readLittleEndian<uint8_t>());
+		header.elementSize	= file.readLittleEndian<uint32_t>();
+
+		const auto ndim = file.readLittleEndian<uint32_t>();
+		if (ndim > maxDimensions) {
+			throw std::runtime_error(
+			  fmt::format("'{}' has {} dimensions, but at most {} are supported",
+						  path,
+						  ndim,
+						  maxDimensions));
+		}
+
+		header.dims.resize(ndim);
+		for (auto &dim : header.dims) dim = file.readLittleEndian<uint64_t>();
+		header.bytes = file.readLittleEndian<uint64_t>();
+
+		// Version 1 files have no padding before the data
+		header.offset = fileVersion < 2 ? 24 + 8 * ndim : dataOffset(ndim);
+		char padding[dataAlignment];
+		file.read(padding, header.offset - (24 + 8 * ndim));
+		return header;
+	}
+
+	/// Throw an exception if a header does not describe data of the type \p Bytes expects
+	/// \tparam Bytes The StorageBytes type of the storage being read into
+	/// \param header The header to check
+	/// \param path The path of the file, for error messages
+	template<typename Bytes>
+	void checkDType(const Header &header, const std::string &path) {
+		if (header.dtype != Bytes::dtype || header.elementSize != Bytes::elementSize) {
+			throw std::runtime_error(fmt::format("'{}' contains {} data, but {} was expected",
+												 path,
+												 dtypeName(header.dtype),
+												 dtypeName(Bytes::dtype)));
+		}
+	}
+
+	/// Throw an exception if the data size in a header does not match the size of a storage
+	/// object
+	/// \param header The header to check
+	/// \param bytes The size of the storage object in bytes
+	/// \param path The path of the file, for error messages
+	LIBRAPID_INLINE void checkBytes(const Header &header, size_t bytes, const std::string &path) {
+		if (header.bytes != bytes) {
+			throw std::runtime_error(
+			  fmt::format("'{}' contains {} bytes of data, but its shape requires {}",
+						  path,
+						  header.bytes,
+						  bytes));
+		}
+	}
+
+	/// Check that the dimensions in a header describe the data that follows it, before any
+	/// memory is allocated for them, so a corrupt header cannot trigger a huge allocation. The
+	/// product of the dimensions must not overflow, must match the size of the data, and the
+	/// data must fit in the rest of the file. The file is left at the start of the data.
+	/// \tparam Bytes The StorageBytes type of the storage being read into
+	/// \param file The file being read
+	/// \param header The header of the file
+	/// \param path The path of the file, for error messages
+	template<typename Bytes>
+	void checkShape(File &file, const Header &header, const std::string &path) {
+		uint64_t elements = 1;
+		bool overflow	  = false;
+		for (const auto dim : header.dims) {
+			if (dim != 0 && elements > std::numeric_limits<uint64_t>::max() / dim) {
+				overflow = true;
+			}
+			elements *= dim;
+		}
+
+		// An array with an empty dimension has no elements, whatever its other dimensions are
+		if (std::find(header.dims.begin(), header.dims.end(), 0) != header.dims.end()) {
+			elements = 0;
+			overflow = false;
+		}
+
+		if (overflow || elements > std::numeric_limits<size_t>::max() ||
+			header.bytes % Bytes::elementSize != 0 ||
+			header.bytes / Bytes::elementSize != Bytes::units(elements)) {
+			throw std::runtime_error(
+			  fmt::format("'{}' has dimensions ({}), which do not match its {} bytes of data",
+						  path,
+						  fmt::join(header.dims, ", "),
+						  header.bytes));
+		}
+
+		const uint64_t fileSize = file.seekEnd();
+		if (fileSize < header.offset || header.bytes > fileSize - header.offset) {
+			throw std::runtime_error(fmt::format(
+			  "'{}' is truncated: it should contain {} bytes of data", path, header.bytes));
+		}
+		file.seek(header.offset);
+	}
+
+	/// Write a shape and storage object to a file
+	/// \tparam ShapeType The shape type
+	/// \tparam StorageType The storage type
+	/// \param path The path of the file
+	/// \param shape The shape of the array
+	/// \param storage The storage of the array
+	template<typename ShapeType, typename StorageType>
+	void save(const std::string &path, const ShapeType &shape, const StorageType &storage) {
+		using Bytes = StorageBytes<StorageType>;
+
+		const ShapeType fileShape = serializedShape(shape, storage);
+		Header header;
+		header.littleEndian = hostIsLittleEndian();
+		header.dtype		= Bytes::dtype;
+		header.elementSize	= static_cast<uint32_t>(Bytes::elementSize);
+		header.bytes		= Bytes::bytes(storage);
+		for (size_t i = 0; i < fileShape.ndim(); ++i) {
+			header.dims.push_back(static_cast<uint64_t>(fileShape[i]));
+		}
+		header.offset = dataOffset(header.dims.size());
+
+		File file(path, "wb");
+		writeHeader(file, header);
+		file.write(Bytes::data(storage), Bytes::bytes(storage));
+	}
+
+	/// Read a file written by `save` into a shape and storage object. The storage is resized to
+	/// fit the data
+	/// \tparam ShapeType The shape type
+	/// \tparam StorageType The storage type
+	/// \param path The path of the file
+	/// \param shape The shape to read into
+	/// \param storage The storage to read into
+	template<typename ShapeType, typename StorageType>
+	void load(const std::string &path, ShapeType &shape, StorageType &storage) {
+		using Bytes = StorageBytes<StorageType>;
+
+		File file(path, "rb");
+		const Header header = readHeader(file, path, ShapeType::MaxDimensions);
+		checkDType<Bytes>(header, path);
+		checkShape<Bytes>(file, header, path);
+		shape = ShapeType(header.dims);
+
+		if constexpr (typetraits::IsFixedStorage<StorageType>::value) {
+			if (shape != serializedShape(shape, storage)) {
+				throw std::runtime_error(fmt::format(
+				  "'{}' has shape {}, which does not fit a fixed-size array", path, shape.str()));
+			}
+		} else {
+			storage.resize(shape.size(), 0);
+		}
+
+		checkBytes(header, Bytes::bytes(storage), path);
+		file.read(Bytes::data(storage), header.bytes);
+		if (header.littleEndian != hostIsLittleEndian()) {
+			swapBytes(static_cast<uint8_t *>(Bytes::data(storage)),
+					  header.bytes / Bytes::swapSize,
+					  Bytes::swapSize);
+		}
+		Bytes::finish(storage);
+	}
+} // namespace librapid::detail::serialize
+
+namespace librapid {
+	/// Map an array saved with `ArrayContainer::save` into memory, without reading it. Elements
+	/// are read from the file on demand, so arrays larger than physical memory can be used.
+	///
+	/// The file must contain elements of type \p Scalar in the host's byte order.
+	/// \tparam Scalar The scalar type of the array
+	/// \param path The path of the file
+	/// \param mode How the file is mapped
+	/// \return An array referring to the mapped data
+	template<typename Scalar>
+	auto mapArray(const std::string &path, MapMode mode = MapMode::ReadOnly)
+	  -> Array<Scalar, MappedStorage<Scalar>> {
+		namespace serialize = detail::serialize;
+		using ArrayType		= Array<Scalar, MappedStorage<Scalar>>;
+		using ShapeType		= typename ArrayType::ShapeType;
+		using Bytes			= serialize::StorageBytes<MappedStorage<Scalar>>;
+
+		serialize::Header header;
+		{
+			serialize::File file(path, "rb");
+			header = serialize::readHeader(file, path, ShapeType::MaxDimensions);
+			serialize::checkDType<Bytes>(header, path);
+			serialize::checkShape<Bytes>(file, header, path);
+		}
+		if (header.littleEndian != serialize::hostIsLittleEndian()) {
+			throw std::runtime_error(
+			  fmt::format("'{}' uses a different byte order to this machine, so it must be loaded "
+						  "rather than mapped",
+						  path));
+		}
+
+		const ShapeType shape(header.dims);
+		serialize::checkBytes(header, shape.size() * sizeof(Scalar), path);
+		return ArrayType(shape, MappedStorage<Scalar>(path, mode, shape.size(), header.offset));
+	}
+
+	/// Create (or overwrite) a file which can be opened with `mapArray` or `load`, and map it
+	/// into memory for reading and writing. The elements are initially zero, and changes made
+	/// to the array are written to the file.
+	/// \tparam Scalar The scalar type of the array
+	/// \tparam ShapeType The shape type
+	/// \param path The path of the file
+	/// \param shape The shape of the array
+	/// \return An array referring to the mapped data
+	template<typename Scalar, typename ShapeType>
+	auto createMappedArray(const std::string &path, const ShapeType &shape)
+	  -> Array<Scalar, MappedStorage<Scalar>> {
+		namespace serialize = detail::serialize;
+		using ArrayType		= Array<Scalar, MappedStorage<Scalar>>;
+		using Bytes			= serialize::StorageBytes<MappedStorage<Scalar>>;
+
+		const typename ArrayType::ShapeType arrayShape(shape);
+		serialize::Header header;
+		header.littleEndian = serialize::hostIsLittleEndian();
+		header.dtype		= Bytes::dtype;
+		header.elementSize	= static_cast<uint32_t>(Bytes::elementSize);
+		header.bytes		= arrayShape.size() * sizeof(Scalar);
+		for (size_t i = 0; i < arrayShape.ndim(); ++i) {
+			header.dims.push_back(static_cast<uint64_t>(arrayShape[i]));
+		}
+		header.offset = serialize::dataOffset(arrayShape.ndim());
+
+		{
+			serialize::File file(path, "wb");
+			serialize::writeHeader(file, header);
+		}
+
+		return ArrayType(arrayShape,
+						 MappedStorage<Scalar>::create(path, arrayShape.size(), header.offset));
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_SERIALIZE_HPP
@@ -7,13 +7,20 @@
  */
 
 namespace librapid {
-	template<typename T = size_t, size_t N = 32>
+	/// A Shape stores the dimensions of an array inline, so it never allocates. Up to \p N
+	/// dimensions are supported, and \p N defaults to LIBRAPID_MAX_ARRAY_DIMS, which is kept
+	/// small because every array, ArrayView and Stride carries at least one Shape. The number of
+	/// elements is cached, so size() is O(1) unless the Shape has been modified through the
+	/// non-const operator[].
+	/// \tparam T The type of each dimension
+	/// \tparam N The maximum number of dimensions
+	template<typename T = size_t, size_t N = LIBRAPID_MAX_ARRAY_DIMS>
 	class Shape {
 	public:
 		using SizeType						  = T;
 		static constexpr size_t MaxDimensions = N;
 
-		/// Default constructor
+		/// Default constructor. The Shape has zero dimensions
 		Shape() = default;
 
 		/// Create a shape object from the dimensions of a FixedStorage object. This is used
@@ -38,11 +45,11 @@ namespace librapid {
 
 		/// Create a copy of a Shape object
 		/// \param other Shape object to copy
-		Shape(const Shape &other) = default;
+		Shape(const Shape &other);
 
 		/// Create a Shape from an RValue
 		/// \param other Temporary Shape object to copy
-		Shape(Shape &&other) noexcept = default;
+		Shape(Shape &&other) noexcept;
 
 		/// Create a Shape object from one with a different type and number of dimensions.
 		/// \tparam V Scalar type of the values
@@ -76,12 +83,12 @@ namespace librapid {
 		/// Assign an RValue Shape to this object
 		/// \param other RValue to move
 		/// \return
-		Shape &operator=(Shape &&other) noexcept = default;
+		Shape &operator=(Shape &&other) noexcept;
 
 		/// Assign a Shape to this object
 		/// \param other Shape to copy
 		/// \return
-		Shape &operator=(const Shape &other) = default;
+		Shape &operator=(const Shape &other);
 
 		/// Return a Shape object with \p dims dimensions, all initialized to zero.
 		/// \param dims Number of dimensions
@@ -100,7 +107,8 @@ namespace librapid {
 		template<typename Index>
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const T &operator[](Index index) const;
 
-		/// Access an element of the Shape object
+		/// Access an element of the Shape object. The value may be modified through the
+		/// reference, so the cached size is discarded until the Shape is next copied.
 		/// \tparam Index Typename of the index
 		/// \param index Index to access
 		/// \return A reference to the value at the index
@@ -136,20 +144,35 @@ namespace librapid {
 		LIBRAPID_NODISCARD std::string str(const std::string &format = "{}") const;
 
 	protected:
-		T m_dims;
+		/// Marks m_size as out of date
+		static constexpr T unknownSize = std::numeric_limits<T>::max();
+
+		/// Return the product of the dimensions, ignoring the cached size
+		/// \return Number of elements
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE T computeSize() const;
+
+		/// Copy \p other into this object, caching its size if it is not already known
+		/// \param other Shape object to copy
+		LIBRAPID_ALWAYS_INLINE void copyFrom(const Shape &other);
+
+		T m_dims = 0;
+		T m_size = 1;
 		std::array<T, N> m_data;
 	};
 
 	namespace detail {
 		template<typename T, size_t... Dims>
-		Shape<size_t, 32> shapeFromFixedStorage(const FixedStorage<T, Dims...> &) {
-			return Shape<size_t, 32>({Dims...});
+		Shape<size_t, LIBRAPID_MAX_ARRAY_DIMS>
+		shapeFromFixedStorage(const FixedStorage<T, Dims...> &) {
+			return Shape<size_t, LIBRAPID_MAX_ARRAY_DIMS>({Dims...});
 		}
 	} // namespace detail
 
 	template<typename T, size_t N>
 	template<typename Scalar, size_t... Dimensions>
-	Shape<T, N>::Shape(const FixedStorage<Scalar, Dimensions...> &) : m_data({Dimensions...}) {}
+	Shape<T, N>::Shape(const FixedStorage<Scalar, Dimensions...> &) :
+			m_dims(sizeof...(Dimensions)), m_size((Dimensions * ... * 1)),
+			m_data({Dimensions...}) {}
 
 	template<typename T, size_t N>
 	template<typename V, typename typetraits::EnableIf<typetraits::CanCast<V, T>::value>>
@@ -159,6 +182,7 @@ namespace librapid {
 						N,
 						vals.size());
 		for (size_t i = 0; i < vals.size(); ++i) { m_data[i] = *(vals.begin() + i); }
+		m_size = computeSize();
 	}
 
 	template<typename T, size_t N>
@@ -169,6 +193,7 @@ namespace librapid {
 						N,
 						vals.size());
 		for (size_t i = 0; i < vals.size(); ++i) { m_data[i] = vals[i]; }
+		m_size = computeSize();
 	}
 
 	template<typename T, size_t N>
@@ -179,6 +204,7 @@ namespace librapid {
 						N,
 						other.ndim());
 		for (size_t i = 0; i < m_dims; ++i) { m_data[i] = other[i]; }
+		m_size = computeSize();
 	}
 
 	template<typename T, size_t N>
@@ -189,6 +215,7 @@ namespace librapid {
 						N,
 						other.ndim());
 		for (size_t i = 0; i < m_dims; ++i) { m_data[i] = other[i]; }
+		m_size = computeSize();
 	}
 
 	template<typename T, size_t N>
@@ -200,6 +227,7 @@ namespace librapid {
 						vals.size());
 		m_dims = vals.size();
 		for (int64_t i = 0; i < vals.size(); ++i) { m_data[i] = *(vals.begin() + i); }
+		m_size = computeSize();
 		return *this;
 	}
 
@@ -212,14 +240,45 @@ namespace librapid {
 						vals.size());
 		m_dims = vals.size();
 		for (int64_t i = 0; i < vals.size(); ++i) { m_data[i] = vals[i]; }
+		m_size = computeSize();
+		return *this;
+	}
+
+	template<typename T, size_t N>
+	Shape<T, N>::Shape(const Shape &other) {
+		copyFrom(other);
+	}
+
+	template<typename T, size_t N>
+	Shape<T, N>::Shape(Shape &&other) noexcept {
+		copyFrom(other);
+	}
+
+	template<typename T, size_t N>
+	auto Shape<T, N>::operator=(const Shape &other) -> Shape & {
+		copyFrom(other);
+		return *this;
+	}
+
+	template<typename T, size_t N>
+	auto Shape<T, N>::operator=(Shape &&other) noexcept -> Shape & {
+		copyFrom(other);
 		return *this;
 	}
 
+	template<typename T, size_t N>
+	void Shape<T, N>::copyFrom(const Shape &other) {
+		m_dims = other.m_dims;
+		m_data = other.m_data;
+		m_size = other.m_size != unknownSize ? other.m_size : other.computeSize();
+	}
+
 	template<typename T, size_t N>
 	Shape<T, N> Shape<T, N>::zeros(size_t dims) {
 		Shape res;
 		res.m_dims = dims;
 		for (size_t i = 0; i < dims; ++i) res.m_data[i] = 0;
+		res.m_size = dims == 0 ? 1 : 0;
 		return res;
 	}
 
@@ -228,6 +287,7 @@ namespace librapid {
 		Shape res;
 		res.m_dims = dims;
 		for (size_t i = 0; i < dims; ++i) res.m_data[i] = 1;
+		res.m_size = 1;
 		return res;
 	}
 
@@ -244,6 +304,7 @@ namespace librapid {
 	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE T &Shape<T, N>::operator[](Index index) {
 		LIBRAPID_ASSERT(static_cast<T>(index) < m_dims, "Index out of bounds");
 		LIBRAPID_ASSERT(index >= 0, "Index out of bounds");
+		m_size = unknownSize;
 		return m_data[index];
 	}
 
@@ -276,11 +337,17 @@ namespace librapid {
 		Shape res;
 		res.m_dims = end - start;
 		for (size_t i = 0; i < res.m_dims; ++i) res.m_data[i] = m_data[i + start];
+		res.m_size = res.computeSize();
 		return res;
 	}
 
 	template<typename T, size_t N>
 	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE T Shape<T, N>::size() const {
+		return m_size != unknownSize ? m_size : computeSize();
+	}
+
+	template<typename T, size_t N>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE T Shape<T, N>::computeSize() const {
 		T res = 1;
 		for (size_t i = 0; i < m_dims; ++i) res *= m_data[i];
 		return res;
@@ -0,0 +1,549 @@
+#ifndef LIBRAPID_ARRAY_SORT_HPP
+#define LIBRAPID_ARRAY_SORT_HPP
+
+/*
+ * Sorting and selection along one axis of an array.
+ *
+ * An array is treated as a set of independent lines along the chosen axis. Lines along the
+ * last axis are contiguous and are sorted in place in the array's storage. Lines along other
+ * axes are strided, so each one is copied into a buffer, sorted and copied back.
+ *
+ * Short lines are sorted with branchless sorting networks. Longer lines use std::sort. Many
+ * lines are sorted in parallel, one line per task. A single long line is cut into one run per
+ * thread, the runs are sorted in parallel, and the runs are then merged in parallel. Each merge
+ * is split between the threads by binary searching for where every thread's share of the
+ * output starts.
+ *
+ * NaN values are ordered after every other value, so they are found at the end of sorted lines
+ * and at the start of the largest values.
+ */
+
+namespace librapid {
+	namespace detail::sort {
+		/// The layout of the lines of an array along one axis. Line i starts at element
+		/// `(i / inner) * extent * inner + i % inner` and has a stride of `inner`.
+		struct Lines {
+			int64_t count;	// The number of lines
+			int64_t extent; // The length of each line
+			int64_t inner;	// The stride between elements of a line
+
+			/// \param line The index of a line
+			/// \return The index of the first element of the line
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t start(int64_t line) const {
+				return (line / inner) * extent * inner + line % inner;
+			}
+		};
+
+		/// Return the layout of the lines of an array along an axis
+		/// \tparam ShapeType The shape type of the array
+		/// \param shape The shape of the array
+		/// \param axis The axis. Negative values count back from the last axis.
+		/// \return The lines
+		/// \throws std::runtime_error if the axis is out of range
+		template<typename ShapeType>
+		Lines lines(const ShapeType &shape, int64_t axis) {
+			const int64_t ndim = static_cast<int64_t>(shape.ndim());
+			if (axis < -ndim || axis >= ndim) {
+				throw std::runtime_error(fmt::format(
+				  "Axis {} is out of range for an array with {} dimensions", axis, ndim));
+			}
+			if (axis < 0) axis += ndim;
+
+			Lines result {1, static_cast<int64_t>(shape[axis]), 1};
+			for (int64_t i = 0; i < ndim; ++i) {
+				if (i < axis) result.count *= static_cast<int64_t>(shape[i]);
+				if (i > axis) result.inner *= static_cast<int64_t>(shape[i]);
+			}
+			result.count *= result.inner;
+			return result;
+		}
+
+		/// Sorting works directly on contiguous host memory
+		template<typename StorageType>
+		constexpr void assertSortable() {
+			static_assert(typetraits::IsStorage<StorageType>::value ||
+							typetraits::IsFixedStorage<StorageType>::value ||
+							typetraits::IsMappedStorage<StorageType>::value,
+						  "Sorting requires a Storage, FixedStorage or MappedStorage object");
+		}
+
+		/// \return True if \p value is NaN
+		template<typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isNaN(const T &value) {
+			if constexpr (std::is_floating_point_v<T>) {
+				return std::isnan(value);
+			} else {
+				return value != value;
+			}
+		}
+
+		/// A strict weak ordering which places NaN values after every other value
+		struct Less {
+			template<typename T>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool operator()(const T &a,
+																	  const T &b) const {
+				return a < b || (isNaN(b) && !isNaN(a));
+			}
+		};
+
+		/// One compare-exchange of a sorting network
+		struct Comparator {
+			uint8_t first;
+			uint8_t second;
+		};
+
+		/// Call \p f for each comparator of Batcher's odd-even merge sort network for N elements,
+		/// in order
+		/// \tparam N The number of elements, which must be a power of two
+		/// \tparam F The type of the function
+		/// \param f Callable taking the indices of the two elements to compare
+		template<size_t N, typename F>
+		constexpr void forEachComparator(F &&f) {
+			for (size_t p = 1; p < N; p <<= 1) {
+				for (size_t k = p; k >= 1; k >>= 1) {
+					for (size_t j = k % p; j + k < N; j += 2 * k) {
+						for (size_t i = 0; i < k && i + j + k < N; ++i) {
+							if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) f(i + j, i + j + k);
+						}
+					}
+				}
+			}
+		}
+
+		/// \return The number of comparators in the sorting network for N elements
+		template<size_t N>
+		constexpr size_t networkSize() {
+			size_t count = 0;
+			forEachComparator<N>([&count](size_t, size_t) { ++count; });
+			return count;
+		}
+
+		/// \return The comparators of the sorting network for N elements
+		template<size_t N>
+		constexpr std::array<Comparator, networkSize<N>()> makeNetwork() {
+			std::array<Comparator, networkSize<N>()> result {};
+			size_t index = 0;
+			forEachComparator<N>([&result, &index](size_t a, size_t b) {
+				result[index++] = {static_cast<uint8_t>(a), static_cast<uint8_t>(b)};
+			});
+			return result;
+		}
+
+		/// The sorting network for N elements
+		template<size_t N>
+		constexpr auto network = makeNetwork<N>();
+
+		/// Apply a sorting network to N values. The comparators are expanded at compile time, so
+		/// the values can be kept in registers, and each compare-exchange is a branchless min
+		/// and max.
+		/// \tparam N The size of the network
+		/// \tparam Scalar The type of the values
+		/// \tparam I The indices of the comparators
+		/// \param values The values
+		template<size_t N, typename Scalar, size_t... I>
+		LIBRAPID_ALWAYS_INLINE void applyNetwork(Scalar *values, std::index_sequence<I...>) {
+			const auto compareExchange = [values](size_t first, size_t second) {
+				const Scalar a	 = values[first];
+				const Scalar b	 = values[second];
+				values[first]  = a < b ? a : b;
+				values[second] = a < b ? b : a;
+			};
+			(compareExchange(network<N>[I].first, network<N>[I].second), ...);
+		}
+
+		/// Sort \p size <= N values with a sorting network. The values are padded to N with the
+		/// largest value of the type (infinity, where the type has one), so the padding sorts
+		/// after every real value and the first \p size results are the sorted input.
+		/// \tparam N The size of the network
+		/// \tparam Scalar The type of the values, which must not be NaN
+		/// \param data The values
+		/// \param size The number of values
+		template<size_t N, typename Scalar>
+		void networkSort(Scalar *data, int64_t size) {
+			using Limits		 = std::numeric_limits<Scalar>;
+			const Scalar largest = Limits::has_infinity ? Limits::infinity() : Limits::max();
+
+			Scalar values[N];
+			for (int64_t i = 0; i < size; ++i) values[i] = data[i];
+			for (int64_t i = size; i < static_cast<int64_t>(N); ++i) values[i] = largest;
+
+			applyNetwork<N>(values, std::make_index_sequence<networkSize<N>()>());
+			for (int64_t i = 0; i < size; ++i) data[i] = values[i];
+		}
+
+		/// Lines with at most this many elements are sorted with a sorting network
+		constexpr int64_t networkSortSize = 16;
+
+		/// Sort contiguous values on one thread. NaN values are moved to the end first, so the
+		/// rest can be sorted with the built-in comparison.
+		/// \tparam Scalar The type of the values
+		/// \param data The values
+		/// \param size The number of values
+		template<typename Scalar>
+		void sortRun(Scalar *data, int64_t size) {
+			if constexpr (std::is_floating_point_v<Scalar>) {
+				size = std::partition(data, data + size, [](Scalar x) { return !std::isnan(x); }) -
+					   data;
+			}
+
+			if constexpr (std::is_arithmetic_v<Scalar>) {
+				if (size <= 4) return networkSort<4>(data, size);
+				if (size <= 8) return networkSort<8>(data, size);
+				if (size <= networkSortSize) return networkSort<networkSortSize>(data, size);
+				std::sort(data, data + size);
+			} else {
+				std::sort(data, data + size, Less());
+			}
+		}
+
+		/// Return the number of elements of \p a among the first \p k elements of the stable
+		/// merge of the sorted ranges \p a and \p b
+		/// \tparam T The type of the elements
+		/// \tparam Compare The type of the comparison
+		/// \param k The number of merged elements
+		/// \param a The first range
+		/// \param sizeA The length of \p a
+		/// \param b The second range
+		/// \param sizeB The length of \p b
+		/// \param less The comparison
+		/// \return The number of elements taken from \p a
+		template<typename T, typename Compare>
+		int64_t coRank(int64_t k, const T *a, int64_t sizeA, const T *b, int64_t sizeB,
+					   const Compare &less) {
+			int64_t low	 = ::librapid::max(k - sizeB, int64_t(0));
+			int64_t high = ::librapid::min(k, sizeA);
+			while (low < high) {
+				const int64_t i = (low + high) / 2;
+				// Elements of a which are not greater than b[k - i - 1] are merged before it
+				if (!less(b[k - i - 1], a[i])) {
+					low = i + 1;
+				} else {
+					high = i;
+				}
+			}
+			return low;
+		}
+
+		/// Sort a contiguous range on multiple threads. The range is cut into one run per
+		/// thread, and the runs are sorted in parallel by \p sortRun. Pairs of runs are then
+		/// merged, level by level, with every merge split evenly between the threads.
+		/// \tparam T The type of the elements
+		/// \tparam Compare The type of the comparison
+		/// \tparam SortRun The type of the function sorting one run
+		/// \param data The elements
+		/// \param size The number of elements
+		/// \param less The comparison used to merge runs
+		/// \param sortRun Callable taking (pointer, count), which sorts one run
+		template<typename T, typename Compare, typename SortRun>
+		void parallelSort(T *data, int64_t size, const Compare &less, const SortRun &sortRun) {
+			const int64_t threads = global::numThreads;
+			std::vector<int64_t> bounds(threads + 1);
+			for (int64_t i = 0; i <= threads; ++i) bounds[i] = size * i / threads;
+
+#pragma omp parallel for shared(threads, data, bounds, sortRun) default(none)                      \
+  num_threads(global::numThreads)
+			for (int64_t run = 0; run < threads; ++run) {
+				sortRun(data + bounds[run], bounds[run + 1] - bounds[run]);
+			}
+
+			std::vector<T> buffer(size);
+			T *src = data;
+			T *dst = buffer.data();
+			while (bounds.size() > 2) {
+				// Merge runs 2i and 2i + 1. An odd run at the end is copied. Each merge is split
+				// into pieces with the same share of the output as the runs have of the data
+				std::vector<int64_t> merged;
+				for (size_t run = 0; run + 1 < bounds.size(); run += 2) {
+					merged.push_back(bounds[run]);
+				}
+				merged.push_back(size);
+
+				const int64_t pieces = threads;
+#pragma omp parallel for shared(pieces, size, src, dst, bounds, less) default(none)                \
+  num_threads(global::numThreads)
+				for (int64_t piece = 0; piece < pieces; ++piece) {
+					const int64_t outBegin = size * piece / pieces;
+					const int64_t outEnd   = size * (piece + 1) / pieces;
+
+					// Find the merge containing the first element of this piece, and write
+					// every merge which overlaps it
+					const auto first = std::upper_bound(bounds.begin(), bounds.end(), outBegin);
+					size_t pair		 = static_cast<size_t>(first - bounds.begin() - 1);
+					pair -= pair % 2;
+					for (; pair + 1 < bounds.size() && bounds[pair] < outEnd; pair += 2) {
+						const int64_t begin = bounds[pair];
+						const int64_t mid	= bounds[pair + 1];
+						const int64_t end	= pair + 2 < bounds.size() ? bounds[pair + 2] : mid;
+						const int64_t lo	= ::librapid::max(outBegin, begin) - begin;
+						const int64_t hi	= ::librapid::min(outEnd, end) - begin;
+
+						const T *a			= src + begin;
+						const T *b			= src + mid;
+						const int64_t sizeA = mid - begin;
+						const int64_t sizeB = end - mid;
+						const int64_t aLo	= coRank(lo, a, sizeA, b, sizeB, less);
+						const int64_t aHi	= coRank(hi, a, sizeA, b, sizeB, less);
+						std::merge(a + aLo,
+								   a + aHi,
+								   b + (lo - aLo),
+								   b + (hi - aHi),
+								   dst + begin + lo,
+								   less);
+					}
+				}
+
+				bounds = std::move(merged);
+				std::swap(src, dst);
+			}
+
+			if (src != data) std::copy(src, src + size, data);
+		}
+
+		/// \return True if the lines of an array are large enough to be processed in parallel
+		LIBRAPID_NODISCARD LIBRAPID_INLINE bool parallelLines(const Lines &lines) {
+			return lines.count > 1 && lines.count * lines.extent > global::multithreadThreshold &&
+				   global::numThreads > 1;
+		}
+
+		/// \return True if there are too few lines to keep every thread busy, so each line
+		/// should be sorted on multiple threads instead
+		LIBRAPID_NODISCARD LIBRAPID_INLINE bool parallelWithinLines(const Lines &lines) {
+			return lines.count < global::numThreads &&
+				   lines.extent > global::multithreadThreshold && global::numThreads > 1;
+		}
+
+		/// Call \p f for every line of an array, with a pointer to its contiguous elements.
+		/// Strided lines are copied into a buffer for the call, and copied back afterwards if
+		/// the elements are not const.
+		/// \tparam T The type of the elements
+		/// \tparam F The type of the function
+		/// \param data The elements of the array
+		/// \param lines The lines of the array
+		/// \param parallel True to process the lines on multiple threads
+		/// \param f Callable taking (pointer, line index)
+		template<typename T, typename F>
+		void forEachLine(T *data, const Lines &lines, bool parallel, const F &f) {
+			const int64_t blocks = parallel ? ::librapid::min(global::numThreads, lines.count) : 1;
+
+			const auto process = [&](int64_t block) {
+				const int64_t first = lines.count * block / blocks;
+				const int64_t last	= lines.count * (block + 1) / blocks;
+				if (lines.inner == 1) {
+					for (int64_t line = first; line < last; ++line) {
+						f(data + line * lines.extent, line);
+					}
+					return;
+				}
+
+				std::vector<std::remove_const_t<T>> buffer(lines.extent);
+				for (int64_t line = first; line < last; ++line) {
+					T *start = data + lines.start(line);
+					for (int64_t i = 0; i < lines.extent; ++i) buffer[i] = start[i * lines.inner];
+					f(buffer.data(), line);
+					if constexpr (!std::is_const_v<T>) {
+						for (int64_t i = 0; i < lines.extent; ++i) {
+							start[i * lines.inner] = buffer[i];
+						}
+					}
+				}
+			};
+
+			if (blocks == 1) return process(0);
+
+#pragma omp parallel for shared(blocks, process) default(none) num_threads(global::numThreads)
+			for (int64_t block = 0; block < blocks; ++block) { process(block); }
+		}
+
+		/// Sort one contiguous line of values
+		/// \tparam Scalar The type of the values
+		/// \param values The values
+		/// \param size The number of values
+		/// \param parallel True to sort on multiple threads
+		template<typename Scalar>
+		void sortLine(Scalar *values, int64_t size, bool parallel) {
+			if (!parallel) return sortRun(values, size);
+
+			if constexpr (std::is_floating_point_v<Scalar>) {
+				size = std::partition(
+						 values, values + size, [](Scalar x) { return !std::isnan(x); }) -
+					   values;
+			}
+			parallelSort(values, size, Less(), [](Scalar *run, int64_t count) {
+				sortRun(run, count);
+			});
+		}
+
+		/// Sort indices by the values they refer to, keeping equal values in index order
+		/// \tparam Scalar The type of the values
+		/// \param values The values of one line
+		/// \param indices The sorted indices
+		/// \param size The number of values
+		/// \param parallel True to sort on multiple threads
+		template<typename Scalar>
+		void argsortLine(const Scalar *values, int64_t *indices, int64_t size, bool parallel) {
+			std::iota(indices, indices + size, int64_t(0));
+			const auto less = [values](int64_t a, int64_t b) {
+				return Less()(values[a], values[b]);
+			};
+
+			if (parallel) {
+				parallelSort(indices, size, less, [&less](int64_t *run, int64_t count) {
+					std::stable_sort(run, run + count, less);
+				});
+			} else {
+				std::stable_sort(indices, indices + size, less);
+			}
+		}
+	} // namespace detail::sort
+
+	/// Sort an array in place along one axis. NaN values are placed at the end of each line.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param array The array to sort
+	/// \param axis The axis to sort along. Negative values count back from the last axis.
+	/// \throws std::runtime_error if the axis is out of range
+	template<typename ShapeType, typename StorageType>
+	void sort(array::ArrayContainer<ShapeType, StorageType> &array, int64_t axis = -1) {
+		using Scalar = typename StorageType::Scalar;
+		detail::sort::assertSortable<StorageType>();
+
+		const detail::sort::Lines lines = detail::sort::lines(array.shape(), axis);
+		const bool withinLines			= detail::sort::parallelWithinLines(lines);
+		detail::sort::forEachLine(array.storage().begin(),
+								  lines,
+								  !withinLines && detail::sort::parallelLines(lines),
+								  [&lines, withinLines](Scalar *line, int64_t) {
+									  detail::sort::sortLine(line, lines.extent, withinLines);
+								  });
+	}
+
+	/// Return the indices which would sort an array along one axis. Equal values keep their
+	/// original order, and NaN values are placed last.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param array The array
+	/// \param axis The axis to sort along. Negative values count back from the last axis.
+	/// \return An array with the same shape as \p array, where each line along \p axis holds
+	/// the indices of the sorted elements of the corresponding line of \p array
+	/// \throws std::runtime_error if the axis is out of range
+	template<typename ShapeType, typename StorageType>
+	auto argsort(const array::ArrayContainer<ShapeType, StorageType> &array, int64_t axis = -1)
+	  -> array::ArrayContainer<ShapeType, Storage<int64_t>> {
+		using Scalar = typename StorageType::Scalar;
+		detail::sort::assertSortable<StorageType>();
+
+		const detail::sort::Lines lines = detail::sort::lines(array.shape(), axis);
+		const bool withinLines			= detail::sort::parallelWithinLines(lines);
+		array::ArrayContainer<ShapeType, Storage<int64_t>> result(array.shape());
+		int64_t *indices = result.storage().begin();
+
+		detail::sort::forEachLine(
+		  array.storage().begin(),
+		  lines,
+		  !withinLines && detail::sort::parallelLines(lines),
+		  [&lines, withinLines, indices](const Scalar *line, int64_t index) {
+			  if (lines.inner == 1) {
+				  detail::sort::argsortLine(
+					line, indices + index * lines.extent, lines.extent, withinLines);
+				  return;
+			  }
+
+			  std::vector<int64_t> order(lines.extent);
+			  detail::sort::argsortLine(line, order.data(), lines.extent, withinLines);
+			  int64_t *start = indices + lines.start(index);
+			  for (int64_t i = 0; i < lines.extent; ++i) start[i * lines.inner] = order[i];
+		  });
+		return result;
+	}
+
+	/// Partially sort an array along one axis, so the element at position \p n of each line is
+	/// the one which would be there if the line were sorted. Every element before it is not
+	/// greater, and every element after it is not less. NaN values are treated as the largest.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param array The array to partition
+	/// \param n The position of the selected element in each line
+	/// \param axis The axis to partition along. Negative values count back from the last axis.
+	/// \throws std::runtime_error if the axis or \p n is out of range
+	template<typename ShapeType, typename StorageType>
+	void nthElement(array::ArrayContainer<ShapeType, StorageType> &array, int64_t n,
+					int64_t axis = -1) {
+		using Scalar = typename StorageType::Scalar;
+		detail::sort::assertSortable<StorageType>();
+
+		const detail::sort::Lines lines = detail::sort::lines(array.shape(), axis);
+		if (n < 0 || n >= lines.extent) {
+			throw std::runtime_error(
+			  fmt::format("Cannot select element {} of a line of length {}", n, lines.extent));
+		}
+
+		detail::sort::forEachLine(array.storage().begin(),
+								  lines,
+								  detail::sort::parallelLines(lines),
+								  [&lines, n](Scalar *line, int64_t) {
+									  std::nth_element(
+										line, line + n, line + lines.extent, detail::sort::Less());
+								  });
+	}
+
+	/// Find the \p k largest (or smallest) elements of each line of an array along one axis.
+	/// NaN values are treated as the largest. Equal values are ordered by their index.
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param array The array
+	/// \param k The number of elements to find in each line
+	/// \param axis The axis to search along. Negative values count back from the last axis.
+	/// \param largest True to find the largest elements, false to find the smallest
+	/// \return The values and the indices of the elements, in order from the largest (or
+	/// smallest). Both have the shape of \p array, with \p k elements along \p axis.
+	/// \throws std::runtime_error if the axis or \p k is out of range
+	template<typename ShapeType, typename StorageType>
+	auto topk(const array::ArrayContainer<ShapeType, StorageType> &array, int64_t k,
+			  int64_t axis = -1, bool largest = true)
+	  -> std::pair<array::ArrayContainer<ShapeType, Storage<typename StorageType::Scalar>>,
+				   array::ArrayContainer<ShapeType, Storage<int64_t>>> {
+		using Scalar = typename StorageType::Scalar;
+		detail::sort::assertSortable<StorageType>();
+
+		const detail::sort::Lines lines = detail::sort::lines(array.shape(), axis);
+		if (k < 0 || k > lines.extent) {
+			throw std::runtime_error(fmt::format(
+			  "Cannot find {} elements in a line of length {}", k, lines.extent));
+		}
+
+		ShapeType shape = array.shape();
+		shape[static_cast<int64_t>(axis < 0 ? axis + shape.ndim() : axis)] = k;
+		array::ArrayContainer<ShapeType, Storage<Scalar>> values(shape);
+		array::ArrayContainer<ShapeType, Storage<int64_t>> indices(shape);
+		const detail::sort::Lines outLines {lines.count, k, lines.inner};
+		Scalar *outValues	= values.storage().begin();
+		int64_t *outIndices = indices.storage().begin();
+
+		detail::sort::forEachLine(
+		  array.storage().begin(),
+		  lines,
+		  detail::sort::parallelLines(lines),
+		  [&](const Scalar *line, int64_t index) {
+			  const auto before = [line, largest](int64_t a, int64_t b) {
+				  const detail::sort::Less less;
+				  if (less(line[a], line[b])) return !largest;
+				  if (less(line[b], line[a])) return largest;
+				  return a < b;
+			  };
+
+			  std::vector<int64_t> order(lines.extent);
+			  std::iota(order.begin(), order.end(), int64_t(0));
+			  std::nth_element(order.begin(), order.begin() + k, order.end(), before);
+			  std::sort(order.begin(), order.begin() + k, before);
+
+			  const int64_t start = outLines.start(index);
+			  for (int64_t i = 0; i < k; ++i) {
+				  outValues[start + i * lines.inner]  = line[order[i]];
+				  outIndices[start + i * lines.inner] = order[i];
+			  }
+		  });
+		return {std::move(values), std::move(indices)};
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_SORT_HPP
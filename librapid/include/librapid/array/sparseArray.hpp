@@ -0,0 +1,634 @@
+#ifndef LIBRAPID_ARRAY_SPARSE_ARRAY_HPP
+#define LIBRAPID_ARRAY_SPARSE_ARRAY_HPP
+
+/*
+ * Sparse matrices, stored in compressed sparse row (CSR) or compressed sparse column (CSC)
+ * layout.
+ *
+ * A CSR matrix stores the column indices and values of the nonzero elements of each row,
+ * sorted by column. Row i occupies the elements [offsets[i], offsets[i + 1]), so there is one
+ * more offset than there are rows. A CSC matrix is the same with rows and columns swapped,
+ * which is also the CSR layout of its transpose. Products with dense vectors and matrices are
+ * computed by the cxxblas sparse kernels.
+ */
+
+namespace librapid {
+	/// The order in which the nonzero elements of a SparseArray are stored
+	enum class SparseLayout {
+		CSR, // Compressed sparse row: elements are grouped by row
+		CSC	 // Compressed sparse column: elements are grouped by column
+	};
+
+	namespace detail::sparse {
+		/// A point on the merge path of a CSR matrix. The path merges the row end offsets with
+		/// the element indices, so moving along it either finishes a row or consumes an element.
+		/// Every row before \p row, and every element before \p element, has been consumed.
+		/// \tparam Index The type of the offsets and indices
+		template<typename Index>
+		struct PathCoordinate {
+			Index row;
+			Index element;
+		};
+
+		/// The points splitting the merge path of a CSR matrix into parts of equal length
+		template<typename Index>
+		using Partition = std::vector<PathCoordinate<Index>>;
+
+		/// Find the point at which the merge path of a CSR matrix crosses a diagonal, with a
+		/// binary search
+		/// \tparam Index The type of the offsets and indices
+		/// \param diagonal The diagonal (the number of rows plus elements consumed)
+		/// \param offsets The row offsets of the matrix
+		/// \param rows The number of rows
+		/// \param nnz The number of elements
+		/// \return The point on the path
+		template<typename Index>
+		PathCoordinate<Index> mergePathSearch(int64_t diagonal, const Index *offsets,
+											  int64_t rows, int64_t nnz) {
+			int64_t low	 = ::librapid::max(diagonal - nnz, int64_t(0));
+			int64_t high = ::librapid::min(diagonal, rows);
+			while (low < high) {
+				const int64_t pivot = (low + high) / 2;
+				if (static_cast<int64_t>(offsets[pivot + 1]) <= diagonal - pivot - 1) {
+					low = pivot + 1;
+				} else {
+					high = pivot;
+				}
+			}
+			return {static_cast<Index>(low), static_cast<Index>(diagonal - low)};
+		}
+
+		/// Split the work of multiplying a CSR matrix by a vector into \p parts parts, each of
+		/// which finishes the same number of rows plus elements. Unlike splitting the rows
+		/// evenly, this balances matrices whose rows have very different lengths, and very long
+		/// rows are shared between parts.
+		/// \tparam Index The type of the offsets and indices
+		/// \param offsets The row offsets of the matrix
+		/// \param rows The number of rows
+		/// \param parts The number of parts
+		/// \return The parts + 1 points splitting the merge path
+		template<typename Index>
+		Partition<Index> partition(const Index *offsets, int64_t rows, int64_t parts) {
+			const int64_t nnz	 = static_cast<int64_t>(offsets[rows]);
+			const int64_t length = rows + nnz;
+			Partition<Index> result(parts + 1);
+			for (int64_t part = 0; part <= parts; ++part) {
+				result[part] = mergePathSearch(length * part / parts, offsets, rows, nnz);
+			}
+			return result;
+		}
+
+		/// Compute the dot product of the elements [begin, end) of a CSR matrix with a dense
+		/// vector. The products are summed into one accumulator per packet lane, so the loads
+		/// from \p x can be compiled to gather instructions and the additions vectorised.
+		/// \tparam Scalar The type of the values
+		/// \tparam Index The type of the offsets and indices
+		/// \param indices The column indices of the matrix
+		/// \param values The values of the matrix
+		/// \param x The dense vector
+		/// \param begin The first element
+		/// \param end One past the last element
+		/// \return The dot product
+		template<typename Scalar, typename Index>
+		LIBRAPID_ALWAYS_INLINE Scalar gatherDot(const Index *indices, const Scalar *values,
+												const Scalar *x, Index begin, Index end) {
+			constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+			constexpr int64_t width		  = packetWidth > 1 ? packetWidth : 1;
+
+			std::array<Scalar, width> lanes;
+			lanes.fill(Scalar(0));
+			Index k = begin;
+			for (; k + width <= end; k += width) {
+				for (int64_t lane = 0; lane < width; ++lane) {
+					lanes[lane] += values[k + lane] * x[indices[k + lane]];
+				}
+			}
+
+			Scalar sum = Scalar(0);
+			for (; k < end; ++k) sum += values[k] * x[indices[k]];
+			for (int64_t lane = 0; lane < width; ++lane) sum += lanes[lane];
+			return sum;
+		}
+
+		/// Compute y = alpha * A * x + beta * y for the part of a CSR matrix A between two points
+		/// on its merge path. The last row of the part may be unfinished, in which case the sum
+		/// of its elements in this part is returned, and must be added to y (scaled by alpha)
+		/// once every part is complete.
+		/// \tparam Scalar The type of the values
+		/// \tparam Index The type of the offsets and indices
+		/// \param begin The start of the part
+		/// \param end The end of the part
+		/// \param offsets The row offsets of the matrix
+		/// \param indices The column indices of the matrix
+		/// \param values The values of the matrix
+		/// \param x The vector to multiply by
+		/// \param alpha The scale factor of the product
+		/// \param beta The scale factor of y
+		/// \param y The result
+		/// \return The partial sum of the unfinished row
+		template<typename Scalar, typename Index>
+		Scalar csrmvPart(PathCoordinate<Index> begin, PathCoordinate<Index> end,
+						 const Index *offsets, const Index *indices, const Scalar *values,
+						 const Scalar *x, const Scalar &alpha, const Scalar &beta, Scalar *y) {
+			const bool scale = beta != Scalar(0);
+			Index k			 = begin.element;
+			for (Index row = begin.row; row < end.row; ++row) {
+				const Index rowEnd = offsets[row + 1];
+				const Scalar sum   = alpha * gatherDot(indices, values, x, k, rowEnd);
+				y[row]			   = scale ? sum + beta * y[row] : sum;
+				k				   = rowEnd;
+			}
+			return gatherDot(indices, values, x, k, end.element);
+		}
+	} // namespace detail::sparse
+
+	/// A two-dimensional array which only stores its nonzero elements. Elements are grouped by
+	/// row (CSR) or by column (CSC), and sorted by their index within each group.
+	/// \tparam Scalar_ The type of the values
+	/// \tparam Index_ The signed integer type used for offsets and indices
+	template<typename Scalar_, typename Index_ = int32_t>
+	class SparseArray {
+	public:
+		using Scalar	   = Scalar_;
+		using Index		   = Index_;
+		using DenseType	   = Array<Scalar>;
+		using ShapeType	   = typename DenseType::ShapeType;
+		using IndexStorage = Storage<Index>;
+		using ValueStorage = Storage<Scalar>;
+
+		static_assert(std::is_integral_v<Index> && std::is_signed_v<Index>,
+					  "SparseArray indices must be signed integers");
+
+		/// Create an empty 0x0 CSR matrix
+		SparseArray() : SparseArray(0, 0) {}
+
+		/// Create a matrix of zeros
+		/// \param rows The number of rows
+		/// \param cols The number of columns
+		/// \param layout The layout of the matrix
+		SparseArray(size_t rows, size_t cols, SparseLayout layout = SparseLayout::CSR);
+
+		/// Create a matrix from coordinate (COO) triplets. The triplets may be in any order, and
+		/// the values of repeated coordinates are summed.
+		/// \param rows The number of rows
+		/// \param cols The number of columns
+		/// \param rowIndices The row of each value
+		/// \param colIndices The column of each value
+		/// \param values The values
+		/// \param layout The layout of the matrix
+		/// \return The matrix
+		/// \throws std::runtime_error if the triplets have different lengths, or an index is out
+		/// of range
+		static SparseArray fromTriplets(size_t rows, size_t cols,
+										const std::vector<Index> &rowIndices,
+										const std::vector<Index> &colIndices,
+										const std::vector<Scalar> &values,
+										SparseLayout layout = SparseLayout::CSR);
+
+		/// Create a matrix from the nonzero elements of a dense two-dimensional array
+		/// \param dense The dense array
+		/// \param layout The layout of the matrix
+		/// \return The matrix
+		/// \throws std::runtime_error if the array is not two-dimensional
+		static SparseArray fromDense(const DenseType &dense,
+									 SparseLayout layout = SparseLayout::CSR);
+
+		/// \return A dense array containing the elements of this matrix
+		LIBRAPID_NODISCARD DenseType toDense() const;
+
+		/// Return this matrix stored in another layout. Converting between CSR and CSC takes
+		/// O(nnz + rows + cols) time.
+		/// \param layout The layout of the result
+		/// \return The converted matrix
+		LIBRAPID_NODISCARD SparseArray toLayout(SparseLayout layout) const;
+
+		/// Return one element of the matrix. This performs a binary search of the row (or
+		/// column), so is not intended for iterating over the matrix.
+		/// \param row The row of the element
+		/// \param col The column of the element
+		/// \return The element, or zero if it is not stored
+		LIBRAPID_NODISCARD Scalar get(size_t row, size_t col) const;
+
+		/// Multiply this matrix by a dense vector or matrix
+		/// \param x A vector with `cols()` elements, or a matrix with `cols()` rows
+		/// \return The product, with `rows()` elements or rows
+		/// \throws std::runtime_error if the shape of \p x does not match this matrix
+		LIBRAPID_NODISCARD DenseType dot(const DenseType &x) const;
+
+		/// Compute y = alpha * A * x + beta * y, where A is this matrix. Large CSR products with
+		/// vectors are computed on multiple threads, each of which is given the same number of
+		/// rows plus elements (see detail::sparse::partition).
+		/// \param x A vector with `cols()` elements, or a matrix with `cols()` rows
+		/// \param y The result, with `rows()` elements or rows, and the same number of columns as
+		/// \p x. Its contents are ignored if \p beta is zero.
+		/// \param alpha The scale factor of the product
+		/// \param beta The scale factor of \p y
+		/// \throws std::runtime_error if the shapes of \p x and \p y do not match this matrix
+		void dot(const DenseType &x, DenseType &y, const Scalar &alpha = Scalar(1),
+				 const Scalar &beta = Scalar(0)) const;
+
+		/// \return The number of rows
+		LIBRAPID_NODISCARD size_t rows() const noexcept { return m_rows; }
+
+		/// \return The number of columns
+		LIBRAPID_NODISCARD size_t cols() const noexcept { return m_cols; }
+
+		/// \return The shape of the matrix, {rows, cols}
+		LIBRAPID_NODISCARD ShapeType shape() const { return ShapeType({m_rows, m_cols}); }
+
+		/// \return The number of stored elements
+		LIBRAPID_NODISCARD size_t nnz() const noexcept { return m_values.size(); }
+
+		/// \return The layout of the matrix
+		LIBRAPID_NODISCARD SparseLayout layout() const noexcept { return m_layout; }
+
+		/// \return The offset of the first element of each row (CSR) or column (CSC), followed
+		/// by the number of stored elements
+		LIBRAPID_NODISCARD const IndexStorage &offsets() const noexcept { return m_offsets; }
+
+		/// \return The column (CSR) or row (CSC) index of each stored element
+		LIBRAPID_NODISCARD const IndexStorage &indices() const noexcept { return m_indices; }
+
+		/// \return The value of each stored element
+		LIBRAPID_NODISCARD const ValueStorage &values() const noexcept { return m_values; }
+
+	private:
+		/// \return The number of rows (CSR) or columns (CSC)
+		LIBRAPID_NODISCARD size_t majorSize() const noexcept {
+			return m_layout == SparseLayout::CSR ? m_rows : m_cols;
+		}
+
+		/// \return The number of columns (CSR) or rows (CSC)
+		LIBRAPID_NODISCARD size_t minorSize() const noexcept {
+			return m_layout == SparseLayout::CSR ? m_cols : m_rows;
+		}
+
+		/// Compute y = alpha * A * x + beta * y for vectors x and y
+		void spmv(const Scalar *x, Scalar *y, const Scalar &alpha, const Scalar &beta) const;
+
+		/// Return the merge path partition of a CSR matrix into \p parts parts
+		LIBRAPID_NODISCARD std::shared_ptr<const detail::sparse::Partition<Index>>
+		rowPartition(int64_t parts) const;
+
+		/// Compute Y = alpha * A * X + beta * Y for row-major matrices X and Y with \p n columns
+		void spmm(const Scalar *x, Scalar *y, size_t n, const Scalar &alpha,
+				  const Scalar &beta) const;
+
+		size_t m_rows = 0;
+		size_t m_cols = 0;
+		SparseLayout m_layout;
+		IndexStorage m_offsets;
+		IndexStorage m_indices;
+		ValueStorage m_values;
+
+		mutable std::shared_ptr<const detail::sparse::Partition<Index>> m_partition;
+	};
+
+	template<typename Scalar, typename Index>
+	SparseArray<Scalar, Index>::SparseArray(size_t rows, size_t cols, SparseLayout layout) :
+			m_rows(rows), m_cols(cols), m_layout(layout),
+			m_offsets((layout == SparseLayout::CSR ? rows : cols) + 1, Index(0)) {}
+
+	template<typename Scalar, typename Index>
+	auto SparseArray<Scalar, Index>::fromTriplets(size_t rows, size_t cols,
+												  const std::vector<Index> &rowIndices,
+												  const std::vector<Index> &colIndices,
+												  const std::vector<Scalar> &values,
+												  SparseLayout layout) -> SparseArray {
+		if (rowIndices.size() != values.size() || colIndices.size() != values.size()) {
+			throw std::runtime_error(
+			  fmt::format("Triplets must have the same length, but found {} rows, {} columns and "
+						  "{} values",
+						  rowIndices.size(),
+						  colIndices.size(),
+						  values.size()));
+		}
+
+		SparseArray result(rows, cols, layout);
+		const bool csr					= layout == SparseLayout::CSR;
+		const std::vector<Index> &major = csr ? rowIndices : colIndices;
+		const std::vector<Index> &minor = csr ? colIndices : rowIndices;
+		const size_t majorSize			= result.majorSize();
+		const size_t count				= values.size();
+
+		for (size_t i = 0; i < count; ++i) {
+			if (rowIndices[i] < 0 || static_cast<size_t>(rowIndices[i]) >= rows ||
+				colIndices[i] < 0 || static_cast<size_t>(colIndices[i]) >= cols) {
+				throw std::runtime_error(fmt::format(
+				  "Index ({}, {}) is out of range for a {}x{} matrix",
+				  rowIndices[i],
+				  colIndices[i],
+				  rows,
+				  cols));
+			}
+		}
+
+		// Counting sort of the triplets by their major index
+		IndexStorage &offsets = result.m_offsets;
+		for (size_t i = 0; i < count; ++i) ++offsets[major[i] + 1];
+		for (size_t i = 0; i < majorSize; ++i) offsets[i + 1] += offsets[i];
+
+		IndexStorage indices(count);
+		ValueStorage sorted(count);
+		std::vector<Index> next(offsets.begin(), offsets.begin() + majorSize);
+		for (size_t i = 0; i < count; ++i) {
+			const Index pos = next[major[i]]++;
+			indices[pos]	= minor[i];
+			sorted[pos]		= values[i];
+		}
+
+		// Sort each row (or column) by minor index, summing repeated elements. The elements are
+		// compacted in place, since the write position never passes the read position
+		std::vector<std::pair<Index, Scalar>> group;
+		Index out = 0;
+		for (size_t i = 0; i < majorSize; ++i) {
+			const Index begin = offsets[i];
+			const Index end	  = offsets[i + 1];
+			group.clear();
+			for (Index k = begin; k < end; ++k) group.emplace_back(indices[k], sorted[k]);
+			std::sort(group.begin(), group.end(), [](const auto &a, const auto &b) {
+				return a.first < b.first;
+			});
+
+			offsets[i] = out;
+			for (size_t k = 0; k < group.size(); ++k) {
+				if (k > 0 && group[k].first == group[k - 1].first) {
+					sorted[out - 1] += group[k].second;
+				} else {
+					indices[out] = group[k].first;
+					sorted[out]	 = group[k].second;
+					++out;
+				}
+			}
+		}
+		offsets[majorSize] = out;
+
+		indices.resize(static_cast<size_t>(out));
+		sorted.resize(static_cast<size_t>(out));
+		result.m_indices = std::move(indices);
+		result.m_values	 = std::move(sorted);
+		return result;
+	}
+
+	template<typename Scalar, typename Index>
+	auto SparseArray<Scalar, Index>::fromDense(const DenseType &dense, SparseLayout layout)
+	  -> SparseArray {
+		if (dense.ndim() != 2) {
+			throw std::runtime_error(fmt::format(
+			  "Only two-dimensional arrays can be made sparse, but the array has {} dimensions",
+			  dense.ndim()));
+		}
+
+		const size_t rows = dense.shape()[0];
+		const size_t cols = dense.shape()[1];
+		SparseArray result(rows, cols, layout);
+		const bool csr			 = layout == SparseLayout::CSR;
+		const size_t majorSize	 = result.majorSize();
+		const size_t minorSize	 = result.minorSize();
+		const size_t majorStride = csr ? cols : 1;
+		const size_t minorStride = csr ? 1 : cols;
+		const Scalar *data		 = dense.storage().begin();
+
+		for (size_t i = 0; i < majorSize; ++i) {
+			Index count = 0;
+			for (size_t j = 0; j < minorSize; ++j) {
+				if (data[i * majorStride + j * minorStride] != Scalar(0)) ++count;
+			}
+			result.m_offsets[i + 1] = result.m_offsets[i] + count;
+		}
+
+		const size_t nnz = static_cast<size_t>(result.m_offsets[majorSize]);
+		result.m_indices = IndexStorage(nnz);
+		result.m_values	 = ValueStorage(nnz);
+		size_t pos		 = 0;
+		for (size_t i = 0; i < majorSize; ++i) {
+			for (size_t j = 0; j < minorSize; ++j) {
+				const Scalar value = data[i * majorStride + j * minorStride];
+				if (value == Scalar(0)) continue;
+				result.m_indices[pos] = static_cast<Index>(j);
+				result.m_values[pos]  = value;
+				++pos;
+			}
+		}
+		return result;
+	}
+
+	template<typename Scalar, typename Index>
+	auto SparseArray<Scalar, Index>::toDense() const -> DenseType {
+		DenseType dense(shape(), Scalar(0));
+		const bool csr			 = m_layout == SparseLayout::CSR;
+		const size_t majorStride = csr ? m_cols : 1;
+		const size_t minorStride = csr ? 1 : m_cols;
+		Scalar *data			 = dense.storage().begin();
+
+		for (size_t i = 0; i < majorSize(); ++i) {
+			for (Index k = m_offsets[i]; k < m_offsets[i + 1]; ++k) {
+				data[i * majorStride + static_cast<size_t>(m_indices[k]) * minorStride] =
+				  m_values[k];
+			}
+		}
+		return dense;
+	}
+
+	template<typename Scalar, typename Index>
+	auto SparseArray<Scalar, Index>::toLayout(SparseLayout layout) const -> SparseArray {
+		if (layout == m_layout) return *this;
+
+		// Counting sort of the elements by their minor index. Visiting the elements in order of
+		// their major index leaves each group of the result sorted
+		SparseArray result(m_rows, m_cols, layout);
+		const size_t count	  = nnz();
+		IndexStorage &offsets = result.m_offsets;
+		for (size_t k = 0; k < count; ++k) ++offsets[m_indices[k] + 1];
+		for (size_t j = 0; j < minorSize(); ++j) offsets[j + 1] += offsets[j];
+
+		result.m_indices = IndexStorage(count);
+		result.m_values	 = ValueStorage(count);
+		std::vector<Index> next(offsets.begin(), offsets.begin() + minorSize());
+		for (size_t i = 0; i < majorSize(); ++i) {
+			for (Index k = m_offsets[i]; k < m_offsets[i + 1]; ++k) {
+				const Index pos		  = next[m_indices[k]]++;
+				result.m_indices[pos] = static_cast<Index>(i);
+				result.m_values[pos]  = m_values[k];
+			}
+		}
+		return result;
+	}
+
+	template<typename Scalar, typename Index>
+	auto SparseArray<Scalar, Index>::get(size_t row, size_t col) const -> Scalar {
+		LIBRAPID_ASSERT(row < m_rows && col < m_cols,
+						"Index ({}, {}) is out of range for a {}x{} matrix",
+						row,
+						col,
+						m_rows,
+						m_cols);
+
+		const bool csr	   = m_layout == SparseLayout::CSR;
+		const size_t major = csr ? row : col;
+		const Index minor  = static_cast<Index>(csr ? col : row);
+		const Index *begin = m_indices.begin() + m_offsets[major];
+		const Index *end   = m_indices.begin() + m_offsets[major + 1];
+		const Index *found = std::lower_bound(begin, end, minor);
+		if (found == end || *found != minor) return Scalar(0);
+		return m_values[static_cast<size_t>(found - m_indices.begin())];
+	}
+
+	template<typename Scalar, typename Index>
+	auto SparseArray<Scalar, Index>::dot(const DenseType &x) const -> DenseType {
+		if (x.ndim() == 1) {
+			DenseType y(ShapeType({m_rows}));
+			dot(x, y);
+			return y;
+		}
+
+		if (x.ndim() != 2) {
+			throw std::runtime_error(fmt::format(
+			  "Sparse matrices can only be multiplied by vectors or matrices, not by an array "
+			  "with {} dimensions",
+			  x.ndim()));
+		}
+
+		DenseType y(ShapeType({m_rows, static_cast<size_t>(x.shape()[1])}));
+		dot(x, y);
+		return y;
+	}
+
+	template<typename Scalar, typename Index>
+	void SparseArray<Scalar, Index>::dot(const DenseType &x, DenseType &y, const Scalar &alpha,
+										 const Scalar &beta) const {
+		const bool vector = x.ndim() == 1 && y.ndim() == 1;
+		const bool matrix = x.ndim() == 2 && y.ndim() == 2 && x.shape()[1] == y.shape()[1];
+		if ((!vector && !matrix) || x.shape()[0] != m_cols || y.shape()[0] != m_rows) {
+			throw std::runtime_error(fmt::format(
+			  "Cannot multiply a {}x{} sparse matrix by an array of shape {} into an array of "
+			  "shape {}",
+			  m_rows,
+			  m_cols,
+			  x.shape().str(),
+			  y.shape().str()));
+		}
+
+		if (vector) {
+			spmv(x.storage().begin(), y.storage().begin(), alpha, beta);
+		} else {
+			spmm(x.storage().begin(), y.storage().begin(), x.shape()[1], alpha, beta);
+		}
+	}
+
+	template<typename Scalar, typename Index>
+	void SparseArray<Scalar, Index>::spmv(const Scalar *x, Scalar *y, const Scalar &alpha,
+										  const Scalar &beta) const {
+		// The elements of a CSC matrix are the CSR elements of its transpose
+		if (m_layout == SparseLayout::CSC) {
+			cxxblas::gecrsmv(cxxblas::Trans,
+							 static_cast<Index>(m_cols),
+							 static_cast<Index>(m_rows),
+							 alpha,
+							 m_values.begin(),
+							 m_offsets.begin(),
+							 m_indices.begin(),
+							 x,
+							 beta,
+							 y);
+			return;
+		}
+
+		const Index *offsets = m_offsets.begin();
+		const Index *indices = m_indices.begin();
+		const Scalar *values = m_values.begin();
+		const int64_t rows	 = static_cast<int64_t>(m_rows);
+		const int64_t work	 = rows + static_cast<int64_t>(nnz());
+		if (global::numThreads < 2 || work < global::multithreadThreshold) {
+			detail::sparse::csrmvPart<Scalar, Index>({0, 0},
+													 {static_cast<Index>(rows), m_offsets[rows]},
+													 offsets,
+													 indices,
+													 values,
+													 x,
+													 alpha,
+													 beta,
+													 y);
+			return;
+		}
+
+		const auto partition = rowPartition(global::numThreads);
+		const int64_t parts	 = static_cast<int64_t>(partition->size()) - 1;
+		std::vector<Scalar> carries(parts);
+
+#pragma omp parallel for shared(parts, partition, offsets, indices, values, x, alpha, beta, y,     \
+  carries) default(none) num_threads(global::numThreads)
+		for (int64_t part = 0; part < parts; ++part) {
+			carries[part] = detail::sparse::csrmvPart((*partition)[part],
+													  (*partition)[part + 1],
+													  offsets,
+													  indices,
+													  values,
+													  x,
+													  alpha,
+													  beta,
+													  y);
+		}
+
+		// Add the sums of the rows which were shared between parts. Each row is finished (and
+		// y scaled by beta) by the last part containing it, so this must happen afterwards
+		for (int64_t part = 0; part < parts; ++part) {
+			const Index row = (*partition)[part + 1].row;
+			if (row < rows) y[row] += alpha * carries[part];
+		}
+	}
+
+	template<typename Scalar, typename Index>
+	auto SparseArray<Scalar, Index>::rowPartition(int64_t parts) const
+	  -> std::shared_ptr<const detail::sparse::Partition<Index>> {
+		// The partition only depends on the offsets, so it is computed once and reused for
+		// every product with the same number of threads. Copies of the matrix share it
+		auto partition = std::atomic_load(&m_partition);
+		if (partition && static_cast<int64_t>(partition->size()) == parts + 1) return partition;
+
+		partition = std::make_shared<const detail::sparse::Partition<Index>>(
+		  detail::sparse::partition(m_offsets.begin(), static_cast<int64_t>(m_rows), parts));
+		std::atomic_store(&m_partition, partition);
+		return partition;
+	}
+
+	template<typename Scalar, typename Index>
+	void SparseArray<Scalar, Index>::spmm(const Scalar *x, Scalar *y, size_t n,
+										  const Scalar &alpha, const Scalar &beta) const {
+		// cxxblas multiplies column-major matrices, so X and Y are transposed into temporary
+		// buffers, where each column is contiguous
+		std::vector<Scalar> xT(m_cols * n);
+		std::vector<Scalar> yT(m_rows * n, Scalar(0));
+		for (size_t i = 0; i < m_cols; ++i) {
+			for (size_t j = 0; j < n; ++j) xT[j * m_cols + i] = x[i * n + j];
+		}
+		if (beta != Scalar(0)) {
+			for (size_t i = 0; i < m_rows; ++i) {
+				for (size_t j = 0; j < n; ++j) yT[j * m_rows + i] = y[i * n + j];
+			}
+		}
+
+		const Index rows = static_cast<Index>(m_rows);
+		const Index cols = static_cast<Index>(m_cols);
+		const bool csr	 = m_layout == SparseLayout::CSR;
+		cxxblas::gecrsmm(csr ? cxxblas::NoTrans : cxxblas::Trans,
+						 csr ? rows : cols,
+						 static_cast<Index>(n),
+						 csr ? cols : rows,
+						 alpha,
+						 m_values.begin(),
+						 m_offsets.begin(),
+						 m_indices.begin(),
+						 xT.data(),
+						 cols,
+						 beta,
+						 yT.data(),
+						 rows);
+
+		for (size_t i = 0; i < m_rows; ++i) {
+			for (size_t j = 0; j < n; ++j) y[i * n + j] = yT[j * m_rows + i];
+		}
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_SPARSE_ARRAY_HPP
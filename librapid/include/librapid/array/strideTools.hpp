@@ -9,7 +9,7 @@ namespace librapid {
 	/// \tparam T The type of the Stride. Must be an integer type.
 	/// \tparam N The number of dimensions in the Stride.
 	/// \see Shape
-	template<typename T = size_t, size_t N = 32>
+	template<typename T = size_t, size_t N = LIBRAPID_MAX_ARRAY_DIMS>
 	class Stride : public Shape<T, N> {
 	public:
 		/// Default Constructor
@@ -36,6 +36,13 @@ namespace librapid {
 		/// Move a Stride object to this Stride object.
 		/// \param other The Stride object to move.
 		Stride &operator=(Stride &&other) noexcept = default;
+
+		/// Return the strides of a range of dimensions. Unlike Shape::subshape, the result is a
+		/// Stride, so the values are kept as they are rather than being treated as a Shape.
+		/// \param start Starting index
+		/// \param end Ending index
+		/// \return The strides of dimensions \p start to \p end
+		LIBRAPID_NODISCARD Stride subshape(size_t start, size_t end) const;
 	};
 
 	template<typename T, size_t N>
@@ -50,6 +57,14 @@ namespace librapid {
 		tmp[this->m_dims - 1] = 1;
 		for (size_t i = this->m_dims - 1; i > 0; --i) tmp[i - 1] = tmp[i] * this->m_data[i];
 		for (size_t i = 0; i < this->m_dims; ++i) this->m_data[i] = tmp[i];
+		this->m_size = this->computeSize();
+	}
+
+	template<typename T, size_t N>
+	auto Stride<T, N>::subshape(size_t start, size_t end) const -> Stride {
+		Stride res;
+		static_cast<Shape<T, N> &>(res) = Shape<T, N>::subshape(start, end);
+		return res;
 	}
 } // namespace librapid
 
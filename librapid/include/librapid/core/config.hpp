@@ -234,8 +234,12 @@
 
 #include "cudaConfig.hpp"
 
+// Configuration Option: LIBRAPID_MAX_ARRAY_DIMS
+// The maximum number of dimensions of an Array. Shapes and strides are stored inline with
+// this many elements, so a smaller value makes every array and view smaller and cheaper to
+// copy.
 #ifndef LIBRAPID_MAX_ARRAY_DIMS
-#	define LIBRAPID_MAX_ARRAY_DIMS 32
+#	define LIBRAPID_MAX_ARRAY_DIMS 8
 #endif // LIBRAPID_MAX_ARRAY_DIMS
 
 // Configuration Option: LIBRAPID_OPTIMISE_SMALL_ARRAYS
@@ -6,11 +6,13 @@
 #include "debugTrap.hpp"
 #include "config.hpp"
 #include "global.hpp"
+#include "packet.hpp"
 #include "traits.hpp"
 #include "typetraits.hpp"
 #include "helperMacros.hpp"
 
 #include "forward.hpp"
+#include "cpuDispatch.hpp"
 
 // BLAS
 #include "cxxblas/cxxblas.h"
@@ -0,0 +1,120 @@
+#ifndef LIBRAPID_CORE_CPU_DISPATCH_HPP
+#define LIBRAPID_CORE_CPU_DISPATCH_HPP
+
+/*
+ * Runtime selection of SIMD kernels. The packet types used by the expression templates are fixed
+ * at compile time, so a binary built for a baseline CPU would never use wider instruction sets.
+ * The hot element-wise kernels are therefore compiled once for each supported instruction set
+ * (see "src/cpuDispatch.cpp"), and the best one the host CPU supports is selected the first time
+ * it is needed. Setting the LIBRAPID_SIMD environment variable to "generic", "sse4", "avx2" or
+ * "avx512" overrides the choice (it is still clamped to what the CPU supports).
+ */
+
+namespace librapid {
+	/// Instruction set levels which kernels can be dispatched to, in increasing order
+	enum class SimdLevel : int {
+		Generic = 0, /// Compiled with the flags used to build LibRapid
+		SSE4	= 1, /// SSE4.2
+		AVX2	= 2, /// AVX2 and FMA
+		AVX512	= 3	 /// AVX-512 (F, DQ, BW and VL)
+	};
+
+	/// Query the host CPU (with CPUID) and return the highest SIMD level it and the operating
+	/// system support, limited to the levels LibRapid was compiled with.
+	/// \return The highest supported SIMD level
+	LIBRAPID_NODISCARD SimdLevel detectSimdLevel();
+
+	/// Return the SIMD level currently used for dispatched kernels
+	/// \return The active SIMD level
+	LIBRAPID_NODISCARD SimdLevel simdLevel();
+
+	/// Select the SIMD level used for dispatched kernels. Levels the host CPU does not support are
+	/// clamped to the highest supported level.
+	/// \param level The requested SIMD level
+	/// \return The SIMD level which was actually selected
+	SimdLevel setSimdLevel(SimdLevel level);
+
+	/// Return a lowercase name for a SIMD level (e.g. "avx2")
+	/// \param level The SIMD level
+	/// \return The name of the level
+	LIBRAPID_NODISCARD const char *simdLevelName(SimdLevel level);
+
+	namespace detail::dispatch {
+		/// Element-wise operations with runtime-dispatched kernels
+		enum class BinaryOp { Add = 0, Sub = 1, Mul = 2, Div = 3 };
+
+		/// Evaluates as true if kernels are compiled for the scalar type \p T
+		template<typename T>
+		struct IsDispatchable : std::false_type {};
+
+		template<>
+		struct IsDispatchable<float> : std::true_type {};
+
+		template<>
+		struct IsDispatchable<double> : std::true_type {};
+
+		template<>
+		struct IsDispatchable<int32_t> : std::true_type {};
+
+		template<>
+		struct IsDispatchable<uint32_t> : std::true_type {};
+
+		template<>
+		struct IsDispatchable<int64_t> : std::true_type {};
+
+		template<>
+		struct IsDispatchable<uint64_t> : std::true_type {};
+
+		/// Maps an element-wise functor to its dispatched operation
+		/// \tparam Functor The functor type (e.g. detail::Plus)
+		template<typename Functor>
+		struct BinaryOpOf {
+			static constexpr bool supported = false;
+		};
+
+		template<>
+		struct BinaryOpOf<Plus> {
+			static constexpr bool supported = true;
+			static constexpr BinaryOp op	= BinaryOp::Add;
+		};
+
+		template<>
+		struct BinaryOpOf<Minus> {
+			static constexpr bool supported = true;
+			static constexpr BinaryOp op	= BinaryOp::Sub;
+		};
+
+		template<>
+		struct BinaryOpOf<Multiply> {
+			static constexpr bool supported = true;
+			static constexpr BinaryOp op	= BinaryOp::Mul;
+		};
+
+		template<>
+		struct BinaryOpOf<Divide> {
+			static constexpr bool supported = true;
+			static constexpr BinaryOp op	= BinaryOp::Div;
+		};
+
+		/// Compute dst[i] = lhs[i] op rhs[i] with the kernel for the active SIMD level. \p dst
+		/// may be equal to \p lhs or \p rhs, but must not partially overlap them.
+		/// \tparam T The scalar type
+		/// \param op The operation to perform
+		/// \param dst The output buffer
+		/// \param lhs The left-hand operand
+		/// \param rhs The right-hand operand
+		/// \param size The number of elements to process
+		template<typename T>
+		void binary(BinaryOp op, T *dst, const T *lhs, const T *rhs, int64_t size);
+
+		/// Compute dst[i] = lhs[i] op rhs
+		template<typename T>
+		void binary(BinaryOp op, T *dst, const T *lhs, T rhs, int64_t size);
+
+		/// Compute dst[i] = lhs op rhs[i]
+		template<typename T>
+		void binary(BinaryOp op, T *dst, T lhs, const T *rhs, int64_t size);
+	} // namespace detail::dispatch
+} // namespace librapid
+
+#endif // LIBRAPID_CORE_CPU_DISPATCH_HPP
@@ -11,6 +11,12 @@ namespace librapid {
 	template<typename Scalar_>
 	class CudaStorage;
 
+	template<typename Allocator_>
+	class BitStorage;
+
+	template<typename Scalar_>
+	class MappedStorage;
+
 	namespace array {
 		template<typename ShapeType_, typename StorageType_>
 		class ArrayContainer;
@@ -28,6 +34,12 @@ namespace librapid {
 		template<typename desc, typename Functor_, typename... Args>
 		class Function;
 
+		// Element-wise functors (defined in "operations.hpp")
+		struct Plus;
+		struct Minus;
+		struct Multiply;
+		struct Divide;
+
 		template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
 				 typename Functor_, typename... Args>
 		LIBRAPID_ALWAYS_INLINE void
@@ -52,12 +64,67 @@ namespace librapid {
 		  array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
 		  const detail::Function<descriptor::Trivial, Functor_, Args...> &function);
 
+		template<typename ShapeType_, typename StorageAllocator, typename Functor_,
+				 typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, BitStorage<StorageAllocator>> &lhs,
+			   const detail::Function<descriptor::Trivial, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageAllocator, typename Functor_,
+				 typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assignParallel(array::ArrayContainer<ShapeType_, BitStorage<StorageAllocator>> &lhs,
+					   const detail::Function<descriptor::Trivial, Functor_, Args...> &function);
+
+		template<typename Functor_, typename ShapeType_, typename StorageScalar,
+				 typename StorageAllocator, typename RHS>
+		LIBRAPID_ALWAYS_INLINE void assignInPlace(
+		  array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+		  const RHS &rhs);
+
+		template<typename Functor_, typename ShapeType_, typename StorageScalar,
+				 size_t... StorageSize, typename RHS>
+		LIBRAPID_ALWAYS_INLINE void assignInPlace(
+		  array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+		  const RHS &rhs);
+
+		template<typename Functor_, typename ShapeType_, typename StorageScalar,
+				 typename StorageAllocator, typename RHS>
+		LIBRAPID_ALWAYS_INLINE void assignInPlaceParallel(
+		  array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+		  const RHS &rhs);
+
+		template<typename ShapeType_, typename StorageScalar, typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, MappedStorage<StorageScalar>> &lhs,
+			   const detail::Function<descriptor::Trivial, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageScalar, typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assignParallel(array::ArrayContainer<ShapeType_, MappedStorage<StorageScalar>> &lhs,
+					   const detail::Function<descriptor::Trivial, Functor_, Args...> &function);
+
+		template<typename Functor_, typename ShapeType_, typename StorageScalar, typename RHS>
+		LIBRAPID_ALWAYS_INLINE void
+		assignInPlace(array::ArrayContainer<ShapeType_, MappedStorage<StorageScalar>> &lhs,
+					  const RHS &rhs);
+
+		template<typename Functor_, typename ShapeType_, typename StorageScalar, typename RHS>
+		LIBRAPID_ALWAYS_INLINE void
+		assignInPlaceParallel(array::ArrayContainer<ShapeType_, MappedStorage<StorageScalar>> &lhs,
+							  const RHS &rhs);
+
 #if defined(LIBRAPID_HAS_CUDA)
 		template<typename ShapeType_, typename StorageScalar, typename Functor_, typename... Args>
 		LIBRAPID_ALWAYS_INLINE void
 		assign(array::ArrayContainer<ShapeType_, CudaStorage<StorageScalar>> &lhs,
 			   const detail::Function<descriptor::Trivial, Functor_, Args...> &function);
 
+		template<typename Functor_, typename ShapeType_, typename StorageScalar, typename RHS>
+		LIBRAPID_ALWAYS_INLINE void
+		assignInPlace(array::ArrayContainer<ShapeType_, CudaStorage<StorageScalar>> &lhs,
+					  const RHS &rhs);
+
 #endif // LIBRAPID_HAS_CUDA
 	}  // namespace detail
 } // namespace librapid
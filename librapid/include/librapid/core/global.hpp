@@ -18,6 +18,17 @@ namespace librapid::global {
 
 	// Number of threads used by LibRapid
 	extern int64_t numThreads;
+
+	/// Arrays with more elements than this are printed with only their edges visible, and
+	/// "..." in place of the other elements. A negative value disables this
+	extern int64_t printThreshold;
+
+	/// Number of elements printed at each end of every dimension of an elided array
+	extern int64_t printEdgeItems;
+
+	/// Seed used by random number generation when no seed is given. This is initialised from
+	/// `std::random_device` at startup; assign to it to make results reproducible
+	extern uint64_t randomSeed;
 } // namespace librapid::global
 
 #endif // LIBRAPID_CORE_GLOBAL_HPP
\ No newline at end of file
@@ -13,12 +13,14 @@
 #include <array>
 #include <atomic>
 #include <cfloat>
+#include <charconv>
 #include <chrono>
 #include <cmath>
 #include <complex>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <cfloat>
 #include <fstream>
 #include <iomanip>
@@ -27,7 +29,10 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <random>
+#include <string_view>
 #include <utility>
 
 #if defined(LIBRAPID_HAS_OMP)
@@ -37,6 +42,11 @@
 #if defined(_WIN32) || defined(_WIN64)
 #	define WIN32_LEAN_AND_MEAN
 #	include <Windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
 #endif
 
 // Remove a few macros
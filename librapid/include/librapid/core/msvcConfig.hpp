@@ -3,6 +3,7 @@
 
 #define LIBRAPID_INLINE		   inline
 #define LIBRAPID_ALWAYS_INLINE inline __forceinline
+#define LIBRAPID_LAMBDA_INLINE [[msvc::forceinline]]
 
 #if defined(LIBRAPID_ENABLE_ASSERT)
 #	define LIBRAPID_STATUS(msg, ...)                                                              \
@@ -0,0 +1,315 @@
+#ifndef LIBRAPID_CORE_PACKET_HPP
+#define LIBRAPID_CORE_PACKET_HPP
+
+/*
+ * Packet types for scalars which Vc does not vectorise. They provide the subset of the
+ * Vc::Vector interface used by LibRapid's expression templates (load/store, broadcasting,
+ * arithmetic, bitwise operations and masked comparisons).
+ */
+
+namespace librapid::detail {
+	/// Mask returned by comparisons between Int64Packet objects
+	/// \tparam Width The number of lanes in the mask
+	template<size_t Width>
+	class Int64PacketMask {
+	public:
+		Int64PacketMask() = default;
+
+		/// Create a mask with every lane set to \p value
+		/// \param value The value of each lane
+		LIBRAPID_ALWAYS_INLINE explicit Int64PacketMask(bool value) {
+			for (size_t i = 0; i < Width; ++i) m_data[i] = value;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool operator[](size_t index) const {
+			return m_data[index];
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool &operator[](size_t index) {
+			return m_data[index];
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Int64PacketMask operator!() const {
+			Int64PacketMask res;
+			for (size_t i = 0; i < Width; ++i) res.m_data[i] = !m_data[i];
+			return res;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Int64PacketMask
+		operator&&(const Int64PacketMask &other) const {
+			Int64PacketMask res;
+			for (size_t i = 0; i < Width; ++i) res.m_data[i] = m_data[i] && other.m_data[i];
+			return res;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Int64PacketMask
+		operator||(const Int64PacketMask &other) const {
+			Int64PacketMask res;
+			for (size_t i = 0; i < Width; ++i) res.m_data[i] = m_data[i] || other.m_data[i];
+			return res;
+		}
+
+		/// \return True if every lane is set
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isFull() const {
+			bool res = true;
+			for (size_t i = 0; i < Width; ++i) res = res && m_data[i];
+			return res;
+		}
+
+		/// \return True if no lane is set
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isEmpty() const {
+			bool res = true;
+			for (size_t i = 0; i < Width; ++i) res = res && !m_data[i];
+			return res;
+		}
+
+		/// \return The lanes as a bitmask (lane i is bit i)
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE uint64_t toInt() const {
+			uint64_t res = 0;
+			for (size_t i = 0; i < Width; ++i) res |= static_cast<uint64_t>(m_data[i]) << i;
+			return res;
+		}
+
+	private:
+		bool m_data[Width];
+	};
+
+	/// A packet of 64-bit integers. Vc 1.x has no 64-bit integer vectors, so this holds one
+	/// register's worth of lanes (the same number as Vc::Vector<double>) and implements each
+	/// operation as a fixed-length loop. The compiler maps these loops onto native SIMD
+	/// instructions (e.g. vpaddq and vpcmpgtq with AVX2) and emulates the operations which have
+	/// no native instruction, such as multiplication without AVX-512DQ.
+	/// \tparam T int64_t or uint64_t
+	template<typename T>
+	class Int64Packet {
+	public:
+		static_assert(std::is_integral_v<T> && sizeof(T) == 8,
+					  "Int64Packet requires a 64-bit integer type");
+
+		using EntryType				 = T;
+		static constexpr size_t Size = Vc::Vector<double>::size();
+		using MaskType				 = Int64PacketMask<Size>;
+
+		Int64Packet() = default;
+
+		/// Broadcast a scalar to every lane
+		/// \param value The value to broadcast
+		LIBRAPID_ALWAYS_INLINE Int64Packet(T value) {
+			for (size_t i = 0; i < Size; ++i) m_data[i] = value;
+		}
+
+		/// \return The number of lanes in the packet
+		LIBRAPID_NODISCARD static constexpr size_t size() { return Size; }
+
+		/// Load Size elements from \p ptr (which need not be aligned)
+		/// \param ptr Pointer to the first element
+		LIBRAPID_ALWAYS_INLINE void load(const T *ptr) {
+			for (size_t i = 0; i < Size; ++i) m_data[i] = ptr[i];
+		}
+
+		/// Store the packet to \p ptr (which need not be aligned)
+		/// \param ptr Pointer to the first element
+		LIBRAPID_ALWAYS_INLINE void store(T *ptr) const {
+			for (size_t i = 0; i < Size; ++i) ptr[i] = m_data[i];
+		}
+
+		/// Set the lanes selected by \p mask to zero
+		/// \param mask The lanes to zero
+		LIBRAPID_ALWAYS_INLINE void setZero(const MaskType &mask) {
+			for (size_t i = 0; i < Size; ++i) m_data[i] = mask[i] ? T(0) : m_data[i];
+		}
+
+		/// Set every lane to zero
+		LIBRAPID_ALWAYS_INLINE void setZero() {
+			for (size_t i = 0; i < Size; ++i) m_data[i] = T(0);
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE T operator[](size_t index) const {
+			return m_data[index];
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE T &operator[](size_t index) {
+			return m_data[index];
+		}
+
+		/// \return The sum of all lanes
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE T sum() const {
+			T res = 0;
+			for (size_t i = 0; i < Size; ++i) res += m_data[i];
+			return res;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Int64Packet operator-() const {
+			Int64Packet res;
+			for (size_t i = 0; i < Size; ++i) res.m_data[i] = -m_data[i];
+			return res;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Int64Packet operator~() const {
+			Int64Packet res;
+			for (size_t i = 0; i < Size; ++i) res.m_data[i] = ~m_data[i];
+			return res;
+		}
+
+#define LIBRAPID_INT64_PACKET_BINARY_OP(OP_)                                                       \
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Int64Packet operator OP_(                     \
+	  const Int64Packet &lhs, const Int64Packet &rhs) {                                            \
+		Int64Packet res;                                                                           \
+		for (size_t i = 0; i < Size; ++i) res.m_data[i] = lhs.m_data[i] OP_ rhs.m_data[i];         \
+		return res;                                                                                \
+	}                                                                                              \
+                                                                                                   \
+	LIBRAPID_ALWAYS_INLINE Int64Packet &operator OP_##=(const Int64Packet & other) {               \
+		for (size_t i = 0; i < Size; ++i) m_data[i] = m_data[i] OP_ other.m_data[i];               \
+		return *this;                                                                              \
+	}
+
+#define LIBRAPID_INT64_PACKET_COMPARISON_OP(OP_)                                                   \
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend MaskType operator OP_(                        \
+	  const Int64Packet &lhs, const Int64Packet &rhs) {                                            \
+		MaskType res;                                                                              \
+		for (size_t i = 0; i < Size; ++i) res[i] = lhs.m_data[i] OP_ rhs.m_data[i];                \
+		return res;                                                                                \
+	}
+
+		LIBRAPID_INT64_PACKET_BINARY_OP(+)
+		LIBRAPID_INT64_PACKET_BINARY_OP(-)
+		LIBRAPID_INT64_PACKET_BINARY_OP(*)
+		LIBRAPID_INT64_PACKET_BINARY_OP(/)
+		LIBRAPID_INT64_PACKET_BINARY_OP(%)
+		LIBRAPID_INT64_PACKET_BINARY_OP(&)
+		LIBRAPID_INT64_PACKET_BINARY_OP(|)
+		LIBRAPID_INT64_PACKET_BINARY_OP(^)
+		LIBRAPID_INT64_PACKET_BINARY_OP(<<)
+		LIBRAPID_INT64_PACKET_BINARY_OP(>>)
+
+		LIBRAPID_INT64_PACKET_COMPARISON_OP(<)
+		LIBRAPID_INT64_PACKET_COMPARISON_OP(>)
+		LIBRAPID_INT64_PACKET_COMPARISON_OP(<=)
+		LIBRAPID_INT64_PACKET_COMPARISON_OP(>=)
+		LIBRAPID_INT64_PACKET_COMPARISON_OP(==)
+		LIBRAPID_INT64_PACKET_COMPARISON_OP(!=)
+
+#undef LIBRAPID_INT64_PACKET_BINARY_OP
+#undef LIBRAPID_INT64_PACKET_COMPARISON_OP
+
+	private:
+		alignas(sizeof(T) * Size) T m_data[Size];
+	};
+
+	/// Count the number of set bits in a 64-bit word
+	/// \param word The word to count the bits of
+	/// \return The number of set bits
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t popCount(uint64_t word) {
+#if defined(LIBRAPID_GNU) || defined(LIBRAPID_CLANG)
+		return __builtin_popcountll(word);
+#elif defined(LIBRAPID_MSVC) && defined(_M_X64)
+		return static_cast<int64_t>(__popcnt64(word));
+#else
+		word = word - ((word >> 1) & 0x5555555555555555ull);
+		word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+		word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+		return static_cast<int64_t>((word * 0x0101010101010101ull) >> 56);
+#endif
+	}
+
+	template<typename Word>
+	class BitPointer;
+
+	/// A packet of 64 booleans, stored as the bits of a single 64-bit word (lane i is bit i).
+	/// Logical operations process every lane with a single integer instruction.
+	class BitPacket {
+	public:
+		using EntryType				 = bool;
+		static constexpr size_t Size = 64;
+
+		BitPacket() = default;
+
+		/// Broadcast a boolean to every lane
+		/// \param value The value to broadcast
+		LIBRAPID_ALWAYS_INLINE BitPacket(bool value) : m_bits(value ? ~uint64_t(0) : 0) {}
+
+		/// Create a packet from its bits
+		/// \param bits The lanes of the packet
+		/// \return The new packet
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static BitPacket fromBits(uint64_t bits) {
+			BitPacket res;
+			res.m_bits = bits;
+			return res;
+		}
+
+		/// \return The number of lanes in the packet
+		LIBRAPID_NODISCARD static constexpr size_t size() { return Size; }
+
+		/// \return The lanes of the packet as a bitmask
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE uint64_t bits() const { return m_bits; }
+
+		/// Pack 64 (byte-sized) booleans from \p ptr
+		/// \param ptr Pointer to the first element
+		LIBRAPID_ALWAYS_INLINE void load(const bool *ptr) {
+			m_bits = 0;
+			for (size_t i = 0; i < Size; ++i) m_bits |= static_cast<uint64_t>(ptr[i]) << i;
+		}
+
+		/// Unpack the packet into 64 (byte-sized) booleans at \p ptr
+		/// \param ptr Pointer to the first element
+		LIBRAPID_ALWAYS_INLINE void store(bool *ptr) const {
+			for (size_t i = 0; i < Size; ++i) ptr[i] = (m_bits >> i) & 1;
+		}
+
+		/// Load the word of bit-packed storage referenced by \p ptr
+		/// \param ptr Pointer to the first element, which must be the first bit of a word
+		template<typename Word>
+		LIBRAPID_ALWAYS_INLINE void load(const BitPointer<Word> &ptr) {
+			LIBRAPID_ASSERT(ptr.bit() == 0, "BitPacket loads must be word-aligned");
+			m_bits = *ptr.word();
+		}
+
+		/// Store the packet into the word of bit-packed storage referenced by \p ptr
+		/// \param ptr Pointer to the first element, which must be the first bit of a word
+		template<typename Word>
+		LIBRAPID_ALWAYS_INLINE void store(const BitPointer<Word> &ptr) const {
+			LIBRAPID_ASSERT(ptr.bit() == 0, "BitPacket stores must be word-aligned");
+			*ptr.word() = m_bits;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool operator[](size_t index) const {
+			return (m_bits >> index) & 1;
+		}
+
+		/// \return The number of lanes which are set
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t count() const {
+			return popCount(m_bits);
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE BitPacket operator!() const {
+			return fromBits(~m_bits);
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE BitPacket operator~() const {
+			return fromBits(~m_bits);
+		}
+
+#define LIBRAPID_BIT_PACKET_BINARY_OP(OP_)                                                         \
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend BitPacket operator OP_(                       \
+	  const BitPacket &lhs, const BitPacket &rhs) {                                                \
+		return fromBits(lhs.m_bits OP_ rhs.m_bits);                                                \
+	}                                                                                              \
+                                                                                                   \
+	LIBRAPID_ALWAYS_INLINE BitPacket &operator OP_##=(const BitPacket & other) {                   \
+		m_bits OP_##= other.m_bits;                                                                \
+		return *this;                                                                              \
+	}
+
+		LIBRAPID_BIT_PACKET_BINARY_OP(&)
+		LIBRAPID_BIT_PACKET_BINARY_OP(|)
+		LIBRAPID_BIT_PACKET_BINARY_OP(^)
+
+#undef LIBRAPID_BIT_PACKET_BINARY_OP
+
+	private:
+		uint64_t m_bits;
+	};
+} // namespace librapid::detail
+
+#endif // LIBRAPID_CORE_PACKET_HPP
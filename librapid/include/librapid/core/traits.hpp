@@ -118,14 +118,14 @@ namespace librapid {
 		struct TypeInfo<bool> {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = bool;
-			using Packet							   = std::false_type;
+			using Packet							   = detail::BitPacket;
 			using Device							   = device::CPU;
-			static constexpr int64_t packetWidth	   = 1;
+			static constexpr int64_t packetWidth	   = Packet::size();
 			static constexpr char name[]			   = "char";
 			static constexpr bool supportsArithmetic   = false;
-			static constexpr bool supportsLogical	   = false;
+			static constexpr bool supportsLogical	   = true;
 			static constexpr bool supportsBinary	   = true;
-			static constexpr bool allowVectorisation   = false;
+			static constexpr bool allowVectorisation   = true;
 
 #if defined(LIBRAPID_HAS_CUDA)
 			static constexpr cudaDataType_t CudaType = cudaDataType_t::CUDA_R_8I;
@@ -349,14 +349,14 @@ namespace librapid {
 		struct TypeInfo<int64_t> {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = int64_t;
-			using Packet							   = std::false_type;
+			using Packet							   = detail::Int64Packet<int64_t>;
 			using Device							   = device::CPU;
-			static constexpr int64_t packetWidth	   = 1;
+			static constexpr int64_t packetWidth	   = Packet::size();
 			static constexpr char name[]			   = "int64_t";
 			static constexpr bool supportsArithmetic   = true;
 			static constexpr bool supportsLogical	   = true;
 			static constexpr bool supportsBinary	   = true;
-			static constexpr bool allowVectorisation   = false;
+			static constexpr bool allowVectorisation   = true;
 
 #if defined(LIBRAPID_HAS_CUDA)
 			static constexpr cudaDataType_t CudaType = cudaDataType_t::CUDA_R_64I;
@@ -379,14 +379,14 @@ namespace librapid {
 		struct TypeInfo<uint64_t> {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = uint64_t;
-			using Packet							   = std::false_type;
+			using Packet							   = detail::Int64Packet<uint64_t>;
 			using Device							   = device::CPU;
-			static constexpr int64_t packetWidth	   = 1;
+			static constexpr int64_t packetWidth	   = Packet::size();
 			static constexpr char name[]			   = "uint64_t";
 			static constexpr bool supportsArithmetic   = true;
 			static constexpr bool supportsLogical	   = true;
 			static constexpr bool supportsBinary	   = true;
-			static constexpr bool allowVectorisation   = false;
+			static constexpr bool allowVectorisation   = true;
 
 #if defined(LIBRAPID_HAS_CUDA)
 			static constexpr cudaDataType_t CudaType = cudaDataType_t::CUDA_R_64U;
@@ -10,6 +10,37 @@ namespace librapid {
 			return First * product<Rest...>();
 		}
 	}
+
+	namespace detail {
+		/// Loops with at most this many iterations are expanded by unrolledFor
+		constexpr int64_t unrollLimit = 64;
+
+		template<int64_t Begin, int64_t Step, typename Func, int64_t... I>
+		LIBRAPID_ALWAYS_INLINE void unrolledForImpl(Func &func,
+													std::integer_sequence<int64_t, I...>) {
+			(func(std::integral_constant<int64_t, Begin + I * Step>()), ...);
+		}
+
+		/// Call \p func(index) for index = Begin, Begin + Step, ... while index < End. When
+		/// there are at most unrollLimit iterations, the calls are expanded at compile time and
+		/// each index is passed as a std::integral_constant, so it can be used as a template
+		/// argument. Otherwise this is an ordinary loop over int64_t indices.
+		/// \tparam Begin The first index
+		/// \tparam End One past the last index
+		/// \tparam Step The distance between consecutive indices
+		/// \tparam Func The type of the function
+		/// \param func The function to call with each index
+		template<int64_t Begin, int64_t End, int64_t Step = 1, typename Func>
+		LIBRAPID_ALWAYS_INLINE void unrolledFor(Func &&func) {
+			static_assert(Step > 0, "The step must be positive");
+			constexpr int64_t count = End > Begin ? (End - Begin + Step - 1) / Step : 0;
+			if constexpr (count <= unrollLimit) {
+				unrolledForImpl<Begin, Step>(func, std::make_integer_sequence<int64_t, count>());
+			} else {
+				for (int64_t index = Begin; index < End; index += Step) func(index);
+			}
+		}
+	} // namespace detail
 } // namespace librapid
 
 #endif // LIBRAPID_MATH_COMPILE_TIME_HPP
\ No newline at end of file
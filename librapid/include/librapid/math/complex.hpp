@@ -842,6 +842,21 @@ namespace librapid {
 		return Complex<T>(val.real(), -val.imag());
 	}
 
+	/// \brief Multiply by the conjugate of a complex number
+	///
+	/// Compute `left * conj(right)` without negating the imaginary component of \p right first
+	///
+	/// \tparam T Scalar type of the complex numbers
+	/// \param left The complex number to multiply
+	/// \param right The complex number whose conjugate is used
+	/// \return left * conj(right)
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Complex<T> conjMultiply(const Complex<T> &left,
+																	  const Complex<T> &right) {
+		return Complex<T>(left.real() * right.real() + left.imag() * right.imag(),
+						  left.imag() * right.real() - left.real() * right.imag());
+	}
+
 	template<typename T>
 	LIBRAPID_NODISCARD Complex<T> acos(const Complex<T> &other) {
 		const T arcBig = T(0.25) * ::librapid::sqrt(typetraits::TypeInfo<T>::max());
@@ -1528,24 +1543,236 @@ namespace librapid {
 		return Complex<T>(::librapid::ceil(real(other)), ::librapid::ceil(imag(other)));
 	}
 
+	/// Return a random complex number whose real and imaginary components are uniformly
+	/// distributed between those of \p min and \p max. The components are variates 0 and 1 of
+	/// a single stream, so they are independent even when a seed is given.
+	/// \tparam T The type of the components
+	/// \param min The lower bounds of the components
+	/// \param max The upper bounds of the components
+	/// \param seed The seed, or -1 to use the global seed
+	/// \return A random complex number
+	/// \see random
 	template<typename T>
 	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Complex<T>
 	random(const Complex<T> &min, const Complex<T> &max, uint64_t seed = -1) {
-		return Complex<T>(::librapid::random(real(min), real(max), seed),
-						  ::librapid::random(imag(min), imag(max), seed));
+		const Philox generator = detail::randomGenerator(seed);
+		return Complex<T>(detail::randomUniform(generator, 0, real(min), real(max)),
+						  detail::randomUniform(generator, 1, imag(min), imag(max)));
 	}
 
+	namespace detail {
+		/// Packet type for complex numbers with float or double components. The real and
+		/// imaginary components are held in separate SIMD vectors, so multiplication and
+		/// division are computed lane-wise without shuffling components between lanes. Loads and
+		/// stores convert between this layout and the interleaved layout of Complex<T> in memory.
+		/// \tparam T The type of the components (float or double)
+		template<typename T>
+		class ComplexPacket {
+		public:
+			static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+						  "ComplexPacket requires float or double components");
+
+			using Scalar				 = Complex<T>;
+			using RealPacket			 = Vc::Vector<T>;
+			using EntryType				 = Scalar;
+			using MaskType				 = typename RealPacket::MaskType;
+			static constexpr size_t Size = RealPacket::size();
+
+			ComplexPacket() = default;
+
+			/// Broadcast a complex value to every lane
+			LIBRAPID_ALWAYS_INLINE ComplexPacket(const Scalar &value) :
+					m_real(value.real()), m_imag(value.imag()) {}
+
+			/// Broadcast a real value to every lane. The imaginary components are zero
+			LIBRAPID_ALWAYS_INLINE ComplexPacket(T value) : m_real(value), m_imag(T(0)) {}
+
+			/// Create a packet from its real and imaginary components
+			LIBRAPID_ALWAYS_INLINE ComplexPacket(const RealPacket &real, const RealPacket &imag) :
+					m_real(real), m_imag(imag) {}
+
+			/// \return The number of lanes in the packet
+			LIBRAPID_NODISCARD static constexpr size_t size() { return Size; }
+
+			/// Load Size values from \p ptr (which need not be aligned). The compiler turns the
+			/// strided copies into shuffles which separate the components.
+			/// \param ptr Pointer to the first element
+			LIBRAPID_ALWAYS_INLINE void load(const Scalar *ptr) {
+				alignas(RealPacket) T real[Size];
+				alignas(RealPacket) T imag[Size];
+				for (size_t i = 0; i < Size; ++i) {
+					real[i] = ptr[i].real();
+					imag[i] = ptr[i].imag();
+				}
+				m_real.load(real, Vc::Aligned);
+				m_imag.load(imag, Vc::Aligned);
+			}
+
+			/// Store the packet to \p ptr (which need not be aligned)
+			/// \param ptr Pointer to the first element
+			LIBRAPID_ALWAYS_INLINE void store(Scalar *ptr) const {
+				alignas(RealPacket) T real[Size];
+				alignas(RealPacket) T imag[Size];
+				m_real.store(real, Vc::Aligned);
+				m_imag.store(imag, Vc::Aligned);
+				for (size_t i = 0; i < Size; ++i) {
+					ptr[i].real(real[i]);
+					ptr[i].imag(imag[i]);
+				}
+			}
+
+			/// Set the lanes selected by \p mask to zero
+			LIBRAPID_ALWAYS_INLINE void setZero(const MaskType &mask) {
+				m_real.setZero(mask);
+				m_imag.setZero(mask);
+			}
+
+			/// Set every lane to zero
+			LIBRAPID_ALWAYS_INLINE void setZero() {
+				m_real.setZero();
+				m_imag.setZero();
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar operator[](size_t index) const {
+				return Scalar(m_real[index], m_imag[index]);
+			}
+
+			/// \return The real components
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const RealPacket &real() const {
+				return m_real;
+			}
+
+			/// \return The imaginary components
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const RealPacket &imag() const {
+				return m_imag;
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ComplexPacket operator-() const {
+				return ComplexPacket(-m_real, -m_imag);
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend ComplexPacket
+			operator+(const ComplexPacket &lhs, const ComplexPacket &rhs) {
+				return ComplexPacket(lhs.m_real + rhs.m_real, lhs.m_imag + rhs.m_imag);
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend ComplexPacket
+			operator-(const ComplexPacket &lhs, const ComplexPacket &rhs) {
+				return ComplexPacket(lhs.m_real - rhs.m_real, lhs.m_imag - rhs.m_imag);
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend ComplexPacket
+			operator*(const ComplexPacket &lhs, const ComplexPacket &rhs) {
+				return ComplexPacket(lhs.m_real * rhs.m_real - lhs.m_imag * rhs.m_imag,
+									 lhs.m_real * rhs.m_imag + lhs.m_imag * rhs.m_real);
+			}
+
+			/// Division with Smith's algorithm, as in Complex::operator/=. Each lane divides
+			/// by the larger component of the divisor, chosen with a mask rather than a branch.
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend ComplexPacket
+			operator/(const ComplexPacket &lhs, const ComplexPacket &rhs) {
+				const MaskType realIsLarger = Vc::abs(rhs.m_imag) < Vc::abs(rhs.m_real);
+				const RealPacket large		= Vc::iif(realIsLarger, rhs.m_real, rhs.m_imag);
+				const RealPacket small		= Vc::iif(realIsLarger, rhs.m_imag, rhs.m_real);
+				const RealPacket ratio		= small / large;
+				const RealPacket divisor	= large + ratio * small;
+
+				const RealPacket realScaled = lhs.m_real * ratio;
+				const RealPacket imagScaled = lhs.m_imag * ratio;
+				const RealPacket real =
+				  Vc::iif(realIsLarger, lhs.m_real + imagScaled, realScaled + lhs.m_imag);
+				const RealPacket imag =
+				  Vc::iif(realIsLarger, lhs.m_imag - realScaled, imagScaled - lhs.m_real);
+				return ComplexPacket(real / divisor, imag / divisor);
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend MaskType
+			operator==(const ComplexPacket &lhs, const ComplexPacket &rhs) {
+				return lhs.m_real == rhs.m_real && lhs.m_imag == rhs.m_imag;
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend MaskType
+			operator!=(const ComplexPacket &lhs, const ComplexPacket &rhs) {
+				return lhs.m_real != rhs.m_real || lhs.m_imag != rhs.m_imag;
+			}
+
+			/// \return The complex conjugate of each lane
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend ComplexPacket
+			conj(const ComplexPacket &val) {
+				return ComplexPacket(val.m_real, -val.m_imag);
+			}
+
+			/// \return lhs * conj(rhs) for each lane
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend ComplexPacket
+			conjMultiply(const ComplexPacket &lhs, const ComplexPacket &rhs) {
+				return ComplexPacket(lhs.m_real * rhs.m_real + lhs.m_imag * rhs.m_imag,
+									 lhs.m_imag * rhs.m_real - lhs.m_real * rhs.m_imag);
+			}
+
+			/// \return The squared magnitude of each lane
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend RealPacket
+			norm(const ComplexPacket &val) {
+				return val.m_real * val.m_real + val.m_imag * val.m_imag;
+			}
+
+			/// Like hypot, the larger component is factored out of the square root, so the
+			/// magnitude does not overflow or underflow when the squared magnitude would
+			/// \return The magnitude of each lane
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend RealPacket
+			abs(const ComplexPacket &val) {
+				const RealPacket real  = Vc::abs(val.m_real);
+				const RealPacket imag  = Vc::abs(val.m_imag);
+				const RealPacket large = Vc::max(real, imag);
+				const RealPacket small = Vc::min(real, imag);
+
+				// Equal components (including two zeros or two infinities) have a ratio of one
+				const RealPacket ratio = Vc::iif(large == small, RealPacket(T(1)), small / large);
+				return large * Vc::sqrt(RealPacket(T(1)) + ratio * ratio);
+			}
+
+			/// \return The phase angle of each lane
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend RealPacket
+			arg(const ComplexPacket &val) {
+				return Vc::atan2(val.m_imag, val.m_real);
+			}
+
+			/// \return The exponential of each lane
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend ComplexPacket
+			exp(const ComplexPacket &val) {
+				const RealPacket rho = Vc::exp(val.m_real);
+				return ComplexPacket(rho * Vc::cos(val.m_imag), rho * Vc::sin(val.m_imag));
+			}
+
+		private:
+			RealPacket m_real;
+			RealPacket m_imag;
+		};
+
+		/// True if complex numbers with components of type \p T are vectorised with
+		/// ComplexPacket
+		template<typename T>
+		constexpr bool complexHasPacket = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+		/// The packet type of complex numbers with components of type \p T
+		template<typename T>
+		using ComplexPacketType =
+		  std::conditional_t<complexHasPacket<T>, ComplexPacket<T>, std::false_type>;
+	} // namespace detail
+
 	namespace typetraits {
 		template<typename T>
 		struct TypeInfo<Complex<T>> {
-			detail::LibRapidType type				 = detail::LibRapidType::Scalar;
-			using Scalar							 = Complex<T>;
-			using Packet							 = std::false_type;
-			static constexpr int64_t packetWidth	 = 1;
-			static constexpr char name[]			 = "Complex";
-			static constexpr bool supportsArithmetic = true;
-			static constexpr bool supportsLogical	 = true;
-			static constexpr bool supportsBinary	 = false;
+			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
+			using Scalar							   = Complex<T>;
+			using Packet							   = detail::ComplexPacketType<T>;
+			using Device							   = device::CPU;
+			static constexpr int64_t packetWidth =
+			  detail::complexHasPacket<T> ? TypeInfo<T>::packetWidth : 1;
+			static constexpr char name[]			   = "Complex";
+			static constexpr bool supportsArithmetic   = true;
+			static constexpr bool supportsLogical	   = true;
+			static constexpr bool supportsBinary	   = false;
+			static constexpr bool allowVectorisation   = detail::complexHasPacket<T>;
 
 #if defined(LIBRAPID_HAS_CUDA)
 			static constexpr cudaDataType_t CudaType = cudaDataType_t::CUDA_C_64F;
@@ -1563,6 +1790,14 @@ namespace librapid {
 			LIMIT_IMPL(quietNaN) { return TypeInfo<T>::quietNaN(); }
 			LIMIT_IMPL(signalingNaN) { return TypeInfo<T>::signalingNaN(); }
 		};
+
+		/// Evaluates as true if the input type is a Complex number
+		/// \tparam T Input type
+		template<typename T>
+		struct IsComplex : std::false_type {};
+
+		template<typename T>
+		struct IsComplex<Complex<T>> : std::true_type {};
 	} // namespace typetraits
 } // namespace librapid
 
@@ -0,0 +1,431 @@
+#ifndef LIBRAPID_MATH_HALF_HPP
+#define LIBRAPID_MATH_HALF_HPP
+
+/*
+ * 16-bit floating point types. Values are stored in 16 bits but all arithmetic is performed in
+ * single precision -- each scalar operation converts its operands to float and rounds the result
+ * back to the nearest representable value (ties to even). Array expressions convert a whole
+ * packet at a time, using F16C or AVX-512 BF16 instructions when the compiler targets them, and a
+ * portable software conversion otherwise. They evaluate the whole expression in single precision
+ * and round once, when the result is stored.
+ */
+
+#if defined(__F16C__) || (defined(__AVX512BF16__) && defined(__AVX512VL__))
+#	include <immintrin.h>
+#endif
+
+namespace librapid {
+	namespace detail {
+		/// IEEE 754 binary16: 1 sign bit, 5 exponent bits and 10 mantissa bits
+		struct HalfFormat {
+			static constexpr char name[] = "half";
+
+			static constexpr uint16_t minBits		   = 0x0400;
+			static constexpr uint16_t maxBits		   = 0x7BFF;
+			static constexpr uint16_t epsilonBits	   = 0x1400;
+			static constexpr uint16_t roundErrorBits   = 0x3800;
+			static constexpr uint16_t denormMinBits	   = 0x0001;
+			static constexpr uint16_t infinityBits	   = 0x7C00;
+			static constexpr uint16_t quietNaNBits	   = 0x7E00;
+			static constexpr uint16_t signalingNaNBits = 0x7D00;
+
+			/// Convert a float to binary16, rounding to the nearest value (ties to even)
+			/// \param value The value to convert
+			/// \return The bits of the binary16 value
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static uint16_t fromFloat(float value) {
+				const uint32_t bits	   = bitCast<uint32_t>(value);
+				const uint32_t sign	   = (bits >> 16) & 0x8000;
+				const uint32_t absBits = bits & 0x7FFFFFFF;
+
+				// Infinity and NaN (keeping NaNs quiet)
+				if (absBits >= 0x7F800000) {
+					const uint32_t payload = 0x200 | ((absBits >> 13) & 0x3FF);
+					return static_cast<uint16_t>(sign | 0x7C00 |
+												 (absBits > 0x7F800000 ? payload : 0));
+				}
+
+				// Too large to represent -- round to infinity
+				if (absBits >= 0x47800000) return static_cast<uint16_t>(sign | 0x7C00);
+
+				// Subnormal result (or zero)
+				if (absBits < 0x38800000) {
+					if (absBits < 0x33000000) return static_cast<uint16_t>(sign);
+					const uint32_t exponent = absBits >> 23;
+					const uint32_t mantissa = (absBits & 0x7FFFFF) | 0x800000;
+					const uint32_t shift	= 126 - exponent;
+					const uint32_t halfway	= 1u << (shift - 1);
+					const uint32_t rem		= mantissa & ((1u << shift) - 1);
+					uint32_t result			= mantissa >> shift;
+					if (rem > halfway || (rem == halfway && (result & 1))) ++result;
+					return static_cast<uint16_t>(sign | result);
+				}
+
+				// Normal result. Rounding may carry into the exponent, which is correct
+				uint32_t result	   = (absBits - 0x38000000) >> 13;
+				const uint32_t rem = absBits & 0x1FFF;
+				if (rem > 0x1000 || (rem == 0x1000 && (result & 1))) ++result;
+				return static_cast<uint16_t>(sign | result);
+			}
+
+			/// Convert a binary16 value to float (this is always exact)
+			/// \param bits The bits of the binary16 value
+			/// \return The value as a float
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static float toFloat(uint16_t bits) {
+				const uint32_t sign		= static_cast<uint32_t>(bits & 0x8000) << 16;
+				const uint32_t exponent = (bits >> 10) & 0x1F;
+				const uint32_t mantissa = bits & 0x3FF;
+
+				if (exponent == 0x1F) {
+					// Infinity or NaN. NaNs are made quiet, as the F16C instructions do
+					const uint32_t quiet = mantissa ? 0x400000 : 0;
+					return bitCast<float>(sign | 0x7F800000 | quiet | (mantissa << 13));
+				}
+				if (exponent == 0) {
+					// Zero or subnormal -- the value is mantissa * 2^-24
+					const float value = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+					return sign ? -value : value;
+				}
+				return bitCast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+			}
+
+			/// Convert \p size binary16 values to floats
+			/// \param src Pointer to the binary16 bits
+			/// \param dst Pointer to the output floats
+			/// \param size Number of elements to convert
+			LIBRAPID_ALWAYS_INLINE static void toFloat(const uint16_t *src, float *dst,
+													   size_t size) {
+				size_t index = 0;
+#if defined(__F16C__)
+				for (; index + 8 <= size; index += 8) {
+					const __m128i packed =
+					  _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + index));
+					_mm256_storeu_ps(dst + index, _mm256_cvtph_ps(packed));
+				}
+#endif
+				for (; index < size; ++index) dst[index] = toFloat(src[index]);
+			}
+
+			/// Convert \p size floats to binary16, rounding to nearest (ties to even)
+			/// \param src Pointer to the floats
+			/// \param dst Pointer to the output binary16 bits
+			/// \param size Number of elements to convert
+			LIBRAPID_ALWAYS_INLINE static void fromFloat(const float *src, uint16_t *dst,
+														 size_t size) {
+				size_t index = 0;
+#if defined(__F16C__)
+				for (; index + 8 <= size; index += 8) {
+					const __m128i packed =
+					  _mm256_cvtps_ph(_mm256_loadu_ps(src + index), _MM_FROUND_TO_NEAREST_INT);
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + index), packed);
+				}
+#endif
+				for (; index < size; ++index) dst[index] = fromFloat(src[index]);
+			}
+		};
+
+		/// bfloat16: the upper 16 bits of an IEEE 754 binary32 value (1 sign bit, 8 exponent bits
+		/// and 7 mantissa bits)
+		struct BFloat16Format {
+			static constexpr char name[] = "bfloat16";
+
+			static constexpr uint16_t minBits		   = 0x0080;
+			static constexpr uint16_t maxBits		   = 0x7F7F;
+			static constexpr uint16_t epsilonBits	   = 0x3C00;
+			static constexpr uint16_t roundErrorBits   = 0x3F00;
+			static constexpr uint16_t denormMinBits	   = 0x0001;
+			static constexpr uint16_t infinityBits	   = 0x7F80;
+			static constexpr uint16_t quietNaNBits	   = 0x7FC0;
+			static constexpr uint16_t signalingNaNBits = 0x7FA0;
+
+			/// Convert a float to bfloat16, rounding to the nearest value (ties to even)
+			/// \param value The value to convert
+			/// \return The bits of the bfloat16 value
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static uint16_t fromFloat(float value) {
+				const uint32_t bits = bitCast<uint32_t>(value);
+				if ((bits & 0x7FFFFFFF) > 0x7F800000) {
+					return static_cast<uint16_t>((bits >> 16) | 0x40); // Keep NaNs quiet
+				}
+				return static_cast<uint16_t>((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+			}
+
+			/// Convert a bfloat16 value to float (this is always exact)
+			/// \param bits The bits of the bfloat16 value
+			/// \return The value as a float
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static float toFloat(uint16_t bits) {
+				return bitCast<float>(static_cast<uint32_t>(bits) << 16);
+			}
+
+			/// Convert \p size bfloat16 values to floats
+			/// \param src Pointer to the bfloat16 bits
+			/// \param dst Pointer to the output floats
+			/// \param size Number of elements to convert
+			LIBRAPID_ALWAYS_INLINE static void toFloat(const uint16_t *src, float *dst,
+													   size_t size) {
+				// A shift and a reinterpretation, which compilers vectorise without help
+				for (size_t index = 0; index < size; ++index) dst[index] = toFloat(src[index]);
+			}
+
+			/// Convert \p size floats to bfloat16, rounding to nearest (ties to even)
+			/// \param src Pointer to the floats
+			/// \param dst Pointer to the output bfloat16 bits
+			/// \param size Number of elements to convert
+			LIBRAPID_ALWAYS_INLINE static void fromFloat(const float *src, uint16_t *dst,
+														 size_t size) {
+				size_t index = 0;
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+				for (; index + 8 <= size; index += 8) {
+					const __m128bh packed = _mm256_cvtneps_pbh(_mm256_loadu_ps(src + index));
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + index),
+									 reinterpret_cast<const __m128i &>(packed));
+				}
+#endif
+				for (; index < size; ++index) dst[index] = fromFloat(src[index]);
+			}
+		};
+
+		/// A 16-bit floating point value which computes in single precision
+		/// \tparam Format The storage format (HalfFormat or BFloat16Format)
+		template<typename Format>
+		class Float16 {
+		public:
+			Float16() = default;
+
+			/// Construct from any arithmetic value, rounding to the nearest representable value
+			/// \tparam T The type of the value
+			/// \param value The value to convert
+			template<typename T, typename std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
+			LIBRAPID_ALWAYS_INLINE Float16(T value) :
+					m_bits(Format::fromFloat(static_cast<float>(value))) {}
+
+			/// Construct a value directly from its bit pattern
+			/// \param bits The bits of the value
+			/// \return The new value
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static constexpr Float16
+			fromBits(uint16_t bits) {
+				Float16 res(BitsTag {}, bits);
+				return res;
+			}
+
+			/// \return The bits of the value
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE constexpr uint16_t bits() const {
+				return m_bits;
+			}
+
+			/// Convert to any arithmetic type (via float)
+			template<typename T, typename std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE explicit operator T() const {
+				return static_cast<T>(Format::toFloat(m_bits));
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Float16 operator-() const {
+				return fromBits(m_bits ^ 0x8000);
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Float16 operator+() const { return *this; }
+
+#define LIBRAPID_FLOAT16_ARITHMETIC_OP(OP_)                                                        \
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Float16 operator OP_(const Float16 &lhs,      \
+																		  const Float16 &rhs) {    \
+		return Float16(static_cast<float>(lhs) OP_ static_cast<float>(rhs));                       \
+	}                                                                                              \
+                                                                                                   \
+	LIBRAPID_ALWAYS_INLINE Float16 &operator OP_##=(const Float16 & other) {                       \
+		*this = *this OP_ other;                                                                   \
+		return *this;                                                                              \
+	}
+
+#define LIBRAPID_FLOAT16_COMPARISON_OP(OP_)                                                        \
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend bool operator OP_(const Float16 &lhs,         \
+																	   const Float16 &rhs) {       \
+		return static_cast<float>(lhs) OP_ static_cast<float>(rhs);                                \
+	}
+
+			LIBRAPID_FLOAT16_ARITHMETIC_OP(+)
+			LIBRAPID_FLOAT16_ARITHMETIC_OP(-)
+			LIBRAPID_FLOAT16_ARITHMETIC_OP(*)
+			LIBRAPID_FLOAT16_ARITHMETIC_OP(/)
+
+			LIBRAPID_FLOAT16_COMPARISON_OP(<)
+			LIBRAPID_FLOAT16_COMPARISON_OP(>)
+			LIBRAPID_FLOAT16_COMPARISON_OP(<=)
+			LIBRAPID_FLOAT16_COMPARISON_OP(>=)
+			LIBRAPID_FLOAT16_COMPARISON_OP(==)
+			LIBRAPID_FLOAT16_COMPARISON_OP(!=)
+
+#undef LIBRAPID_FLOAT16_ARITHMETIC_OP
+#undef LIBRAPID_FLOAT16_COMPARISON_OP
+
+			/// Return a string representation of the value
+			/// \param format The format string used for the (float) value
+			/// \return The value as a string
+			LIBRAPID_NODISCARD std::string str(const std::string &format = "{}") const {
+				return fmt::format(format, static_cast<float>(*this));
+			}
+
+		private:
+			struct BitsTag {};
+			constexpr Float16(BitsTag, uint16_t bits) : m_bits(bits) {}
+
+			uint16_t m_bits;
+		};
+
+		/// Packet type for 16-bit floats. Values are widened to a Vc::Vector<float> on load,
+		/// computed in single precision, and rounded back to 16 bits on store. The tail of a loop
+		/// is evaluated as a partial packet (see loadPartial), so every element of an array
+		/// expression is rounded at the same point, wherever it falls in the loop.
+		/// \tparam Format The storage format (HalfFormat or BFloat16Format)
+		template<typename Format>
+		class Float16Packet {
+		public:
+			using Scalar				 = Float16<Format>;
+			using FloatPacket			 = Vc::Vector<float>;
+			using EntryType				 = Scalar;
+			using MaskType				 = typename FloatPacket::MaskType;
+			static constexpr size_t Size = FloatPacket::size();
+
+			Float16Packet() = default;
+
+			/// Broadcast a 16-bit value to every lane
+			LIBRAPID_ALWAYS_INLINE Float16Packet(const Scalar &value) :
+					m_data(static_cast<float>(value)) {}
+
+			/// Broadcast a (single precision) value to every lane
+			LIBRAPID_ALWAYS_INLINE Float16Packet(float value) : m_data(value) {}
+
+			/// Wrap a packet of floats
+			LIBRAPID_ALWAYS_INLINE Float16Packet(const FloatPacket &data) : m_data(data) {}
+
+			/// \return The number of lanes in the packet
+			LIBRAPID_NODISCARD static constexpr size_t size() { return Size; }
+
+			/// Load and widen Size values from \p ptr (which need not be aligned)
+			/// \param ptr Pointer to the first element
+			LIBRAPID_ALWAYS_INLINE void load(const Scalar *ptr) {
+				static_assert(sizeof(Scalar) == sizeof(uint16_t), "Invalid Float16 layout");
+				alignas(FloatPacket) float tmp[Size];
+				Format::toFloat(reinterpret_cast<const uint16_t *>(ptr), tmp, Size);
+				m_data.load(tmp, Vc::Aligned);
+			}
+
+			/// Round and store the packet to \p ptr (which need not be aligned)
+			/// \param ptr Pointer to the first element
+			LIBRAPID_ALWAYS_INLINE void store(Scalar *ptr) const {
+				alignas(FloatPacket) float tmp[Size];
+				m_data.store(tmp, Vc::Aligned);
+				Format::fromFloat(tmp, reinterpret_cast<uint16_t *>(ptr), Size);
+			}
+
+			/// Load and widen \p count values from \p ptr, setting the remaining lanes to zero
+			/// \param ptr Pointer to the first element
+			/// \param count The number of values to load (at most Size)
+			LIBRAPID_ALWAYS_INLINE void loadPartial(const Scalar *ptr, size_t count) {
+				alignas(FloatPacket) float tmp[Size] = {};
+				Format::toFloat(reinterpret_cast<const uint16_t *>(ptr), tmp, count);
+				m_data.load(tmp, Vc::Aligned);
+			}
+
+			/// Round and store the first \p count lanes of the packet to \p ptr
+			/// \param ptr Pointer to the first element
+			/// \param count The number of values to store (at most Size)
+			LIBRAPID_ALWAYS_INLINE void storePartial(Scalar *ptr, size_t count) const {
+				alignas(FloatPacket) float tmp[Size];
+				m_data.store(tmp, Vc::Aligned);
+				Format::fromFloat(tmp, reinterpret_cast<uint16_t *>(ptr), count);
+			}
+
+			/// Set the lanes selected by \p mask to zero
+			LIBRAPID_ALWAYS_INLINE void setZero(const MaskType &mask) { m_data.setZero(mask); }
+
+			/// Set every lane to zero
+			LIBRAPID_ALWAYS_INLINE void setZero() { m_data.setZero(); }
+
+			/// \return The widened values
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const FloatPacket &data() const {
+				return m_data;
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Float16Packet operator-() const {
+				return Float16Packet(-m_data);
+			}
+
+#define LIBRAPID_FLOAT16_PACKET_ARITHMETIC_OP(OP_)                                                 \
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Float16Packet operator OP_(                  \
+	  const Float16Packet &lhs, const Float16Packet &rhs) {                                        \
+		return Float16Packet(FloatPacket(lhs.m_data OP_ rhs.m_data));                              \
+	}
+
+#define LIBRAPID_FLOAT16_PACKET_COMPARISON_OP(OP_)                                                 \
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend MaskType operator OP_(                       \
+	  const Float16Packet &lhs, const Float16Packet &rhs) {                                        \
+		return lhs.m_data OP_ rhs.m_data;                                                          \
+	}
+
+			LIBRAPID_FLOAT16_PACKET_ARITHMETIC_OP(+)
+			LIBRAPID_FLOAT16_PACKET_ARITHMETIC_OP(-)
+			LIBRAPID_FLOAT16_PACKET_ARITHMETIC_OP(*)
+			LIBRAPID_FLOAT16_PACKET_ARITHMETIC_OP(/)
+
+			LIBRAPID_FLOAT16_PACKET_COMPARISON_OP(<)
+			LIBRAPID_FLOAT16_PACKET_COMPARISON_OP(>)
+			LIBRAPID_FLOAT16_PACKET_COMPARISON_OP(<=)
+			LIBRAPID_FLOAT16_PACKET_COMPARISON_OP(>=)
+			LIBRAPID_FLOAT16_PACKET_COMPARISON_OP(==)
+			LIBRAPID_FLOAT16_PACKET_COMPARISON_OP(!=)
+
+#undef LIBRAPID_FLOAT16_PACKET_ARITHMETIC_OP
+#undef LIBRAPID_FLOAT16_PACKET_COMPARISON_OP
+
+		private:
+			FloatPacket m_data;
+		};
+	} // namespace detail
+
+	/// IEEE 754 half precision floating point value
+	using half = detail::Float16<detail::HalfFormat>;
+
+	/// Brain floating point value (bfloat16)
+	using bfloat16 = detail::Float16<detail::BFloat16Format>;
+
+	namespace typetraits {
+		template<typename Format>
+		struct TypeInfo<detail::Float16<Format>> {
+			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
+			using Scalar							   = detail::Float16<Format>;
+			using Packet							   = detail::Float16Packet<Format>;
+			using Device							   = device::CPU;
+			static constexpr int64_t packetWidth	   = Packet::size();
+			static constexpr const char *name		   = Format::name;
+			static constexpr bool supportsArithmetic   = true;
+			static constexpr bool supportsLogical	   = true;
+			static constexpr bool supportsBinary	   = false;
+			static constexpr bool allowVectorisation   = true;
+
+#if defined(LIBRAPID_HAS_CUDA)
+			static constexpr cudaDataType_t CudaType =
+			  std::is_same_v<Format, detail::HalfFormat> ? cudaDataType_t::CUDA_R_16F
+														 : cudaDataType_t::CUDA_R_16BF;
+#endif
+
+			static constexpr bool canAlign	= true;
+			static constexpr bool canMemcpy = true;
+
+			LIMIT_IMPL_CONSTEXPR(min) { return Scalar::fromBits(Format::minBits); }
+			LIMIT_IMPL_CONSTEXPR(max) { return Scalar::fromBits(Format::maxBits); }
+			LIMIT_IMPL_CONSTEXPR(epsilon) { return Scalar::fromBits(Format::epsilonBits); }
+			LIMIT_IMPL_CONSTEXPR(roundError) { return Scalar::fromBits(Format::roundErrorBits); }
+			LIMIT_IMPL_CONSTEXPR(denormMin) { return Scalar::fromBits(Format::denormMinBits); }
+			LIMIT_IMPL_CONSTEXPR(infinity) { return Scalar::fromBits(Format::infinityBits); }
+			LIMIT_IMPL_CONSTEXPR(quietNaN) { return Scalar::fromBits(Format::quietNaNBits); }
+			LIMIT_IMPL_CONSTEXPR(signalingNaN) {
+				return Scalar::fromBits(Format::signalingNaNBits);
+			}
+		};
+	} // namespace typetraits
+} // namespace librapid
+
+// Support FMT printing
+#ifdef FMT_API
+LIBRAPID_SIMPLE_IO_IMPL(typename Format, librapid::detail::Float16<Format>)
+#endif // FMT_API
+
+#endif // LIBRAPID_MATH_HALF_HPP
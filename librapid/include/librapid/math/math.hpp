@@ -8,6 +8,9 @@
 #include "coreMath.hpp"
 #include "multiprec.hpp"
 #include "genericVector.hpp"
+#include "vecArray.hpp"
+#include "half.hpp"
+#include "random.hpp"
 // #include "simdVector.hpp"
 #include "complex.hpp"
 
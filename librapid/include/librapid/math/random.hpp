@@ -0,0 +1,491 @@
+#ifndef LIBRAPID_MATH_RANDOM_HPP
+#define LIBRAPID_MATH_RANDOM_HPP
+
+/*
+ * Counter-based random number generation. Every value produced by the Philox4x32-10
+ * generator is a pure function of a key (the seed), a stream identifier and a counter (the
+ * position in the stream), so any part of a stream can be generated without generating the
+ * values before it. Arrays can therefore be filled in parallel with results that do not depend
+ * on how the work is divided between threads, and large arrays can be generated in independent
+ * shards.
+ *
+ * See "Parallel Random Numbers: As Easy as 1, 2, 3" (Salmon et al., SC 2011).
+ */
+
+namespace librapid {
+	/// A Philox4x32-10 counter-based random number generator. Each call to `block` maps a
+	/// 64-bit counter onto four independent 32-bit words; word `n` of the stream is word
+	/// `n % 4` of block `n / 4`.
+	///
+	/// Variates are indexed rather than drawn: `uniform<T>(index)` always returns the same
+	/// value for a given generator and index, so skipping ahead is free. The generator also
+	/// satisfies the UniformRandomBitGenerator requirements, so it can be used with the
+	/// distributions in `<random>`.
+	class Philox {
+	public:
+		using result_type = uint32_t;
+		using Block		  = std::array<uint32_t, 4>;
+
+		/// Number of 32-bit words produced per counter value
+		static constexpr int64_t blockSize = 4;
+
+		/// Number of blocks generated together when filling a range of words. The rounds are
+		/// computed on all blocks of a batch at once so the compiler can vectorise them.
+		static constexpr int64_t batchSize = 8;
+
+		/// Create a generator from a seed and, optionally, a stream identifier. Generators with
+		/// the same seed and different streams produce independent sequences.
+		/// \param seed The seed (key) of the generator
+		/// \param stream The stream identifier
+		explicit Philox(uint64_t seed = 0, uint64_t stream = 0);
+
+		/// \return The seed of the generator
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE uint64_t seed() const;
+
+		/// \return The stream identifier of the generator
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE uint64_t stream() const;
+
+		/// \return The index of the next word returned by `operator()`
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE uint64_t position() const;
+
+		/// Compute the four words for a single counter value
+		/// \param counter The counter value
+		/// \return The generated block
+		LIBRAPID_NODISCARD Block block(uint64_t counter) const;
+
+		/// Write \p count consecutive words of the stream, starting at word \p first, to
+		/// \p dst
+		/// \param first The index of the first word
+		/// \param count The number of words to generate
+		/// \param dst The destination pointer
+		void words(uint64_t first, int64_t count, uint32_t *dst) const;
+
+		/// Return the uniformly distributed variate with a given index. Floating point
+		/// variates are in the range [0, 1) and use 24 (float) or 53 (double) random bits.
+		/// \tparam T The type of the variate (float or double)
+		/// \param index The index of the variate
+		/// \return The variate
+		template<typename T>
+		LIBRAPID_NODISCARD T uniform(uint64_t index) const;
+
+		/// Return the standard normally distributed variate with a given index, generated with
+		/// the Box-Muller transform
+		/// \tparam T The type of the variate (float or double)
+		/// \param index The index of the variate
+		/// \return The variate
+		template<typename T>
+		LIBRAPID_NODISCARD T normal(uint64_t index) const;
+
+		/// Return a packet of uniformly distributed variates. Lane `i` of the result is equal
+		/// to `uniform<T>(index + i)`.
+		/// \tparam T The scalar type of the packet (float or double)
+		/// \param index The index of the first variate
+		/// \return The packet of variates
+		template<typename T>
+		LIBRAPID_NODISCARD auto uniformPacket(uint64_t index) const ->
+		  typename typetraits::TypeInfo<T>::Packet;
+
+		/// Return a packet of standard normally distributed variates. Lane `i` of the result
+		/// uses the same random bits as `normal<T>(index + i)`, though the transcendental
+		/// functions are evaluated with SIMD instructions, so the results may differ in the
+		/// last bit.
+		/// \tparam T The scalar type of the packet (float or double)
+		/// \param index The index of the first variate
+		/// \return The packet of variates
+		template<typename T>
+		LIBRAPID_NODISCARD auto normalPacket(uint64_t index) const ->
+		  typename typetraits::TypeInfo<T>::Packet;
+
+		/// \return The smallest value returned by `operator()`
+		LIBRAPID_NODISCARD static constexpr result_type min() { return 0; }
+
+		/// \return The largest value returned by `operator()`
+		LIBRAPID_NODISCARD static constexpr result_type max() { return ~result_type(0); }
+
+		/// \return The next word in the stream
+		LIBRAPID_ALWAYS_INLINE result_type operator()();
+
+		/// Skip \p count words of the stream in constant time
+		/// \param count The number of words to skip
+		LIBRAPID_ALWAYS_INLINE void discard(uint64_t count);
+
+	private:
+		/// Write \p Count unit variates of type \p T, starting at variate \p index, to \p dst
+		template<typename T, int64_t Count>
+		void units(uint64_t index, T *dst) const;
+
+		/// Apply the ten Philox rounds to `Batch` counters at once
+		template<int64_t Batch>
+		LIBRAPID_ALWAYS_INLINE void rounds(uint64_t counter, uint32_t (&out)[Batch * 4]) const;
+
+		static constexpr uint32_t s_multiplier0 = 0xD2511F53;
+		static constexpr uint32_t s_multiplier1 = 0xCD9E8D57;
+		static constexpr uint32_t s_weyl0		= 0x9E3779B9;
+		static constexpr uint32_t s_weyl1		= 0xBB67AE85;
+
+		uint64_t m_seed;
+		uint64_t m_stream;
+		uint64_t m_position = 0;
+		Block m_buffer {};
+	};
+
+	namespace detail {
+		/// Number of 32-bit words consumed by one uniform variate of type \p T
+		template<typename T>
+		constexpr int64_t randomWordsPerVariate() {
+			if constexpr (std::is_integral_v<T>) {
+				return 2;
+			} else {
+				return sizeof(T) > sizeof(float) ? 2 : 1;
+			}
+		}
+
+		/// The floating point type used to generate variates of type \p T
+		template<typename T>
+		using RandomUnitType = std::conditional_t<randomWordsPerVariate<T>() == 2, double, float>;
+
+		/// Return a new, unique stream identifier. Unseeded random number generation draws from
+		/// a fresh stream each time so successive calls do not overlap.
+		/// \return The stream identifier
+		LIBRAPID_INLINE uint64_t nextRandomStream() {
+			static std::atomic<uint64_t> stream(0);
+			return stream.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		/// Return the generator to use for a given seed. A seed of -1 selects the global seed
+		/// and a fresh stream.
+		/// \param seed The seed
+		/// \return The generator
+		LIBRAPID_INLINE Philox randomGenerator(uint64_t seed) {
+			if (seed == static_cast<uint64_t>(-1)) {
+				return Philox(global::randomSeed, nextRandomStream());
+			}
+			return Philox(seed);
+		}
+
+		/// Multiply two 64-bit values
+		/// \param lhs The first value
+		/// \param rhs The second value
+		/// \param low Set to the low 64 bits of the product
+		/// \return The high 64 bits of the product
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE uint64_t multiplyWide(uint64_t lhs, uint64_t rhs,
+																		uint64_t &low) {
+			const uint64_t lhsLow = lhs & 0xFFFFFFFF, lhsHigh = lhs >> 32;
+			const uint64_t rhsLow = rhs & 0xFFFFFFFF, rhsHigh = rhs >> 32;
+			const uint64_t lowLow	= lhsLow * rhsLow;
+			const uint64_t highLow	= lhsHigh * rhsLow;
+			const uint64_t lowHigh	= lhsLow * rhsHigh;
+			const uint64_t highHigh = lhsHigh * rhsHigh;
+			const uint64_t middle	= (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+			low						= (middle << 32) | (lowLow & 0xFFFFFFFF);
+			return highHigh + (highLow >> 32) + (middle >> 32);
+		}
+
+		/// Return the 64-bit word used by attempt \p attempt at integer variate \p index.
+		/// The first attempt uses words 2 * index and 2 * index + 1 of the generator's stream.
+		/// Later attempts (which are rarely needed) use the same words of separate streams, so
+		/// every variate still depends only on its index.
+		/// \param generator The generator
+		/// \param index The index of the variate
+		/// \param attempt The attempt number, starting at zero
+		/// \return The random word
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE uint64_t
+		randomWord64(const Philox &generator, uint64_t index, uint64_t attempt) {
+			uint32_t bits[2];
+			if (attempt == 0) {
+				generator.words(index * 2, 2, bits);
+			} else {
+				Philox(generator.seed(), ~(generator.stream() + attempt - 1))
+				  .words(index * 2, 2, bits);
+			}
+			return bits[0] | (static_cast<uint64_t>(bits[1]) << 32);
+		}
+
+		/// Return variate \p index of a uniform distribution over [lower, upper) for floating
+		/// point types, or [lower, upper] for integer types. Integer variates use Lemire's
+		/// multiply-shift method with rejection, so they are unbiased for every range.
+		///
+		/// See "Fast Random Integer Generation in an Interval" (Lemire, 2019).
+		template<typename T>
+		LIBRAPID_NODISCARD T randomUniform(const Philox &generator, uint64_t index, const T &lower,
+										   const T &upper) {
+			if constexpr (std::is_integral_v<T>) {
+				const uint64_t range = static_cast<uint64_t>(upper) - static_cast<uint64_t>(lower);
+				uint64_t value		 = randomWord64(generator, index, 0);
+				if (range == std::numeric_limits<uint64_t>::max()) return static_cast<T>(value);
+
+				// The high word of value * span is uniform over [0, span) unless the low word
+				// falls below 2^64 mod span, in which case the candidate is rejected. The
+				// (slow) modulo is only computed when rejection is possible
+				const uint64_t span = range + 1;
+				uint64_t low;
+				uint64_t high = multiplyWide(value, span, low);
+				if (low < span) {
+					const uint64_t threshold = (0 - span) % span;
+					for (uint64_t attempt = 1; low < threshold; ++attempt) {
+						value = randomWord64(generator, index, attempt);
+						high  = multiplyWide(value, span, low);
+					}
+				}
+				return static_cast<T>(static_cast<uint64_t>(lower) + high);
+			} else {
+				using Unit = RandomUnitType<T>;
+				const Unit unit = generator.uniform<Unit>(index);
+				return static_cast<T>(static_cast<Unit>(lower) +
+									  unit * (static_cast<Unit>(upper) - static_cast<Unit>(lower)));
+			}
+		}
+
+		/// Return variate \p index of a normal distribution with a given mean and standard
+		/// deviation
+		template<typename T>
+		LIBRAPID_NODISCARD T randomNormal(const Philox &generator, uint64_t index, const T &mean,
+										  const T &stddev) {
+			static_assert(!std::is_integral_v<T>, "Normal variates must be of floating point type");
+			using Unit = RandomUnitType<T>;
+			return static_cast<T>(static_cast<Unit>(mean) +
+								  generator.normal<Unit>(index) * static_cast<Unit>(stddev));
+		}
+
+		/// Write \p count uniformly distributed variates, starting at variate \p first, to
+		/// \p dst. Float and double variates are generated in packets; a partial packet at the
+		/// end is computed in full and truncated, so the value written for each variate depends
+		/// only on its index.
+		template<typename T>
+		void generateUniform(const Philox &generator, uint64_t first, T *dst, int64_t count,
+							 const T &lower, const T &upper) {
+			if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+				using Packet			   = typename typetraits::TypeInfo<T>::Packet;
+				constexpr int64_t width	   = typetraits::TypeInfo<T>::packetWidth;
+				const Packet lowerPacket   = lower;
+				const Packet scale		   = upper - lower;
+				const int64_t vectorLength = count - (count % width);
+
+				for (int64_t i = 0; i < vectorLength; i += width) {
+					Packet value = lowerPacket + generator.uniformPacket<T>(first + i) * scale;
+					value.store(dst + i, Vc::Unaligned);
+				}
+
+				if (vectorLength < count) {
+					alignas(Packet) T tmp[width];
+					Packet value =
+					  lowerPacket + generator.uniformPacket<T>(first + vectorLength) * scale;
+					value.store(tmp, Vc::Aligned);
+					std::copy(tmp, tmp + (count - vectorLength), dst + vectorLength);
+				}
+			} else {
+				for (int64_t i = 0; i < count; ++i) {
+					dst[i] = randomUniform(generator, first + i, lower, upper);
+				}
+			}
+		}
+
+		/// Write \p count normally distributed variates, starting at variate \p first, to
+		/// \p dst
+		/// \see generateUniform
+		template<typename T>
+		void generateNormal(const Philox &generator, uint64_t first, T *dst, int64_t count,
+							const T &mean, const T &stddev) {
+			if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+				using Packet			   = typename typetraits::TypeInfo<T>::Packet;
+				constexpr int64_t width	   = typetraits::TypeInfo<T>::packetWidth;
+				const Packet meanPacket	   = mean;
+				const Packet stddevPacket  = stddev;
+				const int64_t vectorLength = count - (count % width);
+
+				for (int64_t i = 0; i < vectorLength; i += width) {
+					Packet value = meanPacket + generator.normalPacket<T>(first + i) * stddevPacket;
+					value.store(dst + i, Vc::Unaligned);
+				}
+
+				if (vectorLength < count) {
+					alignas(Packet) T tmp[width];
+					Packet value =
+					  meanPacket + generator.normalPacket<T>(first + vectorLength) * stddevPacket;
+					value.store(tmp, Vc::Aligned);
+					std::copy(tmp, tmp + (count - vectorLength), dst + vectorLength);
+				}
+			} else {
+				for (int64_t i = 0; i < count; ++i) {
+					dst[i] = randomNormal(generator, first + i, mean, stddev);
+				}
+			}
+		}
+	} // namespace detail
+
+	inline Philox::Philox(uint64_t seed, uint64_t stream) : m_seed(seed), m_stream(stream) {}
+
+	LIBRAPID_ALWAYS_INLINE uint64_t Philox::seed() const { return m_seed; }
+
+	LIBRAPID_ALWAYS_INLINE uint64_t Philox::stream() const { return m_stream; }
+
+	LIBRAPID_ALWAYS_INLINE uint64_t Philox::position() const { return m_position; }
+
+	template<int64_t Batch>
+	LIBRAPID_ALWAYS_INLINE void Philox::rounds(uint64_t counter,
+											   uint32_t (&out)[Batch * 4]) const {
+		uint32_t c0[Batch], c1[Batch], c2[Batch], c3[Batch];
+		for (int64_t i = 0; i < Batch; ++i) {
+			const uint64_t value = counter + static_cast<uint64_t>(i);
+			c0[i]				 = static_cast<uint32_t>(value);
+			c1[i]				 = static_cast<uint32_t>(value >> 32);
+			c2[i]				 = static_cast<uint32_t>(m_stream);
+			c3[i]				 = static_cast<uint32_t>(m_stream >> 32);
+		}
+
+		uint32_t key0 = static_cast<uint32_t>(m_seed);
+		uint32_t key1 = static_cast<uint32_t>(m_seed >> 32);
+
+		for (int round = 0; round < 10; ++round) {
+			for (int64_t i = 0; i < Batch; ++i) {
+				const uint64_t product0 = static_cast<uint64_t>(s_multiplier0) * c0[i];
+				const uint64_t product1 = static_cast<uint64_t>(s_multiplier1) * c2[i];
+				const uint32_t next0	= static_cast<uint32_t>(product1 >> 32) ^ c1[i] ^ key0;
+				const uint32_t next2	= static_cast<uint32_t>(product0 >> 32) ^ c3[i] ^ key1;
+				c1[i]					= static_cast<uint32_t>(product1);
+				c3[i]					= static_cast<uint32_t>(product0);
+				c0[i]					= next0;
+				c2[i]					= next2;
+			}
+			key0 += s_weyl0;
+			key1 += s_weyl1;
+		}
+
+		for (int64_t i = 0; i < Batch; ++i) {
+			out[i * 4 + 0] = c0[i];
+			out[i * 4 + 1] = c1[i];
+			out[i * 4 + 2] = c2[i];
+			out[i * 4 + 3] = c3[i];
+		}
+	}
+
+	inline auto Philox::block(uint64_t counter) const -> Block {
+		uint32_t out[4];
+		rounds<1>(counter, out);
+		return {out[0], out[1], out[2], out[3]};
+	}
+
+	inline void Philox::words(uint64_t first, int64_t count, uint32_t *dst) const {
+		uint64_t counter = first / blockSize;
+		int64_t skip	 = static_cast<int64_t>(first % blockSize);
+
+		while (count > 0) {
+			uint32_t batch[batchSize * blockSize];
+			rounds<batchSize>(counter, batch);
+			const int64_t available = batchSize * blockSize - skip;
+			const int64_t n			= count < available ? count : available;
+			std::copy(batch + skip, batch + skip + n, dst);
+			dst += n;
+			count -= n;
+			counter += batchSize;
+			skip = 0;
+		}
+	}
+
+	template<typename T, int64_t Count>
+	void Philox::units(uint64_t index, T *dst) const {
+		static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+					  "Philox can only generate float and double variates");
+		constexpr int64_t wordsPerVariate = detail::randomWordsPerVariate<T>();
+		uint32_t bits[Count * wordsPerVariate];
+		words(index * wordsPerVariate, Count * wordsPerVariate, bits);
+
+		for (int64_t i = 0; i < Count; ++i) {
+			if constexpr (wordsPerVariate == 1) {
+				dst[i] = static_cast<float>(bits[i] >> 8) * 0x1p-24f;
+			} else {
+				const uint64_t value =
+				  bits[i * 2] | (static_cast<uint64_t>(bits[i * 2 + 1]) << 32);
+				dst[i] = static_cast<double>(value >> 11) * 0x1p-53;
+			}
+		}
+	}
+
+	template<typename T>
+	T Philox::uniform(uint64_t index) const {
+		T res;
+		units<T, 1>(index, &res);
+		return res;
+	}
+
+	template<typename T>
+	T Philox::normal(uint64_t index) const {
+		// Variate i uses uniform variates 2i and 2i + 1. 1 - u is in (0, 1], so the logarithm
+		// is always finite
+		T u[2];
+		units<T, 2>(index * 2, u);
+		return std::sqrt(T(-2) * std::log(T(1) - u[0])) * std::cos(static_cast<T>(TAU) * u[1]);
+	}
+
+	template<typename T>
+	auto Philox::uniformPacket(uint64_t index) const -> typename typetraits::TypeInfo<T>::Packet {
+		using Packet			= typename typetraits::TypeInfo<T>::Packet;
+		constexpr int64_t width = typetraits::TypeInfo<T>::packetWidth;
+		alignas(Packet) T tmp[width];
+		units<T, width>(index, tmp);
+
+		Packet res;
+		res.load(tmp, Vc::Aligned);
+		return res;
+	}
+
+	template<typename T>
+	auto Philox::normalPacket(uint64_t index) const -> typename typetraits::TypeInfo<T>::Packet {
+		using Packet			= typename typetraits::TypeInfo<T>::Packet;
+		constexpr int64_t width = typetraits::TypeInfo<T>::packetWidth;
+		alignas(Packet) T tmp[width * 2];
+		alignas(Packet) T u0[width];
+		alignas(Packet) T u1[width];
+		units<T, width * 2>(index * 2, tmp);
+		for (int64_t i = 0; i < width; ++i) {
+			u0[i] = tmp[i * 2];
+			u1[i] = tmp[i * 2 + 1];
+		}
+
+		Packet first, second;
+		first.load(u0, Vc::Aligned);
+		second.load(u1, Vc::Aligned);
+		Packet radius = Vc::sqrt(Packet(T(-2)) * Vc::log(Packet(T(1)) - first));
+		return radius * Vc::cos(Packet(static_cast<T>(TAU)) * second);
+	}
+
+	LIBRAPID_ALWAYS_INLINE auto Philox::operator()() -> result_type {
+		if (m_position % blockSize == 0) m_buffer = block(m_position / blockSize);
+		return m_buffer[m_position++ % blockSize];
+	}
+
+	LIBRAPID_ALWAYS_INLINE void Philox::discard(uint64_t count) {
+		const uint64_t target = m_position + count;
+		if (target % blockSize != 0) m_buffer = block(target / blockSize);
+		m_position = target;
+	}
+
+	/// Return a uniformly distributed random value in the range [lower, upper) for floating
+	/// point types, or [lower, upper] for integer types. If a seed is given, the result is a
+	/// deterministic function of it; otherwise a value is drawn from the global seed
+	/// (`global::randomSeed`) on a fresh stream.
+	/// \tparam T The type of the value
+	/// \param lower The lower bound
+	/// \param upper The upper bound
+	/// \param seed The seed, or -1 to use the global seed
+	/// \return A random value
+	template<typename T = double>
+	LIBRAPID_NODISCARD T random(const T &lower = 0, const T &upper = 1, uint64_t seed = -1) {
+		return detail::randomUniform(detail::randomGenerator(seed), 0, lower, upper);
+	}
+
+	/// Return a normally distributed random value with a given mean and standard deviation
+	/// \tparam T The type of the value
+	/// \param mean The mean of the distribution
+	/// \param stddev The standard deviation of the distribution
+	/// \param seed The seed, or -1 to use the global seed
+	/// \return A random value
+	/// \see random
+	template<typename T = double>
+	LIBRAPID_NODISCARD T randomGaussian(const T &mean = 0, const T &stddev = 1,
+										uint64_t seed = -1) {
+		return detail::randomNormal(detail::randomGenerator(seed), 0, mean, stddev);
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_MATH_RANDOM_HPP
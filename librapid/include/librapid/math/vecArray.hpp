@@ -0,0 +1,406 @@
+#ifndef LIBRAPID_MATH_VEC_ARRAY_HPP
+#define LIBRAPID_MATH_VEC_ARRAY_HPP
+
+/*
+ * This file defines VecArray, a structure-of-arrays container for many GenericVector objects.
+ * Each component is stored contiguously, so the batch operations (dot, cross, mag, norm, proj)
+ * load a packet of x components, a packet of y components and so on, and process packetWidth
+ * vectors per instruction. Every kernel is written once over a "batch" type, which is the packet
+ * type for the vectorised part of the array and the scalar type for the elements left over.
+ */
+
+namespace librapid {
+	namespace detail {
+		/// Load a batch of values from \p ptr: a whole packet if \p Batch is a packet type,
+		/// otherwise a single value
+		/// \tparam Batch The packet type or the scalar type
+		/// \tparam Scalar The scalar type
+		/// \param ptr Pointer to the first value
+		/// \return The batch of values
+		template<typename Batch, typename Scalar>
+		LIBRAPID_ALWAYS_INLINE Batch loadBatch(const Scalar *ptr) {
+			if constexpr (std::is_same_v<Batch, Scalar>) {
+				return *ptr;
+			} else {
+				Batch res;
+				res.load(ptr, Vc::Unaligned);
+				return res;
+			}
+		}
+
+		/// Store a batch of values to \p ptr
+		/// \tparam Batch The packet type or the scalar type
+		/// \tparam Scalar The scalar type
+		/// \param batch The values to store
+		/// \param ptr Pointer to the first destination value
+		/// \see loadBatch
+		template<typename Batch, typename Scalar>
+		LIBRAPID_ALWAYS_INLINE void storeBatch(const Batch &batch, Scalar *ptr) {
+			if constexpr (std::is_same_v<Batch, Scalar>) {
+				*ptr = batch;
+			} else {
+				batch.store(ptr, Vc::Unaligned);
+			}
+		}
+
+		/// Square root of a batch of values
+		/// \tparam Batch The packet type or the scalar type
+		/// \param batch The values
+		/// \return The square root of each value
+		template<typename Batch>
+		LIBRAPID_ALWAYS_INLINE Batch sqrtBatch(const Batch &batch) {
+			if constexpr (std::is_arithmetic_v<Batch>) {
+				return static_cast<Batch>(::librapid::sqrt(batch));
+			} else {
+				return Vc::sqrt(batch);
+			}
+		}
+	} // namespace detail
+
+	/// A VecArray stores a list of \p Dims dimensional vectors as a structure of arrays: the
+	/// x components of every vector are contiguous, followed by the y components, and so on.
+	/// The batch operations process packetWidth vectors at once for float and double vectors,
+	/// which is much faster than calling the same GenericVector functions on a
+	/// std::vector<Vec>. A VecArray can be converted to and from a std::vector<Vec>.
+	/// \tparam Scalar The type of each component
+	/// \tparam Dims The number of dimensions of each vector
+	/// \see GenericVector
+	template<typename Scalar, int64_t Dims = 3>
+	class VecArray {
+	public:
+		using VectorType = GenericVector<Scalar, Dims>;
+		using Packet	 = typename typetraits::TypeInfo<Scalar>::Packet;
+		static constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+		/// True if the batch operations use SIMD packets. Other types use scalar loops.
+		static constexpr bool vectorised =
+		  (std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>) && packetWidth > 1;
+
+		/// Create an empty VecArray
+		VecArray() = default;
+
+		/// Create a VecArray of \p size zero vectors
+		/// \param size The number of vectors
+		explicit VecArray(int64_t size);
+
+		/// Create a VecArray from a list of vectors
+		/// \param vectors The vectors to store
+		VecArray(const std::vector<VectorType> &vectors);
+
+		/// Convert this VecArray to a list of vectors
+		/// \return A std::vector containing a copy of every vector
+		LIBRAPID_NODISCARD std::vector<VectorType> toVector() const;
+
+		/// Convert this VecArray to a list of vectors
+		/// \return A std::vector containing a copy of every vector
+		/// \see toVector
+		explicit operator std::vector<VectorType>() const { return toVector(); }
+
+		/// Return the number of vectors in the VecArray
+		/// \return The number of vectors
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t size() const { return m_size; }
+
+		/// Return the number of dimensions of each vector
+		/// \return The number of dimensions
+		LIBRAPID_NODISCARD static constexpr int64_t dims() { return Dims; }
+
+		/// Change the number of vectors. New vectors are set to zero.
+		/// \param size The new number of vectors
+		void resize(int64_t size);
+
+		/// Return a copy of the vector at \p index
+		/// \param index The index of the vector
+		/// \return The vector
+		LIBRAPID_NODISCARD VectorType operator[](int64_t index) const;
+
+		/// Overwrite the vector at \p index
+		/// \param index The index of the vector
+		/// \param vector The new value of the vector
+		void set(int64_t index, const VectorType &vector);
+
+		/// Return a pointer to the contiguous values of component \p dim of every vector
+		/// \param dim The component (0 for x, 1 for y, ...)
+		/// \return Pointer to size() values
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar *component(int64_t dim);
+
+		/// Return a pointer to the contiguous values of component \p dim of every vector
+		/// \param dim The component (0 for x, 1 for y, ...)
+		/// \return Pointer to size() values
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const Scalar *component(int64_t dim) const;
+
+		/// Calculate the dot product of each vector with the corresponding vector in \p other
+		/// \param other The other vectors, which must have the same size
+		/// \return The dot products
+		LIBRAPID_NODISCARD std::vector<Scalar> dot(const VecArray &other) const;
+
+		/// Calculate the dot products into an existing std::vector, which is resized to size()
+		/// \param other The other vectors, which must have the same size
+		/// \param result The std::vector to write the dot products to
+		void dot(const VecArray &other, std::vector<Scalar> &result) const;
+
+		/// Calculate the cross product of each vector with the corresponding vector in \p other
+		/// \param other The other vectors, which must have the same size
+		/// \return The cross products
+		LIBRAPID_NODISCARD VecArray cross(const VecArray &other) const;
+
+		/// Calculate the cross products into an existing VecArray, which is resized to size().
+		/// \p result may be this VecArray or \p other.
+		/// \param other The other vectors, which must have the same size
+		/// \param result The VecArray to write the cross products to
+		void cross(const VecArray &other, VecArray &result) const;
+
+		/// Calculate the squared magnitude of each vector
+		/// \return The squared magnitudes
+		LIBRAPID_NODISCARD std::vector<Scalar> mag2() const;
+
+		/// Calculate the magnitude of each vector
+		/// \return The magnitudes
+		LIBRAPID_NODISCARD std::vector<Scalar> mag() const;
+
+		/// Calculate the magnitudes into an existing std::vector, which is resized to size()
+		/// \param result The std::vector to write the magnitudes to
+		void mag(std::vector<Scalar> &result) const;
+
+		/// Calculate the normalized version of each vector
+		/// \return The normalized vectors
+		LIBRAPID_NODISCARD VecArray norm() const;
+
+		/// Normalize each vector into an existing VecArray, which is resized to size().
+		/// \p result may be this VecArray.
+		/// \param result The VecArray to write the normalized vectors to
+		void norm(VecArray &result) const;
+
+		/// Project each vector onto the corresponding vector in \p other
+		/// \param other The vectors to project onto, which must have the same size
+		/// \return The projections
+		LIBRAPID_NODISCARD VecArray proj(const VecArray &other) const;
+
+		/// Calculate the projections into an existing VecArray, which is resized to size().
+		/// \p result may be this VecArray or \p other.
+		/// \param other The vectors to project onto, which must have the same size
+		/// \param result The VecArray to write the projections to
+		void proj(const VecArray &other, VecArray &result) const;
+
+	private:
+		/// Call \p kernel(index, batch) for every batch of vectors, where batch is a
+		/// default-constructed Packet for whole packets and a Scalar for the remaining vectors
+		/// \tparam Kernel The type of the kernel
+		/// \param kernel The kernel to call
+		template<typename Kernel>
+		LIBRAPID_ALWAYS_INLINE void forEachBatch(Kernel &&kernel) const;
+
+		/// Throw an error if \p other does not contain the same number of vectors as this
+		/// \param other The other VecArray
+		void checkSize(const VecArray &other) const;
+
+		std::array<std::vector<Scalar>, Dims> m_components;
+		int64_t m_size = 0;
+	};
+
+	template<typename Scalar, int64_t Dims>
+	VecArray<Scalar, Dims>::VecArray(int64_t size) {
+		resize(size);
+	}
+
+	template<typename Scalar, int64_t Dims>
+	VecArray<Scalar, Dims>::VecArray(const std::vector<VectorType> &vectors) {
+		resize(static_cast<int64_t>(vectors.size()));
+		for (int64_t d = 0; d < Dims; ++d) {
+			Scalar *dst = m_components[d].data();
+			for (int64_t i = 0; i < m_size; ++i) dst[i] = vectors[i][d];
+		}
+	}
+
+	template<typename Scalar, int64_t Dims>
+	auto VecArray<Scalar, Dims>::toVector() const -> std::vector<VectorType> {
+		std::vector<VectorType> res(m_size);
+		for (int64_t d = 0; d < Dims; ++d) {
+			const Scalar *src = m_components[d].data();
+			for (int64_t i = 0; i < m_size; ++i) res[i][d] = src[i];
+		}
+		return res;
+	}
+
+	template<typename Scalar, int64_t Dims>
+	void VecArray<Scalar, Dims>::resize(int64_t size) {
+		LIBRAPID_ASSERT(size >= 0, "Cannot resize a VecArray to a negative size");
+		for (auto &values : m_components) values.resize(size);
+		m_size = size;
+	}
+
+	template<typename Scalar, int64_t Dims>
+	auto VecArray<Scalar, Dims>::operator[](int64_t index) const -> VectorType {
+		LIBRAPID_ASSERT(index >= 0 && index < m_size, "Index out of bounds");
+		VectorType res;
+		for (int64_t d = 0; d < Dims; ++d) res[d] = m_components[d][index];
+		return res;
+	}
+
+	template<typename Scalar, int64_t Dims>
+	void VecArray<Scalar, Dims>::set(int64_t index, const VectorType &vector) {
+		LIBRAPID_ASSERT(index >= 0 && index < m_size, "Index out of bounds");
+		for (int64_t d = 0; d < Dims; ++d) m_components[d][index] = vector[d];
+	}
+
+	template<typename Scalar, int64_t Dims>
+	auto VecArray<Scalar, Dims>::component(int64_t dim) -> Scalar * {
+		LIBRAPID_ASSERT(dim >= 0 && dim < Dims, "Component out of bounds");
+		return m_components[dim].data();
+	}
+
+	template<typename Scalar, int64_t Dims>
+	auto VecArray<Scalar, Dims>::component(int64_t dim) const -> const Scalar * {
+		LIBRAPID_ASSERT(dim >= 0 && dim < Dims, "Component out of bounds");
+		return m_components[dim].data();
+	}
+
+	template<typename Scalar, int64_t Dims>
+	template<typename Kernel>
+	void VecArray<Scalar, Dims>::forEachBatch(Kernel &&kernel) const {
+		int64_t index = 0;
+		if constexpr (vectorised) {
+			const int64_t vectorSize = m_size - (m_size % packetWidth);
+			for (; index < vectorSize; index += packetWidth) kernel(index, Packet());
+		}
+
+		for (; index < m_size; ++index) kernel(index, Scalar());
+	}
+
+	template<typename Scalar, int64_t Dims>
+	void VecArray<Scalar, Dims>::checkSize(const VecArray &other) const {
+		if (other.m_size != m_size) {
+			throw std::runtime_error(fmt::format(
+			  "VecArray sizes must be equal. Received {} and {}", m_size, other.m_size));
+		}
+	}
+
+	template<typename Scalar, int64_t Dims>
+	auto VecArray<Scalar, Dims>::dot(const VecArray &other) const -> std::vector<Scalar> {
+		std::vector<Scalar> res;
+		dot(other, res);
+		return res;
+	}
+
+	template<typename Scalar, int64_t Dims>
+	void VecArray<Scalar, Dims>::dot(const VecArray &other, std::vector<Scalar> &result) const {
+		checkSize(other);
+		result.resize(m_size);
+		forEachBatch([&](int64_t index, auto batch) LIBRAPID_LAMBDA_INLINE {
+			using Batch = decltype(batch);
+			Batch sum	= detail::loadBatch<Batch>(m_components[0].data() + index) *
+						detail::loadBatch<Batch>(other.m_components[0].data() + index);
+			for (int64_t d = 1; d < Dims; ++d) {
+				sum += detail::loadBatch<Batch>(m_components[d].data() + index) *
+					   detail::loadBatch<Batch>(other.m_components[d].data() + index);
+			}
+			detail::storeBatch(sum, result.data() + index);
+		});
+	}
+
+	template<typename Scalar, int64_t Dims>
+	auto VecArray<Scalar, Dims>::cross(const VecArray &other) const -> VecArray {
+		VecArray res;
+		cross(other, res);
+		return res;
+	}
+
+	template<typename Scalar, int64_t Dims>
+	void VecArray<Scalar, Dims>::cross(const VecArray &other, VecArray &result) const {
+		static_assert(Dims == 3, "Cross product is only defined for 3D Vectors");
+		checkSize(other);
+		result.resize(m_size);
+		forEachBatch([&](int64_t index, auto batch) LIBRAPID_LAMBDA_INLINE {
+			using Batch	   = decltype(batch);
+			const Batch ax = detail::loadBatch<Batch>(m_components[0].data() + index);
+			const Batch ay = detail::loadBatch<Batch>(m_components[1].data() + index);
+			const Batch az = detail::loadBatch<Batch>(m_components[2].data() + index);
+			const Batch bx = detail::loadBatch<Batch>(other.m_components[0].data() + index);
+			const Batch by = detail::loadBatch<Batch>(other.m_components[1].data() + index);
+			const Batch bz = detail::loadBatch<Batch>(other.m_components[2].data() + index);
+			detail::storeBatch(Batch(ay * bz - az * by), result.m_components[0].data() + index);
+			detail::storeBatch(Batch(az * bx - ax * bz), result.m_components[1].data() + index);
+			detail::storeBatch(Batch(ax * by - ay * bx), result.m_components[2].data() + index);
+		});
+	}
+
+	template<typename Scalar, int64_t Dims>
+	auto VecArray<Scalar, Dims>::mag2() const -> std::vector<Scalar> {
+		return dot(*this);
+	}
+
+	template<typename Scalar, int64_t Dims>
+	auto VecArray<Scalar, Dims>::mag() const -> std::vector<Scalar> {
+		std::vector<Scalar> res;
+		mag(res);
+		return res;
+	}
+
+	template<typename Scalar, int64_t Dims>
+	void VecArray<Scalar, Dims>::mag(std::vector<Scalar> &result) const {
+		result.resize(m_size);
+		forEachBatch([&](int64_t index, auto batch) LIBRAPID_LAMBDA_INLINE {
+			using Batch = decltype(batch);
+			Batch sum	= Batch(Scalar(0));
+			for (int64_t d = 0; d < Dims; ++d) {
+				const Batch value = detail::loadBatch<Batch>(m_components[d].data() + index);
+				sum += value * value;
+			}
+			detail::storeBatch(detail::sqrtBatch(sum), result.data() + index);
+		});
+	}
+
+	template<typename Scalar, int64_t Dims>
+	auto VecArray<Scalar, Dims>::norm() const -> VecArray {
+		VecArray res;
+		norm(res);
+		return res;
+	}
+
+	template<typename Scalar, int64_t Dims>
+	void VecArray<Scalar, Dims>::norm(VecArray &result) const {
+		result.resize(m_size);
+		forEachBatch([&](int64_t index, auto batch) LIBRAPID_LAMBDA_INLINE {
+			using Batch = decltype(batch);
+			Batch values[Dims];
+			Batch sum = Batch(Scalar(0));
+			for (int64_t d = 0; d < Dims; ++d) {
+				values[d] = detail::loadBatch<Batch>(m_components[d].data() + index);
+				sum += values[d] * values[d];
+			}
+			const Batch mag = detail::sqrtBatch(sum);
+			for (int64_t d = 0; d < Dims; ++d) {
+				detail::storeBatch(Batch(values[d] / mag), result.m_components[d].data() + index);
+			}
+		});
+	}
+
+	template<typename Scalar, int64_t Dims>
+	auto VecArray<Scalar, Dims>::proj(const VecArray &other) const -> VecArray {
+		VecArray res;
+		proj(other, res);
+		return res;
+	}
+
+	template<typename Scalar, int64_t Dims>
+	void VecArray<Scalar, Dims>::proj(const VecArray &other, VecArray &result) const {
+		checkSize(other);
+		result.resize(m_size);
+		forEachBatch([&](int64_t index, auto batch) LIBRAPID_LAMBDA_INLINE {
+			using Batch = decltype(batch);
+			Batch onto[Dims];
+			Batch dot  = Batch(Scalar(0));
+			Batch mag2 = Batch(Scalar(0));
+			for (int64_t d = 0; d < Dims; ++d) {
+				onto[d] = detail::loadBatch<Batch>(other.m_components[d].data() + index);
+				dot += detail::loadBatch<Batch>(m_components[d].data() + index) * onto[d];
+				mag2 += onto[d] * onto[d];
+			}
+			const Batch scale = dot / mag2;
+			for (int64_t d = 0; d < Dims; ++d) {
+				detail::storeBatch(Batch(onto[d] * scale), result.m_components[d].data() + index);
+			}
+		});
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_MATH_VEC_ARRAY_HPP
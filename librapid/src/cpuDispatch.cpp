@@ -0,0 +1,266 @@
+#include <librapid/librapid.hpp>
+
+// Per-function target attributes are needed to compile kernels for instruction sets which are not
+// enabled for the rest of the build. Other compilers and architectures only get the generic
+// kernels.
+#if (defined(__x86_64__) || defined(__i386__)) &&                                                  \
+  (defined(LIBRAPID_GNU) || defined(LIBRAPID_CLANG))
+#	include <cpuid.h>
+#	define LIBRAPID_MULTI_TARGET
+#	define LIBRAPID_TARGET_SSE4   __attribute__((target("sse4.2")))
+#	define LIBRAPID_TARGET_AVX2   __attribute__((target("avx2,fma")))
+#	define LIBRAPID_TARGET_AVX512 __attribute__((target("avx512f,avx512dq,avx512bw,avx512vl")))
+#endif
+
+// The output may alias an input exactly, but never partially, so there are no loop-carried
+// dependencies and the loops can be vectorised without runtime overlap checks. "omp simd" also
+// forces vectorisation at optimisation levels where it is otherwise disabled.
+#if defined(_OPENMP) && !defined(LIBRAPID_MSVC)
+#	define LIBRAPID_SIMD_LOOP _Pragma("omp simd")
+#elif defined(LIBRAPID_CLANG)
+#	define LIBRAPID_SIMD_LOOP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(LIBRAPID_GNU)
+#	define LIBRAPID_SIMD_LOOP _Pragma("GCC ivdep")
+#elif defined(LIBRAPID_MSVC)
+#	define LIBRAPID_SIMD_LOOP __pragma(loop(ivdep))
+#else
+#	define LIBRAPID_SIMD_LOOP
+#endif
+
+namespace librapid {
+	namespace {
+		struct AddOp {
+			template<typename T>
+			static LIBRAPID_ALWAYS_INLINE T apply(T lhs, T rhs) {
+				return lhs + rhs;
+			}
+		};
+
+		struct SubOp {
+			template<typename T>
+			static LIBRAPID_ALWAYS_INLINE T apply(T lhs, T rhs) {
+				return lhs - rhs;
+			}
+		};
+
+		struct MulOp {
+			template<typename T>
+			static LIBRAPID_ALWAYS_INLINE T apply(T lhs, T rhs) {
+				return lhs * rhs;
+			}
+		};
+
+		struct DivOp {
+			template<typename T>
+			static LIBRAPID_ALWAYS_INLINE T apply(T lhs, T rhs) {
+				return lhs / rhs;
+			}
+		};
+
+		template<typename T>
+		using ArrayArrayKernel = void (*)(T *, const T *, const T *, int64_t);
+
+		template<typename T>
+		using ArrayScalarKernel = void (*)(T *, const T *, T, int64_t);
+
+		template<typename T>
+		using ScalarArrayKernel = void (*)(T *, T, const T *, int64_t);
+
+		/// The kernels compiled for a single SIMD level, indexed by detail::dispatch::BinaryOp
+		template<typename T>
+		struct KernelTable {
+			ArrayArrayKernel<T> arrayArray[4];
+			ArrayScalarKernel<T> arrayScalar[4];
+			ScalarArrayKernel<T> scalarArray[4];
+		};
+
+		// The same loops are compiled once per instruction set. The operation is a template
+		// parameter so it is inlined into each kernel.
+#define LIBRAPID_DEFINE_KERNELS(NAMESPACE_, TARGET_)                                               \
+	namespace NAMESPACE_ {                                                                         \
+		template<typename T, typename Op>                                                          \
+		TARGET_ void arrayArray(T *dst, const T *lhs, const T *rhs, int64_t size) {                \
+			LIBRAPID_SIMD_LOOP                                                                     \
+			for (int64_t i = 0; i < size; ++i) dst[i] = Op::apply(lhs[i], rhs[i]);                 \
+		}                                                                                          \
+                                                                                                   \
+		template<typename T, typename Op>                                                          \
+		TARGET_ void arrayScalar(T *dst, const T *lhs, T rhs, int64_t size) {                      \
+			LIBRAPID_SIMD_LOOP                                                                     \
+			for (int64_t i = 0; i < size; ++i) dst[i] = Op::apply(lhs[i], rhs);                    \
+		}                                                                                          \
+                                                                                                   \
+		template<typename T, typename Op>                                                          \
+		TARGET_ void scalarArray(T *dst, T lhs, const T *rhs, int64_t size) {                      \
+			LIBRAPID_SIMD_LOOP                                                                     \
+			for (int64_t i = 0; i < size; ++i) dst[i] = Op::apply(lhs, rhs[i]);                    \
+		}                                                                                          \
+                                                                                                   \
+		template<typename T>                                                                       \
+		constexpr KernelTable<T> table = {                                                         \
+		  {arrayArray<T, AddOp>,                                                                   \
+		   arrayArray<T, SubOp>,                                                                   \
+		   arrayArray<T, MulOp>,                                                                   \
+		   arrayArray<T, DivOp>},                                                                  \
+		  {arrayScalar<T, AddOp>,                                                                  \
+		   arrayScalar<T, SubOp>,                                                                  \
+		   arrayScalar<T, MulOp>,                                                                  \
+		   arrayScalar<T, DivOp>},                                                                 \
+		  {scalarArray<T, AddOp>,                                                                  \
+		   scalarArray<T, SubOp>,                                                                  \
+		   scalarArray<T, MulOp>,                                                                  \
+		   scalarArray<T, DivOp>}};                                                                \
+	}
+
+		LIBRAPID_DEFINE_KERNELS(generic, )
+#if defined(LIBRAPID_MULTI_TARGET)
+		LIBRAPID_DEFINE_KERNELS(sse4, LIBRAPID_TARGET_SSE4)
+		LIBRAPID_DEFINE_KERNELS(avx2, LIBRAPID_TARGET_AVX2)
+		LIBRAPID_DEFINE_KERNELS(avx512, LIBRAPID_TARGET_AVX512)
+#endif // LIBRAPID_MULTI_TARGET
+
+#undef LIBRAPID_DEFINE_KERNELS
+
+		/// Return the kernel table for a given SIMD level
+		template<typename T>
+		const KernelTable<T> &kernelTable(SimdLevel level) {
+#if defined(LIBRAPID_MULTI_TARGET)
+			switch (level) {
+				case SimdLevel::AVX512: return avx512::table<T>;
+				case SimdLevel::AVX2: return avx2::table<T>;
+				case SimdLevel::SSE4: return sse4::table<T>;
+				default: return generic::table<T>;
+			}
+#else
+			return generic::table<T>;
+#endif // LIBRAPID_MULTI_TARGET
+		}
+
+#if defined(LIBRAPID_MULTI_TARGET)
+		/// Execute CPUID with the given leaf and subleaf
+		/// \param leaf The CPUID leaf (EAX)
+		/// \param subleaf The CPUID subleaf (ECX)
+		/// \return EAX, EBX, ECX and EDX, in that order
+		std::array<uint32_t, 4> cpuid(uint32_t leaf, uint32_t subleaf) {
+			std::array<uint32_t, 4> regs {};
+			__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+			return regs;
+		}
+
+		/// Read XCR0, which says which register states the operating system saves
+		uint64_t xcr0() {
+			uint32_t eax, edx;
+			__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return (static_cast<uint64_t>(edx) << 32) | eax;
+		}
+
+		bool bit(uint32_t reg, int index) { return (reg >> index) & 1; }
+#endif // LIBRAPID_MULTI_TARGET
+
+		/// Parse the LIBRAPID_SIMD environment variable. Unset or unrecognised values request
+		/// the highest level available.
+		SimdLevel requestedSimdLevel() {
+			const char *env = std::getenv("LIBRAPID_SIMD");
+			if (env == nullptr) return SimdLevel::AVX512;
+
+			std::string value(env);
+			std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) {
+				return static_cast<char>(std::tolower(c));
+			});
+
+			for (auto level :
+				 {SimdLevel::Generic, SimdLevel::SSE4, SimdLevel::AVX2, SimdLevel::AVX512}) {
+				if (value == simdLevelName(level)) return level;
+			}
+			return SimdLevel::AVX512;
+		}
+
+		std::atomic<SimdLevel> &activeSimdLevel() {
+			static std::atomic<SimdLevel> level(
+			  std::min(requestedSimdLevel(), detectSimdLevel()));
+			return level;
+		}
+	} // namespace
+
+	SimdLevel detectSimdLevel() {
+		static const SimdLevel detected = []() {
+#if defined(LIBRAPID_MULTI_TARGET)
+			const uint32_t maxLeaf = cpuid(0, 0)[0];
+			if (maxLeaf < 1) return SimdLevel::Generic;
+
+			const auto leaf1 = cpuid(1, 0);
+			if (!bit(leaf1[2], 19) || !bit(leaf1[2], 20)) return SimdLevel::Generic;
+
+			// AVX state must be enabled by the operating system (OSXSAVE + XCR0 bits 1 and 2)
+			const bool osxsave = bit(leaf1[2], 27);
+			if (!osxsave || !bit(leaf1[2], 28) || !bit(leaf1[2], 12) || maxLeaf < 7)
+				return SimdLevel::SSE4;
+			const uint64_t xcr = xcr0();
+			if ((xcr & 0x6) != 0x6) return SimdLevel::SSE4;
+
+			const auto leaf7 = cpuid(7, 0);
+			if (!bit(leaf7[1], 5)) return SimdLevel::SSE4;
+
+			// AVX-512 additionally requires the opmask and ZMM states (XCR0 bits 5, 6 and 7)
+			if ((xcr & 0xE0) != 0xE0) return SimdLevel::AVX2;
+			if (!bit(leaf7[1], 16) || !bit(leaf7[1], 17) || !bit(leaf7[1], 30) ||
+				!bit(leaf7[1], 31))
+				return SimdLevel::AVX2;
+
+			return SimdLevel::AVX512;
+#else
+			return SimdLevel::Generic;
+#endif // LIBRAPID_MULTI_TARGET
+		}();
+		return detected;
+	}
+
+	SimdLevel simdLevel() { return activeSimdLevel().load(std::memory_order_relaxed); }
+
+	SimdLevel setSimdLevel(SimdLevel level) {
+		SimdLevel selected = std::min(level, detectSimdLevel());
+		activeSimdLevel().store(selected, std::memory_order_relaxed);
+		return selected;
+	}
+
+	const char *simdLevelName(SimdLevel level) {
+		switch (level) {
+			case SimdLevel::Generic: return "generic";
+			case SimdLevel::SSE4: return "sse4";
+			case SimdLevel::AVX2: return "avx2";
+			case SimdLevel::AVX512: return "avx512";
+		}
+		return "unknown";
+	}
+
+	namespace detail::dispatch {
+		template<typename T>
+		void binary(BinaryOp op, T *dst, const T *lhs, const T *rhs, int64_t size) {
+			kernelTable<T>(simdLevel()).arrayArray[static_cast<int>(op)](dst, lhs, rhs, size);
+		}
+
+		template<typename T>
+		void binary(BinaryOp op, T *dst, const T *lhs, T rhs, int64_t size) {
+			kernelTable<T>(simdLevel()).arrayScalar[static_cast<int>(op)](dst, lhs, rhs, size);
+		}
+
+		template<typename T>
+		void binary(BinaryOp op, T *dst, T lhs, const T *rhs, int64_t size) {
+			kernelTable<T>(simdLevel()).scalarArray[static_cast<int>(op)](dst, lhs, rhs, size);
+		}
+
+#define LIBRAPID_INSTANTIATE_DISPATCH(TYPE_)                                                       \
+	template void binary<TYPE_>(BinaryOp, TYPE_ *, const TYPE_ *, const TYPE_ *, int64_t);         \
+	template void binary<TYPE_>(BinaryOp, TYPE_ *, const TYPE_ *, TYPE_, int64_t);                 \
+	template void binary<TYPE_>(BinaryOp, TYPE_ *, TYPE_, const TYPE_ *, int64_t)
+
+		LIBRAPID_INSTANTIATE_DISPATCH(float);
+		LIBRAPID_INSTANTIATE_DISPATCH(double);
+		LIBRAPID_INSTANTIATE_DISPATCH(int32_t);
+		LIBRAPID_INSTANTIATE_DISPATCH(uint32_t);
+		LIBRAPID_INSTANTIATE_DISPATCH(int64_t);
+		LIBRAPID_INSTANTIATE_DISPATCH(uint64_t);
+
+#undef LIBRAPID_INSTANTIATE_DISPATCH
+	} // namespace detail::dispatch
+} // namespace librapid
@@ -5,6 +5,10 @@ namespace librapid::global {
 	int64_t multithreadThreshold	 = 5000;
 	int64_t gemmMultithreadThreshold = 100;
 	int64_t numThreads				 = 8;
+	int64_t printThreshold			 = 1000;
+	int64_t printEdgeItems			 = 3;
+	uint64_t randomSeed				 = (static_cast<uint64_t>(std::random_device {}()) << 32) |
+						   std::random_device {}();
 
 #if defined(LIBRAPID_HAS_CUDA)
 	cudaStream_t cudaStream;
@@ -557,6 +557,89 @@ namespace lrc = librapid;
 	do {                                                                                           \
 	} while (false)
 
+#define TEST_COMPOUND_ASSIGNMENT(SCALAR, DEVICE)                                                   \
+	SECTION(fmt::format(                                                                           \
+	  "Test Compound Assignment [{} | {}]", STRINGIFY(SCALAR), STRINGIFY(DEVICE))) {               \
+		/* Large enough to run in parallel */                                                      \
+		lrc::Array<SCALAR, DEVICE>::ShapeType shape({101, 103});                                   \
+		lrc::Array<SCALAR, DEVICE> testA(shape); /* Prime-dimensioned to force wrapping */         \
+		lrc::Array<SCALAR, DEVICE> testB(shape);                                                   \
+                                                                                                   \
+		for (int64_t i = 0; i < shape[0]; ++i) {                                                   \
+			for (int64_t j = 0; j < shape[1]; ++j) {                                               \
+				SCALAR a = (j + i * shape[1]) % 1000 + 1;                                          \
+				SCALAR b = (i + j * shape[0]) % 100 + 1;                                           \
+                                                                                                   \
+				testA[i][j] = a;                                                                   \
+				testB[i][j] = b;                                                                   \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		auto begin = testA.storage().begin();                                                      \
+                                                                                                   \
+		auto sumResult = (testA + testB).eval();                                                   \
+		testA += testB;                                                                            \
+		bool sumValid = true;                                                                      \
+		for (int64_t i = 0; i < shape[0] * shape[1]; ++i) {                                        \
+			if (!(testA.scalar(i) == sumResult.scalar(i))) {                                       \
+				REQUIRE(testA.scalar(i) == sumResult.scalar(i));                                   \
+				sumValid = false;                                                                  \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(sumValid);                                                                         \
+                                                                                                   \
+		auto diffResult = (testA - SCALAR(1)).eval();                                              \
+		testA -= SCALAR(1);                                                                        \
+		bool diffValid = true;                                                                     \
+		for (int64_t i = 0; i < shape[0] * shape[1]; ++i) {                                        \
+			if (!(testA.scalar(i) == diffResult.scalar(i))) {                                      \
+				REQUIRE(testA.scalar(i) == diffResult.scalar(i));                                  \
+				diffValid = false;                                                                 \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(diffValid);                                                                        \
+                                                                                                   \
+		auto prodResult = (testA * (testB + SCALAR(1))).eval();                                    \
+		testA *= testB + SCALAR(1);                                                                \
+		bool prodValid = true;                                                                     \
+		for (int64_t i = 0; i < shape[0] * shape[1]; ++i) {                                        \
+			if (!(testA.scalar(i) == prodResult.scalar(i))) {                                      \
+				REQUIRE(testA.scalar(i) == prodResult.scalar(i));                                  \
+				prodValid = false;                                                                 \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(prodValid);                                                                        \
+                                                                                                   \
+		auto divResult = (testA / testB).eval();                                                   \
+		testA /= testB;                                                                            \
+		bool divValid = true;                                                                      \
+		for (int64_t i = 0; i < shape[0] * shape[1]; ++i) {                                        \
+			if (!(testA.scalar(i) == divResult.scalar(i))) {                                       \
+				REQUIRE(testA.scalar(i) == divResult.scalar(i));                                   \
+				divValid = false;                                                                  \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(divValid);                                                                         \
+                                                                                                   \
+		/* In-place operations must not reallocate the array */                                    \
+		REQUIRE(testA.storage().begin() == begin);                                                 \
+                                                                                                   \
+		lrc::Array<SCALAR, DEVICE> testC(lrc::Array<SCALAR, DEVICE>::ShapeType({2, 3}));           \
+		testC << 1, 2, 3, 4, 5, 6;                                                                 \
+		testC += 1;                                                                                \
+		testC *= 2;                                                                                \
+		REQUIRE(testC.str() == fmt::format("[[{} {} {}]\n [{} {} {}]]",                            \
+										   SCALAR(4),                                              \
+										   SCALAR(6),                                              \
+										   SCALAR(8),                                              \
+										   SCALAR(10),                                             \
+										   SCALAR(12),                                             \
+										   SCALAR(14)));                                           \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+
 #define TEST_ALL(SCALAR, DEVICE)                                                                   \
 	TEST_CONSTRUCTORS(SCALAR, DEVICE);                                                             \
 	TEST_INDEXING(SCALAR, DEVICE);                                                                 \
@@ -566,7 +649,8 @@ namespace lrc = librapid;
 	TEST_ARITHMETIC_SCALAR_ARRAY(SCALAR, DEVICE);                                                  \
 	TEST_COMPARISONS(SCALAR, DEVICE);                                                              \
 	TEST_COMPARISONS_ARRAY_SCALAR(SCALAR, DEVICE);                                                 \
-	TEST_COMPARISONS_SCALAR_ARRAY(SCALAR, DEVICE);
+	TEST_COMPARISONS_SCALAR_ARRAY(SCALAR, DEVICE);                                                 \
+	TEST_COMPOUND_ASSIGNMENT(SCALAR, DEVICE);
 
 TEST_CASE("Test Array -- int8_t CPU", "[array-lib]") {
 	TEST_CONSTRUCTORS(int8_t, lrc::device::CPU);
@@ -604,6 +688,117 @@ TEST_CASE("Test Array -- float CPU", "[array-lib]") { TEST_ALL(float, lrc::devic
 
 TEST_CASE("Test Array -- double CPU", "[array-lib]") { TEST_ALL(double, lrc::device::CPU); }
 
+TEST_CASE("Test Array -- 64-bit integer packets", "[array-lib]") {
+	using Packet = lrc::typetraits::TypeInfo<int64_t>::Packet;
+	REQUIRE(lrc::typetraits::TypeInfo<int64_t>::packetWidth == Packet::size());
+	REQUIRE(lrc::typetraits::TypeInfo<uint64_t>::packetWidth == Packet::size());
+
+	// Values which do not fit in 32 bits, so an incorrectly emulated multiply is detected
+	int64_t lhsData[Packet::size()], rhsData[Packet::size()], result[Packet::size()];
+	for (size_t i = 0; i < Packet::size(); ++i) {
+		lhsData[i] = (int64_t(1) << 40) + int64_t(i) * 12345;
+		rhsData[i] = -int64_t(i) - 3;
+	}
+
+	Packet lhs, rhs;
+	lhs.load(lhsData);
+	rhs.load(rhsData);
+
+	(lhs * rhs + Packet(7)).store(result);
+	for (size_t i = 0; i < Packet::size(); ++i) REQUIRE(result[i] == lhsData[i] * rhsData[i] + 7);
+
+	Packet cmp(1);
+	cmp.setZero(!(rhs < Packet(-4)));
+	cmp.store(result);
+	for (size_t i = 0; i < Packet::size(); ++i) REQUIRE(result[i] == (rhsData[i] < -4 ? 1 : 0));
+
+	// Nested expressions use the packet path rather than the dispatched kernels
+	lrc::Array<int64_t> a(lrc::Array<int64_t>::ShapeType {3, 5});
+	lrc::Array<int64_t> b(lrc::Array<int64_t>::ShapeType {3, 5});
+	for (int64_t i = 0; i < 15; ++i) {
+		a.storage()[i] = (int64_t(1) << 35) + i;
+		b.storage()[i] = i + 1;
+	}
+
+	lrc::Array<int64_t> c = (a + b) * b - a;
+	for (int64_t i = 0; i < 15; ++i) {
+		const int64_t x = a.storage()[i], y = b.storage()[i];
+		REQUIRE(c.storage()[i] == (x + y) * y - x);
+	}
+}
+
+TEST_CASE("Test Array -- bool indexing", "[array-lib]") {
+	// Rows of 70 bits, so most rows start part way through a storage word
+	lrc::Array<bool> bits(lrc::Array<bool>::ShapeType {3, 70});
+	for (int64_t i = 0; i < 3; ++i) {
+		for (int64_t j = 0; j < 70; ++j) bits[i][j] = (i * 70 + j) % 3 == 0;
+	}
+
+	for (int64_t i = 0; i < 3; ++i) {
+		for (int64_t j = 0; j < 70; ++j) {
+			REQUIRE(bits[i][j].get() == ((i * 70 + j) % 3 == 0));
+			REQUIRE(bits.storage()[i * 70 + j] == ((i * 70 + j) % 3 == 0));
+		}
+	}
+
+	// Rows reference the original array
+	auto row = bits[1];
+	REQUIRE(row.shape() == lrc::Array<bool>::ShapeType {70});
+	row[5] = true;
+	row[6] = false;
+	REQUIRE(bits.storage()[75]);
+	REQUIRE(!bits.storage()[76]);
+
+	const lrc::Array<bool> &constBits = bits;
+	auto constRow					  = constBits[2].eval();
+	for (int64_t j = 0; j < 70; ++j) {
+		REQUIRE(constRow.storage()[j] == ((140 + j) % 3 == 0));
+	}
+
+	lrc::Array<bool> small(lrc::Array<bool>::ShapeType {2, 2});
+	small.storage()[0] = true;
+	small.storage()[3] = true;
+	REQUIRE(small[0][0].get());
+	REQUIRE(!small[0][1].get());
+	REQUIRE(small[1][1].get());
+}
+
+TEST_CASE("Test Array -- mixed-type compound assignment", "[array-lib]") {
+	// Large enough to run in parallel, and not a multiple of any packet width
+	const int64_t size = 100003;
+
+	lrc::Array<int32_t> ints(lrc::Array<int32_t>::ShapeType {size});
+	lrc::Array<float> floats(lrc::Array<float>::ShapeType {size});
+	lrc::Array<int8_t> bytes(lrc::Array<int8_t>::ShapeType {7});
+	for (int64_t i = 0; i < size; ++i) {
+		ints.storage()[i]	= int32_t(i % 1000) - 500;
+		floats.storage()[i] = float(i % 1000) * 0.25f;
+	}
+	for (int64_t i = 0; i < 7; ++i) bytes.storage()[i] = int8_t(i * 10);
+
+	// The operation is evaluated in the promoted type and only the result is cast back, so
+	// ints *= 1.5 matches the element-wise int(x * 1.5) rather than x * 1
+	ints *= 1.5;
+	floats += 0.1;
+	ints /= 2.5;
+	for (int64_t i = 0; i < size; ++i) {
+		const int32_t x = int32_t(i % 1000) - 500;
+		REQUIRE(ints.storage()[i] == int32_t(int32_t(x * 1.5) / 2.5));
+		REQUIRE(floats.storage()[i] == float(double(float(i % 1000) * 0.25f) + 0.1));
+	}
+
+	// Values which are exactly representable in the array's type give the same result
+	bytes += 1;
+	bytes *= 2.0;
+	for (int64_t i = 0; i < 7; ++i) REQUIRE(bytes.storage()[i] == int8_t((i * 10 + 1) * 2));
+
+	// Values outside the range of the array's type are never converted to it
+	ints /= 1e10;
+	bytes /= -1e300;
+	for (int64_t i = 0; i < size; ++i) REQUIRE(ints.storage()[i] == 0);
+	for (int64_t i = 0; i < 7; ++i) REQUIRE(bytes.storage()[i] == 0);
+}
+
 #if defined(LIBRAPID_USE_MULTIPREC)
 
 TEST_CASE("Test Array -- lrc::mpfr CPU", "[array-lib]") { TEST_ALL(lrc::mpfr, lrc::device::CPU); }
@@ -0,0 +1,76 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+TEST_CASE("Test fromData -- nested data", "[arrayFromData]") {
+	SECTION("Initializer lists") {
+		auto matrix = lrc::fromData<int32_t>({{1, 2, 3}, {4, 5, 6}});
+		REQUIRE(matrix.shape() == lrc::Array<int32_t>::ShapeType {2, 3});
+		for (int32_t i = 0; i < 6; ++i) { REQUIRE(matrix.storage()[i] == i + 1); }
+
+		auto tensor =
+		  lrc::fromData<double>({{{1, 2}, {3, 4}}, {{5, 6}, {7, 8}}, {{9, 10}, {11, 12}}});
+		REQUIRE(tensor.shape() == lrc::Array<double>::ShapeType {3, 2, 2});
+		for (int32_t i = 0; i < 12; ++i) { REQUIRE(tensor.storage()[i] == i + 1); }
+		REQUIRE(tensor[2][1][0].get() == 11);
+
+		auto fourD = lrc::fromData<float>({{{{1}, {2}}}, {{{3}, {4}}}});
+		REQUIRE(fourD.shape() == lrc::Array<float>::ShapeType {2, 1, 2, 1});
+		REQUIRE(fourD.storage()[3] == 4);
+	}
+
+	SECTION("Vectors") {
+		std::vector<std::vector<int64_t>> rows(50, std::vector<int64_t>(7));
+		for (size_t i = 0; i < rows.size(); ++i) {
+			for (size_t j = 0; j < rows[i].size(); ++j) rows[i][j] = i * 10 + j;
+		}
+
+		auto matrix = lrc::fromData(rows);
+		REQUIRE(matrix.shape() == lrc::Array<int64_t>::ShapeType {50, 7});
+		for (size_t i = 0; i < 50; ++i) {
+			for (size_t j = 0; j < 7; ++j) REQUIRE(matrix.storage()[i * 7 + j] == i * 10 + j);
+		}
+
+		std::vector<std::vector<std::vector<int64_t>>> blocks(3, rows);
+		auto tensor = lrc::fromData(blocks);
+		REQUIRE(tensor.shape() == lrc::Array<int64_t>::ShapeType {3, 50, 7});
+		REQUIRE(tensor.storage()[2 * 350 + 49 * 7 + 6] == 496);
+	}
+
+	SECTION("Boolean arrays") {
+		auto array = lrc::fromData<bool>({{true, false, true}, {false, false, true}});
+		REQUIRE(array.shape() == lrc::Array<bool>::ShapeType {2, 3});
+		REQUIRE(array.storage()[0]);
+		REQUIRE(!array.storage()[1]);
+		REQUIRE(array.storage()[5]);
+	}
+
+	SECTION("Ragged data") {
+		REQUIRE_THROWS_AS(lrc::fromData<int32_t>({{1, 2, 3}, {4, 5}}), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::fromData<int32_t>({{{1, 2}}, {{3, 4}, {5, 6}}}),
+						  std::runtime_error);
+
+		std::vector<std::vector<float>> rows {{1, 2}, {3, 4}, {5, 6, 7}};
+		REQUIRE_THROWS_AS(lrc::fromData(rows), std::runtime_error);
+	}
+}
+
+TEST_CASE("Benchmark fromData", "[arrayFromData][benchmark]") {
+	std::vector<std::vector<double>> rows(2000, std::vector<double>(1000));
+	for (size_t i = 0; i < rows.size(); ++i) {
+		for (size_t j = 0; j < rows[i].size(); ++j) rows[i][j] = static_cast<double>(i + j);
+	}
+
+	std::vector<std::vector<std::vector<float>>> blocks(
+	  100, std::vector<std::vector<float>>(100, std::vector<float>(100, 1.0f)));
+
+	BENCHMARK("fromData 2000x1000 std::vector<std::vector<double>>") {
+		return lrc::fromData(rows).storage()[0];
+	};
+
+	BENCHMARK("fromData 100x100x100 std::vector<std::vector<std::vector<float>>>") {
+		return lrc::fromData(blocks).storage()[0];
+	};
+}
@@ -0,0 +1,114 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+TEST_CASE("Test Array String -- alignment", "[arrayString]") {
+	lrc::Array<double> floats(lrc::Array<double>::ShapeType {2, 2});
+	floats << 1.5, 10.25, 100, 2.125;
+	REQUIRE(floats.str() == "[[  1.5 10.25 ]\n [100    2.125]]");
+	REQUIRE(floats.str("{:.1f}") == "[[  1.5 10.2]\n [100.0  2.1]]");
+	REQUIRE(fmt::format("{:.2f}", floats) == "[[  1.50 10.25]\n [100.00  2.12]]");
+
+	lrc::Array<int32_t> ints(lrc::Array<int32_t>::ShapeType {3});
+	ints << -1, 20, 300;
+	REQUIRE(ints.str() == "[-1 20 300]");
+	REQUIRE(ints[1].str() == "20");
+
+	lrc::Array<bool> bools(lrc::Array<bool>::ShapeType {2, 2});
+	bools << true, false, false, true;
+	REQUIRE(bools.str() == "[[ true false]\n [false  true]]");
+}
+
+TEST_CASE("Test Array String -- elision", "[arrayString]") {
+	using ShapeType = lrc::Array<int32_t>::ShapeType;
+
+	SECTION("Vectors") {
+		lrc::Array<int32_t> array(ShapeType {2000});
+		for (int32_t i = 0; i < 2000; ++i) array.storage()[i] = i;
+		REQUIRE(array.str() == "[0 1 2 ... 1997 1998 1999]");
+
+		// Arrays at the threshold are printed in full
+		lrc::Array<int32_t> small(ShapeType {lrc::global::printThreshold});
+		REQUIRE(small.str().find("...") == std::string::npos);
+	}
+
+	SECTION("Matrices") {
+		lrc::Array<int32_t> array(ShapeType {100, 100});
+		for (int32_t i = 0; i < 10000; ++i) array.storage()[i] = i;
+
+		std::string expected = "[";
+		const int32_t rows[] = {0, 1, 2, -1, 97, 98, 99};
+		for (size_t i = 0; i < 7; ++i) {
+			if (i > 0) expected += "\n ";
+			if (rows[i] < 0) {
+				expected += "...";
+				continue;
+			}
+			const int32_t row = rows[i] * 100;
+			expected += fmt::format("[{:>4} {:>4} {:>4} ... {:>4} {:>4} {:>4}]",
+									row,
+									row + 1,
+									row + 2,
+									row + 97,
+									row + 98,
+									row + 99);
+		}
+		expected += "]";
+		REQUIRE(array.str() == expected);
+
+		// Views are elided according to their own size
+		REQUIRE(array[0].str().find("...") == std::string::npos);
+		lrc::Array<int32_t> wide(ShapeType {2, 2000});
+		for (int32_t i = 0; i < 4000; ++i) wide.storage()[i] = i;
+		REQUIRE(wide[1].str() == "[2000 2001 2002 ... 3997 3998 3999]");
+	}
+
+	SECTION("Higher dimensions") {
+		lrc::Array<int32_t> array(ShapeType {20, 2, 50});
+		for (int32_t i = 0; i < 2000; ++i) array.storage()[i] = i % 10;
+
+		const std::string block = "[[0 1 2 ... 7 8 9]\n  [0 1 2 ... 7 8 9]]";
+		std::string expected	= "[" + block;
+		for (int i = 0; i < 2; ++i) expected += "\n\n " + block;
+		expected += "\n\n ...";
+		for (int i = 0; i < 3; ++i) expected += "\n\n " + block;
+		expected += "]";
+		REQUIRE(array.str() == expected);
+	}
+
+	SECTION("Settings") {
+		const int64_t prevThreshold = lrc::global::printThreshold;
+		const int64_t prevEdgeItems = lrc::global::printEdgeItems;
+
+		lrc::Array<int32_t> array(ShapeType {10});
+		for (int32_t i = 0; i < 10; ++i) array.storage()[i] = i;
+
+		lrc::global::printThreshold = 5;
+		lrc::global::printEdgeItems = 1;
+		REQUIRE(array.str() == "[0 ... 9]");
+
+		lrc::global::printEdgeItems = 5;
+		REQUIRE(array.str() == "[0 1 2 3 4 5 6 7 8 9]");
+
+		lrc::global::printEdgeItems = 2;
+		lrc::global::printThreshold = -1;
+		REQUIRE(array.str() == "[0 1 2 3 4 5 6 7 8 9]");
+
+		lrc::global::printThreshold = prevThreshold;
+		lrc::global::printEdgeItems = prevEdgeItems;
+	}
+}
+
+TEST_CASE("Benchmark Array String", "[arrayString][benchmark]") {
+	lrc::Array<double> array(lrc::Array<double>::ShapeType {1000, 1000});
+	lrc::fillRandom(array, -100.0, 100.0, 1);
+
+	BENCHMARK("str() 1000x1000 (elided)") { return array.str().size(); };
+
+	const int64_t prevThreshold = lrc::global::printThreshold;
+	lrc::global::printThreshold = -1;
+	BENCHMARK("str() 1000x1000 (full)") { return array.str().size(); };
+	lrc::global::printThreshold = prevThreshold;
+}
@@ -0,0 +1,135 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+TEST_CASE("Test BitStorage -- storage", "[bitStorage]") {
+	lrc::BitStorage<> empty;
+	REQUIRE(empty.size() == 0);
+
+	lrc::BitStorage<> zeros(130);
+	REQUIRE(zeros.size() == 130);
+	REQUIRE(zeros.numWords() == 3);
+	REQUIRE(zeros.count() == 0);
+	REQUIRE(!zeros.any());
+
+	lrc::BitStorage<> ones(130, true);
+	REQUIRE(ones.count() == 130);
+	REQUIRE(ones.all());
+
+	ones[5]	  = false;
+	ones[129] = false;
+	REQUIRE(!ones[5]);
+	REQUIRE(ones[6]);
+	REQUIRE(ones.count() == 128);
+	REQUIRE(!ones.all());
+
+	// Growing keeps the existing bits and zeroes the new ones
+	ones.resize(200);
+	REQUIRE(ones.size() == 200);
+	REQUIRE(ones.count() == 128);
+	REQUIRE(!ones[150]);
+
+	// Shrinking clears the padding, so the count stays consistent
+	ones.resize(100);
+	REQUIRE(ones.count() == 99);
+
+	lrc::BitStorage<> list = {true, false, true, true};
+	REQUIRE(list.size() == 4);
+	REQUIRE(list.count() == 3);
+	REQUIRE(!list[1]);
+
+	auto fromData = lrc::BitStorage<>::fromData(std::vector<bool> {false, true, false});
+	REQUIRE(fromData.count() == 1);
+	REQUIRE(fromData[1]);
+
+	lrc::BitStorage<> copy(list);
+	copy[1] = true;
+	REQUIRE(copy.all());
+	REQUIRE(!list[1]);
+
+	int64_t set = 0;
+	for (bool bit : list) set += bit;
+	REQUIRE(set == 3);
+
+	REQUIRE(sizeof(lrc::Array<bool>::StorageType::Scalar) == sizeof(bool));
+	REQUIRE(lrc::typetraits::IsBitStorage<lrc::Array<bool>::StorageType>::value);
+}
+
+#define TEST_BIT_MASK(SCALAR)                                                                      \
+	SECTION(fmt::format("Test Comparison Masks [{}]", STRINGIFY(SCALAR))) {                        \
+		for (int64_t size : {1, 63, 64, 65, 1003, 10007}) {                                        \
+			lrc::Array<SCALAR> lhs(lrc::Array<SCALAR>::ShapeType {size});                          \
+			lrc::Array<SCALAR> rhs(lrc::Array<SCALAR>::ShapeType {size});                          \
+			for (int64_t i = 0; i < size; ++i) {                                                   \
+				lhs.storage()[i] = SCALAR(i % 11);                                                 \
+				rhs.storage()[i] = SCALAR(i % 7);                                                  \
+			}                                                                                      \
+                                                                                                   \
+			lrc::Array<bool> lt	 = lhs < rhs;                                                      \
+			lrc::Array<bool> geq = lhs >= rhs;                                                     \
+			lrc::Array<bool> eq	 = lhs == rhs;                                                     \
+			lrc::Array<bool> sum = lhs + rhs;                                                      \
+                                                                                                   \
+			int64_t expectedCount = 0;                                                             \
+			for (int64_t i = 0; i < size; ++i) {                                                   \
+				bool expected = (i % 11) < (i % 7);                                                \
+				expectedCount += expected;                                                         \
+				REQUIRE(lt.storage()[i] == expected);                                              \
+				REQUIRE(geq.storage()[i] == !expected);                                            \
+				REQUIRE(eq.storage()[i] == ((i % 11) == (i % 7)));                                 \
+				REQUIRE(sum.storage()[i] == ((i % 11) + (i % 7) != 0));                            \
+			}                                                                                      \
+                                                                                                   \
+			REQUIRE(lrc::count(lt) == expectedCount);                                              \
+			REQUIRE(lrc::count(lhs < rhs) == expectedCount);                                       \
+			REQUIRE(lrc::count(geq) == size - expectedCount);                                      \
+			REQUIRE(lrc::any(eq));                                                                 \
+		}                                                                                          \
+	}
+
+TEST_CASE("Test BitStorage -- comparison masks", "[bitStorage]") {
+	TEST_BIT_MASK(float)
+	TEST_BIT_MASK(double)
+	TEST_BIT_MASK(int32_t)
+	TEST_BIT_MASK(int64_t)
+}
+
+TEST_CASE("Test BitStorage -- logical operations", "[bitStorage]") {
+	for (int64_t size : {1, 64, 100, 10007}) {
+		lrc::Array<bool> lhs(lrc::Array<bool>::ShapeType {size});
+		lrc::Array<bool> rhs(lrc::Array<bool>::ShapeType {size});
+		for (int64_t i = 0; i < size; ++i) {
+			lhs.storage()[i] = i % 3 == 0;
+			rhs.storage()[i] = i % 2 == 0;
+		}
+
+		lrc::Array<bool> andRes = lhs & rhs;
+		lrc::Array<bool> orRes	= lhs | rhs;
+		lrc::Array<bool> xorRes = lhs ^ rhs;
+		lrc::Array<bool> notRes = !lhs;
+		lrc::Array<bool> expr	= (lhs | rhs) & !(lhs & rhs);
+		lrc::Array<bool> scalar = lhs ^ true;
+
+		for (int64_t i = 0; i < size; ++i) {
+			bool x = i % 3 == 0;
+			bool y = i % 2 == 0;
+			REQUIRE(andRes.storage()[i] == (x && y));
+			REQUIRE(orRes.storage()[i] == (x || y));
+			REQUIRE(xorRes.storage()[i] == (x != y));
+			REQUIRE(notRes.storage()[i] == !x);
+			REQUIRE(expr.storage()[i] == (x != y));
+			REQUIRE(scalar.storage()[i] == !x);
+		}
+
+		REQUIRE(lrc::count(expr) == lrc::count(xorRes));
+		REQUIRE(lrc::count(lhs) + lrc::count(!lhs) == size);
+		REQUIRE(lrc::all(lhs | !lhs));
+		REQUIRE(!lrc::any(lhs & !lhs));
+	}
+
+	lrc::Array<bool> small = {true, false, true};
+	REQUIRE(fmt::format("{}", small) == "[true false true]");
+}
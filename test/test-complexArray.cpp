@@ -0,0 +1,213 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+template<typename T>
+static T tolerance() {
+	return std::is_same_v<T, float> ? T(1e-5) : T(1e-12);
+}
+
+template<typename T>
+static bool isClose(T lhs, T rhs) {
+	return std::abs(lhs - rhs) <= tolerance<T>() * std::max(T(1), std::abs(rhs));
+}
+
+template<typename T>
+static bool isClose(const lrc::Complex<T> &lhs, const lrc::Complex<T> &rhs) {
+	return isClose(lhs.real(), rhs.real()) && isClose(lhs.imag(), rhs.imag());
+}
+
+template<typename T>
+static lrc::Array<lrc::Complex<T>> randomComplex(int64_t size, uint64_t seed, T range = T(10)) {
+	std::mt19937_64 generator(seed);
+	std::uniform_real_distribution<T> distribution(-range, range);
+	lrc::Array<lrc::Complex<T>> res(lrc::Shape({size}));
+	for (int64_t i = 0; i < size; ++i) {
+		res.storage()[i] = lrc::Complex<T>(distribution(generator), distribution(generator));
+	}
+	return res;
+}
+
+TEST_CASE("Test ComplexPacket", "[complexArray]") {
+	using Complex = lrc::Complex<double>;
+	using Packet  = lrc::detail::ComplexPacket<double>;
+	constexpr size_t width = Packet::size();
+	REQUIRE(lrc::typetraits::TypeInfo<Complex>::packetWidth == width);
+
+	std::vector<Complex> values(width), result(width);
+	for (size_t i = 0; i < width; ++i) values[i] = Complex(double(i) + 1, -2 * double(i));
+
+	Packet packet;
+	packet.load(values.data());
+	for (size_t i = 0; i < width; ++i) {
+		REQUIRE(packet[i].real() == values[i].real());
+		REQUIRE(packet[i].imag() == values[i].imag());
+		REQUIRE(packet.real()[i] == values[i].real());
+		REQUIRE(packet.imag()[i] == values[i].imag());
+	}
+
+	packet.store(result.data());
+	for (size_t i = 0; i < width; ++i) REQUIRE(isClose(result[i], values[i]));
+
+	// Broadcasting
+	const Packet broadcast(Complex(3, -4));
+	const Packet real(2.5);
+	for (size_t i = 0; i < width; ++i) {
+		REQUIRE(isClose(broadcast[i], Complex(3, -4)));
+		REQUIRE(isClose(real[i], Complex(2.5, 0)));
+	}
+
+	// Division by zero gives NaN, as it does for scalars
+	const Complex quotient = (Packet(Complex(1, 1)) / Packet(Complex(0, 0)))[0];
+	REQUIRE(std::isnan(quotient.real()));
+	REQUIRE(std::isnan(quotient.imag()));
+
+	// The magnitude neither overflows nor underflows when the squared magnitude would
+	REQUIRE(isClose(abs(Packet(Complex(3e300, 4e300)))[0], 5e300));
+	REQUIRE(isClose(abs(Packet(Complex(3e-300, -4e-300)))[0] * 1e300, 5.0));
+	REQUIRE(abs(Packet(Complex(0, 0)))[0] == 0);
+	REQUIRE(std::isinf(abs(Packet(Complex(INFINITY, -INFINITY)))[0]));
+
+	// Equality compares both components
+	const auto mask = Packet(Complex(1, 2)) == Packet(Complex(1, 3));
+	REQUIRE(!mask[0]);
+	REQUIRE((Packet(Complex(1, 2)) != Packet(Complex(1, 3)))[0]);
+}
+
+template<typename T>
+static void testComplexArray(int64_t size) {
+	using Complex = lrc::Complex<T>;
+	const auto lhs = randomComplex<T>(size, 1234 + size);
+	const auto rhs = randomComplex<T>(size, 5678 + size);
+	lrc::Array<T> real(lrc::Shape({size}));
+	for (int64_t i = 0; i < size; ++i) real.storage()[i] = T(i % 7) - T(3);
+
+	const lrc::Array<Complex> product	 = lhs * rhs;
+	const lrc::Array<Complex> quotient	 = lhs / rhs;
+	const lrc::Array<Complex> sum		 = lhs + rhs - lhs * Complex(2, -1);
+	const lrc::Array<Complex> scaled	 = lhs * T(3);
+	const lrc::Array<Complex> mixed		 = lhs * real;
+	const lrc::Array<Complex> conjugate	 = lrc::conj(lhs);
+	const lrc::Array<Complex> conjProd	 = lrc::conjMultiply(lhs, rhs);
+	const lrc::Array<T> magnitude		 = lrc::abs(lhs);
+	const lrc::Array<T> productMagnitude = lrc::abs(lhs * rhs);
+	const lrc::Array<T> phase			 = lrc::arg(lhs);
+
+	// Keep the real components small enough that the exponential does not overflow a float
+	const auto small					 = randomComplex<T>(size, 42 + size, T(5));
+	const lrc::Array<Complex> exponent	 = lrc::exp(small);
+
+	lrc::Array<Complex> inPlace = lhs;
+	inPlace *= rhs;
+	inPlace /= Complex(2, 1);
+
+	for (int64_t i = 0; i < size; ++i) {
+		const Complex a = lhs.storage()[i];
+		const Complex b = rhs.storage()[i];
+		REQUIRE(isClose(Complex(product.storage()[i]), a * b));
+		REQUIRE(isClose(Complex(quotient.storage()[i]), a / b));
+		REQUIRE(isClose(Complex(sum.storage()[i]), a + b - a * Complex(2, -1)));
+		REQUIRE(isClose(Complex(scaled.storage()[i]), a * T(3)));
+		REQUIRE(isClose(Complex(mixed.storage()[i]), a * T(real.storage()[i])));
+		REQUIRE(isClose(Complex(conjugate.storage()[i]), lrc::conj(a)));
+		REQUIRE(isClose(Complex(conjProd.storage()[i]), a * lrc::conj(b)));
+		REQUIRE(isClose(T(magnitude.storage()[i]), lrc::abs(a)));
+		REQUIRE(isClose(T(productMagnitude.storage()[i]), lrc::abs(a * b)));
+		REQUIRE(isClose(T(phase.storage()[i]), lrc::arg(a)));
+		REQUIRE(isClose(Complex(exponent.storage()[i]), lrc::exp(Complex(small.storage()[i]))));
+		REQUIRE(isClose(Complex(inPlace.storage()[i]), a * b / Complex(2, 1)));
+	}
+}
+
+TEST_CASE("Test complex array operations", "[complexArray]") {
+	SECTION("Serial") {
+		// Sizes which leave 0, 1 and several elements after the last whole packet
+		for (int64_t size : {0, 1, 3, 4, 7, 16, 1001}) {
+			testComplexArray<float>(size);
+			testComplexArray<double>(size);
+		}
+	}
+
+	SECTION("Parallel") {
+		const int64_t prevThreads	= lrc::global::numThreads;
+		const int64_t prevThreshold = lrc::global::multithreadThreshold;
+		lrc::global::numThreads			  = 4;
+		lrc::global::multithreadThreshold = 0;
+
+		testComplexArray<float>(1001);
+		testComplexArray<double>(1001);
+
+		lrc::global::numThreads			  = prevThreads;
+		lrc::global::multithreadThreshold = prevThreshold;
+	}
+}
+
+static void benchmarkComplexArray(int64_t size) {
+	using Complex  = lrc::Complex<double>;
+	const auto lhs = randomComplex<double>(size, 1);
+	const auto rhs = randomComplex<double>(size, 2);
+
+	const std::vector<Complex> lhsVector(lhs.storage().begin(), lhs.storage().begin() + size);
+	const std::vector<Complex> rhsVector(rhs.storage().begin(), rhs.storage().begin() + size);
+	std::vector<Complex> vector(size);
+	std::vector<double> realVector(size);
+	lrc::Array<Complex> array(lrc::Shape({size}));
+	lrc::Array<double> realArray(lrc::Shape({size}));
+
+	BENCHMARK(fmt::format("Multiply {} complex values with std::vector", size)) {
+		for (int64_t i = 0; i < size; ++i) vector[i] = lhsVector[i] * rhsVector[i];
+		return vector[0];
+	};
+
+	BENCHMARK(fmt::format("Multiply {} complex values with Array", size)) {
+		array = lhs * rhs;
+		return array.storage()[0];
+	};
+
+	BENCHMARK(fmt::format("Divide {} complex values with std::vector", size)) {
+		for (int64_t i = 0; i < size; ++i) vector[i] = lhsVector[i] / rhsVector[i];
+		return vector[0];
+	};
+
+	BENCHMARK(fmt::format("Divide {} complex values with Array", size)) {
+		array = lhs / rhs;
+		return array.storage()[0];
+	};
+
+	BENCHMARK(fmt::format("Conjugate multiply {} complex values with std::vector", size)) {
+		for (int64_t i = 0; i < size; ++i) vector[i] = lhsVector[i] * lrc::conj(rhsVector[i]);
+		return vector[0];
+	};
+
+	BENCHMARK(fmt::format("Conjugate multiply {} complex values with Array", size)) {
+		array = lrc::conjMultiply(lhs, rhs);
+		return array.storage()[0];
+	};
+
+	BENCHMARK(fmt::format("Magnitude of {} complex values with std::vector", size)) {
+		for (int64_t i = 0; i < size; ++i) realVector[i] = lrc::abs(lhsVector[i]);
+		return realVector[0];
+	};
+
+	BENCHMARK(fmt::format("Magnitude of {} complex values with Array", size)) {
+		realArray = lrc::abs(lhs);
+		return realArray.storage()[0];
+	};
+
+	BENCHMARK(fmt::format("Exponential of {} complex values with std::vector", size)) {
+		for (int64_t i = 0; i < size; ++i) vector[i] = lrc::exp(lhsVector[i]);
+		return vector[0];
+	};
+
+	BENCHMARK(fmt::format("Exponential of {} complex values with Array", size)) {
+		array = lrc::exp(lhs);
+		return array.storage()[0];
+	};
+}
+
+TEST_CASE("Benchmark complex arrays", "[complexArray][benchmark]") {
+	benchmarkComplexArray(4096);
+	benchmarkComplexArray(1000000);
+}
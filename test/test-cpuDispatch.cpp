@@ -0,0 +1,65 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+#define TEST_DISPATCH(SCALAR)                                                                      \
+	SECTION(fmt::format("Test Dispatched Kernels [{}]", STRINGIFY(SCALAR))) {                      \
+		const lrc::SimdLevel initial = lrc::simdLevel();                                           \
+		const int64_t size			 = 1003;                                                       \
+		lrc::Array<SCALAR> lhs(lrc::Array<SCALAR>::ShapeType {size});                              \
+		lrc::Array<SCALAR> rhs(lrc::Array<SCALAR>::ShapeType {size});                              \
+		for (int64_t i = 0; i < size; ++i) {                                                       \
+			lhs.storage()[i] = static_cast<SCALAR>(i % 100 + 50);                                  \
+			rhs.storage()[i] = static_cast<SCALAR>(i % 7 + 1);                                     \
+		}                                                                                          \
+                                                                                                   \
+		for (auto level : {lrc::SimdLevel::Generic,                                                \
+						   lrc::SimdLevel::SSE4,                                                   \
+						   lrc::SimdLevel::AVX2,                                                   \
+						   lrc::SimdLevel::AVX512}) {                                              \
+			REQUIRE(lrc::setSimdLevel(level) == std::min(level, lrc::detectSimdLevel()));          \
+                                                                                                   \
+			lrc::Array<SCALAR> sum		= lhs + rhs;                                               \
+			lrc::Array<SCALAR> diff		= lhs - rhs;                                               \
+			lrc::Array<SCALAR> prod		= lhs * rhs;                                               \
+			lrc::Array<SCALAR> quot		= lhs / rhs;                                               \
+			lrc::Array<SCALAR> scalarR	= lhs - SCALAR(3);                                         \
+			lrc::Array<SCALAR> scalarL	= SCALAR(200) - lhs;                                       \
+			lrc::Array<SCALAR> inPlace	= lhs;                                                     \
+			inPlace *= rhs;                                                                        \
+                                                                                                   \
+			for (int64_t i = 0; i < size; ++i) {                                                   \
+				const SCALAR a = lhs.storage()[i];                                                 \
+				const SCALAR b = rhs.storage()[i];                                                 \
+				REQUIRE(sum.storage()[i] == SCALAR(a + b));                                        \
+				REQUIRE(diff.storage()[i] == SCALAR(a - b));                                       \
+				REQUIRE(prod.storage()[i] == SCALAR(a * b));                                       \
+				REQUIRE(quot.storage()[i] == SCALAR(a / b));                                       \
+				REQUIRE(scalarR.storage()[i] == SCALAR(a - SCALAR(3)));                            \
+				REQUIRE(scalarL.storage()[i] == SCALAR(SCALAR(200) - a));                          \
+				REQUIRE(inPlace.storage()[i] == SCALAR(a * b));                                    \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		lrc::setSimdLevel(initial);                                                                \
+	}
+
+TEST_CASE("Test CPU Dispatch", "[cpuDispatch]") {
+	SECTION("Test SIMD Level Query") {
+		REQUIRE(lrc::simdLevel() <= lrc::detectSimdLevel());
+		REQUIRE(std::string(lrc::simdLevelName(lrc::SimdLevel::Generic)) == "generic");
+		REQUIRE(std::string(lrc::simdLevelName(lrc::SimdLevel::SSE4)) == "sse4");
+		REQUIRE(std::string(lrc::simdLevelName(lrc::SimdLevel::AVX2)) == "avx2");
+		REQUIRE(std::string(lrc::simdLevelName(lrc::SimdLevel::AVX512)) == "avx512");
+	}
+
+	TEST_DISPATCH(int32_t);
+	TEST_DISPATCH(uint32_t);
+	TEST_DISPATCH(int64_t);
+	TEST_DISPATCH(uint64_t);
+	TEST_DISPATCH(float);
+	TEST_DISPATCH(double);
+}
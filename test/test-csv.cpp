@@ -0,0 +1,277 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <filesystem>
+#include <fstream>
+
+namespace lrc = librapid;
+
+static std::string tempPath(const std::string &name) {
+	return (std::filesystem::temp_directory_path() / name).string();
+}
+
+static void writeFile(const std::string &path, const std::string &contents) {
+	std::ofstream out(path, std::ios::binary);
+	out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+// Check that parsing \p text throws an exception whose message contains \p expected
+static void requireError(const std::string &text, const std::string &expected,
+						 const lrc::CsvOptions &options = {}) {
+	try {
+		(void)lrc::parseCsv<double>(text, options);
+		FAIL("Expected an exception");
+	} catch (const std::runtime_error &error) {
+		INFO(error.what());
+		REQUIRE(std::string(error.what()).find(expected) != std::string::npos);
+	}
+}
+
+TEST_CASE("Test CSV -- parsing", "[csv]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+
+	SECTION("Comma-separated values") {
+		auto array = lrc::parseCsv<double>("x,y,z\n"
+										   "1, 2.5 ,-3\r\n"
+										   "\n"
+										   "# A comment\n"
+										   "  4e2,+5,6.  # Another comment\n"
+										   "7,8,.9",
+										   {',', '#', 1});
+		REQUIRE(array.shape() == ShapeType {3, 3});
+		const double expected[] = {1, 2.5, -3, 400, 5, 6, 7, 8, 0.9};
+		for (size_t i = 0; i < 9; ++i) { REQUIRE(array.storage()[i] == expected[i]); }
+	}
+
+	SECTION("Other delimiters") {
+		lrc::CsvOptions options;
+		options.delimiter = ' ';
+		auto spaces		  = lrc::parseCsv<int32_t>("  1  2\t3\n4 5   6  \n", options);
+		REQUIRE(spaces.shape() == lrc::Array<int32_t>::ShapeType {2, 3});
+		for (int32_t i = 0; i < 6; ++i) { REQUIRE(spaces.storage()[i] == i + 1); }
+
+		options.delimiter = '\t';
+		auto tabs		  = lrc::parseCsv<int32_t>("1\t 2\n3\t4\n", options);
+		REQUIRE(tabs.shape() == lrc::Array<int32_t>::ShapeType {2, 2});
+		REQUIRE(tabs.storage()[1] == 2);
+		requireError("1\t\t2\n", "Missing value in column 2", options);
+
+		options.delimiter = ';';
+		options.comment	  = '\0';
+		requireError("#1\n", "Invalid value '#1'", options);
+		options.comment = '#';
+		auto column		= lrc::parseCsv<float>("#1\n2\n3\n", options);
+		REQUIRE(column.shape() == lrc::Array<float>::ShapeType {2, 1});
+		REQUIRE(column.storage()[1] == 3);
+	}
+
+	SECTION("Integers") {
+		auto array = lrc::parseCsv<int64_t>("-9223372036854775808, 9223372036854775807, +7\n");
+		REQUIRE(array.storage()[0] == std::numeric_limits<int64_t>::min());
+		REQUIRE(array.storage()[1] == std::numeric_limits<int64_t>::max());
+		REQUIRE(array.storage()[2] == 7);
+
+		auto bytes = lrc::parseCsv<uint8_t>("0,255\n");
+		REQUIRE(bytes.storage()[1] == 255);
+		REQUIRE_THROWS_AS(lrc::parseCsv<uint8_t>("256\n"), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::parseCsv<uint8_t>("-1\n"), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::parseCsv<int32_t>("1.5\n"), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::parseCsv<int32_t>("+-1\n"), std::runtime_error);
+	}
+
+	SECTION("Floating point values are correctly rounded") {
+		const char *text = "0.1,1e22,1e23,-0,2.2250738585072014e-308,4.9e-324,"
+						   "1.7976931348623157e308,123456789012345678901234567890,"
+						   "0.30000000000000004,9007199254740993,inf,-Infinity,nan\n";
+		auto array		 = lrc::parseCsv<double>(text);
+		const double expected[] = {0.1,
+								   1e22,
+								   1e23,
+								   -0.0,
+								   2.2250738585072014e-308,
+								   4.9e-324,
+								   1.7976931348623157e308,
+								   123456789012345678901234567890.0,
+								   0.30000000000000004,
+								   9007199254740992.0};
+		for (size_t i = 0; i < 10; ++i) { REQUIRE(array.storage()[i] == expected[i]); }
+		REQUIRE(std::signbit(array.storage()[3]));
+		REQUIRE(array.storage()[10] == std::numeric_limits<double>::infinity());
+		REQUIRE(array.storage()[11] == -std::numeric_limits<double>::infinity());
+		REQUIRE(std::isnan(array.storage()[12]));
+
+		auto floats = lrc::parseCsv<float>("0.1,16777217,3.4028235e38,1e-45\n");
+		REQUIRE(floats.storage()[0] == 0.1f);
+		REQUIRE(floats.storage()[1] == 16777216.0f);
+		REQUIRE(floats.storage()[2] == 3.4028235e38f);
+		REQUIRE(floats.storage()[3] == 1e-45f);
+
+		auto halves = lrc::parseCsv<lrc::half>("0.5,-2,65504\n");
+		REQUIRE(static_cast<float>(halves.storage()[0]) == 0.5f);
+		REQUIRE(static_cast<float>(halves.storage()[2]) == 65504.0f);
+
+		// Shortest round-trip representations of random values must parse back exactly
+		std::mt19937_64 generator(42);
+		std::string random;
+		std::vector<double> values;
+		for (size_t i = 0; i < 10000; ++i) {
+			uint64_t bits;
+			do { bits = generator(); } while (std::isnan(lrc::bitCast<double>(bits)) ||
+											   std::isinf(lrc::bitCast<double>(bits)));
+			values.push_back(i % 2 == 0 ? lrc::bitCast<double>(bits)
+										: static_cast<double>(bits % 1000000) / 1000);
+			random += fmt::format("{}\n", values.back());
+		}
+		auto parsed = lrc::parseCsv<double>(random);
+		for (size_t i = 0; i < values.size(); ++i) { REQUIRE(parsed.storage()[i] == values[i]); }
+	}
+
+	SECTION("Errors") {
+		requireError("1,2\n3,x\n", "(line 2): Invalid value 'x' in column 2");
+		requireError("1,2\n3\n", "(line 2): Expected 2 columns but found 1");
+		requireError("# Header\n\n1,2\n3,4,5\n", "(line 4): Expected 2 columns but found more");
+		requireError("1,2\n3,\n", "Missing value in column 2");
+		requireError("1,2 3\n", "Invalid value '2 3'");
+		requireError("# Nothing here\n\n", "does not contain any data");
+		requireError("", "does not contain any data");
+	}
+}
+
+TEST_CASE("Test CSV -- files", "[csv]") {
+	using ShapeType	 = lrc::Array<double>::ShapeType;
+	std::string path = tempPath("librapid-test-csv.csv");
+
+	const int64_t prevThreads = lrc::global::numThreads;
+	lrc::global::numThreads	  = 4;
+
+	// Enough rows to be split between threads
+	const size_t rows = 50000;
+	std::string text  = "a,b,c,d\n";
+	for (size_t i = 0; i < rows; ++i) {
+		text += fmt::format("{},{},{},{}\n", i, i * 0.5, -static_cast<double>(i), i % 7);
+		if (i % 1000 == 0) text += "# Comment\n\n";
+	}
+	text += "# A long line\n" + std::string(200, ' ') + "1,2,3,4";
+	writeFile(path, text);
+
+	const auto check = [&](const lrc::Array<double> &array) {
+		REQUIRE(array.shape() == ShapeType {rows + 1, size_t(4)});
+		for (size_t i = 0; i < rows; ++i) {
+			REQUIRE(array.storage()[i * 4 + 0] == static_cast<double>(i));
+			REQUIRE(array.storage()[i * 4 + 1] == i * 0.5);
+			REQUIRE(array.storage()[i * 4 + 2] == -static_cast<double>(i));
+			REQUIRE(array.storage()[i * 4 + 3] == static_cast<double>(i % 7));
+		}
+		REQUIRE(array.storage()[rows * 4 + 3] == 4);
+	};
+
+	lrc::CsvOptions options;
+	options.skipRows = 1;
+
+	SECTION("Two passes") {
+		check(lrc::loadCsv<double>(path, options));
+		check(lrc::parseCsv<double>(text, options));
+	}
+
+	SECTION("One pass") {
+		options.twoPass = false;
+		check(lrc::loadCsv<double>(path, options));
+		check(lrc::parseCsv<double>(text, options));
+	}
+
+	SECTION("Small chunks") {
+		// Lines span chunk boundaries, and some lines are longer than a chunk
+		options.chunkSize = 100;
+		check(lrc::loadCsv<double>(path, options));
+		options.twoPass = false;
+		check(lrc::loadCsv<double>(path, options));
+	}
+
+	SECTION("Comments longer than a chunk") {
+		// The first chunks after the skipped rows hold no data
+		std::string commented = "a,b,c,d\n";
+		for (size_t i = 0; i < 20; ++i) commented += "# A comment before the data\n\n";
+		writeFile(path, commented + text.substr(text.find('\n') + 1));
+		options.chunkSize = 100;
+		check(lrc::loadCsv<double>(path, options));
+		options.twoPass = false;
+		check(lrc::loadCsv<double>(path, options));
+	}
+
+	SECTION("Existing arrays") {
+		lrc::Array<double> dst(ShapeType {rows + 1, size_t(4)});
+		const double *before = dst.storage().begin();
+		lrc::loadCsv(path, dst, options);
+		REQUIRE(dst.storage().begin() == before);
+		check(dst);
+
+		lrc::Array<double> tooSmall(ShapeType {rows, size_t(4)});
+		REQUIRE_THROWS_AS(lrc::loadCsv(path, tooSmall, options), std::runtime_error);
+		lrc::Array<double> tooLarge(ShapeType {rows + 2, size_t(4)});
+		REQUIRE_THROWS_AS(lrc::loadCsv(path, tooLarge, options), std::runtime_error);
+		lrc::Array<double> wrongColumns(ShapeType {(rows + 1) * 2, size_t(2)});
+		REQUIRE_THROWS_AS(lrc::loadCsv(path, wrongColumns, options), std::runtime_error);
+	}
+
+	SECTION("Errors report the line in the file") {
+		writeFile(path, text + "\n1,2,3,oops\n");
+		options.chunkSize = 4096;
+		try {
+			(void)lrc::loadCsv<double>(path, options);
+			FAIL("Expected an exception");
+		} catch (const std::runtime_error &error) {
+			const size_t line = static_cast<size_t>(std::count(text.begin(), text.end(), '\n'));
+			REQUIRE(std::string(error.what()).find(fmt::format("(line {})", line + 2)) !=
+					std::string::npos);
+		}
+
+		REQUIRE_THROWS_AS(lrc::loadCsv<double>(tempPath("librapid-missing.csv")),
+						  std::runtime_error);
+	}
+
+	lrc::global::numThreads = prevThreads;
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Benchmark CSV", "[csv][benchmark]") {
+	std::string path = tempPath("librapid-bench-csv.csv");
+
+	const size_t rows = 1 << 18;
+	std::string text;
+	std::mt19937 generator(1);
+	std::uniform_real_distribution<double> distribution(-1000, 1000);
+	for (size_t i = 0; i < rows; ++i) {
+		for (size_t j = 0; j < 8; ++j) {
+			text += fmt::format(j == 0 ? "{:.6f}" : ",{:.6f}", distribution(generator));
+		}
+		text += '\n';
+	}
+	writeFile(path, text);
+
+	BENCHMARK("loadCsv 2M values") { return lrc::loadCsv<double>(path).storage()[0]; };
+
+	BENCHMARK("loadCsv 2M values (one pass)") {
+		lrc::CsvOptions options;
+		options.twoPass = false;
+		return lrc::loadCsv<double>(path, options).storage()[0];
+	};
+
+	BENCHMARK("std::vector<std::vector<double>> + fromData 2M values") {
+		std::ifstream in(path);
+		std::vector<std::vector<double>> data;
+		std::string line;
+		while (std::getline(in, line)) {
+			std::vector<double> row;
+			const char *ptr = line.c_str();
+			char *end		= nullptr;
+			while (*ptr != '\0') {
+				row.push_back(std::strtod(ptr, &end));
+				ptr = *end == ',' ? end + 1 : end;
+			}
+			data.push_back(std::move(row));
+		}
+		return lrc::fromData(data).storage()[0];
+	};
+
+	std::filesystem::remove(path);
+}
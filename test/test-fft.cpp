@@ -0,0 +1,304 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+template<typename T>
+using ComplexArray = lrc::Array<lrc::Complex<T>>;
+using ShapeType	   = lrc::Array<double>::ShapeType;
+using Reference	   = std::vector<std::complex<double>>;
+
+template<typename T>
+static T tolerance() {
+	return std::is_same_v<T, float> ? T(2e-5) : T(1e-12);
+}
+
+template<typename T>
+static ComplexArray<T> randomComplex(const ShapeType &shape, uint64_t seed) {
+	std::mt19937_64 generator(seed);
+	std::uniform_real_distribution<T> distribution(-1, 1);
+	ComplexArray<T> res(shape);
+	for (size_t i = 0; i < shape.size(); ++i) {
+		res.storage()[i] = lrc::Complex<T>(distribution(generator), distribution(generator));
+	}
+	return res;
+}
+
+template<typename T>
+static lrc::Array<T> randomReal(const ShapeType &shape, uint64_t seed) {
+	std::mt19937_64 generator(seed);
+	std::uniform_real_distribution<T> distribution(-1, 1);
+	lrc::Array<T> res(shape);
+	for (size_t i = 0; i < shape.size(); ++i) res.storage()[i] = distribution(generator);
+	return res;
+}
+
+template<typename StorageType>
+static Reference values(const lrc::ArrayRef<StorageType> &array) {
+	Reference res(array.shape().size());
+	for (size_t i = 0; i < res.size(); ++i) {
+		const auto value = array.storage()[i];
+		if constexpr (lrc::typetraits::IsComplex<typename StorageType::Scalar>::value) {
+			res[i] = {double(value.real()), double(value.imag())};
+		} else {
+			res[i] = {double(value), 0.0};
+		}
+	}
+	return res;
+}
+
+// Transform every line along \p axis with a direct DFT, in double precision
+static Reference referenceDft(const Reference &data, const ShapeType &shape, int64_t axis,
+							  bool inverse) {
+	const auto lines = lrc::detail::sort::lines(shape, axis);
+	const double sign = inverse ? 1 : -1;
+	Reference res(data.size());
+	for (int64_t line = 0; line < lines.count; ++line) {
+		const int64_t start = lines.start(line);
+		for (int64_t k = 0; k < lines.extent; ++k) {
+			std::complex<double> sum = 0;
+			for (int64_t j = 0; j < lines.extent; ++j) {
+				const double angle = sign * 2 * lrc::PI * double((j * k) % lines.extent) /
+									 double(lines.extent);
+				sum += data[start + j * lines.inner] * std::polar(1.0, angle);
+			}
+			res[start + k * lines.inner] = inverse ? sum / double(lines.extent) : sum;
+		}
+	}
+	return res;
+}
+
+template<typename T>
+static bool isClose(const Reference &result, const Reference &expected) {
+	if (result.size() != expected.size()) return false;
+	double scale = 1;
+	for (const auto &value : expected) scale = std::max(scale, std::abs(value));
+	for (size_t i = 0; i < result.size(); ++i) {
+		if (std::abs(result[i] - expected[i]) > tolerance<T>() * scale) return false;
+	}
+	return true;
+}
+
+// Check every transform of an array along one axis against the direct DFT
+template<typename T>
+static void requireTransforms(const ShapeType &shape, int64_t axis, uint64_t seed) {
+	const auto complex = randomComplex<T>(shape, seed);
+	const auto real	   = randomReal<T>(shape, seed + 1);
+	const auto lines   = lrc::detail::sort::lines(shape, axis);
+
+	const Reference spectrum = referenceDft(values(complex), shape, axis, false);
+	REQUIRE(isClose<T>(values(lrc::fft::fft(complex, axis)), spectrum));
+	REQUIRE(isClose<T>(values(lrc::fft::ifft(complex, axis)),
+					   referenceDft(values(complex), shape, axis, true)));
+	REQUIRE(isClose<T>(values(lrc::fft::ifft(lrc::fft::fft(complex, axis), axis)),
+					   values(complex)));
+
+	// Real input: rfft keeps the first n / 2 + 1 frequencies of the full transform
+	const Reference realSpectrum = referenceDft(values(real), shape, axis, false);
+	REQUIRE(isClose<T>(values(lrc::fft::fft(real, axis)), realSpectrum));
+
+	const auto half		 = lrc::fft::rfft(real, axis);
+	const auto halfLines = lrc::detail::sort::lines(half.shape(), axis);
+	REQUIRE(halfLines.extent == lines.extent / 2 + 1);
+	Reference expected(half.shape().size());
+	for (int64_t line = 0; line < lines.count; ++line) {
+		for (int64_t k = 0; k < halfLines.extent; ++k) {
+			expected[halfLines.start(line) + k * lines.inner] =
+			  realSpectrum[lines.start(line) + k * lines.inner];
+		}
+	}
+	REQUIRE(isClose<T>(values(half), expected));
+
+	const auto restored = lrc::fft::irfft(half, lines.extent, axis);
+	REQUIRE(restored.shape() == shape);
+	REQUIRE(isClose<T>(values(restored), values(real)));
+}
+
+TEST_CASE("Test FFT", "[fft]") {
+	SECTION("Values") {
+		ComplexArray<double> array(ShapeType {4});
+		for (int64_t i = 0; i < 4; ++i) array.storage()[i] = lrc::Complex<double>(i + 1, 0);
+
+		const Reference expected = {{10, 0}, {-2, 2}, {-2, 0}, {-2, -2}};
+		REQUIRE(isClose<double>(values(lrc::fft::fft(array)), expected));
+
+		// A single value is its own transform
+		ComplexArray<double> single(ShapeType {1});
+		single.storage()[0] = lrc::Complex<double>(3, -1);
+		REQUIRE(isClose<double>(values(lrc::fft::fft(single)), {{3, -1}}));
+
+		REQUIRE_THROWS_AS(lrc::fft::fft(array, 1), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::fft::fft(array, -2), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::fft::irfft(array, 0), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::fft::irfft(single), std::runtime_error);
+
+		ComplexArray<double> empty(ShapeType {3, 0});
+		REQUIRE(lrc::fft::fft(empty, 0).shape() == empty.shape());
+
+		// A real transform of an empty axis has no frequencies to return
+		lrc::Array<double> realEmpty(ShapeType {3, 0});
+		REQUIRE(lrc::fft::rfft(realEmpty, 0).shape() == ShapeType {2, 0});
+		REQUIRE_THROWS_AS(lrc::fft::rfft(realEmpty), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::fft::rfftn(realEmpty), std::runtime_error);
+
+		// A zero-dimensional array has no axis for the real transform
+		lrc::Array<double> realScalar(ShapeType::zeros(0));
+		ComplexArray<double> complexScalar(ShapeType::zeros(0));
+		REQUIRE(realScalar.shape().ndim() == 0);
+		REQUIRE_THROWS_AS(lrc::fft::rfftn(realScalar), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::fft::irfftn(complexScalar), std::runtime_error);
+	}
+
+	SECTION("Lengths") {
+		// Powers of two and three, mixed radices, generic prime radices, and primes above
+		// maxRadix which use Bluestein's algorithm
+		for (int64_t n : {2, 3, 4, 5, 6, 7, 8, 9, 12, 13, 15, 16, 25, 30, 49, 60, 64, 67, 97,
+						  100, 128, 210, 243, 360, 1000, 1009, 1024, 4096}) {
+			requireTransforms<float>(ShapeType {n}, 0, n);
+			requireTransforms<double>(ShapeType {n}, 0, n);
+		}
+	}
+
+	SECTION("Axes") {
+		for (const ShapeType &shape : {ShapeType {3, 8}, ShapeType {5, 6, 7}, ShapeType {4, 97},
+									   ShapeType {2, 3, 128}, ShapeType {40, 20},
+									   ShapeType {1000, 3}}) {
+			for (int64_t axis = 0; axis < static_cast<int64_t>(shape.ndim()); ++axis) {
+				requireTransforms<float>(shape, axis, shape.size() + axis);
+				requireTransforms<double>(shape, axis, shape.size() + axis);
+			}
+		}
+	}
+
+	SECTION("Multiple axes") {
+		const ShapeType shape {6, 10, 16};
+		const auto array = randomComplex<double>(shape, 11);
+		const Reference data = values(array);
+
+		Reference expected = data;
+		for (int64_t axis : {0, 1, 2}) expected = referenceDft(expected, shape, axis, false);
+		const auto spectrum = lrc::fft::fftn(array);
+		REQUIRE(isClose<double>(values(spectrum), expected));
+		REQUIRE(isClose<double>(values(lrc::fft::ifftn(spectrum)), data));
+
+		Reference expected2 = referenceDft(referenceDft(data, shape, 1, false), shape, 2, false);
+		REQUIRE(isClose<double>(values(lrc::fft::fft2(array)), expected2));
+		REQUIRE(isClose<double>(
+		  values(lrc::fft::fftn(array, {2, 0})),
+		  referenceDft(referenceDft(data, shape, 2, false), shape, 0, false)));
+
+		const auto real = randomReal<double>(shape, 12);
+		REQUIRE(lrc::fft::rfftn(real).shape() == ShapeType {6, 10, 9});
+		REQUIRE(isClose<double>(values(lrc::fft::irfftn(lrc::fft::rfftn(real), {}, 16)),
+								values(real)));
+		REQUIRE(lrc::fft::rfftn(real, {0, 1}).shape() == ShapeType {6, 6, 16});
+		REQUIRE(isClose<double>(values(lrc::fft::irfftn(lrc::fft::rfftn(real, {0, 1}), {0, 1}, 10)),
+								values(real)));
+	}
+
+	SECTION("Normalisation") {
+		const ShapeType shape {8, 9};
+		const auto array = randomComplex<double>(shape, 13);
+		Reference expected = referenceDft(values(array), shape, -1, false);
+
+		Reference ortho = expected;
+		for (auto &value : ortho) value /= 3.0;
+		REQUIRE(isClose<double>(values(lrc::fft::fft(array, -1, lrc::fft::Norm::Ortho)), ortho));
+
+		Reference forward = expected;
+		for (auto &value : forward) value /= 9.0;
+		REQUIRE(
+		  isClose<double>(values(lrc::fft::fft(array, -1, lrc::fft::Norm::Forward)), forward));
+
+		for (auto norm :
+			 {lrc::fft::Norm::Backward, lrc::fft::Norm::Ortho, lrc::fft::Norm::Forward}) {
+			REQUIRE(isClose<double>(
+			  values(lrc::fft::ifft2(lrc::fft::fft2(array, norm), norm)), values(array)));
+			const auto real = randomReal<double>(shape, 14);
+			REQUIRE(isClose<double>(
+			  values(lrc::fft::irfft(lrc::fft::rfft(real, 0, norm), 8, 0, norm)), values(real)));
+		}
+	}
+
+	SECTION("Inverse real transform lengths") {
+		// Frequencies are cropped or padded with zeros to fit the output length
+		const auto real		= randomReal<double>(ShapeType {12}, 15);
+		const auto spectrum = lrc::fft::rfft(real);
+		REQUIRE(lrc::fft::irfft(spectrum).shape() == ShapeType {12});
+		REQUIRE(lrc::fft::irfft(spectrum, 11).shape() == ShapeType {11});
+
+		ComplexArray<double> padded(ShapeType {10});
+		for (int64_t k = 0; k < 10; ++k) {
+			padded.storage()[k] = k < 7 ? spectrum.storage()[k] : lrc::Complex<double>();
+		}
+		REQUIRE(isClose<double>(values(lrc::fft::irfft(padded, 12)), values(real)));
+	}
+
+	SECTION("Plans are cached") {
+		const auto plan = lrc::detail::fft::getPlan<double>(360);
+		REQUIRE(plan->size() == 360);
+		REQUIRE(lrc::detail::fft::getPlan<double>(360) == plan);
+		REQUIRE(lrc::detail::fft::factorise(360) == std::vector<int64_t> {4, 2, 3, 3, 5});
+	}
+
+	SECTION("Parallel") {
+		const int64_t prevThreads	= lrc::global::numThreads;
+		const int64_t prevThreshold = lrc::global::multithreadThreshold;
+		lrc::global::multithreadThreshold = 1000;
+
+		// One long line is split within each stage; many lines are shared out between threads.
+		// Neither changes the arithmetic, so the results do not depend on the number of threads
+		for (const ShapeType &shape : {ShapeType {65536}, ShapeType {4099}, ShapeType {64, 1000},
+									   ShapeType {1000, 64}, ShapeType {3, 4096}}) {
+			const auto array = randomComplex<double>(shape, shape.size());
+			for (int64_t axis = 0; axis < static_cast<int64_t>(shape.ndim()); ++axis) {
+				lrc::global::numThreads = 1;
+				const Reference serial	= values(lrc::fft::fft(array, axis));
+				lrc::global::numThreads = 5;
+				REQUIRE(values(lrc::fft::fft(array, axis)) == serial);
+			}
+		}
+
+		lrc::global::numThreads = 5;
+		requireTransforms<double>(ShapeType {3, 1024}, 0, 16);
+		requireTransforms<float>(ShapeType {2048}, 0, 17);
+
+		lrc::global::numThreads			  = prevThreads;
+		lrc::global::multithreadThreshold = prevThreshold;
+	}
+}
+
+static void benchmarkFft(int64_t size) {
+	const auto complex = randomComplex<double>(ShapeType {size}, 1);
+	const auto real	   = randomReal<double>(ShapeType {size}, 2);
+
+	BENCHMARK(fmt::format("fft of {} complex doubles", size)) {
+		return lrc::fft::fft(complex).storage()[0];
+	};
+
+	BENCHMARK(fmt::format("rfft of {} doubles", size)) {
+		return lrc::fft::rfft(real).storage()[0];
+	};
+}
+
+TEST_CASE("Benchmark FFT", "[fft][benchmark]") {
+	// Powers of two, mixed radices and a prime
+	for (int64_t size : {1024, 65536, 1 << 20, 1000, 3 * 5 * 7 * 1024, 1009}) benchmarkFft(size);
+
+	const auto single = randomComplex<float>(ShapeType {1 << 20}, 3);
+	BENCHMARK("fft of 1048576 complex floats") { return lrc::fft::fft(single).storage()[0]; };
+
+	const auto matrix = randomComplex<double>(ShapeType {1024, 1024}, 4);
+	BENCHMARK("fft of 1024 lines of 1024 complex doubles along axis 1") {
+		return lrc::fft::fft(matrix, 1).storage()[0];
+	};
+
+	BENCHMARK("fft of 1024 lines of 1024 complex doubles along axis 0") {
+		return lrc::fft::fft(matrix, 0).storage()[0];
+	};
+
+	BENCHMARK("fft2 of 1024x1024 complex doubles") {
+		return lrc::fft::fft2(matrix).storage()[0];
+	};
+}
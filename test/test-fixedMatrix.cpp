@@ -0,0 +1,275 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+template<typename Scalar, size_t... Dims>
+static lrc::ArrayF<Scalar, Dims...> randomFixed(uint64_t seed) {
+	std::mt19937_64 generator(seed);
+	std::uniform_real_distribution<double> distribution(-1, 1);
+	lrc::ArrayF<Scalar, Dims...> array;
+	for (auto &value : array.storage()) value = static_cast<Scalar>(distribution(generator));
+	return array;
+}
+
+template<typename Scalar, size_t M, size_t K, size_t N>
+static lrc::ArrayF<Scalar, M, N> naiveMatmul(const lrc::ArrayF<Scalar, M, K> &lhs,
+											 const lrc::ArrayF<Scalar, K, N> &rhs) {
+	lrc::ArrayF<Scalar, M, N> result;
+	for (size_t i = 0; i < M; ++i) {
+		for (size_t j = 0; j < N; ++j) {
+			Scalar sum = 0;
+			for (size_t k = 0; k < K; ++k) {
+				sum += lhs.storage()[i * K + k] * rhs.storage()[k * N + j];
+			}
+			result.storage()[i * N + j] = sum;
+		}
+	}
+	return result;
+}
+
+template<typename Scalar, size_t M, size_t N>
+static void requireClose(const lrc::ArrayF<Scalar, M, N> &lhs,
+						 const lrc::ArrayF<Scalar, M, N> &rhs, double tolerance) {
+	for (size_t i = 0; i < M * N; ++i) {
+		REQUIRE(std::abs(lhs.storage()[i] - rhs.storage()[i]) < tolerance);
+	}
+}
+
+template<typename Scalar, size_t N>
+static void testSquare() {
+	using Matrix   = lrc::ArrayF<Scalar, N, N>;
+	const auto tol = std::is_same_v<Scalar, float> ? 1e-3 : 1e-9;
+
+	// A random matrix with a large diagonal is well conditioned
+	Matrix matrix = randomFixed<Scalar, N, N>(N);
+	for (size_t i = 0; i < N; ++i) matrix.storage()[i * N + i] += Scalar(N);
+
+	Matrix identity(Scalar(0));
+	for (size_t i = 0; i < N; ++i) identity.storage()[i * N + i] = 1;
+
+	const Matrix inv = lrc::inverse(matrix);
+	requireClose(lrc::matmul(matrix, inv), identity, tol);
+	requireClose(lrc::matmul(inv, matrix), identity, tol);
+
+	const Scalar det = lrc::determinant(matrix);
+	REQUIRE(std::abs(det * lrc::determinant(inv) - 1) < tol);
+
+	// The determinant of a triangular matrix is the product of its diagonal
+	Matrix triangular = matrix;
+	Scalar diagonal	  = 1;
+	for (size_t i = 0; i < N; ++i) {
+		for (size_t j = 0; j < i; ++j) triangular.storage()[i * N + j] = 0;
+		diagonal *= triangular.storage()[i * N + i];
+	}
+	REQUIRE(std::abs(lrc::determinant(triangular) - diagonal) < tol * std::abs(diagonal));
+
+	if constexpr (N > 1) {
+		// Exchanging two rows negates the determinant
+		Matrix swapped = matrix;
+		for (size_t j = 0; j < N; ++j) std::swap(swapped.storage()[j], swapped.storage()[N + j]);
+		REQUIRE(std::abs(lrc::determinant(swapped) + det) < tol * std::abs(det));
+
+		// A matrix with two equal rows is singular
+		Matrix equalRows = matrix;
+		for (size_t j = 0; j < N; ++j) {
+			equalRows.storage()[(N - 1) * N + j] = equalRows.storage()[j];
+		}
+		REQUIRE(std::abs(lrc::determinant(equalRows)) < tol);
+
+		// Only an exactly singular matrix cannot be inverted
+		Matrix zeroRow = matrix;
+		for (size_t j = 0; j < N; ++j) zeroRow.storage()[N + j] = 0;
+		REQUIRE(lrc::determinant(zeroRow) == 0);
+		REQUIRE_THROWS_AS(lrc::inverse(zeroRow), std::runtime_error);
+	}
+
+	REQUIRE_THROWS_AS(lrc::inverse(Matrix(Scalar(0))), std::runtime_error);
+}
+
+TEST_CASE("Test fixed-size array assignment", "[fixedMatrix]") {
+	lrc::ArrayF<float, 4, 4> lhs = randomFixed<float, 4, 4>(1);
+	lrc::ArrayF<float, 4, 4> rhs = randomFixed<float, 4, 4>(2);
+
+	// A default-constructed fixed-size array has the shape of its storage
+	lrc::ArrayF<float, 4, 4> result;
+	REQUIRE(result.shape() == lrc::Shape({4, 4}));
+
+	// Fixed-size arrays are always assigned serially, even when every other array would use
+	// threads
+	const int64_t prevThreads	= lrc::global::numThreads;
+	const int64_t prevThreshold = lrc::global::multithreadThreshold;
+	lrc::global::numThreads			  = 8;
+	lrc::global::multithreadThreshold = 0;
+
+	result = lhs + rhs * 2.0f;
+	for (size_t i = 0; i < 16; ++i) {
+		REQUIRE(result.storage()[i] == lhs.storage()[i] + rhs.storage()[i] * 2.0f);
+	}
+
+	lrc::ArrayF<float, 4, 4> constructed = lhs - rhs;
+	constructed -= rhs;
+	for (size_t i = 0; i < 16; ++i) {
+		const float expected = (lhs.storage()[i] - rhs.storage()[i]) - rhs.storage()[i];
+		REQUIRE(constructed.storage()[i] == expected);
+	}
+
+	// Sizes which are not a multiple of the packet width, and one too large to unroll
+	auto odd		= randomFixed<double, 3, 5>(3);
+	auto oddSquared = lrc::ArrayF<double, 3, 5>(odd * odd);
+	for (size_t i = 0; i < 15; ++i) {
+		REQUIRE(oddSquared.storage()[i] == odd.storage()[i] * odd.storage()[i]);
+	}
+
+	auto large	  = randomFixed<double, 31, 17>(4);
+	auto largeSum = lrc::ArrayF<double, 31, 17>(large + large);
+	largeSum += 1.0;
+	for (size_t i = 0; i < 31 * 17; ++i) {
+		REQUIRE(largeSum.storage()[i] == large.storage()[i] * 2 + 1);
+	}
+
+	lrc::global::numThreads			  = prevThreads;
+	lrc::global::multithreadThreshold = prevThreshold;
+}
+
+TEST_CASE("Test fixed-size matrix products", "[fixedMatrix]") {
+	auto a = randomFixed<float, 2, 2>(5);
+	auto b = randomFixed<float, 2, 2>(6);
+	requireClose(lrc::matmul(a, b), naiveMatmul(a, b), 1e-6);
+
+	auto c		 = randomFixed<double, 3, 5>(7);
+	auto d		 = randomFixed<double, 5, 2>(8);
+	auto product = lrc::matmul(c, d);
+	REQUIRE(product.shape() == lrc::Shape({3, 2}));
+	requireClose(product, naiveMatmul(c, d), 1e-12);
+
+	auto e = randomFixed<float, 8, 8>(9);
+	auto f = randomFixed<float, 8, 8>(10);
+	requireClose(lrc::matmul(e, f), naiveMatmul(e, f), 1e-5);
+
+	auto g = randomFixed<double, 1, 7>(11);
+	auto h = randomFixed<double, 7, 1>(12);
+	requireClose(lrc::matmul(g, h), naiveMatmul(g, h), 1e-12);
+}
+
+TEST_CASE("Test fixed-size determinants and inverses", "[fixedMatrix]") {
+	SECTION("Closed forms") {
+		lrc::ArrayF<double, 2, 2> two;
+		two << 4, 7, //
+		  2, 6;
+		REQUIRE(lrc::determinant(two) == 10);
+		lrc::ArrayF<double, 2, 2> twoInverse;
+		twoInverse << 0.6, -0.7, //
+		  -0.2, 0.4;
+		requireClose(lrc::inverse(two), twoInverse, 1e-12);
+
+		lrc::ArrayF<double, 3, 3> three;
+		three << 1, 2, 3, //
+		  0, 1, 4,		  //
+		  5, 6, 0;
+		REQUIRE(lrc::determinant(three) == 1);
+		lrc::ArrayF<double, 3, 3> threeInverse;
+		threeInverse << -24, 18, 5, //
+		  20, -15, -4,				//
+		  -5, 4, 1;
+		requireClose(lrc::inverse(three), threeInverse, 1e-12);
+	}
+
+	SECTION("Every size") {
+		testSquare<float, 1>();
+		testSquare<double, 2>();
+		testSquare<float, 3>();
+		testSquare<double, 3>();
+		testSquare<float, 4>();
+		testSquare<double, 4>();
+		testSquare<double, 5>();
+		testSquare<float, 6>();
+		testSquare<double, 7>();
+		testSquare<float, 8>();
+		testSquare<double, 8>();
+	}
+}
+
+TEST_CASE("Benchmark fixed-size matrices", "[fixedMatrix][benchmark]") {
+	// Each benchmark processes a batch of different matrices, so no result can be computed once
+	// and reused
+	constexpr size_t batch = 256;
+	std::vector<lrc::ArrayF<float, 4, 4>> floats;
+	std::vector<lrc::ArrayF<double, 8, 8>> doubles;
+	for (size_t i = 0; i < batch; ++i) {
+		floats.push_back(randomFixed<float, 4, 4>(i));
+		doubles.push_back(randomFixed<double, 8, 8>(i));
+		for (size_t j = 0; j < 4; ++j) floats.back().storage()[j * 5] += 4;
+		for (size_t j = 0; j < 8; ++j) doubles.back().storage()[j * 9] += 8;
+	}
+	const auto rhs4 = randomFixed<float, 4, 4>(batch);
+	const auto rhs8 = randomFixed<double, 8, 8>(batch);
+
+	lrc::Array<float> dynamicRhs(lrc::Shape({4, 4}));
+	std::copy(rhs4.storage().begin(), rhs4.storage().end(), dynamicRhs.storage().begin());
+	std::vector<lrc::Array<float>> dynamicFloats;
+	for (const auto &matrix : floats) {
+		dynamicFloats.emplace_back(lrc::Shape({4, 4}));
+		std::copy(matrix.storage().begin(),
+				  matrix.storage().end(),
+				  dynamicFloats.back().storage().begin());
+	}
+
+	// Every result is stored, so no part of the computation can be skipped
+	std::vector<lrc::ArrayF<float, 4, 4>> floatResults(batch);
+	std::vector<lrc::ArrayF<double, 8, 8>> doubleResults(batch);
+	std::vector<float> floatDeterminants(batch);
+	std::vector<double> doubleDeterminants(batch);
+	std::vector<lrc::Array<float>> dynamicResults(batch, lrc::Array<float>(lrc::Shape({4, 4})));
+
+	BENCHMARK("256 x ArrayF<float, 4, 4>: result = lhs + rhs * 2") {
+		for (size_t i = 0; i < batch; ++i) floatResults[i] = floats[i] + rhs4 * 2.0f;
+		return floatResults.back().storage()[0];
+	};
+
+	BENCHMARK("256 x Array<float> (4, 4): result = lhs + rhs * 2") {
+		for (size_t i = 0; i < batch; ++i) dynamicResults[i] = dynamicFloats[i] + dynamicRhs * 2.0f;
+		return dynamicResults.back().storage()[0];
+	};
+
+	BENCHMARK("256 x ArrayF<float, 4, 4>: matmul") {
+		for (size_t i = 0; i < batch; ++i) floatResults[i] = lrc::matmul(floats[i], rhs4);
+		return floatResults.back().storage()[0];
+	};
+
+	BENCHMARK("256 x ArrayF<float, 4, 4>: naive matmul") {
+		for (size_t i = 0; i < batch; ++i) floatResults[i] = naiveMatmul(floats[i], rhs4);
+		return floatResults.back().storage()[0];
+	};
+
+	BENCHMARK("256 x ArrayF<double, 8, 8>: matmul") {
+		for (size_t i = 0; i < batch; ++i) doubleResults[i] = lrc::matmul(doubles[i], rhs8);
+		return doubleResults.back().storage()[0];
+	};
+
+	BENCHMARK("256 x ArrayF<double, 8, 8>: naive matmul") {
+		for (size_t i = 0; i < batch; ++i) doubleResults[i] = naiveMatmul(doubles[i], rhs8);
+		return doubleResults.back().storage()[0];
+	};
+
+	BENCHMARK("256 x ArrayF<float, 4, 4>: determinant") {
+		for (size_t i = 0; i < batch; ++i) floatDeterminants[i] = lrc::determinant(floats[i]);
+		return floatDeterminants.back();
+	};
+
+	BENCHMARK("256 x ArrayF<float, 4, 4>: inverse") {
+		for (size_t i = 0; i < batch; ++i) floatResults[i] = lrc::inverse(floats[i]);
+		return floatResults.back().storage()[0];
+	};
+
+	BENCHMARK("256 x ArrayF<double, 8, 8>: determinant") {
+		for (size_t i = 0; i < batch; ++i) doubleDeterminants[i] = lrc::determinant(doubles[i]);
+		return doubleDeterminants.back();
+	};
+
+	BENCHMARK("256 x ArrayF<double, 8, 8>: inverse") {
+		for (size_t i = 0; i < batch; ++i) doubleResults[i] = lrc::inverse(doubles[i]);
+		return doubleResults.back().storage()[0];
+	};
+}
@@ -0,0 +1,164 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+TEST_CASE("Test half -- conversions", "[half]") {
+	// Exactly representable values round-trip
+	for (float value : {0.0f, 1.0f, -2.5f, 0.099975586f, 65504.0f, 6.1035156e-5f}) {
+		REQUIRE(static_cast<float>(lrc::half(value)) == value);
+	}
+
+	REQUIRE(lrc::half(1.0f).bits() == 0x3C00);
+	REQUIRE(lrc::half(-2.0f).bits() == 0xC000);
+	REQUIRE(lrc::half(65504.0f).bits() == 0x7BFF);
+	REQUIRE(lrc::half(1e6f).bits() == 0x7C00);
+	REQUIRE(lrc::half(-1e6f).bits() == 0xFC00);
+	REQUIRE(lrc::half(5.9604645e-8f).bits() == 0x0001); // Smallest subnormal
+	REQUIRE(lrc::half(1e-9f).bits() == 0x0000);
+
+	// Ties round to even
+	REQUIRE(lrc::half(1.0f + 1.0f / 2048).bits() == 0x3C00);
+	REQUIRE(lrc::half(1.0f + 3.0f / 2048).bits() == 0x3C02);
+	REQUIRE(lrc::half(65520.0f).bits() == 0x7C00);
+
+	float nan = std::numeric_limits<float>::quiet_NaN();
+	float inf = std::numeric_limits<float>::infinity();
+	REQUIRE(std::isnan(static_cast<float>(lrc::half(nan))));
+	REQUIRE(std::isinf(static_cast<float>(lrc::half::fromBits(0x7C00))));
+
+	// NaNs and infinities have the same bits as the F16C conversion
+	REQUIRE(lrc::half(nan).bits() == 0x7E00);
+	REQUIRE(lrc::half(-nan).bits() == 0xFE00);
+	REQUIRE(lrc::half(lrc::bitCast<float>(0x7FA00000u)).bits() == 0x7F00); // Signalling
+	REQUIRE(lrc::half(inf).bits() == 0x7C00);
+	REQUIRE(lrc::half(-inf).bits() == 0xFC00);
+	REQUIRE(lrc::bfloat16(nan).bits() == 0x7FC0);
+	REQUIRE(lrc::bfloat16(inf).bits() == 0x7F80);
+	REQUIRE(lrc::bfloat16(-inf).bits() == 0xFF80);
+
+	REQUIRE(lrc::bfloat16(1.0f).bits() == 0x3F80);
+	REQUIRE(lrc::bfloat16(3.0e38f).bits() == 0x7F62);
+	REQUIRE(lrc::bfloat16(1.0f + 1.0f / 256).bits() == 0x3F80);
+	REQUIRE(lrc::bfloat16(1.0f + 3.0f / 256).bits() == 0x3F82);
+	REQUIRE(std::isnan(static_cast<float>(lrc::bfloat16(nan))));
+
+	// Every half value survives a round trip through the bulk converters
+	std::vector<uint16_t> bits(1 << 16), roundTrip(1 << 16);
+	std::vector<float> floats(1 << 16);
+	for (size_t i = 0; i < bits.size(); ++i) bits[i] = static_cast<uint16_t>(i);
+	lrc::detail::HalfFormat::toFloat(bits.data(), floats.data(), bits.size());
+	lrc::detail::HalfFormat::fromFloat(floats.data(), roundTrip.data(), bits.size());
+	for (size_t i = 0; i < bits.size(); ++i) {
+		float expected = lrc::detail::HalfFormat::toFloat(bits[i]);
+		REQUIRE(lrc::bitCast<uint32_t>(floats[i]) == lrc::bitCast<uint32_t>(expected));
+		if (!std::isnan(floats[i])) { REQUIRE(roundTrip[i] == bits[i]); }
+	}
+
+	// The bulk converters handle NaNs and infinities in the same way as the scalar conversion
+	std::vector<float> special = {nan, -nan, inf, -inf, lrc::bitCast<float>(0x7FA00000u),
+								  lrc::bitCast<float>(0xFF801234u), 1.0f, 0.0f, nan};
+	std::vector<uint16_t> specialBits(special.size());
+	lrc::detail::HalfFormat::fromFloat(special.data(), specialBits.data(), special.size());
+	for (size_t i = 0; i < special.size(); ++i) {
+		REQUIRE(specialBits[i] == lrc::detail::HalfFormat::fromFloat(special[i]));
+	}
+
+	// The bulk converters round in the same way as the scalar conversion
+	for (size_t i = 0; i < floats.size(); ++i) {
+		floats[i] = lrc::bitCast<float>(static_cast<uint32_t>(0x33000000 + i * 0x3FFF));
+	}
+	lrc::detail::HalfFormat::fromFloat(floats.data(), roundTrip.data(), floats.size());
+	for (size_t i = 0; i < floats.size(); ++i) {
+		REQUIRE(roundTrip[i] == lrc::detail::HalfFormat::fromFloat(floats[i]));
+	}
+}
+
+TEST_CASE("Test half -- scalar arithmetic", "[half]") {
+	lrc::half a(1.5f), b(0.25f);
+	REQUIRE(static_cast<float>(a + b) == 1.75f);
+	REQUIRE(static_cast<float>(a - b) == 1.25f);
+	REQUIRE(static_cast<float>(a * b) == 0.375f);
+	REQUIRE(static_cast<float>(a / b) == 6.0f);
+	REQUIRE(static_cast<float>(-a) == -1.5f);
+	REQUIRE(a > b);
+	REQUIRE(a != b);
+
+	a += b;
+	REQUIRE(a == lrc::half(1.75f));
+
+	// Results are rounded to half precision after each operation
+	REQUIRE(lrc::half(2048) + lrc::half(1) == lrc::half(2048));
+
+	REQUIRE(lrc::typetraits::TypeInfo<lrc::half>::max() == lrc::half(65504.0f));
+	REQUIRE(lrc::typetraits::TypeInfo<lrc::half>::epsilon() == lrc::half(1.0f / 1024));
+	REQUIRE(lrc::typetraits::TypeInfo<lrc::bfloat16>::epsilon() == lrc::bfloat16(1.0f / 128));
+	REQUIRE(fmt::format("{}", lrc::half(0.5f)) == "0.5");
+	REQUIRE(fmt::format("{}", lrc::bfloat16(-3)) == "-3");
+}
+
+#define TEST_HALF_ARRAY(SCALAR)                                                                    \
+	SECTION(fmt::format("Test Array Operations [{}]", STRINGIFY(SCALAR))) {                        \
+		for (int64_t size : {1, 7, 16, 1003, 10007}) {                                             \
+			lrc::Array<SCALAR> lhs(lrc::Array<SCALAR>::ShapeType {size});                          \
+			lrc::Array<SCALAR> rhs(lrc::Array<SCALAR>::ShapeType {size});                          \
+			for (int64_t i = 0; i < size; ++i) {                                                   \
+				lhs.storage()[i] = SCALAR(static_cast<float>(i % 17) * 0.5f);                      \
+				rhs.storage()[i] = SCALAR(static_cast<float>(i % 13) - 6.0f);                      \
+			}                                                                                      \
+                                                                                                   \
+			lrc::Array<SCALAR> sum	= lhs + rhs;                                                   \
+			lrc::Array<SCALAR> prod = lhs * rhs;                                                   \
+			lrc::Array<SCALAR> expr = (lhs + rhs) * rhs - lhs;                                     \
+			lrc::Array<SCALAR> cmp	= lhs > rhs;                                                   \
+                                                                                                   \
+			for (int64_t i = 0; i < size; ++i) {                                                   \
+				float x = static_cast<float>(lhs.storage()[i]);                                    \
+				float y = static_cast<float>(rhs.storage()[i]);                                    \
+				REQUIRE(sum.storage()[i] == SCALAR(x + y));                                        \
+				REQUIRE(prod.storage()[i] == SCALAR(x * y));                                       \
+				REQUIRE(expr.storage()[i] == SCALAR((x + y) * y - x));                             \
+				REQUIRE(cmp.storage()[i] == SCALAR(x > y ? 1 : 0));                                \
+			}                                                                                      \
+		}                                                                                          \
+	}
+
+TEST_CASE("Test half -- arrays", "[half]") {
+	// The inputs are chosen so that every intermediate result is exactly representable, so the
+	// results can be checked against single precision arithmetic
+	REQUIRE(sizeof(lrc::half) == 2);
+	REQUIRE(sizeof(lrc::bfloat16) == 2);
+	REQUIRE(lrc::typetraits::TypeInfo<lrc::half>::packetWidth > 1);
+
+	TEST_HALF_ARRAY(lrc::half)
+	TEST_HALF_ARRAY(lrc::bfloat16)
+}
+
+#define TEST_HALF_ROUNDING(SCALAR)                                                                 \
+	SECTION(fmt::format("Test Rounding [{}]", STRINGIFY(SCALAR))) {                                \
+		/* Not a multiple of the packet width, so some elements are in the loop's tail */          \
+		const int64_t size = lrc::typetraits::TypeInfo<SCALAR>::packetWidth * 5 + 3;               \
+		lrc::Array<SCALAR> lhs(lrc::Array<SCALAR>::ShapeType {size});                              \
+		lrc::Array<SCALAR> rhs(lrc::Array<SCALAR>::ShapeType {size});                              \
+		for (int64_t i = 0; i < size; ++i) {                                                       \
+			lhs.storage()[i] = SCALAR(1.0f + static_cast<float>(i) * 0.1f);                        \
+			rhs.storage()[i] = SCALAR(1.0f / static_cast<float>(i + 3));                           \
+		}                                                                                          \
+                                                                                                   \
+		lrc::Array<SCALAR> expr = (lhs + rhs) * rhs / lhs - rhs;                                   \
+		for (int64_t i = 0; i < size; ++i) {                                                       \
+			float x = static_cast<float>(lhs.storage()[i]);                                        \
+			float y = static_cast<float>(rhs.storage()[i]);                                        \
+			REQUIRE(expr.storage()[i].bits() == SCALAR((x + y) * y / x - y).bits());               \
+		}                                                                                          \
+	}
+
+TEST_CASE("Test half -- rounding", "[half]") {
+	// Array expressions are evaluated in single precision and rounded to 16 bits once, when
+	// they are stored. The tail of the loop is evaluated as a partial packet, so every element
+	// gives the same result, wherever it falls in the loop
+	TEST_HALF_ROUNDING(lrc::half)
+	TEST_HALF_ROUNDING(lrc::bfloat16)
+}
@@ -0,0 +1,253 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+template<typename Scalar>
+static lrc::Array<Scalar> randomArray(const typename lrc::Array<Scalar>::ShapeType &shape,
+									  int64_t low, int64_t high, uint64_t seed) {
+	std::mt19937_64 generator(seed);
+	lrc::Array<Scalar> array(shape);
+	for (size_t i = 0; i < shape.size(); ++i) {
+		array.storage()[i] =
+		  static_cast<Scalar>(low + static_cast<int64_t>(generator() % (high - low + 1)));
+	}
+	return array;
+}
+
+TEST_CASE("Test take", "[indexing]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+
+	SECTION("Values") {
+		lrc::Array<double> array(ShapeType {2, 3});
+		array << 10, 11, 12, //
+		  13, 14, 15;
+
+		lrc::Array<int64_t> indices(ShapeType {2, 2});
+		indices << 5, 0, //
+		  -1, 2;
+
+		lrc::Array<double> taken = lrc::take(array, indices);
+		REQUIRE(taken.shape() == ShapeType {2, 2});
+		const double expected[] = {15, 10, 15, 12};
+		for (size_t i = 0; i < 4; ++i) REQUIRE(taken.storage()[i] == expected[i]);
+
+		// The gather is evaluated as part of the larger expression
+		lrc::Array<double> doubled = lrc::take(array, indices) * 2.0;
+		for (size_t i = 0; i < 4; ++i) REQUIRE(doubled.storage()[i] == expected[i] * 2);
+
+		lrc::Array<int32_t> smallIndices(ShapeType {3});
+		smallIndices << 1, 1, 4;
+		lrc::Array<double> repeated = lrc::take(array, smallIndices);
+		REQUIRE(repeated.storage()[0] == 11);
+		REQUIRE(repeated.storage()[1] == 11);
+		REQUIRE(repeated.storage()[2] == 14);
+
+		lrc::Array<int64_t> outOfRange(ShapeType {2});
+		outOfRange << 1, 6;
+		REQUIRE_THROWS_AS(lrc::take(array, outOfRange), std::runtime_error);
+		outOfRange << 1, -7;
+		REQUIRE_THROWS_AS(lrc::take(array, outOfRange), std::runtime_error);
+	}
+
+	SECTION("Parallel") {
+		const int64_t prevThreads	= lrc::global::numThreads;
+		const int64_t prevThreshold = lrc::global::multithreadThreshold;
+		lrc::global::numThreads			  = 3;
+		lrc::global::multithreadThreshold = 1000;
+
+		// Sizes which are not a multiple of any packet width
+		auto values	 = randomArray<float>(ShapeType {30011}, -1000, 1000, 1);
+		auto indices = randomArray<int64_t>(ShapeType {20003}, -30011, 30010, 2);
+		lrc::Array<float> taken = lrc::take(values, indices) + 1.0f;
+		for (size_t i = 0; i < 20003; ++i) {
+			const int64_t index = indices.storage()[i];
+			REQUIRE(taken.storage()[i] == values.storage()[index < 0 ? index + 30011 : index] + 1);
+		}
+
+		lrc::global::numThreads			  = prevThreads;
+		lrc::global::multithreadThreshold = prevThreshold;
+	}
+}
+
+TEST_CASE("Test put", "[indexing]") {
+	using ShapeType = lrc::Array<int32_t>::ShapeType;
+
+	SECTION("Values") {
+		lrc::Array<int32_t> array(ShapeType {2, 3}, 0);
+		lrc::Array<int64_t> indices(ShapeType {4});
+		indices << 0, -1, 2, 0;
+
+		lrc::Array<int32_t> values(ShapeType {4});
+		values << 1, 2, 3, 4;
+		lrc::put(array, indices, values);
+		const int32_t expected[] = {4, 0, 3, 0, 0, 2};
+		for (size_t i = 0; i < 6; ++i) REQUIRE(array.storage()[i] == expected[i]);
+
+		lrc::put(array, indices, 9);
+		const int32_t filled[] = {9, 0, 9, 0, 0, 9};
+		for (size_t i = 0; i < 6; ++i) REQUIRE(array.storage()[i] == filled[i]);
+
+		lrc::Array<int32_t> tooFew(ShapeType {3});
+		REQUIRE_THROWS_AS(lrc::put(array, indices, tooFew), std::runtime_error);
+		indices << 0, 1, 2, 6;
+		REQUIRE_THROWS_AS(lrc::put(array, indices, values), std::runtime_error);
+	}
+
+	SECTION("Repeated indices keep the last value on any number of threads") {
+		const int64_t prevThreads	= lrc::global::numThreads;
+		const int64_t prevThreshold = lrc::global::multithreadThreshold;
+		lrc::global::multithreadThreshold = 1000;
+
+		auto indices = randomArray<int64_t>(ShapeType {50000}, -1000, 999, 3);
+		auto values	 = randomArray<int32_t>(ShapeType {50000}, 0, 1 << 30, 4);
+
+		std::vector<int32_t> expected(1000, -1);
+		for (size_t i = 0; i < 50000; ++i) {
+			const int64_t index = indices.storage()[i];
+			expected[index < 0 ? index + 1000 : index] = values.storage()[i];
+		}
+
+		for (int64_t threads : {1, 4, 7}) {
+			lrc::global::numThreads = threads;
+			lrc::Array<int32_t> array(ShapeType {1000}, -1);
+			lrc::put(array, indices, values);
+			for (size_t i = 0; i < 1000; ++i) REQUIRE(array.storage()[i] == expected[i]);
+		}
+
+		// More threads than elements, and a scalar value
+		lrc::global::numThreads = 7;
+		auto few				= randomArray<int64_t>(ShapeType {5000}, -3, 2, 5);
+		auto fewValues			= randomArray<int32_t>(ShapeType {5000}, 0, 1 << 30, 6);
+		lrc::Array<int32_t> small(ShapeType {3}, -1);
+		lrc::put(small, few, fewValues);
+		for (size_t i = 0; i < 5000; ++i) {
+			const int64_t index = few.storage()[i];
+			expected[index < 0 ? index + 3 : index] = fewValues.storage()[i];
+		}
+		for (size_t i = 0; i < 3; ++i) REQUIRE(small.storage()[i] == expected[i]);
+		lrc::put(small, few, 5);
+		for (size_t i = 0; i < 3; ++i) REQUIRE(small.storage()[i] == 5);
+
+		lrc::global::numThreads			  = prevThreads;
+		lrc::global::multithreadThreshold = prevThreshold;
+	}
+}
+
+TEST_CASE("Test compress", "[indexing]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+
+	SECTION("Values") {
+		lrc::Array<double> array(ShapeType {2, 3});
+		array << 1, -2, 3, //
+		  -4, 5, -6;
+
+		lrc::Array<bool> mask(ShapeType {2, 3});
+		mask << true, false, true, //
+		  false, false, true;
+
+		auto selected = array[mask];
+		REQUIRE(selected.shape() == ShapeType {3});
+		REQUIRE(selected.storage()[0] == 1);
+		REQUIRE(selected.storage()[1] == 3);
+		REQUIRE(selected.storage()[2] == -6);
+
+		// The mask can be an unevaluated comparison
+		auto positive = lrc::compress(array, array > 0.0);
+		REQUIRE(positive.shape() == ShapeType {3});
+		REQUIRE(positive.storage()[0] == 1);
+		REQUIRE(positive.storage()[1] == 3);
+		REQUIRE(positive.storage()[2] == 5);
+
+		REQUIRE(lrc::compress(array, array > 10.0).shape() == ShapeType {0});
+
+		lrc::Array<bool> wrongShape(ShapeType {3, 2});
+		REQUIRE_THROWS_AS(array[wrongShape], std::runtime_error);
+	}
+
+	SECTION("Ranked arrays") {
+		lrc::Matrix<double> matrix(lrc::Shape({2, 3}));
+		matrix << 1, -2, 3, //
+		  -4, 5, -6;
+
+		lrc::Array<bool> mask(ShapeType {2, 3});
+		mask << true, false, true, //
+		  false, false, true;
+
+		// The result of indexing a matrix is a ranked vector
+		auto selected = matrix[mask];
+		static_assert(std::is_same_v<decltype(selected), lrc::RankedArray<double, 1>>);
+		REQUIRE(selected.shape() == lrc::Shape({3}));
+		REQUIRE(selected.storage()[0] == 1);
+		REQUIRE(selected.storage()[1] == 3);
+		REQUIRE(selected.storage()[2] == -6);
+	}
+
+	SECTION("Parallel") {
+		const int64_t prevThreads	= lrc::global::numThreads;
+		const int64_t prevThreshold = lrc::global::multithreadThreshold;
+		lrc::global::multithreadThreshold = 1000;
+
+		for (const ShapeType &shape : {ShapeType {100003}, ShapeType {317, 211}}) {
+			auto array = randomArray<int64_t>(shape, -1000, 1000, shape.size());
+			std::vector<int64_t> expected;
+			for (size_t i = 0; i < shape.size(); ++i) {
+				if (array.storage()[i] % 3 == 0) expected.push_back(array.storage()[i]);
+			}
+
+			lrc::Array<int64_t> mask(shape);
+			for (size_t i = 0; i < shape.size(); ++i) {
+				mask.storage()[i] = array.storage()[i] % 3 == 0;
+			}
+
+			for (int64_t threads : {1, 5}) {
+				lrc::global::numThreads = threads;
+				auto selected			= array[mask];
+				REQUIRE(selected.shape() == ShapeType {expected.size()});
+				REQUIRE(std::equal(expected.begin(), expected.end(), selected.storage().begin()));
+			}
+		}
+
+		lrc::global::numThreads			  = prevThreads;
+		lrc::global::multithreadThreshold = prevThreshold;
+	}
+}
+
+TEST_CASE("Benchmark indexing", "[indexing][benchmark]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+	auto values		= randomArray<double>(ShapeType {1 << 20}, -1000, 1000, 5);
+	auto indices	= randomArray<int64_t>(ShapeType {1 << 20}, 0, (1 << 20) - 1, 6);
+	auto mask		= randomArray<int64_t>(ShapeType {1 << 20}, 0, 1, 7);
+	lrc::Array<double> result(ShapeType {1 << 20});
+
+	BENCHMARK("take 1M doubles at random indices, times 2") {
+		result = lrc::take(values, indices) * 2.0;
+		return result.storage()[0];
+	};
+
+	BENCHMARK("scalar loop gathering 1M doubles, times 2") {
+		for (size_t i = 0; i < (1 << 20); ++i) {
+			result.storage()[i] = values.storage()[indices.storage()[i]] * 2.0;
+		}
+		return result.storage()[0];
+	};
+
+	BENCHMARK("put 1M doubles at random indices") {
+		lrc::put(result, indices, values);
+		return result.storage()[0];
+	};
+
+	BENCHMARK("compress 1M doubles with a random mask") {
+		return values[mask].storage()[0];
+	};
+
+	BENCHMARK("std::copy_if 1M doubles with a random mask") {
+		std::vector<double> selected;
+		selected.reserve(1 << 20);
+		for (size_t i = 0; i < (1 << 20); ++i) {
+			if (mask.storage()[i]) selected.push_back(values.storage()[i]);
+		}
+		return selected[0];
+	};
+}
@@ -0,0 +1,231 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <filesystem>
+#include <fstream>
+
+namespace lrc = librapid;
+
+static std::string tempPath(const std::string &name) {
+	return (std::filesystem::temp_directory_path() / name).string();
+}
+
+TEST_CASE("Test MappedStorage -- anonymous mappings", "[mappedStorage]") {
+	using Storage = lrc::MappedStorage<float>;
+
+	Storage empty;
+	REQUIRE(empty.size() == 0);
+	REQUIRE(!empty.isFileBacked());
+
+	Storage zeros(1000);
+	REQUIRE(zeros.size() == 1000);
+	for (size_t i = 0; i < zeros.size(); ++i) { REQUIRE(zeros[i] == 0); }
+
+	Storage filled(100, 3.5f);
+	for (size_t i = 0; i < filled.size(); ++i) { REQUIRE(filled[i] == 3.5f); }
+
+	for (size_t i = 0; i < filled.size(); ++i) { filled[i] = static_cast<float>(i); }
+	filled.resize(200);
+	REQUIRE(filled.size() == 200);
+	for (size_t i = 0; i < 100; ++i) { REQUIRE(filled[i] == static_cast<float>(i)); }
+
+	Storage copy(filled);
+	copy[0] = 123;
+	REQUIRE(filled[0] == 0);
+	REQUIRE(copy.size() == filled.size());
+
+	Storage moved(std::move(copy));
+	REQUIRE(moved.size() == 200);
+	REQUIRE(moved[0] == 123);
+	REQUIRE(copy.size() == 0);
+
+	zeros = moved;
+	REQUIRE(zeros.size() == 200);
+	REQUIRE(zeros[0] == 123);
+}
+
+TEST_CASE("Test MappedStorage -- file mappings", "[mappedStorage]") {
+	using Storage	 = lrc::MappedStorage<int32_t>;
+	std::string path = tempPath("librapid-test-mapped.bin");
+
+	{
+		Storage storage = Storage::create(path, 1000, 64);
+		REQUIRE(storage.isFileBacked());
+		REQUIRE(storage.mode() == lrc::MapMode::ReadWrite);
+		REQUIRE(std::filesystem::file_size(path) == 64 + 1000 * sizeof(int32_t));
+		for (size_t i = 0; i < storage.size(); ++i) {
+			REQUIRE(storage[i] == 0);
+			storage[i] = static_cast<int32_t>(i * 3);
+		}
+		storage.advise(lrc::MapAdvice::Sequential);
+		storage.flush();
+	}
+
+	// Writes to a read-write mapping reach the file
+	{
+		std::ifstream in(path, std::ios::binary);
+		in.seekg(64 + 10 * sizeof(int32_t));
+		int32_t value = 0;
+		in.read(reinterpret_cast<char *>(&value), sizeof(value));
+		REQUIRE(value == 30);
+	}
+
+	// Offsets which are not a multiple of the page size are supported
+	{
+		Storage storage(path, lrc::MapMode::ReadOnly, 500, 64 + 100 * sizeof(int32_t));
+		storage.advise(lrc::MapAdvice::WillNeed);
+		for (size_t i = 0; i < storage.size(); ++i) {
+			REQUIRE(storage[i] == static_cast<int32_t>((i + 100) * 3));
+		}
+	}
+
+	// Copy-on-write mappings never modify the file
+	{
+		Storage storage(path, lrc::MapMode::CopyOnWrite, 1000, 64);
+		storage[0] = -1;
+		REQUIRE(storage[0] == -1);
+
+		Storage reader(path, lrc::MapMode::ReadOnly, 1000, 64);
+		REQUIRE(reader[0] == 0);
+	}
+
+	// Copying a file mapping produces an independent anonymous mapping
+	{
+		Storage storage(path, lrc::MapMode::ReadOnly, 1000, 64);
+		Storage copy(storage);
+		REQUIRE(!copy.isFileBacked());
+		copy[1] = 7;
+		REQUIRE(storage[1] == 3);
+	}
+
+	REQUIRE_THROWS_AS(Storage(path, lrc::MapMode::ReadOnly, 2000, 64), std::runtime_error);
+	REQUIRE_THROWS_AS(Storage(path, lrc::MapMode::ReadOnly, 10, 2), std::runtime_error);
+	REQUIRE_THROWS_AS(Storage(tempPath("librapid-missing.bin"), lrc::MapMode::ReadOnly, 10),
+					  std::runtime_error);
+
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Test MappedStorage -- arrays", "[mappedStorage]") {
+	using MappedArray = lrc::Array<double, lrc::MappedStorage<double>>;
+	using ShapeType	  = MappedArray::ShapeType;
+
+	SECTION("Anonymous arrays") {
+		MappedArray a(ShapeType {37, 11}, 2);
+		MappedArray b(ShapeType {37, 11}, 3);
+		MappedArray c = a + b * 2;
+		for (size_t i = 0; i < c.storage().size(); ++i) { REQUIRE(c.storage()[i] == 8); }
+
+		c += a;
+		c *= 0.5;
+		for (size_t i = 0; i < c.storage().size(); ++i) { REQUIRE(c.storage()[i] == 5); }
+
+		// Mapped arrays can be mixed with other arrays
+		lrc::Array<double> d(ShapeType {37, 11}, 1);
+		c = c - d;
+		for (size_t i = 0; i < c.storage().size(); ++i) { REQUIRE(c.storage()[i] == 4); }
+	}
+
+	SECTION("Large arrays are assigned in parallel") {
+		const int64_t prevThreads = lrc::global::numThreads;
+		lrc::global::numThreads	  = 4;
+
+		const size_t size = lrc::global::multithreadThreshold * 4 + 3;
+		MappedArray a(ShapeType {size}, 1.5);
+		MappedArray b = a * a + a;
+		for (size_t i = 0; i < size; ++i) { REQUIRE(b.storage()[i] == 3.75); }
+		b -= a;
+		for (size_t i = 0; i < size; ++i) { REQUIRE(b.storage()[i] == 2.25); }
+
+		lrc::global::numThreads = prevThreads;
+	}
+
+	SECTION("File-backed arrays") {
+		std::string path = tempPath("librapid-test-mapped-array.lrpd");
+
+		{
+			auto array = lrc::createMappedArray<double>(path, ShapeType {20, 30});
+			REQUIRE(array.shape() == ShapeType {20, 30});
+			REQUIRE(array.storage().isFileBacked());
+
+			lrc::Array<double> values(ShapeType {20, 30});
+			for (size_t i = 0; i < values.storage().size(); ++i) {
+				values.storage()[i] = static_cast<double>(i);
+			}
+
+			// Results are evaluated directly into the file
+			array = values * 2;
+			array.storage().flush();
+		}
+
+		// Created files can be loaded like any saved array
+		auto loaded = lrc::Array<double>::load(path);
+		REQUIRE(loaded.shape() == ShapeType {20, 30});
+		for (size_t i = 0; i < loaded.storage().size(); ++i) {
+			REQUIRE(loaded.storage()[i] == static_cast<double>(i * 2));
+		}
+
+		auto mapped = lrc::mapArray<double>(path);
+		REQUIRE(mapped.shape() == ShapeType {20, 30});
+		REQUIRE(mapped.storage().mode() == lrc::MapMode::ReadOnly);
+		REQUIRE(reinterpret_cast<uintptr_t>(mapped.storage().begin()) % 64 == 0);
+
+		lrc::Array<double> sum = mapped + loaded;
+		for (size_t i = 0; i < sum.storage().size(); ++i) {
+			REQUIRE(sum.storage()[i] == static_cast<double>(i * 4));
+		}
+
+		REQUIRE_THROWS_AS(lrc::mapArray<float>(path), std::runtime_error);
+		std::filesystem::remove(path);
+	}
+
+	SECTION("Saved arrays can be mapped") {
+		std::string path = tempPath("librapid-test-mapped-saved.lrpd");
+
+		lrc::Array<float> array(lrc::Array<float>::ShapeType {3, 4, 5});
+		lrc::fillRandom(array, -1.0f, 1.0f, 42);
+		array.save(path);
+
+		auto mapped = lrc::mapArray<float>(path, lrc::MapMode::CopyOnWrite);
+		for (size_t i = 0; i < array.storage().size(); ++i) {
+			REQUIRE(mapped.storage()[i] == array.storage()[i]);
+		}
+
+		mapped *= 2.0f;
+		auto reloaded = lrc::Array<float>::load(path);
+		for (size_t i = 0; i < array.storage().size(); ++i) {
+			REQUIRE(reloaded.storage()[i] == array.storage()[i]);
+			REQUIRE(mapped.storage()[i] == array.storage()[i] * 2);
+		}
+		std::filesystem::remove(path);
+	}
+}
+
+TEST_CASE("Benchmark MappedStorage", "[mappedStorage][benchmark]") {
+	using ShapeType	 = lrc::Array<float>::ShapeType;
+	std::string path = tempPath("librapid-bench-mapped.lrpd");
+	const ShapeType shape {1 << 22};
+
+	{
+		auto array = lrc::createMappedArray<float>(path, shape);
+		lrc::fillRandom(array, 0.0f, 1.0f, 1);
+		array.storage().flush();
+	}
+
+	lrc::Array<float> inMemory = lrc::Array<float>::load(path);
+	lrc::Array<float> result(shape);
+
+	BENCHMARK("In-memory a * a") {
+		result = inMemory * inMemory;
+		return result.storage()[0];
+	};
+
+	BENCHMARK("Mapped a * a") {
+		auto mapped = lrc::mapArray<float>(path);
+		mapped.storage().advise(lrc::MapAdvice::Sequential);
+		result = mapped * mapped;
+		return result.storage()[0];
+	};
+
+	std::filesystem::remove(path);
+}
@@ -0,0 +1,302 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <filesystem>
+#include <fstream>
+
+namespace lrc = librapid;
+
+static std::string tempPath(const std::string &name) {
+	return (std::filesystem::temp_directory_path() / name).string();
+}
+
+static std::string readFile(const std::string &path) {
+	std::ifstream in(path, std::ios::binary);
+	return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+static void writeFile(const std::string &path, const std::string &contents) {
+	std::ofstream out(path, std::ios::binary);
+	out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+// Build a version 1.0 .npy header by hand, as NumPy would
+static std::string npyHeader(const std::string &dict) {
+	std::string header = dict;
+	while ((10 + header.size() + 1) % 64 != 0) header += ' ';
+	header += '\n';
+	std::string res = "\x93NUMPY";
+	res += '\x01';
+	res += '\x00';
+	res += static_cast<char>(header.size() & 0xFF);
+	res += static_cast<char>(header.size() >> 8);
+	return res + header;
+}
+
+#define TEST_NPY_ROUND_TRIP(SCALAR)                                                                \
+	SECTION(fmt::format("Round trip [{}]", STRINGIFY(SCALAR))) {                                   \
+		std::string path = tempPath("librapid-test-npy.npy");                                      \
+		lrc::Array<SCALAR> array(lrc::Array<SCALAR>::ShapeType {4, 3, 5});                         \
+		for (size_t i = 0; i < array.storage().size(); ++i) {                                      \
+			array.storage()[i] = static_cast<SCALAR>(i % 100);                                     \
+		}                                                                                          \
+                                                                                                   \
+		lrc::saveNpy(path, array);                                                                 \
+		REQUIRE((std::filesystem::file_size(path) - array.storage().size() * sizeof(SCALAR)) %     \
+				  64 ==                                                                            \
+				0);                                                                                \
+                                                                                                   \
+		auto loaded = lrc::loadNpy<SCALAR>(path);                                                  \
+		REQUIRE(loaded.shape() == array.shape());                                                  \
+		for (size_t i = 0; i < array.storage().size(); ++i) {                                      \
+			REQUIRE(loaded.storage()[i] == array.storage()[i]);                                    \
+		}                                                                                          \
+		std::filesystem::remove(path);                                                             \
+	}
+
+TEST_CASE("Test NPY -- round trip", "[npy]") {
+	TEST_NPY_ROUND_TRIP(int8_t)
+	TEST_NPY_ROUND_TRIP(uint8_t)
+	TEST_NPY_ROUND_TRIP(int16_t)
+	TEST_NPY_ROUND_TRIP(uint32_t)
+	TEST_NPY_ROUND_TRIP(int64_t)
+	TEST_NPY_ROUND_TRIP(float)
+	TEST_NPY_ROUND_TRIP(double)
+	TEST_NPY_ROUND_TRIP(lrc::half)
+	TEST_NPY_ROUND_TRIP(lrc::Complex<float>)
+	TEST_NPY_ROUND_TRIP(lrc::Complex<double>)
+
+	SECTION("Header contents") {
+		std::string path = tempPath("librapid-test-npy-header.npy");
+		lrc::Array<double> array(lrc::Array<double>::ShapeType {7});
+		lrc::saveNpy(path, array);
+
+		const std::string contents = readFile(path);
+		REQUIRE(contents.substr(0, 8) == std::string("\x93NUMPY\x01\x00", 8));
+		REQUIRE(contents.size() == 128 + 7 * sizeof(double));
+		REQUIRE(contents[127] == '\n');
+
+		const std::string order = lrc::detail::serialize::hostIsLittleEndian() ? "<" : ">";
+		REQUIRE(contents.find("'descr': '" + order + "f8'") != std::string::npos);
+		REQUIRE(contents.find("'fortran_order': False") != std::string::npos);
+		REQUIRE(contents.find("'shape': (7,)") != std::string::npos);
+		std::filesystem::remove(path);
+	}
+
+	SECTION("Boolean arrays") {
+		std::string path = tempPath("librapid-test-npy-bool.npy");
+		lrc::Array<bool> array(lrc::Array<bool>::ShapeType {5, 31});
+		for (size_t i = 0; i < array.storage().size(); ++i) {
+			array.storage()[i] = (i % 3) == 0;
+		}
+
+		lrc::saveNpy(path, array);
+		REQUIRE(std::filesystem::file_size(path) == 128 + 5 * 31);
+		REQUIRE(readFile(path).find("'descr': '|b1'") != std::string::npos);
+
+		auto loaded = lrc::loadNpy<bool>(path);
+		REQUIRE(loaded.shape() == array.shape());
+		for (size_t i = 0; i < array.storage().size(); ++i) {
+			REQUIRE(loaded.storage()[i] == array.storage()[i]);
+		}
+		std::filesystem::remove(path);
+	}
+}
+
+TEST_CASE("Test NPY -- files written by NumPy", "[npy]") {
+	std::string path = tempPath("librapid-test-npy-numpy.npy");
+
+	SECTION("Fortran order, big-endian") {
+		// np.array([[0, 1, 2], [3, 4, 5]], dtype='>i4', order='F')
+		std::string contents =
+		  npyHeader("{'descr': '>i4', 'fortran_order': True, 'shape': (2, 3), }");
+		for (int value : {0, 3, 1, 4, 2, 5}) {
+			contents += std::string {0, 0, 0, static_cast<char>(value)};
+		}
+		writeFile(path, contents);
+
+		auto loaded = lrc::loadNpy<int32_t>(path);
+		REQUIRE(loaded.shape() == lrc::Array<int32_t>::ShapeType {2, 3});
+		for (int32_t i = 0; i < 6; ++i) { REQUIRE(loaded.storage()[i] == i); }
+
+		REQUIRE_THROWS_AS(lrc::mapNpy<int32_t>(path), std::runtime_error);
+	}
+
+	SECTION("Fortran order, three dimensions") {
+		std::string contents =
+		  npyHeader("{'descr': '<u2', 'fortran_order': True, 'shape': (2, 3, 4), }");
+
+		// Element (i, j, k) has the value 100i + 10j + k and is stored at i + 2j + 6k
+		for (int k = 0; k < 4; ++k) {
+			for (int j = 0; j < 3; ++j) {
+				for (int i = 0; i < 2; ++i) {
+					const uint16_t value = static_cast<uint16_t>(100 * i + 10 * j + k);
+					contents += static_cast<char>(value & 0xFF);
+					contents += static_cast<char>(value >> 8);
+				}
+			}
+		}
+		writeFile(path, contents);
+
+		auto loaded = lrc::loadNpy<uint16_t>(path);
+		REQUIRE(loaded.shape() == lrc::Array<uint16_t>::ShapeType {2, 3, 4});
+		size_t index = 0;
+		for (int i = 0; i < 2; ++i) {
+			for (int j = 0; j < 3; ++j) {
+				for (int k = 0; k < 4; ++k) {
+					REQUIRE(loaded.storage()[index++] == 100 * i + 10 * j + k);
+				}
+			}
+		}
+	}
+
+	SECTION("Scalars and booleans") {
+		std::string contents = npyHeader("{'descr': '|b1', 'fortran_order': False, 'shape': (), }");
+		contents += '\x01';
+		writeFile(path, contents);
+
+		auto loaded = lrc::loadNpy<bool>(path);
+		REQUIRE(loaded.shape().ndim() == 0);
+		REQUIRE(loaded.storage()[0] == true);
+	}
+
+	SECTION("Invalid files") {
+		writeFile(path, npyHeader("{'descr': '<f8', 'fortran_order': False, 'shape': (3,), }"));
+		REQUIRE_THROWS_AS(lrc::loadNpy<float>(path), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::loadNpy<double>(path), std::runtime_error); // Missing data
+
+		writeFile(path,
+				  npyHeader("{'descr': [('a', '<i4')], 'fortran_order': False, 'shape': (3,), }"));
+		REQUIRE_THROWS_AS(lrc::loadNpy<int32_t>(path), std::runtime_error);
+
+		writeFile(path, npyHeader("{'descr': '<U8', 'fortran_order': False, 'shape': (3,), }"));
+		REQUIRE_THROWS_AS(lrc::loadNpy<int32_t>(path), std::runtime_error);
+
+		writeFile(path, "not a numpy file at all");
+		REQUIRE_THROWS_AS(lrc::loadNpy<int32_t>(path), std::runtime_error);
+	}
+
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Test NPY -- loading without copies", "[npy]") {
+	using ShapeType	 = lrc::Array<float>::ShapeType;
+	std::string path = tempPath("librapid-test-npy-inplace.npy");
+
+	lrc::Array<float> array(ShapeType {16, 9});
+	lrc::fillRandom(array, -1.0f, 1.0f, 7);
+	lrc::saveNpy(path, array);
+
+	SECTION("Pre-allocated arrays are filled in place") {
+		lrc::Array<float> dst(ShapeType {16, 9});
+		const float *before = dst.storage().begin();
+		lrc::loadNpy(path, dst);
+		REQUIRE(dst.storage().begin() == before);
+		for (size_t i = 0; i < array.storage().size(); ++i) {
+			REQUIRE(dst.storage()[i] == array.storage()[i]);
+		}
+
+		lrc::ArrayF<float, 16, 9> fixed;
+		lrc::loadNpy(path, fixed);
+		for (size_t i = 0; i < array.storage().size(); ++i) {
+			REQUIRE(fixed.storage()[i] == array.storage()[i]);
+		}
+
+		lrc::ArrayF<float, 9, 16> wrongShape;
+		REQUIRE_THROWS_AS(lrc::loadNpy(path, wrongShape), std::runtime_error);
+	}
+
+	SECTION("Files can be memory-mapped") {
+		auto mapped = lrc::mapNpy<float>(path);
+		REQUIRE(mapped.shape() == array.shape());
+		REQUIRE(reinterpret_cast<uintptr_t>(mapped.storage().begin()) % 64 == 0);
+		for (size_t i = 0; i < array.storage().size(); ++i) {
+			REQUIRE(mapped.storage()[i] == array.storage()[i]);
+		}
+
+		lrc::Array<float> doubled = mapped * 2;
+		REQUIRE(doubled.storage()[3] == array.storage()[3] * 2);
+		REQUIRE_THROWS_AS(lrc::mapNpy<double>(path), std::runtime_error);
+	}
+
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Test NPZ", "[npy]") {
+	std::string path = tempPath("librapid-test-npz.npz");
+
+	REQUIRE(lrc::detail::npy::crc32(0, "123456789", 9) == 0xCBF43926);
+
+	lrc::Array<double> weights(lrc::Array<double>::ShapeType {10, 20});
+	lrc::Array<int64_t> steps(lrc::Array<int64_t>::ShapeType {3});
+	lrc::Array<bool> mask(lrc::Array<bool>::ShapeType {70});
+	lrc::fillRandom(weights, 0.0, 1.0, 3);
+	for (size_t i = 0; i < 3; ++i) steps.storage()[i] = static_cast<int64_t>(i * 1000);
+	for (size_t i = 0; i < 70; ++i) mask.storage()[i] = i % 7 == 0;
+
+	{
+		lrc::NpzWriter writer(path);
+		writer.add("weights", weights);
+		writer.add("steps", steps);
+		writer.add("mask", mask);
+		writer.add("odd", weights); // An odd-length name, so the header needs padding
+		writer.close();
+	}
+
+	lrc::NpzReader reader(path);
+	REQUIRE(reader.names() == std::vector<std::string> {"weights", "steps", "mask", "odd"});
+	REQUIRE(reader.contains("steps"));
+	REQUIRE(!reader.contains("missing"));
+
+	auto loadedWeights = reader.load<double>("weights");
+	REQUIRE(loadedWeights.shape() == weights.shape());
+	for (size_t i = 0; i < weights.storage().size(); ++i) {
+		REQUIRE(loadedWeights.storage()[i] == weights.storage()[i]);
+	}
+
+	auto loadedSteps = reader.load<int64_t>("steps");
+	for (size_t i = 0; i < 3; ++i) REQUIRE(loadedSteps.storage()[i] == steps.storage()[i]);
+
+	auto loadedMask = reader.load<bool>("mask");
+	for (size_t i = 0; i < 70; ++i) REQUIRE(loadedMask.storage()[i] == mask.storage()[i]);
+
+	// Every entry starts at a multiple of 64 bytes, so any of them can be mapped
+	auto mappedSteps = reader.map<int64_t>("steps");
+	for (size_t i = 0; i < 3; ++i) REQUIRE(mappedSteps.storage()[i] == steps.storage()[i]);
+	for (const std::string name : {"weights", "odd"}) {
+		auto mapped = reader.map<double>(name);
+		REQUIRE(mapped.shape() == weights.shape());
+		REQUIRE(reinterpret_cast<uintptr_t>(mapped.storage().begin()) % 64 == 0);
+		for (size_t i = 0; i < weights.storage().size(); ++i) {
+			REQUIRE(mapped.storage()[i] == weights.storage()[i]);
+		}
+	}
+
+	REQUIRE_THROWS_AS(reader.load<double>("missing"), std::runtime_error);
+	REQUIRE_THROWS_AS(reader.load<float>("weights"), std::runtime_error);
+
+	// The archive ends with an end of central directory record listing four entries
+	const std::string contents = readFile(path);
+	REQUIRE(contents.substr(contents.size() - 22, 4) == "PK\x05\x06");
+	REQUIRE(contents[contents.size() - 12] == 4);
+
+	writeFile(path, "PK but not really a zip file");
+	REQUIRE_THROWS_AS(lrc::NpzReader(path), std::runtime_error);
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Benchmark NPY", "[npy][benchmark]") {
+	std::string path = tempPath("librapid-bench-npy.npy");
+	lrc::Array<float> array(lrc::Array<float>::ShapeType {1 << 24});
+	lrc::fillRandom(array, 0.0f, 1.0f, 1);
+	lrc::Array<float> dst(array.shape());
+
+	BENCHMARK("Save 64MB .npy") { lrc::saveNpy(path, array); };
+
+	BENCHMARK("Load 64MB .npy into an existing array") {
+		lrc::loadNpy(path, dst);
+		return dst.storage()[0];
+	};
+
+	std::filesystem::remove(path);
+}
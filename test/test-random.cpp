@@ -0,0 +1,146 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+TEST_CASE("Test Philox -- known answers", "[random]") {
+	// Test vectors from the Random123 reference implementation. The counter is packed as
+	// (block, stream) and the key as the seed
+	using Block = lrc::Philox::Block;
+	REQUIRE(lrc::Philox(0, 0).block(0) == Block {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+	REQUIRE(lrc::Philox(~uint64_t(0), ~uint64_t(0)).block(~uint64_t(0)) ==
+			Block {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+	REQUIRE(lrc::Philox(0x299f31d0a4093822, 0x0370734413198a2e).block(0x85a308d3243f6a88) ==
+			Block {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+
+	// The sequential interface, skip-ahead and bulk generation agree
+	lrc::Philox generator(1234, 5);
+	std::vector<uint32_t> words(100);
+	generator.words(3, 100, words.data());
+	generator.discard(3);
+	for (uint32_t word : words) { REQUIRE(generator() == word); }
+	REQUIRE(generator.position() == 103);
+
+	// Packets contain consecutive variates
+	auto floats	 = generator.uniformPacket<float>(10);
+	auto doubles = generator.uniformPacket<double>(10);
+	for (int64_t i = 0; i < lrc::typetraits::TypeInfo<float>::packetWidth; ++i) {
+		REQUIRE(floats[i] == generator.uniform<float>(10 + i));
+	}
+	for (int64_t i = 0; i < lrc::typetraits::TypeInfo<double>::packetWidth; ++i) {
+		REQUIRE(doubles[i] == generator.uniform<double>(10 + i));
+	}
+
+	REQUIRE(lrc::random(0.0, 1.0, 5) == lrc::random(0.0, 1.0, 5));
+	REQUIRE(lrc::random(0.0, 1.0) != lrc::random(0.0, 1.0));
+
+	// The components of a random complex number are consecutive variates of one stream
+	using Complex	= lrc::Complex<double>;
+	const Complex z = lrc::random(Complex(0, 0), Complex(1, 1), 5);
+	const lrc::Philox seeded(5);
+	REQUIRE(lrc::real(z) == lrc::detail::randomUniform(seeded, 0, 0.0, 1.0));
+	REQUIRE(lrc::imag(z) == lrc::detail::randomUniform(seeded, 1, 0.0, 1.0));
+	REQUIRE(lrc::real(z) != lrc::imag(z));
+}
+
+#define TEST_RANDOM_FILL(SCALAR)                                                                   \
+	SECTION(fmt::format("Test Random Fill [{}]", STRINGIFY(SCALAR))) {                             \
+		int64_t numThreads = lrc::global::numThreads;                                              \
+		for (int64_t size : {1, 7, 1003, 100003}) {                                                \
+			lrc::Array<SCALAR> serial(lrc::Array<SCALAR>::ShapeType {size});                       \
+			lrc::Array<SCALAR> parallel(lrc::Array<SCALAR>::ShapeType {size});                     \
+			lrc::Array<SCALAR> shard(lrc::Array<SCALAR>::ShapeType {size / 2});                    \
+                                                                                                   \
+			lrc::global::numThreads = 1;                                                           \
+			lrc::fillRandom(serial, SCALAR(-2), SCALAR(3), 42);                                    \
+			lrc::global::numThreads = 8;                                                           \
+			lrc::fillRandom(parallel, SCALAR(-2), SCALAR(3), 42);                                  \
+			lrc::fillRandom(shard, SCALAR(-2), SCALAR(3), 42, size - size / 2);                    \
+                                                                                                   \
+			double mean = 0;                                                                       \
+			for (int64_t i = 0; i < size; ++i) {                                                   \
+				REQUIRE(serial.storage()[i] == parallel.storage()[i]);                             \
+				REQUIRE(serial.storage()[i] >= SCALAR(-2));                                        \
+				REQUIRE(serial.storage()[i] <= SCALAR(3));                                         \
+				mean += static_cast<double>(serial.storage()[i]);                                  \
+			}                                                                                      \
+			for (int64_t i = 0; i < size / 2; ++i) {                                               \
+				REQUIRE(shard.storage()[i] == serial.storage()[size - size / 2 + i]);              \
+			}                                                                                      \
+			if (size > 100000) { REQUIRE(std::abs(mean / size - 0.5) < 0.05); }                    \
+                                                                                                   \
+			lrc::global::numThreads = 1;                                                           \
+			lrc::fillRandomGaussian(serial, SCALAR(1), SCALAR(2), 7);                              \
+			lrc::global::numThreads = 8;                                                           \
+			lrc::fillRandomGaussian(parallel, SCALAR(1), SCALAR(2), 7);                            \
+                                                                                                   \
+			double sum = 0, sumSq = 0;                                                             \
+			for (int64_t i = 0; i < size; ++i) {                                                   \
+				REQUIRE(serial.storage()[i] == parallel.storage()[i]);                             \
+				double value = static_cast<double>(serial.storage()[i]);                           \
+				sum += value;                                                                      \
+				sumSq += value * value;                                                            \
+			}                                                                                      \
+			if (size > 100000) {                                                                   \
+				REQUIRE(std::abs(sum / size - 1) < 0.05);                                          \
+				REQUIRE(std::abs(sumSq / size - (sum / size) * (sum / size) - 4) < 0.1);           \
+			}                                                                                      \
+		}                                                                                          \
+		lrc::global::numThreads = numThreads;                                                      \
+	}
+
+TEST_CASE("Test Philox -- array fills", "[random]") {
+	TEST_RANDOM_FILL(float)
+	TEST_RANDOM_FILL(double)
+	TEST_RANDOM_FILL(lrc::half)
+
+	lrc::Array<int32_t> dice(lrc::Array<int32_t>::ShapeType {10007});
+	lrc::fillRandom(dice, 1, 6);
+	std::array<int64_t, 7> counts {};
+	for (int64_t i = 0; i < 10007; ++i) {
+		REQUIRE(dice.storage()[i] >= 1);
+		REQUIRE(dice.storage()[i] <= 6);
+		++counts[dice.storage()[i]];
+	}
+	for (int64_t i = 1; i <= 6; ++i) { REQUIRE(counts[i] > 1400); }
+
+	BENCHMARK("Fill 1M floats") {
+		lrc::Array<float> values(lrc::Array<float>::ShapeType {1000000});
+		lrc::fillRandom(values, 0.0f, 1.0f, 1);
+		return values.storage()[0];
+	};
+}
+
+TEST_CASE("Test Philox -- integer ranges", "[random]") {
+	// A range of 3 * 2^62 values. Reducing a 64-bit word modulo the range would make the first
+	// third of the range twice as likely as each of the others
+	const uint64_t upper = (uint64_t(3) << 62) - 1;
+	lrc::Array<uint64_t> wide(lrc::Array<uint64_t>::ShapeType {30000});
+	lrc::fillRandom(wide, uint64_t(0), upper, 3);
+
+	const lrc::Philox generator(3);
+	std::array<int64_t, 3> thirds {};
+	for (int64_t i = 0; i < 30000; ++i) {
+		const uint64_t value = wide.storage()[i];
+		REQUIRE(value <= upper);
+		REQUIRE(value == lrc::detail::randomUniform(generator, i, uint64_t(0), upper));
+		++thirds[value >> 62];
+	}
+	for (int64_t count : thirds) { REQUIRE(std::abs(count - 10000) < 500); }
+
+	// Chi-squared test over a small range which is not a power of two (7 values, so 6 degrees
+	// of freedom; 30 is far beyond the 99.9th percentile)
+	lrc::Array<int16_t> small(lrc::Array<int16_t>::ShapeType {70000});
+	lrc::fillRandom(small, int16_t(-3), int16_t(3), 11);
+	std::array<int64_t, 7> counts {};
+	for (int64_t i = 0; i < 70000; ++i) {
+		REQUIRE(small.storage()[i] >= -3);
+		REQUIRE(small.storage()[i] <= 3);
+		++counts[small.storage()[i] + 3];
+	}
+	double chiSquared = 0;
+	for (int64_t count : counts) chiSquared += double(count - 10000) * (count - 10000) / 10000;
+	REQUIRE(chiSquared < 30);
+}
@@ -0,0 +1,145 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+template<typename ArrayType>
+static ArrayType iotaArray(const lrc::Shape<size_t> &shape) {
+	ArrayType array(shape);
+	for (size_t i = 0; i < shape.size(); ++i) array.storage()[i] = static_cast<float>(i);
+	return array;
+}
+
+TEST_CASE("Test RankedShape", "[rankedArray]") {
+	using RankedShape = lrc::RankedShape<size_t, 3>;
+	static_assert(RankedShape::ndim() == 3);
+
+	RankedShape shape({2, 3, 4});
+	REQUIRE(shape.size() == 24);
+	REQUIRE(shape[2] == 4);
+	REQUIRE(shape.str() == "(2, 3, 4)");
+	REQUIRE(RankedShape::zeros().size() == 0);
+	REQUIRE(RankedShape::ones(3).size() == 1);
+	REQUIRE(shape.subshape(1, 3) == lrc::Shape({3, 4}));
+
+	// Conversions to and from a Shape
+	lrc::Shape<size_t> dynamic = shape;
+	REQUIRE(dynamic == lrc::Shape({2, 3, 4}));
+	REQUIRE(shape == dynamic);
+	REQUIRE(dynamic == shape);
+	REQUIRE(RankedShape(dynamic) == shape);
+	REQUIRE(shape != lrc::Shape({2, 3}));
+	REQUIRE(shape != RankedShape({2, 3, 5}));
+
+	REQUIRE_THROWS_AS(RankedShape({2, 3}), std::runtime_error);
+	REQUIRE_THROWS_AS(RankedShape(lrc::Shape({2, 3, 4, 5})), std::runtime_error);
+	REQUIRE_THROWS_AS(RankedShape::zeros(2), std::runtime_error);
+}
+
+TEST_CASE("Test RankedArray", "[rankedArray]") {
+	SECTION("Construction and indexing") {
+		lrc::Matrix<float> matrix(lrc::Shape({2, 3}));
+		matrix << 1, 2, 3, //
+		  4, 5, 6;
+		static_assert(lrc::Matrix<float>::ShapeType::ndim() == 2);
+		REQUIRE(matrix.shape() == lrc::Shape({2, 3}));
+
+		auto row = matrix[1];
+		static_assert(std::is_same_v<decltype(row), lrc::RankedArray<float, 1>>);
+		REQUIRE(row.shape() == lrc::Shape({3}));
+		REQUIRE(row[2].get() == 6);
+		REQUIRE(matrix[0][1].get() == 2);
+
+		lrc::Array<float> array(lrc::Shape({2, 3}));
+		array << 1, 2, 3, //
+		  4, 5, 6;
+		REQUIRE(matrix.str() == array.str());
+
+		lrc::Matrix<float> empty;
+		REQUIRE(empty.shape().size() == 0);
+		REQUIRE_THROWS_AS(lrc::Matrix<float>(lrc::Shape({6})), std::runtime_error);
+	}
+
+	SECTION("Conversions") {
+		auto array	= iotaArray<lrc::Array<float>>(lrc::Shape({3, 4}));
+		auto matrix = iotaArray<lrc::Matrix<float>>(lrc::Shape({3, 4}));
+
+		lrc::Matrix<float> fromArray = array;
+		REQUIRE(fromArray.shape() == matrix.shape());
+		REQUIRE(std::equal(
+		  matrix.storage().begin(), matrix.storage().end(), fromArray.storage().begin()));
+
+		lrc::Array<float> fromMatrix = matrix;
+		REQUIRE(fromMatrix.shape() == array.shape());
+		REQUIRE(std::equal(
+		  array.storage().begin(), array.storage().end(), fromMatrix.storage().begin()));
+
+		// Converting a temporary moves its storage
+		lrc::Matrix<float> moved = lrc::Array<float>(array);
+		REQUIRE(moved.shape() == matrix.shape());
+		REQUIRE(moved.storage()[11] == 11);
+
+		REQUIRE_THROWS_AS(lrc::Matrix<float>(lrc::Array<float>(lrc::Shape({2, 2, 3}))),
+						  std::runtime_error);
+	}
+
+	SECTION("Expressions") {
+		auto lhs = iotaArray<lrc::Matrix<float>>(lrc::Shape({5, 7}));
+		auto rhs = iotaArray<lrc::Matrix<float>>(lrc::Shape({5, 7}));
+
+		lrc::Matrix<float> sum = lhs + rhs * 2.0f;
+		lrc::Array<float> mixed = lhs + iotaArray<lrc::Array<float>>(lrc::Shape({5, 7}));
+		for (size_t i = 0; i < 35; ++i) {
+			REQUIRE(sum.storage()[i] == static_cast<float>(i * 3));
+			REQUIRE(mixed.storage()[i] == static_cast<float>(i * 2));
+		}
+	}
+
+	SECTION("Views") {
+		auto matrix = iotaArray<lrc::Matrix<float>>(lrc::Shape({4, 6}));
+		auto view	= matrix.slice(lrc::Slice(1, 4, 2), lrc::Slice(5, 0, -2));
+		static_assert(decltype(view)::ShapeType::MaxDimensions == 2);
+		REQUIRE(view.shape() == lrc::Shape({2, 3}));
+
+		lrc::Matrix<float> block = view.eval();
+		const float expected[]	 = {11, 9, 7, 23, 21, 19};
+		for (size_t i = 0; i < 6; ++i) {
+			REQUIRE(block.storage()[i] == expected[i]);
+			REQUIRE(view.scalar(i) == expected[i]);
+		}
+
+		auto column = matrix.slice(lrc::Slice(), 2);
+		REQUIRE(column.shape() == lrc::Shape({4}));
+		REQUIRE(column.eval().storage()[3] == 20);
+	}
+}
+
+TEST_CASE("Benchmark RankedArray", "[rankedArray][benchmark]") {
+	auto array	= iotaArray<lrc::Array<float>>(lrc::Shape({1024, 1024}));
+	auto matrix = iotaArray<lrc::Matrix<float>>(lrc::Shape({1024, 1024}));
+
+	// Every other column, so the view is strided in both dimensions
+	auto arrayView	= array.slice(lrc::Slice(), lrc::Slice(0, 1024, 2));
+	auto matrixView = matrix.slice(lrc::Slice(), lrc::Slice(0, 1024, 2));
+
+	BENCHMARK("Sum a strided 1024x512 view of an Array with ArrayView::scalar") {
+		float total = 0;
+		for (int64_t i = 0; i < 1024 * 512; ++i) total += arrayView.scalar(i);
+		return total;
+	};
+
+	BENCHMARK("Sum a strided 1024x512 view of a Matrix with ArrayView::scalar") {
+		float total = 0;
+		for (int64_t i = 0; i < 1024 * 512; ++i) total += matrixView.scalar(i);
+		return total;
+	};
+
+	BENCHMARK("Evaluate a strided 1024x512 view of an Array") {
+		return arrayView.eval().storage()[0];
+	};
+
+	BENCHMARK("Evaluate a strided 1024x512 view of a Matrix") {
+		return matrixView.eval().storage()[0];
+	};
+}
@@ -0,0 +1,244 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+template<typename Scalar>
+static lrc::Array<Scalar> randomArray(const typename lrc::Array<Scalar>::ShapeType &shape,
+									  int64_t low, int64_t high, uint64_t seed) {
+	std::mt19937_64 generator(seed);
+	lrc::Array<Scalar> array(shape);
+	for (size_t i = 0; i < shape.size(); ++i) {
+		array.storage()[i] =
+		  static_cast<Scalar>(low + static_cast<int64_t>(generator() % (high - low + 1)));
+	}
+	return array;
+}
+
+// Scan every line of \p array along \p axis one element at a time
+template<typename StorageType, typename Op>
+static std::vector<typename StorageType::Scalar>
+referenceScan(const lrc::ArrayRef<StorageType> &array, int64_t axis, bool exclusive,
+			  typename StorageType::Scalar identity, Op op) {
+	using Scalar = typename StorageType::Scalar;
+	std::vector<Scalar> result(array.shape().size());
+	const auto lines = axis == lrc::allAxes
+						 ? lrc::detail::sort::Lines {1, static_cast<int64_t>(result.size()), 1}
+						 : lrc::detail::sort::lines(array.shape(), axis);
+	for (int64_t line = 0; line < lines.count; ++line) {
+		Scalar carry = identity;
+		for (int64_t i = 0; i < lines.extent; ++i) {
+			const int64_t index = lines.start(line) + i * lines.inner;
+			const Scalar value	= array.storage()[index];
+			if (exclusive) result[index] = carry;
+			carry = i == 0 ? value : op(carry, value);
+			if (!exclusive) result[index] = carry;
+		}
+	}
+	return result;
+}
+
+template<typename StorageType>
+static std::vector<typename StorageType::Scalar> values(const lrc::ArrayRef<StorageType> &array) {
+	return {array.storage().begin(), array.storage().begin() + array.shape().size()};
+}
+
+// Check every scan of an array of small integers against the reference, along every axis
+// and in both modes
+template<typename StorageType>
+static void requireScans(const lrc::ArrayRef<StorageType> &array) {
+	using Scalar = typename StorageType::Scalar;
+	const auto max = [](Scalar a, Scalar b) { return a > b ? a : b; };
+
+	std::vector<int64_t> axes = {lrc::allAxes};
+	for (int64_t axis = 0; axis < static_cast<int64_t>(array.shape().ndim()); ++axis) {
+		axes.push_back(axis);
+	}
+
+	for (int64_t axis : axes) {
+		for (bool exclusive : {false, true}) {
+			REQUIRE(values(lrc::cumsum(array, axis, exclusive)) ==
+					referenceScan(array, axis, exclusive, Scalar(0), std::plus<Scalar>()));
+			REQUIRE(values(lrc::cumprod(array, axis, exclusive)) ==
+					referenceScan(array, axis, exclusive, Scalar(1), std::multiplies<Scalar>()));
+			REQUIRE(values(lrc::cummax(array, axis, exclusive)) ==
+					referenceScan(array, axis, exclusive,
+								  lrc::detail::scan::Max::identity<Scalar>(), max));
+		}
+	}
+}
+
+TEST_CASE("Test scans", "[scan]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+
+	SECTION("Values") {
+		lrc::Array<double> array(ShapeType {2, 3});
+		array << 1, 2, 3, //
+		  4, 5, 6;
+
+		auto sum = lrc::cumsum(array);
+		REQUIRE(sum.shape() == ShapeType {6});
+		REQUIRE(values(sum) == std::vector<double> {1, 3, 6, 10, 15, 21});
+		REQUIRE(values(lrc::cumsum(array, lrc::allAxes, true)) ==
+				std::vector<double> {0, 1, 3, 6, 10, 15});
+
+		REQUIRE(lrc::cumsum(array, 0).shape() == array.shape());
+		REQUIRE(values(lrc::cumsum(array, 0)) == std::vector<double> {1, 2, 3, 5, 7, 9});
+		REQUIRE(values(lrc::cumsum(array, -1)) == std::vector<double> {1, 3, 6, 4, 9, 15});
+		REQUIRE(values(lrc::cumprod(array, 1)) == std::vector<double> {1, 2, 6, 4, 20, 120});
+		REQUIRE(values(lrc::cumprod(array, 1, true)) == std::vector<double> {1, 1, 2, 1, 4, 20});
+
+		const double inf = std::numeric_limits<double>::infinity();
+		REQUIRE(values(lrc::cummax(array, 0, true)) ==
+				std::vector<double> {-inf, -inf, -inf, 1, 2, 3});
+
+		REQUIRE_THROWS_AS(lrc::cumsum(array, 2), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::cumsum(array, -3), std::runtime_error);
+
+		lrc::Array<double> empty(ShapeType {3, 0});
+		REQUIRE(lrc::cumsum(empty, 0).shape() == empty.shape());
+		REQUIRE(lrc::cumsum(empty).shape() == ShapeType {0});
+	}
+
+	SECTION("NaN values propagate through cummax") {
+		const double nan = std::numeric_limits<double>::quiet_NaN();
+		lrc::Array<double> array(ShapeType {5});
+		array << 1, 3, nan, 2, 5;
+		auto max = lrc::cummax(array);
+		REQUIRE(max.storage()[0] == 1);
+		REQUIRE(max.storage()[1] == 3);
+		for (size_t i = 2; i < 5; ++i) REQUIRE(std::isnan(max.storage()[i]));
+	}
+
+	SECTION("Axes") {
+		// Products of values in [-1, 1] never overflow
+		for (const ShapeType &shape : {ShapeType {37}, ShapeType {17, 23}, ShapeType {4, 30, 5},
+									   ShapeType {3, 700}, ShapeType {2, 300, 3}}) {
+			requireScans(randomArray<int64_t>(shape, -1, 1, shape.size()));
+			requireScans(randomArray<int32_t>(shape, -1, 1, shape.size() + 1));
+			requireScans(randomArray<double>(shape, -1, 1, shape.size() + 2));
+		}
+	}
+
+	SECTION("Ranked arrays") {
+		lrc::Matrix<int64_t> matrix(lrc::Shape({2, 3}));
+		matrix << 1, 2, 3, //
+		  4, 5, 6;
+
+		// The flattened scan has one dimension, so it cannot keep the matrix's shape type
+		auto flat = lrc::cumsum(matrix);
+		REQUIRE(flat.shape() == lrc::Shape({6}));
+		REQUIRE(values(flat) == std::vector<int64_t> {1, 3, 6, 10, 15, 21});
+
+		auto rows = lrc::cumsum(matrix, 1);
+		REQUIRE(rows.shape() == lrc::Shape({2, 3}));
+		REQUIRE(values(rows) == std::vector<int64_t> {1, 3, 6, 4, 9, 15});
+
+		lrc::RankedArray<int64_t, 1> vector(lrc::Shape({3}));
+		vector << 1, 2, 3;
+		auto scanned = lrc::cumsum(vector);
+		static_assert(std::is_same_v<decltype(scanned), lrc::RankedArray<int64_t, 1>>);
+		REQUIRE(values(scanned) == std::vector<int64_t> {1, 3, 6});
+	}
+
+	SECTION("Into an existing array") {
+		auto array = randomArray<int64_t>(ShapeType {40, 50}, -100, 100, 7);
+		lrc::Array<int64_t> flat(ShapeType {2000});
+		lrc::cumsum(array, flat);
+		REQUIRE(values(flat) ==
+				referenceScan(array, lrc::allAxes, false, int64_t(0), std::plus<int64_t>()));
+
+		lrc::Array<int64_t> result(ShapeType {40, 50});
+		lrc::cummax(array, result, 0, true);
+		REQUIRE(values(result) ==
+				referenceScan(array, 0, true, std::numeric_limits<int64_t>::lowest(),
+							  [](int64_t a, int64_t b) { return a > b ? a : b; }));
+
+		// In place
+		const auto expected = referenceScan(array, 1, true, int64_t(0), std::plus<int64_t>());
+		lrc::cumsum(array, array, 1, true);
+		REQUIRE(values(array) == expected);
+
+		lrc::Array<int64_t> wrong(ShapeType {50, 40});
+		REQUIRE_THROWS_AS(lrc::cumsum(array, wrong, 0), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::cumsum(array, result, 2), std::runtime_error);
+	}
+
+	SECTION("Parallel") {
+		const int64_t prevThreads	= lrc::global::numThreads;
+		const int64_t prevThreshold = lrc::global::multithreadThreshold;
+		lrc::global::multithreadThreshold = 1000;
+
+		// A single line is split into chunks; many lines are shared out between threads
+		const std::vector<ShapeType> shapes = {
+		  ShapeType {100003}, ShapeType {2, 40001}, ShapeType {30001, 3}, ShapeType {400, 300}};
+
+		for (const ShapeType &shape : shapes) {
+			lrc::global::numThreads = 5;
+			requireScans(randomArray<int64_t>(shape, -1, 1, shape.size()));
+		}
+
+		// Floating point results do not depend on the number of threads
+		for (const ShapeType &shape : shapes) {
+			auto array = randomArray<double>(shape, -1000, 1000, shape.size());
+			for (int64_t axis : {lrc::allAxes, int64_t(0), int64_t(-1)}) {
+				lrc::global::numThreads = 1;
+				const auto serial		= values(lrc::cumsum(array, axis));
+				lrc::global::numThreads = 5;
+				const auto parallel		= values(lrc::cumsum(array, axis));
+				lrc::global::numThreads = 3;
+				REQUIRE(values(lrc::cumsum(array, axis)) == parallel);
+				REQUIRE(serial == parallel);
+			}
+		}
+
+		// A line with more chunks than are scanned in one parallel pass
+		const int64_t size =
+		  lrc::detail::scan::chunkSize * (lrc::detail::scan::maxParallelChunks + 3) + 17;
+		lrc::Array<int64_t> ones(ShapeType {size});
+		std::fill(ones.storage().begin(), ones.storage().end(), int64_t(1));
+		lrc::global::numThreads = 5;
+		const auto counts		= lrc::cumsum(ones, lrc::allAxes, true);
+		bool counted			= true;
+		for (int64_t i = 0; i < size; ++i) counted &= counts.storage()[i] == i;
+		REQUIRE(counted);
+
+		lrc::global::numThreads			  = prevThreads;
+		lrc::global::multithreadThreshold = prevThreshold;
+	}
+}
+
+TEST_CASE("Benchmark scans", "[scan][benchmark]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+	auto vector		= randomArray<double>(ShapeType {1 << 20}, -1000, 1000, 8);
+	auto matrix		= randomArray<double>(ShapeType {1024, 1024}, -1000, 1000, 9);
+	lrc::Array<double> result(ShapeType {1 << 20});
+	lrc::Array<double> matrixResult(ShapeType {1024, 1024});
+	std::vector<double> output(1 << 20);
+
+	BENCHMARK("cumsum 1M doubles into an existing array") {
+		lrc::cumsum(vector, result);
+		return result.storage()[0];
+	};
+
+	BENCHMARK("std::partial_sum 1M doubles") {
+		std::partial_sum(vector.storage().begin(), vector.storage().end(), output.begin());
+		return output[0];
+	};
+
+	BENCHMARK("cummax 1M doubles into an existing array") {
+		lrc::cummax(vector, result);
+		return result.storage()[0];
+	};
+
+	BENCHMARK("cumsum 1024x1024 doubles along axis 0") {
+		lrc::cumsum(matrix, matrixResult, 0);
+		return matrixResult.storage()[0];
+	};
+
+	BENCHMARK("cumsum 1024x1024 doubles along axis 1") {
+		lrc::cumsum(matrix, matrixResult, 1);
+		return matrixResult.storage()[0];
+	};
+}
@@ -0,0 +1,202 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <filesystem>
+
+namespace lrc = librapid;
+
+static std::string tempPath(const std::string &name) {
+	return (std::filesystem::temp_directory_path() / name).string();
+}
+
+#define TEST_SAVE_LOAD(SCALAR)                                                                     \
+	SECTION(fmt::format("Test Save and Load [{}]", STRINGIFY(SCALAR))) {                           \
+		std::string path = tempPath("librapid-test-serialize.lrpd");                               \
+		lrc::Array<SCALAR> array(lrc::Array<SCALAR>::ShapeType {3, 5, 7});                         \
+		for (size_t i = 0; i < array.storage().size(); ++i) {                                      \
+			array.storage()[i] = static_cast<SCALAR>(i % 100);                                     \
+		}                                                                                          \
+                                                                                                   \
+		array.save(path);                                                                          \
+		auto loaded = lrc::Array<SCALAR>::load(path);                                              \
+		REQUIRE(loaded.shape() == array.shape());                                                  \
+		for (size_t i = 0; i < array.storage().size(); ++i) {                                      \
+			REQUIRE(loaded.storage()[i] == array.storage()[i]);                                    \
+		}                                                                                          \
+		std::filesystem::remove(path);                                                             \
+	}
+
+TEST_CASE("Test Serialize -- round trip", "[serialize]") {
+	TEST_SAVE_LOAD(int8_t)
+	TEST_SAVE_LOAD(uint16_t)
+	TEST_SAVE_LOAD(int32_t)
+	TEST_SAVE_LOAD(int64_t)
+	TEST_SAVE_LOAD(float)
+	TEST_SAVE_LOAD(double)
+	TEST_SAVE_LOAD(lrc::half)
+	TEST_SAVE_LOAD(lrc::Complex<double>)
+
+	SECTION("Boolean arrays") {
+		std::string path = tempPath("librapid-test-serialize-bool.lrpd");
+		lrc::Array<bool> mask(lrc::Array<bool>::ShapeType {10, 13});
+		for (size_t i = 0; i < 130; ++i) mask.storage()[i] = i % 3 == 0;
+		mask.save(path);
+		REQUIRE(std::filesystem::file_size(path) == 64 + 3 * 8);
+
+		auto loaded = lrc::Array<bool>::load(path);
+		REQUIRE(loaded.shape() == mask.shape());
+		for (size_t i = 0; i < 130; ++i) { REQUIRE(loaded.storage()[i] == (i % 3 == 0)); }
+		std::filesystem::remove(path);
+	}
+
+	SECTION("Fixed-size arrays") {
+		std::string path = tempPath("librapid-test-serialize-fixed.lrpd");
+		lrc::ArrayF<int, 2, 3> fixed;
+		for (int i = 0; i < 6; ++i) fixed.storage()[i] = i * i;
+		fixed.save(path);
+
+		auto loaded = lrc::ArrayF<int, 2, 3>::load(path);
+		for (int i = 0; i < 6; ++i) { REQUIRE(loaded.storage()[i] == i * i); }
+		using Transposed = lrc::ArrayF<int, 3, 2>;
+		REQUIRE_THROWS_AS(Transposed::load(path), std::runtime_error);
+		std::filesystem::remove(path);
+	}
+}
+
+TEST_CASE("Test Serialize -- format versions", "[serialize]") {
+	std::string path = tempPath("librapid-test-serialize-versions.lrpd");
+	lrc::Array<float> array(lrc::Array<float>::ShapeType {100});
+	lrc::fillRandom(array, 0.0f, 1.0f, 2);
+	array.save(path);
+
+	std::vector<char> bytes(std::filesystem::file_size(path));
+	{
+		std::ifstream in(path, std::ios::binary);
+		in.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+	}
+
+	// The current version pads the 32-byte header of a 1D array so the data starts at byte 64
+	REQUIRE(bytes[4] == lrc::detail::serialize::version);
+	REQUIRE(lrc::detail::serialize::version == 2);
+	REQUIRE(bytes.size() == 64 + 400);
+
+	// Version 1 files have no padding, and are still read correctly
+	std::vector<char> oldBytes(bytes.begin(), bytes.begin() + 32);
+	oldBytes.insert(oldBytes.end(), bytes.begin() + 64, bytes.end());
+	oldBytes[4] = 1;
+	{
+		std::ofstream out(path, std::ios::binary);
+		out.write(oldBytes.data(), static_cast<std::streamsize>(oldBytes.size()));
+	}
+
+	auto loaded = lrc::Array<float>::load(path);
+	REQUIRE(loaded.shape() == array.shape());
+	for (size_t i = 0; i < 100; ++i) { REQUIRE(loaded.storage()[i] == array.storage()[i]); }
+
+	{
+		auto mapped = lrc::mapArray<float>(path);
+		for (size_t i = 0; i < 100; ++i) { REQUIRE(mapped.storage()[i] == array.storage()[i]); }
+	}
+
+	// Files from a newer version are rejected
+	bytes[4] = 3;
+	{
+		std::ofstream out(path, std::ios::binary);
+		out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+	}
+	REQUIRE_THROWS_AS(lrc::Array<float>::load(path), std::runtime_error);
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Test Serialize -- corrupt headers", "[serialize]") {
+	std::string path = tempPath("librapid-test-serialize-corrupt.lrpd");
+	lrc::Array<float> array(lrc::Array<float>::ShapeType {10, 10});
+	lrc::fillRandom(array, 0.0f, 1.0f, 3);
+	array.save(path);
+
+	std::vector<char> original(std::filesystem::file_size(path));
+	{
+		std::ifstream in(path, std::ios::binary);
+		in.read(original.data(), static_cast<std::streamsize>(original.size()));
+	}
+
+	// Write the file with its two dimensions (at bytes 16 and 24) and data size (at byte 32)
+	// replaced. None of these files may cause a large allocation.
+	const auto writeHeader = [&](uint64_t rows, uint64_t cols, uint64_t bytes) {
+		std::vector<char> corrupt = original;
+		const uint64_t values[]	  = {rows, cols, bytes};
+		for (size_t field = 0; field < 3; ++field) {
+			for (size_t i = 0; i < 8; ++i) {
+				corrupt[16 + field * 8 + i] = static_cast<char>(values[field] >> (i * 8));
+			}
+		}
+		std::ofstream out(path, std::ios::binary);
+		out.write(corrupt.data(), static_cast<std::streamsize>(corrupt.size()));
+	};
+
+	// The product of the dimensions overflows
+	writeHeader(uint64_t(1) << 40, uint64_t(1) << 40, 400);
+	REQUIRE_THROWS_AS(lrc::Array<float>::load(path), std::runtime_error);
+
+	// The dimensions do not match the size of the data
+	writeHeader(20, 10, 400);
+	REQUIRE_THROWS_AS(lrc::Array<float>::load(path), std::runtime_error);
+
+	// The dimensions match the size of the data, but the file is too short to hold it
+	writeHeader(uint64_t(1) << 30, 10, (uint64_t(1) << 30) * 40);
+	REQUIRE_THROWS_AS(lrc::Array<float>::load(path), std::runtime_error);
+	REQUIRE_THROWS_AS(lrc::mapArray<float>(path), std::runtime_error);
+
+	// The original header is still accepted
+	writeHeader(10, 10, 400);
+	REQUIRE(lrc::Array<float>::load(path).shape() == array.shape());
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Test Serialize -- errors and byte order", "[serialize]") {
+	std::string path = tempPath("librapid-test-serialize-errors.lrpd");
+	lrc::Array<float> array(lrc::Array<float>::ShapeType {100});
+	lrc::fillRandom(array, 0.0f, 1.0f, 1);
+	array.save(path);
+
+	REQUIRE_THROWS_AS(lrc::Array<double>::load(path), std::runtime_error);
+	REQUIRE_THROWS_AS(lrc::Array<float>::load(tempPath("librapid-missing.lrpd")),
+					  std::runtime_error);
+
+	// Truncated data
+	std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+	REQUIRE_THROWS_AS(lrc::Array<float>::load(path), std::runtime_error);
+
+	// Data written on a machine with the opposite byte order is converted
+	{
+		std::vector<char> bytes(std::filesystem::file_size(path) + 4);
+		std::ifstream in(path, std::ios::binary);
+		in.read(bytes.data(), static_cast<std::streamsize>(bytes.size() - 4));
+		in.close();
+
+		bytes[6] = lrc::detail::serialize::hostIsLittleEndian() ? 1 : 0;
+		const size_t dataOffset = bytes.size() - 400;
+		for (size_t i = 0; i < 100; ++i) {
+			float value = array.storage()[i];
+			std::memcpy(bytes.data() + dataOffset + i * 4, &value, 4);
+			std::reverse(bytes.data() + dataOffset + i * 4, bytes.data() + dataOffset + i * 4 + 4);
+		}
+
+		std::ofstream out(path, std::ios::binary);
+		out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+	}
+
+	auto swapped = lrc::Array<float>::load(path);
+	for (size_t i = 0; i < 100; ++i) { REQUIRE(swapped.storage()[i] == array.storage()[i]); }
+	std::filesystem::remove(path);
+
+	BENCHMARK("Save and load 64MB") {
+		std::string benchPath = tempPath("librapid-bench-serialize.lrpd");
+		lrc::Array<double> large(lrc::Array<double>::ShapeType {1 << 23});
+		large.save(benchPath);
+		auto res = lrc::Array<double>::load(benchPath);
+		std::filesystem::remove(benchPath);
+		return res.storage().size();
+	};
+}
@@ -40,6 +40,35 @@ TEST_CASE("Test Storage<T>", "[storage]") {
 	REQUIRE(lrc::shapesMatch(
 	  lrc::Shape({1, 2, 3, 4}), lrc::Shape({1, 2, 3, 4}), lrc::Shape({1, 2, 3, 4})));
 
+	SECTION("Cached size") {
+		lrc::Shape<size_t> empty;
+		REQUIRE(empty.ndim() == 0);
+		REQUIRE(empty.size() == 1);
+		REQUIRE(lrc::Shape<size_t>::zeros(0).size() == 1);
+
+		// Writing through operator[] must not leave a stale size behind
+		lrc::Shape shape({2, 3});
+		shape[1] = 5;
+		REQUIRE(shape.size() == 10);
+		lrc::Shape copy = shape;
+		REQUIRE(copy.size() == 10);
+		copy[0] = 0;
+		REQUIRE(copy.size() == 0);
+		copy = shape;
+		REQUIRE(copy.size() == 10);
+
+		REQUIRE(shape.subshape(1, 2).size() == 5);
+		REQUIRE(lrc::Shape<size_t, 3>(shape).size() == 10);
+		REQUIRE(lrc::Shape(lrc::FixedStorage<float, 2, 3, 4>()) == lrc::Shape({2, 3, 4}));
+		REQUIRE(lrc::Shape(lrc::FixedStorage<float, 2, 3, 4>()).size() == 24);
+
+		lrc::Stride stride(lrc::Shape({2, 3, 4}));
+		REQUIRE(stride == lrc::Shape({12, 4, 1}));
+		REQUIRE(stride.subshape(1, 3) == lrc::Shape({4, 1}));
+
+		REQUIRE(lrc::Array<float>::ShapeType::MaxDimensions == LIBRAPID_MAX_ARRAY_DIMS);
+	}
+
 	SECTION("Benchmarks") {
 		BENCHMARK("Shape::zeros(5)") {
 			auto shape = lrc::Shape<size_t, 32>::zeros(5);
@@ -54,5 +83,20 @@ TEST_CASE("Test Storage<T>", "[storage]") {
 		auto lhs = lrc::Shape<size_t, 128>::ones(128);
 		auto rhs = lrc::Shape<size_t, 128>::ones(128);
 		BENCHMARK("Equality") { return lhs == rhs; };
+
+		lrc::Array<float> matrix(lrc::Shape({64, 64}));
+		BENCHMARK("Construct a 3x3 Array") {
+			lrc::Array<float> array(lrc::Shape({3, 3}));
+			return array.shape().size();
+		};
+
+		BENCHMARK("Copy the Shape of an Array") {
+			auto shape = matrix.shape();
+			return shape.size();
+		};
+
+		BENCHMARK("Create an ArrayView of a row of a 64x64 Array") {
+			return lrc::array::ArrayView(matrix)[5].shape().size();
+		};
 	}
 }
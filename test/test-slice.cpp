@@ -0,0 +1,128 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+template<typename Scalar>
+static lrc::Array<Scalar> iotaArray(const typename lrc::Array<Scalar>::ShapeType &shape) {
+	lrc::Array<Scalar> array(shape);
+	for (size_t i = 0; i < shape.size(); ++i) array.storage()[i] = static_cast<Scalar>(i);
+	return array;
+}
+
+template<typename View>
+static std::vector<double> values(const View &view) {
+	auto array = view.eval();
+	return {array.storage().begin(), array.storage().begin() + array.shape().size()};
+}
+
+TEST_CASE("Test slicing", "[slice]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+
+	SECTION("Slices") {
+		auto array = iotaArray<double>(ShapeType {4, 5});
+
+		auto all = array.slice();
+		REQUIRE(all.shape() == ShapeType {4, 5});
+		REQUIRE(values(all) == values(lrc::array::ArrayView(array)));
+
+		auto block = array.slice(lrc::Slice(1, 3), lrc::Slice(1, 5, 2));
+		REQUIRE(block.shape() == ShapeType {2, 2});
+		REQUIRE(block.offset() == 6);
+		REQUIRE(values(block) == std::vector<double> {6, 8, 11, 13});
+
+		auto row = array.slice(2);
+		REQUIRE(row.shape() == ShapeType {5});
+		REQUIRE(values(row) == std::vector<double> {10, 11, 12, 13, 14});
+
+		auto column = array.slice(lrc::Slice(), -2);
+		REQUIRE(column.shape() == ShapeType {4});
+		REQUIRE(values(column) == std::vector<double> {3, 8, 13, 18});
+
+		auto element = array.slice(3, 4);
+		REQUIRE(element.ndim() == 0);
+		REQUIRE(element.get() == 19);
+
+		// Negative steps, and bounds which are clamped to the array
+		auto reversed = array.slice(lrc::Slice(lrc::Slice::none, lrc::Slice::none, -1), 0);
+		REQUIRE(values(reversed) == std::vector<double> {15, 10, 5, 0});
+		REQUIRE(values(array.slice(0, lrc::Slice(-2, -100, -2))) == std::vector<double> {3, 1});
+		REQUIRE(values(array.slice(0, lrc::Slice(2, 100))) == std::vector<double> {2, 3, 4});
+
+		auto empty = array.slice(lrc::Slice(3, 1), lrc::Slice());
+		REQUIRE(empty.shape() == ShapeType {0, 5});
+		REQUIRE(empty.eval().shape() == ShapeType {0, 5});
+
+		REQUIRE_THROWS_AS(array.slice(4), std::runtime_error);
+		REQUIRE_THROWS_AS(array.slice(-5), std::runtime_error);
+		REQUIRE_THROWS_AS(array.slice(0, 0, 0), std::runtime_error);
+		REQUIRE_THROWS_AS(array.slice(lrc::Slice(0, 4, 0)), std::runtime_error);
+	}
+
+	SECTION("Slices of slices") {
+		auto array = iotaArray<double>(ShapeType {4, 5, 6});
+		auto view =
+		  array.slice(lrc::Slice(1, 4), lrc::Slice(lrc::Slice::none, lrc::Slice::none, -2));
+		REQUIRE(view.shape() == ShapeType {3, 3, 6});
+
+		// Slicing a view is the same as slicing its evaluated copy
+		auto copy = view.eval();
+		for (const auto &inner : {lrc::Slice(), lrc::Slice(1, 3), lrc::Slice(5, 0, -3)}) {
+			REQUIRE(values(view.slice(inner, 1)) == values(copy.slice(inner, 1)));
+			REQUIRE(values(view.slice(2, inner, lrc::Slice(0, 6, 4))) ==
+					values(copy.slice(2, inner, lrc::Slice(0, 6, 4))));
+		}
+
+		// Indexing a strided view follows its strides
+		for (int64_t i = 0; i < 3; ++i) {
+			for (int64_t j = 0; j < 3; ++j) {
+				for (int64_t k = 0; k < 6; ++k) {
+					REQUIRE(view[i][j][k].get() == ((i + 1) * 5 + (4 - 2 * j)) * 6 + k);
+				}
+			}
+		}
+	}
+
+	SECTION("Assignment") {
+		auto array = iotaArray<int64_t>(ShapeType {4, 5});
+		array.slice(lrc::Slice(0, 4, 3), lrc::Slice(1, 3)) = 0;
+		REQUIRE(values(array.slice(0)) == std::vector<double> {0, 0, 0, 3, 4});
+		REQUIRE(values(array.slice(3)) == std::vector<double> {15, 0, 0, 18, 19});
+		REQUIRE(array.storage()[5] == 5);
+
+		lrc::Array<int64_t> block(ShapeType {2, 2});
+		block << 100, 101, //
+		  102, 103;
+		array.slice(lrc::Slice(2, 0, -1), lrc::Slice(3, 5)) = block;
+		REQUIRE(values(array.slice(1)) == std::vector<double> {5, 6, 7, 102, 103});
+		REQUIRE(values(array.slice(2)) == std::vector<double> {10, 11, 12, 100, 101});
+
+		array.slice(lrc::Slice(), 4) = array.slice(lrc::Slice(), 0).eval() * int64_t(2);
+		REQUIRE(values(array.slice(lrc::Slice(), 4)) == std::vector<double> {0, 10, 20, 30});
+
+		REQUIRE_THROWS_AS(array.slice(lrc::Slice(0, 3)) = block, std::runtime_error);
+	}
+}
+
+TEST_CASE("Benchmark slicing", "[slice][benchmark]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+	auto matrix		= iotaArray<double>(ShapeType {1024, 1024});
+
+	BENCHMARK("Slice a 512x512 block from a 1024x1024 matrix") {
+		return matrix.slice(lrc::Slice(256, 768), lrc::Slice(256, 768)).offset();
+	};
+
+	BENCHMARK("Index a 1024x1024 matrix with ArrayView::operator[]") {
+		return lrc::array::ArrayView(matrix)[512].offset();
+	};
+
+	BENCHMARK("Evaluate a 512x512 block of a 1024x1024 matrix") {
+		return matrix.slice(lrc::Slice(256, 768), lrc::Slice(256, 768)).eval().storage()[0];
+	};
+
+	BENCHMARK("Fill a 512x512 block of a 1024x1024 matrix") {
+		matrix.slice(lrc::Slice(256, 768), lrc::Slice(256, 768)) = 1.0;
+		return matrix.storage()[0];
+	};
+}
@@ -0,0 +1,297 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+template<typename Scalar>
+static lrc::Array<Scalar> randomArray(const typename lrc::Array<Scalar>::ShapeType &shape,
+									  int64_t range, uint64_t seed) {
+	std::mt19937_64 generator(seed);
+	lrc::Array<Scalar> array(shape);
+	for (size_t i = 0; i < shape.size(); ++i) {
+		array.storage()[i] = static_cast<Scalar>(static_cast<int64_t>(generator() % range) -
+												 range / 2);
+	}
+	return array;
+}
+
+// Check that every line of \p sorted along \p axis is the sorted line of \p original
+template<typename StorageType>
+static void requireSorted(const lrc::ArrayRef<StorageType> &original,
+						  const lrc::ArrayRef<StorageType> &sorted, int64_t axis) {
+	using Scalar	 = typename StorageType::Scalar;
+	const auto lines = lrc::detail::sort::lines(original.shape(), axis);
+	for (int64_t line = 0; line < lines.count; ++line) {
+		std::vector<Scalar> expected, actual;
+		for (int64_t i = 0; i < lines.extent; ++i) {
+			expected.push_back(original.storage()[lines.start(line) + i * lines.inner]);
+			actual.push_back(sorted.storage()[lines.start(line) + i * lines.inner]);
+		}
+		std::sort(expected.begin(), expected.end());
+		REQUIRE(actual == expected);
+	}
+}
+
+TEST_CASE("Test sort", "[sort]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+
+	SECTION("Sorting networks") {
+		for (size_t size = 0; size <= 40; ++size) {
+			auto doubles = randomArray<double>(ShapeType {size}, 1000, size);
+			auto sorted	 = doubles;
+			lrc::sort(sorted);
+			requireSorted(doubles, sorted, 0);
+
+			auto bytes		 = randomArray<int8_t>(ShapeType {size}, 256, size);
+			auto sortedBytes = bytes;
+			lrc::sort(sortedBytes);
+			requireSorted(bytes, sortedBytes, 0);
+
+			auto shorts		  = randomArray<uint16_t>(ShapeType {size}, 65536, size);
+			auto sortedShorts = shorts;
+			lrc::sort(sortedShorts);
+			requireSorted(shorts, sortedShorts, 0);
+		}
+	}
+
+	SECTION("Axes") {
+		auto matrix = randomArray<int32_t>(ShapeType {17, 23}, 50, 1);
+		for (int64_t axis : {0, 1, -1, -2}) {
+			auto sorted = matrix;
+			lrc::sort(sorted, axis);
+			requireSorted(matrix, sorted, axis);
+		}
+
+		auto tensor = randomArray<float>(ShapeType {4, 30, 5}, 100, 2);
+		for (int64_t axis : {0, 1, 2}) {
+			auto sorted = tensor;
+			lrc::sort(sorted, axis);
+			requireSorted(tensor, sorted, axis);
+		}
+
+		REQUIRE_THROWS_AS(lrc::sort(matrix, 2), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::sort(matrix, -3), std::runtime_error);
+	}
+
+	SECTION("Infinities") {
+		// Lines which are not a network size are padded, and the padding must not replace
+		// infinite values
+		const double inf = std::numeric_limits<double>::infinity();
+		lrc::Array<double> three(ShapeType {3});
+		three << inf, 1, 2;
+		lrc::sort(three);
+		REQUIRE(three.storage()[0] == 1);
+		REQUIRE(three.storage()[1] == 2);
+		REQUIRE(three.storage()[2] == inf);
+
+		lrc::Array<double> seven(ShapeType {7});
+		seven << inf, -inf, 3, inf, 0, -inf, -2;
+		lrc::sort(seven);
+		const double expected[] = {-inf, -inf, -2, 0, 3, inf, inf};
+		for (size_t i = 0; i < 7; ++i) REQUIRE(seven.storage()[i] == expected[i]);
+
+		const float infF = std::numeric_limits<float>::infinity();
+		for (int64_t size : {1, 5, 11, 13}) {
+			lrc::Array<float> values(ShapeType {size});
+			for (int64_t i = 0; i < size; ++i) {
+				values.storage()[i] = i % 3 == 0 ? infF : i % 3 == 1 ? -infF : float(size - i);
+			}
+			auto sorted = values;
+			lrc::sort(sorted);
+			requireSorted(values, sorted, 0);
+		}
+	}
+
+	SECTION("NaN values are sorted last") {
+		const double nan = std::numeric_limits<double>::quiet_NaN();
+		lrc::Array<double> array(ShapeType {7});
+		array << 3, nan, -1, 2, nan, -5, 0;
+		lrc::sort(array);
+		const double expected[] = {-5, -1, 0, 2, 3};
+		for (size_t i = 0; i < 5; ++i) REQUIRE(array.storage()[i] == expected[i]);
+		REQUIRE(std::isnan(array.storage()[5]));
+		REQUIRE(std::isnan(array.storage()[6]));
+
+		lrc::Array<double> reordered(ShapeType {7});
+		reordered << 3, nan, -1, 2, nan, -5, 0;
+		auto indices = lrc::argsort(reordered);
+		const int64_t expectedIndices[] = {5, 2, 6, 3, 0, 1, 4};
+		for (size_t i = 0; i < 7; ++i) REQUIRE(indices.storage()[i] == expectedIndices[i]);
+	}
+
+	SECTION("Parallel") {
+		const int64_t prevThreads	= lrc::global::numThreads;
+		const int64_t prevThreshold = lrc::global::multithreadThreshold;
+		lrc::global::numThreads			  = 5;
+		lrc::global::multithreadThreshold = 1000;
+
+		// A single line is split between threads; many lines are shared out between them
+		for (const ShapeType &shape : {ShapeType {100003}, ShapeType {2, 40001},
+									   ShapeType {30001, 3}, ShapeType {400, 300}}) {
+			auto array = randomArray<double>(shape, 1 << 20, shape.size());
+			for (int64_t axis = 0; axis < static_cast<int64_t>(shape.ndim()); ++axis) {
+				auto sorted = array;
+				lrc::sort(sorted, axis);
+				requireSorted(array, sorted, axis);
+			}
+		}
+
+		auto withNaN = randomArray<double>(ShapeType {50000}, 1000, 3);
+		for (size_t i = 0; i < 50000; i += 7) {
+			withNaN.storage()[i] = std::numeric_limits<double>::quiet_NaN();
+		}
+		lrc::sort(withNaN);
+		const size_t numbers = 50000 - (50000 + 6) / 7;
+		REQUIRE(std::is_sorted(withNaN.storage().begin(), withNaN.storage().begin() + numbers));
+		for (size_t i = numbers; i < 50000; ++i) REQUIRE(std::isnan(withNaN.storage()[i]));
+
+		lrc::global::numThreads			  = prevThreads;
+		lrc::global::multithreadThreshold = prevThreshold;
+	}
+}
+
+TEST_CASE("Test argsort", "[sort]") {
+	using ShapeType = lrc::Array<int32_t>::ShapeType;
+
+	const int64_t prevThreads	= lrc::global::numThreads;
+	const int64_t prevThreshold = lrc::global::multithreadThreshold;
+
+	SECTION("Serial") { lrc::global::numThreads = 1; }
+
+	SECTION("Parallel") {
+		lrc::global::numThreads			  = 3;
+		lrc::global::multithreadThreshold = 100;
+	}
+
+	for (const ShapeType &shape : {ShapeType {5000}, ShapeType {30, 40}, ShapeType {3, 2000}}) {
+		// Many repeated values, to check that equal values stay in index order
+		auto array = randomArray<int32_t>(shape, 20, shape.size());
+		for (int64_t axis = 0; axis < static_cast<int64_t>(shape.ndim()); ++axis) {
+			auto indices	 = lrc::argsort(array, axis);
+			const auto lines = lrc::detail::sort::lines(shape, axis);
+			REQUIRE(indices.shape() == shape);
+
+			for (int64_t line = 0; line < lines.count; ++line) {
+				const int64_t start = lines.start(line);
+				std::vector<bool> seen(lines.extent, false);
+				for (int64_t i = 0; i < lines.extent; ++i) {
+					const int64_t index = indices.storage()[start + i * lines.inner];
+					REQUIRE(!seen[index]);
+					seen[index] = true;
+					if (i == 0) continue;
+
+					const int64_t prev = indices.storage()[start + (i - 1) * lines.inner];
+					const int32_t a	   = array.storage()[start + prev * lines.inner];
+					const int32_t b	   = array.storage()[start + index * lines.inner];
+					REQUIRE((a < b || (a == b && prev < index)));
+				}
+			}
+		}
+	}
+
+	lrc::global::numThreads			  = prevThreads;
+	lrc::global::multithreadThreshold = prevThreshold;
+}
+
+TEST_CASE("Test selection", "[sort]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+
+	SECTION("nthElement") {
+		auto array = randomArray<double>(ShapeType {20, 31}, 1000, 4);
+		for (int64_t axis : {0, 1}) {
+			const auto lines = lrc::detail::sort::lines(array.shape(), axis);
+			for (int64_t n : {int64_t(0), lines.extent / 2, lines.extent - 1}) {
+				auto selected = array;
+				auto sorted	  = array;
+				lrc::nthElement(selected, n, axis);
+				lrc::sort(sorted, axis);
+				requireSorted(array, sorted, axis);
+
+				for (int64_t line = 0; line < lines.count; ++line) {
+					const double *start = selected.storage().begin() + lines.start(line);
+					const double nth	= start[n * lines.inner];
+					REQUIRE(nth == sorted.storage()[lines.start(line) + n * lines.inner]);
+					for (int64_t i = 0; i < lines.extent; ++i) {
+						if (i < n) REQUIRE(start[i * lines.inner] <= nth);
+						if (i > n) REQUIRE(start[i * lines.inner] >= nth);
+					}
+				}
+			}
+		}
+
+		REQUIRE_THROWS_AS(lrc::nthElement(array, 31), std::runtime_error);
+		REQUIRE_THROWS_AS(lrc::nthElement(array, -1), std::runtime_error);
+	}
+
+	SECTION("topk") {
+		const double nan = std::numeric_limits<double>::quiet_NaN();
+		lrc::Array<double> array(ShapeType {2, 6});
+		array << 4, 1, 4, nan, 9, -2, //
+		  0, 0, 3, 0, -7, 5;
+
+		auto [largest, largestIndices] = lrc::topk(array, 3);
+		REQUIRE(largest.shape() == ShapeType {2, 3});
+		REQUIRE(std::isnan(largest.storage()[0]));
+		REQUIRE(largest.storage()[1] == 9);
+		REQUIRE(largest.storage()[2] == 4);
+		REQUIRE(largest.storage()[3] == 5);
+		REQUIRE(largest.storage()[4] == 3);
+		REQUIRE(largest.storage()[5] == 0);
+		const int64_t expectedLargest[] = {3, 4, 0, 5, 2, 0};
+		for (size_t i = 0; i < 6; ++i) REQUIRE(largestIndices.storage()[i] == expectedLargest[i]);
+
+		auto [smallest, smallestIndices] = lrc::topk(array, 2, 1, false);
+		const double expectedValues[]	 = {-2, 1, -7, 0};
+		const int64_t expectedSmallest[] = {5, 1, 4, 0};
+		for (size_t i = 0; i < 4; ++i) {
+			REQUIRE(smallest.storage()[i] == expectedValues[i]);
+			REQUIRE(smallestIndices.storage()[i] == expectedSmallest[i]);
+		}
+
+		auto [columns, columnIndices] = lrc::topk(array, 1, 0);
+		REQUIRE(columns.shape() == ShapeType {1, 6});
+		const int64_t expectedColumns[] = {0, 0, 0, 0, 0, 1};
+		for (size_t i = 0; i < 6; ++i) REQUIRE(columnIndices.storage()[i] == expectedColumns[i]);
+
+		REQUIRE(lrc::topk(array, 0).first.shape() == ShapeType {2, 0});
+		REQUIRE_THROWS_AS(lrc::topk(array, 7), std::runtime_error);
+	}
+}
+
+TEST_CASE("Benchmark sort", "[sort][benchmark]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+	auto vector		= randomArray<double>(ShapeType {1 << 20}, 1 << 30, 5);
+	auto rows		= randomArray<double>(ShapeType {1 << 17, 8}, 1 << 30, 6);
+
+	// Every run sorts a fresh copy of the data, since sorted data is faster to sort again
+	BENCHMARK("copy + sort 1M doubles") {
+		auto array = vector;
+		lrc::sort(array);
+		return array.storage()[0];
+	};
+
+	BENCHMARK("copy + std::sort 1M doubles") {
+		std::vector<double> copy(vector.storage().begin(), vector.storage().end());
+		std::sort(copy.begin(), copy.end());
+		return copy[0];
+	};
+
+	BENCHMARK("copy + sort 131072x8 doubles along the last axis") {
+		auto array = rows;
+		lrc::sort(array, 1);
+		return array.storage()[0];
+	};
+
+	BENCHMARK("copy + std::sort each row of 131072x8 doubles") {
+		auto array = rows;
+		for (size_t row = 0; row < (1 << 17); ++row) {
+			std::sort(array.storage().begin() + row * 8, array.storage().begin() + row * 8 + 8);
+		}
+		return array.storage()[0];
+	};
+
+	BENCHMARK("argsort 1M doubles") { return lrc::argsort(vector).storage()[0]; };
+
+	BENCHMARK("topk 10 of 1M doubles") { return lrc::topk(vector, 10).first.storage()[0]; };
+}
@@ -0,0 +1,323 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+using Sparse	= lrc::SparseArray<double>;
+using Dense		= lrc::Array<double>;
+using ShapeType = Dense::ShapeType;
+
+// A random array where about one element in \p every is nonzero
+static Dense randomDense(const ShapeType &shape, size_t every, uint64_t seed) {
+	std::mt19937_64 generator(seed);
+	std::uniform_real_distribution<double> distribution(-10, 10);
+	Dense dense(shape, 0);
+	for (size_t i = 0; i < shape.size(); ++i) {
+		if (generator() % every == 0) dense.storage()[i] = distribution(generator);
+	}
+	return dense;
+}
+
+// The product of two row-major dense matrices (or a matrix and a vector)
+static Dense denseDot(const Dense &a, const Dense &b) {
+	const size_t rows  = a.shape()[0];
+	const size_t inner = a.shape()[1];
+	const size_t cols  = b.ndim() == 1 ? 1 : b.shape()[1];
+	Dense result(b.ndim() == 1 ? ShapeType {rows} : ShapeType {rows, cols}, 0);
+	for (size_t i = 0; i < rows; ++i) {
+		for (size_t k = 0; k < inner; ++k) {
+			for (size_t j = 0; j < cols; ++j) {
+				result.storage()[i * cols + j] +=
+				  a.storage()[i * inner + k] * b.storage()[k * cols + j];
+			}
+		}
+	}
+	return result;
+}
+
+// A matrix whose row lengths follow a power law, so a few rows hold a large share of the
+// elements. Repeated coordinates are summed, so rows may be slightly shorter than drawn
+static Sparse powerLaw(size_t rows, size_t cols, double exponent, uint64_t seed) {
+	std::mt19937_64 generator(seed);
+	std::uniform_real_distribution<double> distribution(0, 1);
+	std::vector<int32_t> rowIndices, colIndices;
+	std::vector<double> values;
+	for (size_t i = 0; i < rows; ++i) {
+		const double length = std::pow(1 - distribution(generator), -1 / exponent) - 1;
+		for (size_t j = 0; j < std::min(cols, static_cast<size_t>(length)); ++j) {
+			rowIndices.push_back(static_cast<int32_t>(i));
+			colIndices.push_back(static_cast<int32_t>(generator() % cols));
+			values.push_back(distribution(generator) - 0.5);
+		}
+	}
+	return Sparse::fromTriplets(rows, cols, rowIndices, colIndices, values);
+}
+
+// A square matrix whose elements are within \p halfWidth of the diagonal
+static Sparse banded(size_t size, int32_t halfWidth) {
+	std::vector<int32_t> rowIndices, colIndices;
+	std::vector<double> values;
+	for (int32_t i = 0; i < static_cast<int32_t>(size); ++i) {
+		for (int32_t j = std::max(0, i - halfWidth);
+			 j <= std::min(static_cast<int32_t>(size) - 1, i + halfWidth);
+			 ++j) {
+			rowIndices.push_back(i);
+			colIndices.push_back(j);
+			values.push_back(1.0 / (1 + std::abs(i - j)));
+		}
+	}
+	return Sparse::fromTriplets(size, size, rowIndices, colIndices, values);
+}
+
+static void requireClose(const Dense &a, const Dense &b) {
+	REQUIRE(a.shape() == b.shape());
+	for (size_t i = 0; i < a.storage().size(); ++i) {
+		REQUIRE(std::abs(a.storage()[i] - b.storage()[i]) < 1e-9);
+	}
+}
+
+TEST_CASE("Test SparseArray -- construction", "[sparseArray]") {
+	SECTION("Triplets") {
+		// [[0 1 0 2]
+		//  [0 0 0 0]
+		//  [3 0 4 5]]
+		auto csr = Sparse::fromTriplets(
+		  3, 4, {2, 0, 2, 0, 2, 2}, {3, 3, 0, 1, 2, 0}, {5, 2, 1, 1, 4, 2});
+		REQUIRE(csr.shape() == ShapeType {3, 4});
+		REQUIRE(csr.nnz() == 5);
+		REQUIRE(csr.layout() == lrc::SparseLayout::CSR);
+
+		const int32_t offsets[] = {0, 2, 2, 5};
+		const int32_t indices[] = {1, 3, 0, 2, 3};
+		const double values[]	= {1, 2, 3, 4, 5};
+		for (size_t i = 0; i < 4; ++i) REQUIRE(csr.offsets()[i] == offsets[i]);
+		for (size_t i = 0; i < 5; ++i) {
+			REQUIRE(csr.indices()[i] == indices[i]);
+			REQUIRE(csr.values()[i] == values[i]);
+		}
+
+		REQUIRE(csr.get(0, 3) == 2);
+		REQUIRE(csr.get(2, 0) == 3);
+		REQUIRE(csr.get(1, 1) == 0);
+		REQUIRE(csr.get(0, 0) == 0);
+
+		auto csc = Sparse::fromTriplets(
+		  3, 4, {2, 0, 2, 0, 2, 2}, {3, 3, 0, 1, 2, 0}, {5, 2, 1, 1, 4, 2}, lrc::SparseLayout::CSC);
+		const int32_t cscOffsets[] = {0, 1, 2, 3, 5};
+		const int32_t cscIndices[] = {2, 0, 2, 0, 2};
+		const double cscValues[]   = {3, 1, 4, 2, 5};
+		for (size_t i = 0; i < 5; ++i) {
+			REQUIRE(csc.offsets()[i] == cscOffsets[i]);
+			REQUIRE(csc.indices()[i] == cscIndices[i]);
+			REQUIRE(csc.values()[i] == cscValues[i]);
+		}
+		REQUIRE(csc.get(2, 3) == 5);
+		REQUIRE(csc.get(1, 3) == 0);
+
+		REQUIRE_THROWS_AS(Sparse::fromTriplets(2, 2, {0, 1}, {0}, {1, 2}), std::runtime_error);
+		REQUIRE_THROWS_AS(Sparse::fromTriplets(2, 2, {0, 2}, {0, 0}, {1, 2}), std::runtime_error);
+		REQUIRE_THROWS_AS(Sparse::fromTriplets(2, 2, {0, 1}, {-1, 0}, {1, 2}), std::runtime_error);
+	}
+
+	SECTION("Empty matrices") {
+		Sparse empty(5, 3);
+		REQUIRE(empty.nnz() == 0);
+		REQUIRE(empty.offsets().size() == 6);
+		requireClose(empty.toDense(), Dense(ShapeType {5, 3}, 0));
+		requireClose(empty.dot(Dense(ShapeType {3}, 1)), Dense(ShapeType {5}, 0));
+	}
+
+	SECTION("Dense conversion") {
+		Dense dense = randomDense({37, 23}, 5, 1);
+		for (auto layout : {lrc::SparseLayout::CSR, lrc::SparseLayout::CSC}) {
+			auto sparse = Sparse::fromDense(dense, layout);
+			REQUIRE(sparse.layout() == layout);
+			requireClose(sparse.toDense(), dense);
+			for (size_t i = 0; i < 37; ++i) {
+				for (size_t j = 0; j < 23; ++j) {
+					REQUIRE(sparse.get(i, j) == dense.storage()[i * 23 + j]);
+				}
+			}
+		}
+
+		auto csr = Sparse::fromDense(dense);
+		auto csc = csr.toLayout(lrc::SparseLayout::CSC);
+		auto ref = Sparse::fromDense(dense, lrc::SparseLayout::CSC);
+		REQUIRE(csc.nnz() == ref.nnz());
+		for (size_t i = 0; i < ref.nnz(); ++i) {
+			REQUIRE(csc.indices()[i] == ref.indices()[i]);
+			REQUIRE(csc.values()[i] == ref.values()[i]);
+		}
+		requireClose(csc.toLayout(lrc::SparseLayout::CSR).toDense(), dense);
+
+		REQUIRE_THROWS_AS(Sparse::fromDense(Dense(ShapeType {4})), std::runtime_error);
+	}
+}
+
+TEST_CASE("Test SparseArray -- products", "[sparseArray]") {
+	Dense dense	 = randomDense({301, 157}, 7, 2);
+	Dense vector = randomDense({157}, 1, 3);
+	Dense matrix = randomDense({157, 5}, 1, 4);
+
+	const int64_t prevThreads	= lrc::global::numThreads;
+	const int64_t prevThreshold = lrc::global::multithreadThreshold;
+
+	SECTION("Serial") {
+		lrc::global::numThreads = 1;
+	}
+
+	SECTION("Parallel") {
+		lrc::global::numThreads			  = 4;
+		lrc::global::multithreadThreshold = 0;
+	}
+
+	for (auto layout : {lrc::SparseLayout::CSR, lrc::SparseLayout::CSC}) {
+		auto sparse = Sparse::fromDense(dense, layout);
+		requireClose(sparse.dot(vector), denseDot(dense, vector));
+		requireClose(sparse.dot(matrix), denseDot(dense, matrix));
+
+		// y = 2 * A * x - y
+		Dense y		   = randomDense({301}, 1, 5);
+		Dense expected = denseDot(dense, vector);
+		for (size_t i = 0; i < 301; ++i) {
+			expected.storage()[i] = 2 * expected.storage()[i] - y.storage()[i];
+		}
+		sparse.dot(vector, y, 2, -1);
+		requireClose(y, expected);
+
+		Dense wrong(ShapeType {156});
+		REQUIRE_THROWS_AS(sparse.dot(wrong), std::runtime_error);
+		Dense result(ShapeType {301, 4});
+		REQUIRE_THROWS_AS(sparse.dot(matrix, result), std::runtime_error);
+	}
+
+	lrc::global::numThreads			  = prevThreads;
+	lrc::global::multithreadThreshold = prevThreshold;
+}
+
+TEST_CASE("Test SparseArray -- load balancing", "[sparseArray]") {
+	SECTION("Merge path partition") {
+		// Rows of lengths 0, 10, 0, 0, 1 and 5
+		const int32_t offsets[] = {0, 0, 10, 10, 10, 11, 16};
+		for (int64_t parts : {1, 2, 3, 7, 22, 40}) {
+			const auto partition = lrc::detail::sparse::partition(offsets, 6, parts);
+			REQUIRE(partition.size() == static_cast<size_t>(parts + 1));
+			REQUIRE(partition.front().row == 0);
+			REQUIRE(partition.front().element == 0);
+			REQUIRE(partition.back().row == 6);
+			REQUIRE(partition.back().element == 16);
+
+			for (int64_t part = 0; part < parts; ++part) {
+				const auto begin = partition[part];
+				const auto end	 = partition[part + 1];
+				REQUIRE(begin.row <= end.row);
+				REQUIRE(begin.element <= end.element);
+
+				// Every part covers an equal share of the 22 rows and elements
+				const int64_t length = (end.row + end.element) - (begin.row + begin.element);
+				REQUIRE(length == 22 * (part + 1) / parts - 22 * part / parts);
+
+				// Every point is on the path: the element is within the row being processed
+				REQUIRE(end.element >= offsets[end.row]);
+				if (end.row < 6) REQUIRE(end.element <= offsets[end.row + 1]);
+			}
+		}
+	}
+
+	SECTION("Products with shared rows") {
+		const int64_t prevThreads	= lrc::global::numThreads;
+		const int64_t prevThreshold = lrc::global::multithreadThreshold;
+		lrc::global::multithreadThreshold = 0;
+
+		// One row holds most of the elements, so it is split between every thread
+		std::vector<int32_t> rows, cols;
+		std::vector<double> values;
+		for (int32_t j = 0; j < 500; ++j) {
+			rows.push_back(3);
+			cols.push_back(j);
+			values.push_back(j % 3 - 1);
+		}
+		rows.push_back(0);
+		cols.push_back(1);
+		values.push_back(2);
+		auto skewed = Sparse::fromTriplets(10, 500, rows, cols, values);
+		auto random = powerLaw(2000, 500, 1.2, 7);
+
+		for (int64_t threads : {1, 2, 3, 8, 13}) {
+			lrc::global::numThreads = threads;
+			for (const Sparse *sparse : {&skewed, &random}) {
+				Dense dense = sparse->toDense();
+				Dense x		= randomDense({sparse->cols()}, 1, threads);
+				requireClose(sparse->dot(x), denseDot(dense, x));
+
+				Dense y		   = randomDense({sparse->rows()}, 1, threads + 1);
+				Dense expected = denseDot(dense, x);
+				for (size_t i = 0; i < sparse->rows(); ++i) {
+					expected.storage()[i] = 0.5 * expected.storage()[i] + 3 * y.storage()[i];
+				}
+				sparse->dot(x, y, 0.5, 3);
+				requireClose(y, expected);
+			}
+		}
+
+		lrc::global::numThreads			  = prevThreads;
+		lrc::global::multithreadThreshold = prevThreshold;
+	}
+}
+
+TEST_CASE("Benchmark SparseArray", "[sparseArray][benchmark]") {
+	// A 100000x100000 matrix with 10 elements per row
+	const size_t size = 100000;
+	std::mt19937_64 generator(6);
+	std::vector<int32_t> rows, cols;
+	std::vector<double> values;
+	for (size_t i = 0; i < size * 10; ++i) {
+		rows.push_back(static_cast<int32_t>(i / 10));
+		cols.push_back(static_cast<int32_t>(generator() % size));
+		values.push_back(1.0);
+	}
+
+	BENCHMARK("fromTriplets 100000x100000, 1M elements") {
+		return Sparse::fromTriplets(size, size, rows, cols, values).nnz();
+	};
+
+	const int64_t prevThreads = lrc::global::numThreads;
+	const std::pair<std::string, Sparse> matrices[] = {
+	  {"uniform", Sparse::fromTriplets(size, size, rows, cols, values)},
+	  {"power-law", powerLaw(size, size, 1.1, 8)},
+	  {"banded", banded(size, 8)}};
+
+	for (const auto &[name, sparse] : matrices) {
+		Dense x(ShapeType {size}, 1);
+		Dense y(ShapeType {size});
+		const std::string description =
+		  fmt::format("{} 100000x100000, {} elements", name, sparse.nnz());
+
+		lrc::global::numThreads = 1;
+		BENCHMARK("SpMV " + description + " (1 thread)") {
+			sparse.dot(x, y);
+			return y.storage()[0];
+		};
+
+		lrc::global::numThreads = prevThreads;
+		BENCHMARK(fmt::format("SpMV {} ({} threads)", description, prevThreads)) {
+			sparse.dot(x, y);
+			return y.storage()[0];
+		};
+
+		BENCHMARK("cxxblas::gecrsmv " + description) {
+			cxxblas::gecrsmv(cxxblas::NoTrans,
+							 static_cast<int32_t>(size),
+							 static_cast<int32_t>(size),
+							 1.0,
+							 sparse.values().begin(),
+							 sparse.offsets().begin(),
+							 sparse.indices().begin(),
+							 x.storage().begin(),
+							 0.0,
+							 y.storage().begin());
+			return y.storage()[0];
+		};
+	}
+}
@@ -0,0 +1,209 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+template<typename Scalar, int64_t Dims>
+static std::vector<lrc::Vec<Scalar, Dims>> randomVectors(int64_t count, uint64_t seed) {
+	std::mt19937_64 generator(seed);
+	std::uniform_int_distribution<int> distribution(-100, 100);
+	std::vector<lrc::Vec<Scalar, Dims>> res(count);
+	for (auto &vector : res) {
+		for (int64_t d = 0; d < Dims; ++d) vector[d] = static_cast<Scalar>(distribution(generator));
+		if (vector.mag2() == 0) vector[0] = 1; // Zero vectors cannot be normalized
+	}
+	return res;
+}
+
+template<typename Scalar>
+static bool isClose(Scalar lhs, Scalar rhs) {
+	if constexpr (std::is_floating_point_v<Scalar>) {
+		const Scalar tolerance = std::is_same_v<Scalar, float> ? Scalar(1e-4) : Scalar(1e-10);
+		return std::abs(lhs - rhs) <= tolerance * std::max(Scalar(1), std::abs(rhs));
+	} else {
+		return lhs == rhs;
+	}
+}
+
+template<typename Scalar, int64_t Dims>
+static bool isClose(const lrc::Vec<Scalar, Dims> &lhs, const lrc::Vec<Scalar, Dims> &rhs) {
+	for (int64_t d = 0; d < Dims; ++d) {
+		if (!isClose(lhs[d], rhs[d])) return false;
+	}
+	return true;
+}
+
+template<typename Scalar, int64_t Dims>
+static bool isClose(const std::vector<lrc::Vec<Scalar, Dims>> &lhs,
+					const std::vector<lrc::Vec<Scalar, Dims>> &rhs) {
+	if (lhs.size() != rhs.size()) return false;
+	for (size_t i = 0; i < lhs.size(); ++i) {
+		if (!isClose(lhs[i], rhs[i])) return false;
+	}
+	return true;
+}
+
+// GenericVector::operator== compares element-wise, so compare every component explicitly
+template<typename Scalar, int64_t Dims>
+static bool isEqual(const lrc::Vec<Scalar, Dims> &lhs, const lrc::Vec<Scalar, Dims> &rhs) {
+	for (int64_t d = 0; d < Dims; ++d) {
+		if (lhs[d] != rhs[d]) return false;
+	}
+	return true;
+}
+
+template<typename Scalar, int64_t Dims>
+static void testVecArray(int64_t count) {
+	using VecArray = lrc::VecArray<Scalar, Dims>;
+	const auto lhsVectors = randomVectors<Scalar, Dims>(count, 1234 + count);
+	const auto rhsVectors = randomVectors<Scalar, Dims>(count, 5678 + count);
+
+	VecArray lhs(lhsVectors);
+	VecArray rhs(rhsVectors);
+	REQUIRE(lhs.size() == count);
+	const auto converted = static_cast<std::vector<lrc::Vec<Scalar, Dims>>>(lhs);
+	REQUIRE(converted.size() == lhsVectors.size());
+
+	for (int64_t i = 0; i < count; ++i) {
+		REQUIRE(isEqual(lhs[i], lhsVectors[i]));
+		REQUIRE(isEqual(converted[i], lhsVectors[i]));
+		for (int64_t d = 0; d < Dims; ++d) REQUIRE(lhs.component(d)[i] == lhsVectors[i][d]);
+	}
+
+	const auto dot	= lhs.dot(rhs);
+	const auto mag2 = lhs.mag2();
+	REQUIRE(static_cast<int64_t>(dot.size()) == count);
+	for (int64_t i = 0; i < count; ++i) {
+		REQUIRE(isClose(dot[i], lhsVectors[i].dot(rhsVectors[i])));
+		REQUIRE(isClose(mag2[i], lhsVectors[i].mag2()));
+	}
+
+	if constexpr (Dims == 3) {
+		const auto cross = lhs.cross(rhs);
+		for (int64_t i = 0; i < count; ++i) {
+			REQUIRE(isEqual(cross[i], lhsVectors[i].cross(rhsVectors[i])));
+		}
+	}
+
+	if constexpr (std::is_floating_point_v<Scalar>) {
+		const auto mag	= lhs.mag();
+		const auto norm = lhs.norm();
+		const auto proj = lhs.proj(rhs);
+		for (int64_t i = 0; i < count; ++i) {
+			REQUIRE(isClose(mag[i], lhsVectors[i].mag()));
+			REQUIRE(isClose(norm[i], lhsVectors[i].norm()));
+			REQUIRE(isClose(proj[i], lhsVectors[i].proj(rhsVectors[i])));
+		}
+	}
+
+	// Results written into existing containers, including the operands themselves
+	if constexpr (std::is_floating_point_v<Scalar>) {
+		VecArray inPlace(lhs);
+		inPlace.proj(rhs, inPlace);
+		REQUIRE(isClose(inPlace.toVector(), lhs.proj(rhs).toVector()));
+
+		inPlace = rhs;
+		lhs.proj(inPlace, inPlace);
+		REQUIRE(isClose(inPlace.toVector(), lhs.proj(rhs).toVector()));
+
+		inPlace = lhs;
+		inPlace.norm(inPlace);
+		REQUIRE(isClose(inPlace.toVector(), lhs.norm().toVector()));
+	}
+
+	std::vector<Scalar> result(3);
+	lhs.dot(rhs, result);
+	REQUIRE(result == dot);
+
+	REQUIRE_THROWS_AS(lhs.dot(VecArray(count + 1)), std::runtime_error);
+}
+
+TEST_CASE("Test VecArray", "[vecArray]") {
+	SECTION("Construction") {
+		lrc::VecArray<double, 3> vectors(4);
+		REQUIRE(vectors.size() == 4);
+		REQUIRE(vectors.dims() == 3);
+		REQUIRE(isEqual(vectors[3], lrc::Vec3d(0, 0, 0)));
+
+		vectors.set(2, lrc::Vec3d(1, 2, 3));
+		REQUIRE(isEqual(vectors[2], lrc::Vec3d(1, 2, 3)));
+		REQUIRE(vectors.component(1)[2] == 2);
+
+		vectors.resize(6);
+		REQUIRE(vectors.size() == 6);
+		REQUIRE(isEqual(vectors[2], lrc::Vec3d(1, 2, 3)));
+		REQUIRE(isEqual(vectors[5], lrc::Vec3d(0, 0, 0)));
+
+		REQUIRE(lrc::VecArray<float, 2>().toVector().empty());
+	}
+
+	SECTION("Batch operations") {
+		// Sizes which leave 0, 1 and several vectors after the last whole packet
+		for (int64_t count : {0, 1, 7, 16, 1001}) {
+			testVecArray<float, 3>(count);
+			testVecArray<double, 3>(count);
+			testVecArray<float, 2>(count);
+			testVecArray<double, 4>(count);
+			testVecArray<int32_t, 3>(count);
+		}
+	}
+}
+
+static void benchmarkVecArray(int64_t count) {
+	const auto lhsVectors = randomVectors<double, 3>(count, 1);
+	const auto rhsVectors = randomVectors<double, 3>(count, 2);
+	const lrc::VecArray<double, 3> lhs(lhsVectors);
+	const lrc::VecArray<double, 3> rhs(rhsVectors);
+
+	// The results are written to existing containers, so only the kernels are measured
+	std::vector<double> scalars(count);
+	std::vector<lrc::Vec3d> vectors(count);
+	lrc::VecArray<double, 3> vecArray(count);
+
+	BENCHMARK(fmt::format("{} Vec3d dot products with std::vector<Vec3d>", count)) {
+		for (int64_t i = 0; i < count; ++i) scalars[i] = lhsVectors[i].dot(rhsVectors[i]);
+		return scalars[0];
+	};
+
+	BENCHMARK(fmt::format("{} Vec3d dot products with VecArray", count)) {
+		lhs.dot(rhs, scalars);
+		return scalars[0];
+	};
+
+	BENCHMARK(fmt::format("{} Vec3d cross products with std::vector<Vec3d>", count)) {
+		for (int64_t i = 0; i < count; ++i) vectors[i] = lhsVectors[i].cross(rhsVectors[i]);
+		return vectors[0];
+	};
+
+	BENCHMARK(fmt::format("{} Vec3d cross products with VecArray", count)) {
+		lhs.cross(rhs, vecArray);
+		return vecArray.component(0)[0];
+	};
+
+	BENCHMARK(fmt::format("Normalize {} Vec3d with std::vector<Vec3d>", count)) {
+		for (int64_t i = 0; i < count; ++i) vectors[i] = lhsVectors[i].norm();
+		return vectors[0];
+	};
+
+	BENCHMARK(fmt::format("Normalize {} Vec3d with VecArray", count)) {
+		lhs.norm(vecArray);
+		return vecArray.component(0)[0];
+	};
+
+	BENCHMARK(fmt::format("Project {} Vec3d with std::vector<Vec3d>", count)) {
+		for (int64_t i = 0; i < count; ++i) vectors[i] = lhsVectors[i].proj(rhsVectors[i]);
+		return vectors[0];
+	};
+
+	BENCHMARK(fmt::format("Project {} Vec3d with VecArray", count)) {
+		lhs.proj(rhs, vecArray);
+		return vecArray.component(0)[0];
+	};
+}
+
+TEST_CASE("Benchmark VecArray", "[vecArray][benchmark]") {
+	// Small enough to stay in cache, and large enough to be limited by memory bandwidth
+	benchmarkVecArray(4096);
+	benchmarkVecArray(1000000);
+}